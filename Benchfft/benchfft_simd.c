@@ -0,0 +1,155 @@
+/**************************************************************************
+File Name  : BENCHFFT_SIMD.C            | Author  : JOHN EDWARDS
+----------------------------------------+----------------------------------
+Compiler :   GCC / Clang                | Start Date    : 17/10/2026
+                                        | Latest Update : 17/10/2026
+---------------------------------------------------------------------------
+
+Description: FFT benchmark for the SigLib DSP library SIMD code paths.
+Compares the library SDA_Rfft, SDA_Cfft and SDA_FftExecute functions
+against a local copy of the scalar radix-2 butterflies, for all power
+of two lengths from 16 to 65536 and reports the execution time per
+transform, the speed-up and the maximum absolute difference between
+the results.
+
+When the library is built with SIGLIB_VECTOR_EXTENSIONS = 0 the
+library functions use the scalar butterflies and the speed-up
+should be 1.0.
+
+Copyright (c) 2026 Delta Numerix All rights reserved.
+
+********************************************** End Of Header Information */
+
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+#define MIN_LOG2_FFT_SIZE 4
+#define MAX_LOG2_FFT_SIZE 16
+#define MAX_FFT_SIZE (1 << MAX_LOG2_FFT_SIZE)
+#define SAMPLES_PER_TIMING 4000000    // Number of samples processed for each timing measurement
+
+static SLData_t pFFTCoeffs[(3 * MAX_FFT_SIZE) / 4];
+static SLData_t pPlanCoeffs[SAI_FftPlanCoeffsLength(MAX_FFT_SIZE)];
+static SLArrayIndex_t pBitReverseTable[MAX_FFT_SIZE];
+static SLData_t pRealSrc[MAX_FFT_SIZE], pImagSrc[MAX_FFT_SIZE];
+static SLData_t pRealScalar[MAX_FFT_SIZE], pImagScalar[MAX_FFT_SIZE];
+static SLData_t pRealSimd[MAX_FFT_SIZE], pImagSimd[MAX_FFT_SIZE];
+
+// Scalar radix-2 DIF butterflies, as used in SDA_Cfft before the SIMD paths were added
+static void ScalarCfft(SLData_t realData[], SLData_t imagData[], const SLData_t* pFFTCoeffs, const SLArrayIndex_t fftLength,
+                       const SLArrayIndex_t log2FFTLength)
+{
+  const SLData_t* pFFTSineCoeffs = pFFTCoeffs;
+  const SLData_t* pFFTCosineCoeffs = pFFTCoeffs + (fftLength >> 2);
+
+  for (SLUFixData_t i = 0, Stride = (SLUFixData_t)fftLength, AngleInc = 1U; i < (SLUFixData_t)log2FFTLength; i++) {
+    SLUFixData_t k = Stride;
+    Stride >>= 1U;
+    SLArrayIndex_t Angle = 0;
+    for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
+      SLData_t Cos = pFFTCosineCoeffs[Angle];
+      SLData_t Sin = pFFTSineCoeffs[Angle];
+      Angle += AngleInc;
+
+      SLUFixData_t h = BflyCounter;
+      SLUFixData_t j = h + Stride;
+
+      for (SLUFixData_t g = k; g <= (SLUFixData_t)fftLength; g += k, h += k, j += k) {
+        SLData_t realTemp = realData[h] - realData[j];
+        SLData_t imagTemp = imagData[h] - imagData[j];
+        realData[h] = realData[h] + realData[j];
+        imagData[h] = imagData[h] + imagData[j];
+        realData[j] = Cos * realTemp + Sin * imagTemp;
+        imagData[j] = Cos * imagTemp - Sin * realTemp;
+      }
+    }
+    AngleInc <<= 1U;
+  }
+}
+
+static SLData_t MaxDifference(const SLData_t* pA, const SLData_t* pB, const SLArrayIndex_t length)
+{
+  SLData_t maxDiff = SIGLIB_ZERO;
+  for (SLArrayIndex_t i = 0; i < length; i++) {
+    if (SDS_Abs(pA[i] - pB[i]) > maxDiff) {
+      maxDiff = SDS_Abs(pA[i] - pB[i]);
+    }
+  }
+  return (maxDiff);
+}
+
+int main(void)
+{
+  printf("\nSigLib FFT SIMD benchmark (SIGLIB_VECTOR_EXTENSIONS = %d, sizeof(SLData_t) = %d)\n\n", (int)SIGLIB_VECTOR_EXTENSIONS,
+         (int)sizeof(SLData_t));
+  printf("  Length   Scalar (us)   SDA_Cfft (us)   Speed-up   Max diff   SDA_Rfft (us)   Max diff   SDA_FftExecute (us)   Max diff\n");
+
+  for (SLArrayIndex_t log2FFTLength = MIN_LOG2_FFT_SIZE; log2FFTLength <= MAX_LOG2_FFT_SIZE; log2FFTLength++) {
+    SLArrayIndex_t fftLength = (SLArrayIndex_t)1 << log2FFTLength;
+    SLArrayIndex_t numLoops = SAMPLES_PER_TIMING / fftLength;
+
+    SIF_Fft(pFFTCoeffs, pBitReverseTable, fftLength);
+    SIF_FftPlan(pPlanCoeffs, SIGLIB_BIT_REV_NONE, fftLength);
+    for (SLArrayIndex_t i = 0; i < fftLength; i++) {
+      pRealSrc[i] = ((SLData_t)rand() / (SLData_t)RAND_MAX) - SIGLIB_HALF;
+      pImagSrc[i] = ((SLData_t)rand() / (SLData_t)RAND_MAX) - SIGLIB_HALF;
+    }
+
+    clock_t startTime = clock();
+    for (SLArrayIndex_t loop = 0; loop < numLoops; loop++) {
+      SDA_Copy(pRealSrc, pRealScalar, fftLength);
+      SDA_Copy(pImagSrc, pImagScalar, fftLength);
+      ScalarCfft(pRealScalar, pImagScalar, pFFTCoeffs, fftLength, log2FFTLength);
+    }
+    double scalarTime = ((double)(clock() - startTime) / CLOCKS_PER_SEC) * 1.0e6 / (double)numLoops;
+
+    startTime = clock();
+    for (SLArrayIndex_t loop = 0; loop < numLoops; loop++) {
+      SDA_Copy(pRealSrc, pRealSimd, fftLength);
+      SDA_Copy(pImagSrc, pImagSimd, fftLength);
+      SDA_Cfft(pRealSimd, pImagSimd, pFFTCoeffs, SIGLIB_BIT_REV_NONE, fftLength, log2FFTLength);
+    }
+    double simdTime = ((double)(clock() - startTime) / CLOCKS_PER_SEC) * 1.0e6 / (double)numLoops;
+
+    SLData_t cfftDiff = MaxDifference(pRealScalar, pRealSimd, fftLength);
+    SLData_t diff = MaxDifference(pImagScalar, pImagSimd, fftLength);
+    cfftDiff = (diff > cfftDiff) ? diff : cfftDiff;
+
+    // Real FFT - the scalar reference is the complex FFT with a zero imaginary input
+    // SDA_Rfft uses the N/2 point complex FFT when the results are bit reverse reordered
+    SDA_Copy(pRealSrc, pRealScalar, fftLength);
+    SDA_Zeros(pImagScalar, fftLength);
+    ScalarCfft(pRealScalar, pImagScalar, pFFTCoeffs, fftLength, log2FFTLength);
+    SDA_BitReverseReorder(pRealScalar, pRealScalar, pBitReverseTable, fftLength);
+    SDA_BitReverseReorder(pImagScalar, pImagScalar, pBitReverseTable, fftLength);
+
+    startTime = clock();
+    for (SLArrayIndex_t loop = 0; loop < numLoops; loop++) {
+      SDA_Copy(pRealSrc, pRealSimd, fftLength);
+      SDA_Rfft(pRealSimd, pImagSimd, pFFTCoeffs, pBitReverseTable, fftLength, log2FFTLength);
+    }
+    double rfftTime = ((double)(clock() - startTime) / CLOCKS_PER_SEC) * 1.0e6 / (double)numLoops;
+
+    SLData_t rfftDiff = MaxDifference(pRealScalar, pRealSimd, fftLength);
+    diff = MaxDifference(pImagScalar, pImagSimd, fftLength);
+    rfftDiff = (diff > rfftDiff) ? diff : rfftDiff;
+
+    // Planned FFT - compare against the reordered scalar complex FFT with a zero imaginary input
+    startTime = clock();
+    for (SLArrayIndex_t loop = 0; loop < numLoops; loop++) {
+      SDA_Copy(pRealSrc, pRealSimd, fftLength);
+      SDA_Zeros(pImagSimd, fftLength);
+      SDA_FftExecute(pRealSimd, pImagSimd, pPlanCoeffs, pBitReverseTable, fftLength, log2FFTLength);
+    }
+    double planTime = ((double)(clock() - startTime) / CLOCKS_PER_SEC) * 1.0e6 / (double)numLoops;
+
+    SLData_t planDiff = MaxDifference(pRealScalar, pRealSimd, fftLength);
+    diff = MaxDifference(pImagScalar, pImagSimd, fftLength);
+    planDiff = (diff > planDiff) ? diff : planDiff;
+
+    printf("  %6d   %11.3lf   %13.3lf   %8.2lf   %8.1le   %13.3lf   %8.1le   %19.3lf   %8.1le\n", (int)fftLength, scalarTime, simdTime,
+           (simdTime > 0.0) ? (scalarTime / simdTime) : 0.0, (double)cfftDiff, rfftTime, (double)rfftDiff, planTime, (double)planDiff);
+  }
+
+  return (0);
+}
@@ -0,0 +1,69 @@
+// test_wav_block.c
+// Block .wav file I/O example - reads a stereo .wav file one block
+// at a time, with the channels deinterleaved and scaled to +/- 1.0,
+// and writes the mono mix to a 32 bit floating point .wav file.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define BLOCK_LENGTH 4096    // Number of frames per block
+#define MAX_CHANNELS 2
+
+// Declare global variables and arrays
+SLData_t inputData[BLOCK_LENGTH * MAX_CHANNELS];    // Left channel then right channel
+SLData_t outputData[BLOCK_LENGTH];
+
+int main(void)
+{
+  SLSampleFile_s inputFile, outputFile;
+  SLArrayIndex_t frameCount;
+  SLData_t peak[MAX_CHANNELS] = {SIGLIB_ZERO, SIGLIB_ZERO};
+
+  if (SUF_WavFileOpenRead(&inputFile,                                    // Pointer to sample file structure
+                          "StereoSample_16kHz.wav",                      // File name
+                          SIGLIB_ONE / 32768.) != SIGLIB_NO_ERROR) {    // Scale 16 bit samples to +/- 1.0
+    printf("Error opening input .wav file\n");
+    exit(-1);
+  }
+
+  SUF_WavDisplayInfo(inputFile.WavInfo);
+  if ((inputFile.NumberOfChannels > MAX_CHANNELS) || (inputFile.WavInfo.WordLength != 16)) {
+    printf("Expected a 16 bit mono or stereo .wav file\n");
+    exit(-1);
+  }
+  const SLArrayIndex_t numberOfChannels = inputFile.NumberOfChannels;
+
+  SLWavFileInfo_s outputInfo = SUF_WavSetInfo(inputFile.WavInfo.SampleRate, 0, 1, 32, 4, SIGLIB_WAV_FORMAT_IEEE_FLOAT);
+  if (SUF_WavFileOpenWrite(&outputFile,                         // Pointer to sample file structure
+                           "mix.wav",                           // File name
+                           outputInfo,                          // WAV file info struct
+                           SIGLIB_ONE) != SIGLIB_NO_ERROR) {    // Floating point samples are not scaled
+    printf("Error opening output .wav file\n");
+    exit(-1);
+  }
+
+  while ((frameCount = SUF_SampleFileReadChannels(&inputFile, inputData, BLOCK_LENGTH)) > 0) {
+    for (SLArrayIndex_t i = 0; i < frameCount; i++) {
+      outputData[i] = SIGLIB_ZERO;
+      for (SLArrayIndex_t channel = 0; channel < numberOfChannels; channel++) {
+        const SLData_t sample = inputData[(channel * BLOCK_LENGTH) + i];
+        outputData[i] += sample / (SLData_t)numberOfChannels;
+        peak[channel] = SDS_MaxMacro(peak[channel], SDS_Absolute(sample));
+      }
+    }
+    SUF_SampleFileWrite(&outputFile, outputData, frameCount);
+  }
+
+  for (SLArrayIndex_t channel = 0; channel < numberOfChannels; channel++) {
+    printf("Channel %d peak level = %lf\n", channel, peak[channel]);
+  }
+  printf("%d frames written to mix.wav\n", outputFile.FrameCount);
+
+  SUF_SampleFileClose(&inputFile);
+  SUF_SampleFileClose(&outputFile);    // Updates the .wav header with the number of frames written
+
+  return (0);
+}
@@ -0,0 +1,97 @@
+// SigLib - Goertzel Filter Bank Example
+// Four tones are detected in each of two channels, with a single pass
+// over the data for each channel.
+// The data is processed in blocks and the filter state is maintained
+// between the blocks, so the detection period can be longer than
+// the block length.
+// The results are compared with SDA_GoertzelDetect, which must be
+// called separately for every frequency that needs to be detected.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define NUMBER_OF_TONES 4
+#define NUMBER_OF_CHANNELS 2
+#define BLOCK_LENGTH 128
+#define NUMBER_OF_BLOCKS 4                                 // Number of blocks in the detection period
+#define SAMPLE_LENGTH (BLOCK_LENGTH * NUMBER_OF_BLOCKS)    // Detection period length
+
+// Declare global variables and arrays
+static const SLData_t toneFrequencies[NUMBER_OF_TONES] = {    // Create an integer number of cycles per detection period
+  16. / ((SLData_t)SAMPLE_LENGTH), 32. / ((SLData_t)SAMPLE_LENGTH), 48. / ((SLData_t)SAMPLE_LENGTH), 64. / ((SLData_t)SAMPLE_LENGTH)};
+static const SLData_t channelFrequencies[NUMBER_OF_CHANNELS] = {16. / ((SLData_t)SAMPLE_LENGTH), 48. / ((SLData_t)SAMPLE_LENGTH)};
+
+SLData_t goertzelCoeffs[NUMBER_OF_TONES];
+SLData_t goertzelState[2 * NUMBER_OF_TONES * NUMBER_OF_CHANNELS];
+SLData_t toneEnergies[NUMBER_OF_TONES * NUMBER_OF_CHANNELS];
+SLData_t blockData[BLOCK_LENGTH * NUMBER_OF_CHANNELS];    // Channel 0 then channel 1
+
+int main(void)
+{
+  SLData_t* pData = SUF_VectorArrayAllocate(SAMPLE_LENGTH * NUMBER_OF_CHANNELS);    // Channel 0 then channel 1
+
+  if (NULL == pData) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  for (SLArrayIndex_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+    SLData_t sinePhase = SIGLIB_ZERO;
+    SDA_SignalGenerate(pData + (channel * SAMPLE_LENGTH),    // Pointer to destination array
+                       SIGLIB_SINE_WAVE,                     // Signal type - Sine wave
+                       SIGLIB_ONE,                           // Signal peak level
+                       SIGLIB_FILL,                          // Fill (overwrite) or add to existing array contents
+                       channelFrequencies[channel],          // Signal frequency
+                       SIGLIB_ZERO,                          // D.C. Offset
+                       SIGLIB_ZERO,                          // Unused
+                       SIGLIB_ZERO,                          // Signal end value - Unused
+                       &sinePhase,                           // Signal phase - maintained across array boundaries
+                       SIGLIB_NULL_DATA_PTR,                 // Unused
+                       SAMPLE_LENGTH);                       // Output dataset length
+  }
+
+  SIF_GoertzelBank(toneFrequencies,        // Pointer to normalised tone frequencies
+                   goertzelCoeffs,         // Pointer to filter coefficients array
+                   goertzelState,          // Pointer to filter state array
+                   NUMBER_OF_TONES,        // Number of tones
+                   NUMBER_OF_CHANNELS);    // Number of channels
+
+  for (SLArrayIndex_t block = 0; block < NUMBER_OF_BLOCKS; block++) {
+    for (SLArrayIndex_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+      SDA_Copy(pData + (channel * SAMPLE_LENGTH) + (block * BLOCK_LENGTH),    // Pointer to source array
+               blockData + (channel * BLOCK_LENGTH),                          // Pointer to destination array
+               BLOCK_LENGTH);                                                 // Dataset length
+    }
+
+    SDA_GoertzelBank(blockData,             // Pointer to source array
+                     goertzelState,         // Pointer to filter state array
+                     goertzelCoeffs,        // Pointer to filter coefficients array
+                     NUMBER_OF_TONES,       // Number of tones
+                     NUMBER_OF_CHANNELS,    // Number of channels
+                     BLOCK_LENGTH);         // Number of samples per channel
+  }
+
+  SDA_GoertzelBankDetect(goertzelState,          // Pointer to filter state array
+                         goertzelCoeffs,         // Pointer to filter coefficients array
+                         toneEnergies,           // Pointer to destination array
+                         NUMBER_OF_TONES,        // Number of tones
+                         NUMBER_OF_CHANNELS);    // Number of channels
+
+  for (SLArrayIndex_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+    for (SLArrayIndex_t tone = 0; tone < NUMBER_OF_TONES; tone++) {
+      SLData_t goertzelDetect = SDA_GoertzelDetect(pData + (channel * SAMPLE_LENGTH),                           // Pointer to source array
+                                                   SIF_GoertzelDetect(toneFrequencies[tone], SAMPLE_LENGTH),    // Filter coefficient
+                                                   SAMPLE_LENGTH);                                              // Dataset length
+      printf("Channel %d, frequency %lf: bank energy = %lf, SDA_GoertzelDetect energy = %lf\n", channel, toneFrequencies[tone],
+             toneEnergies[(channel * NUMBER_OF_TONES) + tone], goertzelDetect);
+    }
+  }
+
+  SUF_MemoryFree(pData);    // Free memory
+
+  return (0);
+}
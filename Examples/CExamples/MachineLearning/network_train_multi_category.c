@@ -243,6 +243,28 @@ int main(int argc, char* argv[])
                  nRows * nInputNodes);     // Array length
 
     // Train the network
+#if defined(NETWORK_BATCH_SIZE)    // Mini-batch training
+    if (SIGLIB_NO_ERROR != SDA_TwoLayerNetworkFitBatch(pShuffledTrainingData,            // Pointer to training data
+                                                       pCategoricalValue,                // Pointer to training categorical value
+                                                       (SLData_t*)layer1Weights,         // Pointer to layer #1 weights
+                                                       SIGLIB_NULL_DATA_PTR,             // No layer #1 biases
+                                                       (SLData_t*)layer2Weights,         // Pointer to layer #2 weights
+                                                       SIGLIB_NULL_DATA_PTR,             // No layer #2 biases
+                                                       HIDDEN_LAYER_ACTIVATION_TYPE,     // Hidden layer activation type
+                                                       HIDDEN_LAYER_ACTIVATION_ALPHA,    // Hidden layer alpha value
+                                                       OUTPUT_LAYER_ACTIVATION_TYPE,     // Output layer activation type
+                                                       OUTPUT_LAYER_ACTIVATION_ALPHA,    // Output layer alpha value
+                                                       learningRate,                     // Learning rate
+                                                       nRows,                            // Number of training sequences
+                                                       NETWORK_INPUT_SAMPLE_LENGTH,      // Input sample length
+                                                       NETWORK_HIDDEN_LAYER_NODES,       // Hidden layer length
+                                                       NUM_CATEGORIES,                   // Number of output categories
+                                                       NETWORK_BATCH_SIZE,               // Mini-batch size
+                                                       1)) {                             // Number of shards per batch
+      printf("\n\nMemory allocation failed\n\n");
+      exit(-1);
+    }
+#else
     SDA_TwoLayerNCategoryNetworkFit(pShuffledTrainingData,            // Pointer to training data
                                     pCategoricalValue,                // Pointer to training categorical value
                                     (SLData_t*)layer1Weights,         // Pointer to layer #1 weights
@@ -259,6 +281,7 @@ int main(int argc, char* argv[])
                                     NETWORK_INPUT_SAMPLE_LENGTH,      // Input sample length
                                     NETWORK_HIDDEN_LAYER_NODES,       // Hidden layer length
                                     NUM_CATEGORIES);                  // Number of output categories
+#endif
   }
 
   if (debugFlag == 1) {
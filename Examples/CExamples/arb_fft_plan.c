@@ -0,0 +1,115 @@
+// SigLib Planned Arbitrary Length FFT Example
+// Lengths with factors of 2, 3 and 5 use a mixed radix FFT, all other lengths
+// use the chirp z-transform with a precalculated chirp spectrum.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define SAMPLE_LENGTH 15          // Mixed radix FFT length (3 * 5)
+#define PRIME_SAMPLE_LENGTH 17    // Chirp z-transform length
+
+// Declare global variables and arrays
+
+int main(void)
+{
+  SLArrayIndex_t planInfo[SIGLIB_FFT_ARB_PLAN_INFO_LENGTH];
+
+  SLData_t* pRealData = SUF_VectorArrayAllocate(PRIME_SAMPLE_LENGTH);    // Allocate memory
+  SLData_t* pImagData = SUF_VectorArrayAllocate(PRIME_SAMPLE_LENGTH);
+  SLData_t* pPlanCoeffs = SUF_VectorArrayAllocate(SUF_FftArbPlanCoeffsLength(SAMPLE_LENGTH));
+  SLData_t* pRealTemp = SUF_VectorArrayAllocate(SUF_FftArbPlanTempLength(SAMPLE_LENGTH));
+  SLData_t* pImagTemp = SUF_VectorArrayAllocate(SUF_FftArbPlanTempLength(SAMPLE_LENGTH));
+
+  if ((NULL == pRealData) || (NULL == pImagData) || (NULL == pPlanCoeffs) || (NULL == pRealTemp) || (NULL == pImagTemp)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SIF_FftArbPlan(planInfo,          // Pointer to plan information
+                 pPlanCoeffs,       // Pointer to plan coefficients
+                 pRealTemp,         // Pointer to real temporary array
+                 pImagTemp,         // Pointer to imaginary temporary array
+                 SAMPLE_LENGTH);    // Arbitrary FFT length
+
+  SLData_t cosinePhase = SIGLIB_ZERO;
+  SDA_SignalGenerate(pRealData,                               // Pointer to destination array
+                     SIGLIB_COSINE_WAVE,                      // Signal type - Cosine wave
+                     SIGLIB_ONE,                              // Signal peak level
+                     SIGLIB_FILL,                             // Fill (overwrite) or add to existing array contents
+                     SIGLIB_TWO / (SLData_t)SAMPLE_LENGTH,    // Signal frequency
+                     SIGLIB_ZERO,                             // D.C. Offset
+                     SIGLIB_ZERO,                             // Unused
+                     SIGLIB_ZERO,                             // Signal end value - Unused
+                     &cosinePhase,                            // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,                    // Unused
+                     SAMPLE_LENGTH);                          // Output dataset length
+  SDA_Zeros(pImagData,                                        // Pointer to data array
+            SAMPLE_LENGTH);                                   // Array length
+
+  SDA_CfftArbPlan(pRealData,         // Pointer to real source array
+                  pImagData,         // Pointer to imaginary source array
+                  pRealData,         // Pointer to real destination array
+                  pImagData,         // Pointer to imaginary destination array
+                  pRealTemp,         // Pointer to real temporary array
+                  pImagTemp,         // Pointer to imaginary temporary array
+                  planInfo,          // Pointer to plan information
+                  pPlanCoeffs,       // Pointer to plan coefficients
+                  SAMPLE_LENGTH);    // Arbitrary FFT length
+
+  printf("\n%d point mixed radix FFT of pure cosine wave (integer number of bins)\n", SAMPLE_LENGTH);
+  SUF_PrintComplexArray(pRealData, pImagData, SAMPLE_LENGTH);
+
+  SDA_CifftArbPlan(pRealData,         // Pointer to real source array
+                   pImagData,         // Pointer to imaginary source array
+                   pRealData,         // Pointer to real destination array
+                   pImagData,         // Pointer to imaginary destination array
+                   pRealTemp,         // Pointer to real temporary array
+                   pImagTemp,         // Pointer to imaginary temporary array
+                   planInfo,          // Pointer to plan information
+                   pPlanCoeffs,       // Pointer to plan coefficients
+                   SAMPLE_LENGTH);    // Arbitrary FFT length
+
+  printf("\nInverse FFT\n");
+  SUF_PrintArray(pRealData, SAMPLE_LENGTH);
+
+  // The cached functions allocate and hold the plan for each length
+  cosinePhase = SIGLIB_ZERO;
+  SDA_SignalGenerate(pRealData,                                     // Pointer to destination array
+                     SIGLIB_COSINE_WAVE,                            // Signal type - Cosine wave
+                     SIGLIB_ONE,                                    // Signal peak level
+                     SIGLIB_FILL,                                   // Fill (overwrite) or add to existing array contents
+                     SIGLIB_TWO / (SLData_t)PRIME_SAMPLE_LENGTH,    // Signal frequency
+                     SIGLIB_ZERO,                                   // D.C. Offset
+                     SIGLIB_ZERO,                                   // Unused
+                     SIGLIB_ZERO,                                   // Signal end value - Unused
+                     &cosinePhase,                                  // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,                          // Unused
+                     PRIME_SAMPLE_LENGTH);                          // Output dataset length
+  SDA_Zeros(pImagData,                                              // Pointer to data array
+            PRIME_SAMPLE_LENGTH);                                   // Array length
+
+  if (SDA_CfftArbCached(pRealData,                                    // Pointer to real source array
+                        pImagData,                                    // Pointer to imaginary source array
+                        pRealData,                                    // Pointer to real destination array
+                        pImagData,                                    // Pointer to imaginary destination array
+                        PRIME_SAMPLE_LENGTH) != SIGLIB_NO_ERROR) {    // Arbitrary FFT length
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  printf("\n%d point chirp z-transform of pure cosine wave (integer number of bins)\n", PRIME_SAMPLE_LENGTH);
+  SUF_PrintComplexArray(pRealData, pImagData, PRIME_SAMPLE_LENGTH);
+
+  SUF_FftArbPlanCacheFree();    // Free the cached plans
+
+  SUF_MemoryFree(pRealData);    // Free memory
+  SUF_MemoryFree(pImagData);
+  SUF_MemoryFree(pPlanCoeffs);
+  SUF_MemoryFree(pRealTemp);
+  SUF_MemoryFree(pImagTemp);
+
+  return (0);
+}
@@ -0,0 +1,74 @@
+// SigLib CRC Example
+// Calculates standard CRCs of the check string "123456789" and then calculates
+// the CRC-24 of a long packet, both in one call and incrementally, as the
+// packet arrives in blocks.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define PACKET_LENGTH 10000
+#define BLOCK_LENGTH 1500
+
+// Declare global variables and arrays
+static const SLUInt8_t CheckString[] = "123456789";
+static SLUInt8_t Packet[PACKET_LENGTH];
+
+int main(void)
+{
+  SLCrc_s Crc32, Crc16, Crc24;
+
+  if ((SIF_Crc(&Crc32,                                 // Pointer to CRC structure
+               0x04C11DB7U,                            // Generator polynomial
+               32,                                     // CRC width
+               0xFFFFFFFFU,                            // Initial CRC value
+               0xFFFFFFFFU,                            // Final XOR value
+               SIGLIB_TRUE,                            // Reflect input bytes
+               SIGLIB_TRUE) != SIGLIB_NO_ERROR) ||     // Reflect output CRC
+      (SIF_Crc(&Crc16,                                 // Pointer to CRC structure
+               0x1021U,                                // Generator polynomial
+               16,                                     // CRC width
+               0xFFFFU,                                // Initial CRC value
+               0x0000U,                                // Final XOR value
+               SIGLIB_FALSE,                           // Reflect input bytes
+               SIGLIB_FALSE) != SIGLIB_NO_ERROR) ||    // Reflect output CRC
+      (SIF_Crc(&Crc24,                                 // Pointer to CRC structure
+               0x864CFBU,                              // Generator polynomial
+               24,                                     // CRC width
+               0x000000U,                              // Initial CRC value
+               0x000000U,                              // Final XOR value
+               SIGLIB_FALSE,                           // Reflect input bytes
+               SIGLIB_FALSE) != SIGLIB_NO_ERROR)) {    // Reflect output CRC
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  printf("CRC-32          = 0x%08X (expected 0xCBF43926)\n", (unsigned int)SDA_Crc(CheckString, &Crc32, 9));
+  printf("CRC-16/IBM-3740 = 0x%04X     (expected 0x29B1)\n", (unsigned int)SDA_Crc(CheckString, &Crc16, 9));
+  printf("CRC-24/LTE-A    = 0x%06X   (expected 0xCDE703)\n\n", (unsigned int)SDA_Crc(CheckString, &Crc24, 9));
+
+  for (SLArrayIndex_t i = 0; i < PACKET_LENGTH; i++) {    // Generate the packet
+    Packet[i] = (SLUInt8_t)rand();
+  }
+
+  SLUInt32_t Register = SDS_CrcStart(&Crc24);                                // Start of packet
+  for (SLArrayIndex_t i = 0; i < PACKET_LENGTH; i += BLOCK_LENGTH) {         // Update the CRC with each block
+    SLArrayIndex_t Length = ((PACKET_LENGTH - i) < BLOCK_LENGTH) ? (PACKET_LENGTH - i) : BLOCK_LENGTH;
+    Register = SDA_CrcUpdate(Packet + i,    // Pointer to source array
+                             Register,      // CRC register
+                             &Crc24,        // Pointer to CRC structure
+                             Length);       // Array length
+  }
+
+  printf("Packet CRC-24 in one call = 0x%06X\n", (unsigned int)SDA_Crc(Packet, &Crc24, PACKET_LENGTH));
+  printf("Packet CRC-24 in blocks   = 0x%06X\n", (unsigned int)SDS_CrcFinish(Register, &Crc24));
+
+  SUF_CrcFree(&Crc32);    // Free the CRC memory
+  SUF_CrcFree(&Crc16);
+  SUF_CrcFree(&Crc24);
+
+  return (0);
+}
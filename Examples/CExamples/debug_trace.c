@@ -0,0 +1,109 @@
+// SigLib Binary Debug Trace Example
+// Logs records to the per thread trace buffers, flushes them to the binary
+// trace file, decodes the trace file to text and checks the text, with and
+// without the thread index, time and function prefix. The records are
+// flushed by SUF_DebugTraceFlush and then by the background flusher.
+// SigLib must be built with SIGLIB_DEBUG_TRACE = 1.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <string.h>
+#define SIGLIB_DEBUG_TRACE 1    // SUF_Debugfprintf records the name of the calling function
+#include <siglib.h>             // SigLib DSP library
+
+// Define constants
+#define TEXT_FILE "debug_trace.log"    // Decoded trace file
+#define LINE_LENGTH 256
+
+// The conversion specifications of the last three formats are too long for the decoder to rebuild
+// so they are printed as they are in the format string, the arguments are still consumed
+#define LONG_FLAGS "%--------------------------------------------------------------------d"
+#define LONG_WIDTH "%0000000000000000000000000000000000000000000000000000000000000000004d"
+#define LONG_STAR "%-----------------------------------------*d"
+
+static const char* pExpected[] = {
+    "Count: 5|",
+    "Width:     5|",
+    "Precision: 3.14|",
+    "String: SigLib|",
+    LONG_FLAGS "|",
+    LONG_WIDTH " 7|",
+    LONG_STAR " 9|",
+};
+
+static void log_records(void)
+{
+  SUF_ClearDebugfprintf();    // Clear the log file and the trace file
+
+  SUF_Debugfprintf("Count: %d|\n", 5);
+  SUF_Debugfprintf("Width: %*d|\n", 5, 5);
+  SUF_Debugfprintf("Precision: %.*lf|\n", 2, 3.14159);
+  SUF_Debugfprintf("String: %s|\n", "SigLib");
+  SUF_Debugfprintf(LONG_FLAGS "|\n", 5);
+  SUF_Debugfprintf(LONG_WIDTH " %d|\n", 5, 7);
+  SUF_Debugfprintf(LONG_STAR " %d|\n", -2147483647, 5, 9);
+}
+
+static int check_trace(const SLFixData_t timestampFlag)
+{
+  if (SIGLIB_NO_ERROR != SUF_DebugTraceDecode(SIGLIB_TRACE_FILE, TEXT_FILE, timestampFlag)) {
+    printf("The trace file could not be decoded - SigLib must be built with SIGLIB_DEBUG_TRACE = 1\n");
+    return (1);
+  }
+
+  FILE* fp_TextFile = fopen(TEXT_FILE, "r");
+  if (NULL == fp_TextFile) {
+    printf("Error opening %s\n", TEXT_FILE);
+    return (1);
+  }
+
+  int errorCount = 0;
+  char line[LINE_LENGTH];
+  for (size_t i = 0; i < (sizeof(pExpected) / sizeof(pExpected[0])); i++) {
+    if (NULL == fgets(line, LINE_LENGTH, fp_TextFile)) {
+      printf("Missing line: %s\n", pExpected[i]);
+      errorCount++;
+      continue;
+    }
+    line[strcspn(line, "\n")] = '\0';
+    const char* pText = line;
+    if (SIGLIB_TRUE == timestampFlag) {    // Prefix - [thread time function]
+      const char* pPrefixEnd = strstr(line, " log_records] ");
+      if ((line[0] != '[') || (NULL == pPrefixEnd)) {
+        printf("Missing prefix: %s\n", line);
+        errorCount++;
+        continue;
+      }
+      pText = pPrefixEnd + strlen(" log_records] ");
+    }
+    if (strcmp(pText, pExpected[i]) != 0) {
+      printf("Decoded: %s\nExpected: %s\n", pText, pExpected[i]);
+      errorCount++;
+    }
+  }
+  fclose(fp_TextFile);
+  return (errorCount);
+}
+
+int main(void)
+{
+  log_records();
+  if (SIGLIB_NO_ERROR != SUF_DebugTraceFlush()) {
+    printf("Error writing %s\n", SIGLIB_TRACE_FILE);
+    return (1);
+  }
+  int errorCount = check_trace(SIGLIB_FALSE) + check_trace(SIGLIB_TRUE);
+
+  if (SIGLIB_NO_ERROR == SUF_DebugTraceStartFlusher(10)) {    // The background flusher is only available on POSIX systems
+    log_records();
+    SUF_DebugTraceStopFlusher();    // The records are written before the flusher stops
+    errorCount += check_trace(SIGLIB_FALSE);
+  }
+
+  if (0 == errorCount) {
+    printf("The decoded trace matches the logged text\n");
+  }
+
+  return (errorCount);
+}
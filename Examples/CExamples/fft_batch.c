@@ -0,0 +1,74 @@
+// SigLib Batched Multi-Channel FFT Example
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define FFT_LENGTH 16
+#define LOG2_FFT_LENGTH SAI_FftLengthLog2(FFT_LENGTH)    // Log2 FFT length
+#define NUMBER_OF_CHANNELS 4
+
+// Declare global variables and arrays
+
+int main(void)
+{
+  SLData_t* pRealData = SUF_VectorArrayAllocate(FFT_LENGTH * NUMBER_OF_CHANNELS);    // Allocate memory
+  SLData_t* pImagData = SUF_VectorArrayAllocate(FFT_LENGTH * NUMBER_OF_CHANNELS);
+  SLData_t* pRealTemp = SUF_VectorArrayAllocate(SAI_FftBatchTempLength(FFT_LENGTH));
+  SLData_t* pImagTemp = SUF_VectorArrayAllocate(SAI_FftBatchTempLength(FFT_LENGTH));
+  SLArrayIndex_t* pFFTBitReverseTable = SUF_IndexArrayAllocate(FFT_LENGTH);
+  SLData_t* pFFTCoeffs = SUF_FftCoefficientAllocate(FFT_LENGTH);
+
+  if ((NULL == pRealData) || (NULL == pImagData) || (NULL == pRealTemp) || (NULL == pImagTemp) || (NULL == pFFTBitReverseTable) ||
+      (NULL == pFFTCoeffs)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SIF_Fft(pFFTCoeffs,             // Pointer to FFT coefficients
+          pFFTBitReverseTable,    // Bit reverse mode flag / Pointer to bit reverse address table
+          FFT_LENGTH);            // FFT length
+
+  // Each channel contains a cosine wave in a different frequency bin
+  for (SLArrayIndex_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+    SLData_t cosinePhase = SIGLIB_ZERO;
+    SDA_SignalGenerate(pRealData + (channel * FFT_LENGTH),                // Pointer to destination array
+                       SIGLIB_COSINE_WAVE,                                // Signal type - Cosine wave
+                       SIGLIB_ONE,                                        // Signal peak level
+                       SIGLIB_FILL,                                       // Fill (overwrite) or add to existing array contents
+                       (SLData_t)(channel + 1) / (SLData_t)FFT_LENGTH,    // Signal frequency
+                       SIGLIB_ZERO,                                       // D.C. Offset
+                       SIGLIB_ZERO,                                       // Unused
+                       SIGLIB_ZERO,                                       // Signal end value - Unused
+                       &cosinePhase,                                      // Signal phase - maintained across array boundaries
+                       SIGLIB_NULL_DATA_PTR,                              // Unused
+                       FFT_LENGTH);                                       // Output dataset length
+  }
+
+  SDA_RfftBatch(pRealData,              // Pointer to real data for the first channel
+                pImagData,              // Pointer to imaginary data for the first channel
+                pRealTemp,              // Pointer to real temporary array
+                pImagTemp,              // Pointer to imaginary temporary array
+                pFFTCoeffs,             // Pointer to FFT coefficients
+                pFFTBitReverseTable,    // Bit reverse mode flag / Pointer to bit reverse address table
+                FFT_LENGTH,             // Channel stride
+                NUMBER_OF_CHANNELS,     // Number of channels
+                FFT_LENGTH,             // FFT length
+                LOG2_FFT_LENGTH);       // log2 FFT length
+
+  for (SLArrayIndex_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+    printf("\nChannel %d: real FFT of pure cosine wave (integer number of bins)\n", (int)channel);
+    SUF_PrintComplexArray(pRealData + (channel * FFT_LENGTH), pImagData + (channel * FFT_LENGTH), FFT_LENGTH);
+  }
+
+  SUF_MemoryFree(pRealData);    // Free memory
+  SUF_MemoryFree(pImagData);
+  SUF_MemoryFree(pRealTemp);
+  SUF_MemoryFree(pImagTemp);
+  SUF_MemoryFree(pFFTBitReverseTable);
+  SUF_MemoryFree(pFFTCoeffs);
+
+  return (0);
+}
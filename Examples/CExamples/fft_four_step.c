@@ -0,0 +1,114 @@
+// SigLib Four-Step FFT Example
+// The four-step FFT splits a large FFT into row FFTs that fit in the cache.
+// The row FFTs are distributed across the parallel executor registered with
+// SUF_SetParallelFor, this example uses OpenMP when it is enabled.
+// The short transforms are checked against SDA_Cdft, lengths below 16 are
+// rejected by SIF_FftFourStep.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define FFT_LENGTH 1048576
+#define LOG2_FFT_LENGTH SAI_FftLengthLog2(FFT_LENGTH)    // Log2 FFT length
+#define PRINT_LENGTH 8                                    // Number of results printed around the peak
+#define MAX_CHECK_LENGTH 64                               // Longest transform checked against the DFT
+
+// Declare global variables and arrays
+static SLData_t RealDft[MAX_CHECK_LENGTH], ImagDft[MAX_CHECK_LENGTH];
+
+#ifdef _OPENMP
+static void OpenMPParallelFor(SLParallelTask_t pTask, void* pContext, SLArrayIndex_t numberOfTasks)
+{
+#  pragma omp parallel for schedule(dynamic)
+  for (SLArrayIndex_t i = 0; i < numberOfTasks; i++) {
+    pTask(pContext, i);
+  }
+}
+#endif
+
+int main(void)
+{
+  SLData_t* pRealData = SUF_VectorArrayAllocate(FFT_LENGTH);    // Allocate memory
+  SLData_t* pImagData = SUF_VectorArrayAllocate(FFT_LENGTH);
+  SLData_t* pRealTemp = SUF_VectorArrayAllocate(FFT_LENGTH);
+  SLData_t* pImagTemp = SUF_VectorArrayAllocate(FFT_LENGTH);
+  SLData_t* pCoeffs = SUF_VectorArrayAllocate(SUF_FftFourStepCoeffsLength(FFT_LENGTH));
+  SLArrayIndex_t* pBitReverseTables = SUF_IndexArrayAllocate(SUF_FftFourStepBitReverseLength(FFT_LENGTH));
+
+  if ((NULL == pRealData) || (NULL == pImagData) || (NULL == pRealTemp) || (NULL == pImagTemp) || (NULL == pCoeffs) ||
+      (NULL == pBitReverseTables)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+#ifdef _OPENMP
+  SUF_SetParallelFor(OpenMPParallelFor);    // Register the parallel executor
+#endif
+
+  if (SIF_FftFourStep(pCoeffs,                             // Pointer to four-step FFT coefficients
+                      pBitReverseTables,                   // Pointer to row FFT bit reverse address tables
+                      FFT_LENGTH) != SIGLIB_NO_ERROR) {    // FFT length
+    printf("\n\nSIF_FftFourStep failed\n\n");
+    exit(0);
+  }
+
+  SLData_t cosinePhase = SIGLIB_ZERO;
+  SDA_SignalGenerate(pRealData,                                // Pointer to destination array
+                     SIGLIB_COSINE_WAVE,                       // Signal type - Cosine wave
+                     SIGLIB_ONE,                               // Signal peak level
+                     SIGLIB_FILL,                              // Fill (overwrite) or add to existing array contents
+                     (SLData_t)1000 / (SLData_t)FFT_LENGTH,    // Signal frequency
+                     SIGLIB_ZERO,                              // D.C. Offset
+                     SIGLIB_ZERO,                              // Unused
+                     SIGLIB_ZERO,                              // Signal end value - Unused
+                     &cosinePhase,                             // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,                     // Unused
+                     FFT_LENGTH);                              // Output dataset length
+  SDA_Zeros(pImagData,                                         // Pointer to data array
+            FFT_LENGTH);                                       // Array length
+
+  SDA_CfftFourStep(pRealData,            // Pointer to real array
+                   pImagData,            // Pointer to imaginary array
+                   pRealTemp,            // Pointer to real temporary array
+                   pImagTemp,            // Pointer to imaginary temporary array
+                   pCoeffs,              // Pointer to four-step FFT coefficients
+                   pBitReverseTables,    // Pointer to row FFT bit reverse address tables
+                   FFT_LENGTH,           // FFT length
+                   LOG2_FFT_LENGTH);     // log2 FFT length
+
+  printf("\n%d point four-step FFT of pure cosine wave, bins %d to %d\n", FFT_LENGTH, 1000 - (PRINT_LENGTH / 2), 1000 + (PRINT_LENGTH / 2) - 1);
+  SUF_PrintComplexArray(pRealData + 1000 - (PRINT_LENGTH / 2), pImagData + 1000 - (PRINT_LENGTH / 2), PRINT_LENGTH);
+
+  printf("\nShort transforms compared with SDA_Cdft\n");
+  for (SLArrayIndex_t checkLength = 4; checkLength <= MAX_CHECK_LENGTH; checkLength *= 2) {
+    for (SLArrayIndex_t i = 0; i < checkLength; i++) {    // Generate test data
+      pRealData[i] = (SLData_t)((i * 37) % 11) - (SLData_t)5;
+      pImagData[i] = (SLData_t)((i * 13) % 7) - (SLData_t)3;
+    }
+    if (SIF_FftFourStep(pCoeffs, pBitReverseTables, checkLength) != SIGLIB_NO_ERROR) {
+      printf("%d point four-step FFT - length rejected\n", checkLength);
+      continue;
+    }
+    SDA_Cdft(pRealData, pImagData, RealDft, ImagDft, checkLength);
+    SDA_CfftFourStep(pRealData, pImagData, pRealTemp, pImagTemp, pCoeffs, pBitReverseTables, checkLength, SAI_FftLengthLog2(checkLength));
+
+    SLData_t maxError = SIGLIB_ZERO;
+    for (SLArrayIndex_t i = 0; i < checkLength; i++) {
+      SLData_t Error = SDS_Abs(pRealData[i] - RealDft[i]) + SDS_Abs(pImagData[i] - ImagDft[i]);
+      maxError = (Error > maxError) ? Error : maxError;
+    }
+    printf("%d point four-step FFT - maximum error = %le\n", checkLength, maxError);
+  }
+
+  SUF_MemoryFree(pRealData);    // Free memory
+  SUF_MemoryFree(pImagData);
+  SUF_MemoryFree(pRealTemp);
+  SUF_MemoryFree(pImagTemp);
+  SUF_MemoryFree(pCoeffs);
+  SUF_MemoryFree(pBitReverseTables);
+
+  return (0);
+}
@@ -0,0 +1,96 @@
+// SigLib Planned (Radix-4 / Radix-2) FFT Example
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define FFT_LENGTH 32
+#define LOG2_FFT_LENGTH SAI_FftLengthLog2(FFT_LENGTH)    // Log2 FFT length
+
+// Declare global variables and arrays
+
+int main(void)
+{
+  SLData_t* pRealData = SUF_VectorArrayAllocate(FFT_LENGTH);    // Allocate memory
+  SLData_t* pImagData = SUF_VectorArrayAllocate(FFT_LENGTH);
+  SLData_t* pRealRef = SUF_VectorArrayAllocate(FFT_LENGTH);
+  SLData_t* pImagRef = SUF_VectorArrayAllocate(FFT_LENGTH);
+  SLArrayIndex_t* pFFTBitReverseTable = SUF_IndexArrayAllocate(FFT_LENGTH);
+  SLData_t* pFFTCoeffs = SUF_FftCoefficientAllocate(FFT_LENGTH);
+  SLData_t* pPlanCoeffs = SUF_FftPlanCoefficientAllocate(FFT_LENGTH);
+
+  if ((NULL == pRealData) || (NULL == pImagData) || (NULL == pRealRef) || (NULL == pImagRef) || (NULL == pFFTBitReverseTable) ||
+      (NULL == pFFTCoeffs) || (NULL == pPlanCoeffs)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SIF_FftPlan(pPlanCoeffs,            // Pointer to FFT plan coefficients
+              pFFTBitReverseTable,    // Bit reverse mode flag / Pointer to bit reverse address table
+              FFT_LENGTH);            // FFT length
+
+  SIF_Fft(pFFTCoeffs,             // Pointer to FFT coefficients
+          SIGLIB_BIT_REV_NONE,    // Bit reverse mode flag / Pointer to bit reverse address table
+          FFT_LENGTH);            // FFT length
+
+  SLData_t cosinePhase = SIGLIB_ZERO;
+  SDA_SignalGenerate(pRealData,                             // Pointer to destination array
+                     SIGLIB_COSINE_WAVE,                    // Signal type - Cosine wave
+                     SIGLIB_ONE,                            // Signal peak level
+                     SIGLIB_FILL,                           // Fill (overwrite) or add to existing array contents
+                     SIGLIB_FOUR / (SLData_t)FFT_LENGTH,    // Signal frequency
+                     SIGLIB_ZERO,                           // D.C. Offset
+                     SIGLIB_ZERO,                           // Unused
+                     SIGLIB_ZERO,                           // Signal end value - Unused
+                     &cosinePhase,                          // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,                  // Unused
+                     FFT_LENGTH);                           // Output dataset length
+  SDA_Zeros(pImagData,      // Pointer to data array
+            FFT_LENGTH);    // Array length
+  SDA_Copy(pRealData, pRealRef, FFT_LENGTH);
+  SDA_Copy(pImagData, pImagRef, FFT_LENGTH);
+
+  SDA_FftExecute(pRealData,              // Pointer to real array
+                 pImagData,              // Pointer to imaginary array
+                 pPlanCoeffs,            // Pointer to FFT plan coefficients
+                 pFFTBitReverseTable,    // Bit reverse mode flag / Pointer to bit reverse address table
+                 FFT_LENGTH,             // FFT length
+                 LOG2_FFT_LENGTH);       // log2 FFT length
+
+  printf("\nPlanned FFT of pure cosine wave (integer number of bins)\n");
+  SUF_PrintComplexArray(pRealData, pImagData, FFT_LENGTH);
+
+  SDA_Cfft(pRealRef,                   // Pointer to real array
+           pImagRef,                   // Pointer to imaginary array
+           pFFTCoeffs,                 // Pointer to FFT coefficients
+           SIGLIB_BIT_REV_STANDARD,    // Bit reverse mode flag / Pointer to bit reverse address table
+           FFT_LENGTH,                 // FFT length
+           LOG2_FFT_LENGTH);           // log2 FFT length
+
+  SDA_Subtract2(pRealData, pRealRef, pRealRef, FFT_LENGTH);
+  SDA_Subtract2(pImagData, pImagRef, pImagRef, FFT_LENGTH);
+  printf("Maximum difference from SDA_Cfft = %le\n", SDS_Max(SDA_AbsMax(pRealRef, FFT_LENGTH), SDA_AbsMax(pImagRef, FFT_LENGTH)));
+
+  SDA_IfftExecute(pRealData,              // Pointer to real array
+                  pImagData,              // Pointer to imaginary array
+                  pPlanCoeffs,            // Pointer to FFT plan coefficients
+                  pFFTBitReverseTable,    // Bit reverse mode flag / Pointer to bit reverse address table
+                  FFT_LENGTH,             // FFT length
+                  LOG2_FFT_LENGTH);       // log2 FFT length
+  SDA_Multiply(pRealData, SIGLIB_ONE / (SLData_t)FFT_LENGTH, pRealData, FFT_LENGTH);
+
+  printf("\nInverse FFT (scaled by 1/N)\n");
+  SUF_PrintArray(pRealData, FFT_LENGTH);
+
+  SUF_MemoryFree(pRealData);    // Free memory
+  SUF_MemoryFree(pImagData);
+  SUF_MemoryFree(pRealRef);
+  SUF_MemoryFree(pImagRef);
+  SUF_MemoryFree(pFFTBitReverseTable);
+  SUF_MemoryFree(pFFTCoeffs);
+  SUF_MemoryFree(pPlanCoeffs);
+
+  return (0);
+}
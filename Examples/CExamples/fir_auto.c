@@ -0,0 +1,161 @@
+// SigLib Automatically Selected Time / Frequency Domain FIR Filter Example
+// SIF_FirAuto models the cost of the time domain and overlap and save
+// frequency domain filters and SDA_FirAuto uses the fastest method.
+// The input history is common to both methods so the filter can be
+// redesigned at run time without a glitch in the output.
+// When the application allows some latency the uniformly partitioned
+// frequency domain filter is also considered, for very long filters.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define SHORT_FILTER_LENGTH 31
+#define LONG_FILTER_LENGTH 1023
+#define VERY_LONG_FILTER_LENGTH 16384
+#define BLOCK_LENGTH 1024
+#define MAX_LATENCY 256    // Latency allowed for the very long filter
+#define PRINT_LENGTH 8
+
+// Declare global variables and arrays
+
+static const char* MethodName(const enum SLFirAutoMethod_t method)
+{
+  if (method == SIGLIB_FIR_AUTO_TIME_DOMAIN) {
+    return ("time domain");
+  } else if (method == SIGLIB_FIR_AUTO_OVERLAP_SAVE) {
+    return ("overlap and save");
+  }
+  return ("partitioned");
+}
+
+int main(void)
+{
+  SLFirAuto_s firAuto;
+
+  SLData_t* pCoeffs = SUF_VectorArrayAllocate(VERY_LONG_FILTER_LENGTH);    // Allocate memory
+  SLData_t* pSrc = SUF_VectorArrayAllocate(BLOCK_LENGTH);
+  SLData_t* pDst = SUF_VectorArrayAllocate(BLOCK_LENGTH);
+
+  if ((NULL == pCoeffs) || (NULL == pSrc) || (NULL == pDst)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SIF_FirLowPassFilter(pCoeffs,                  // Filter coefficients array
+                       0.1,                      // Filter cut off frequency
+                       SIGLIB_HANNING_FILTER,    // Window type
+                       SHORT_FILTER_LENGTH);     // Filter length
+
+  if (SIF_FirAuto(&firAuto,                                        // Pointer to filter structure
+                  pCoeffs,                                         // Pointer to filter coefficients
+                  SHORT_FILTER_LENGTH,                             // Filter length
+                  LONG_FILTER_LENGTH,                              // Maximum filter length
+                  BLOCK_LENGTH,                                    // Maximum number of samples per call
+                  0,                                               // Maximum added latency - none
+                  SIGLIB_FIR_AUTO_SELECT) != SIGLIB_NO_ERROR) {    // Filtering method
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SLData_t sinePhase = SIGLIB_ZERO;
+  SDA_SignalGenerate(pSrc,                    // Pointer to destination array
+                     SIGLIB_SINE_WAVE,        // Signal type - Sine wave
+                     SIGLIB_ONE,              // Signal peak level
+                     SIGLIB_FILL,             // Fill (overwrite) or add to existing array contents
+                     0.01,                    // Signal frequency
+                     SIGLIB_ZERO,             // D.C. Offset
+                     SIGLIB_ZERO,             // Unused
+                     SIGLIB_ZERO,             // Signal end value - Unused
+                     &sinePhase,              // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     BLOCK_LENGTH);           // Output dataset length
+
+  SDA_FirAuto(pSrc,             // Pointer to source array
+              pDst,             // Pointer to destination array
+              &firAuto,         // Pointer to filter structure
+              BLOCK_LENGTH);    // Number of samples to filter
+
+  printf("\n%d tap filter, %d samples per block - %s\n", SHORT_FILTER_LENGTH, BLOCK_LENGTH, MethodName(firAuto.Method));
+  SUF_PrintArray(pDst + BLOCK_LENGTH - PRINT_LENGTH, PRINT_LENGTH);
+
+  // Redesign the filter - the filter history is kept
+  SIF_FirLowPassFilter(pCoeffs,                  // Filter coefficients array
+                       0.1,                      // Filter cut off frequency
+                       SIGLIB_HANNING_FILTER,    // Window type
+                       LONG_FILTER_LENGTH);      // Filter length
+
+  SIF_FirAutoCoefficients(&firAuto,               // Pointer to filter structure
+                          pCoeffs,                // Pointer to filter coefficients
+                          LONG_FILTER_LENGTH);    // Filter length
+
+  SDA_SignalGenerate(pSrc,                    // Pointer to destination array
+                     SIGLIB_SINE_WAVE,        // Signal type - Sine wave
+                     SIGLIB_ONE,              // Signal peak level
+                     SIGLIB_FILL,             // Fill (overwrite) or add to existing array contents
+                     0.01,                    // Signal frequency
+                     SIGLIB_ZERO,             // D.C. Offset
+                     SIGLIB_ZERO,             // Unused
+                     SIGLIB_ZERO,             // Signal end value - Unused
+                     &sinePhase,              // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     BLOCK_LENGTH);           // Output dataset length
+
+  SDA_FirAuto(pSrc,             // Pointer to source array
+              pDst,             // Pointer to destination array
+              &firAuto,         // Pointer to filter structure
+              BLOCK_LENGTH);    // Number of samples to filter
+
+  printf("\n%d tap filter, %d samples per block - %s\n", LONG_FILTER_LENGTH, BLOCK_LENGTH, MethodName(firAuto.Method));
+  SUF_PrintArray(pDst + BLOCK_LENGTH - PRINT_LENGTH, PRINT_LENGTH);
+
+  SUF_FirAutoFree(&firAuto);    // Free the filter memory
+
+  // Very long filter, with some latency allowed
+  SIF_FirLowPassFilter(pCoeffs,                     // Filter coefficients array
+                       0.1,                         // Filter cut off frequency
+                       SIGLIB_HANNING_FILTER,       // Window type
+                       VERY_LONG_FILTER_LENGTH);    // Filter length
+
+  if (SIF_FirAuto(&firAuto,                                        // Pointer to filter structure
+                  pCoeffs,                                         // Pointer to filter coefficients
+                  VERY_LONG_FILTER_LENGTH,                         // Filter length
+                  VERY_LONG_FILTER_LENGTH,                         // Maximum filter length
+                  BLOCK_LENGTH,                                    // Maximum number of samples per call
+                  MAX_LATENCY,                                     // Maximum added latency
+                  SIGLIB_FIR_AUTO_SELECT) != SIGLIB_NO_ERROR) {    // Filtering method
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SDA_SignalGenerate(pSrc,                    // Pointer to destination array
+                     SIGLIB_SINE_WAVE,        // Signal type - Sine wave
+                     SIGLIB_ONE,              // Signal peak level
+                     SIGLIB_FILL,             // Fill (overwrite) or add to existing array contents
+                     0.01,                    // Signal frequency
+                     SIGLIB_ZERO,             // D.C. Offset
+                     SIGLIB_ZERO,             // Unused
+                     SIGLIB_ZERO,             // Signal end value - Unused
+                     &sinePhase,              // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     BLOCK_LENGTH);           // Output dataset length
+
+  SDA_FirAuto(pSrc,             // Pointer to source array
+              pDst,             // Pointer to destination array
+              &firAuto,         // Pointer to filter structure
+              BLOCK_LENGTH);    // Number of samples to filter
+
+  printf("\n%d tap filter, %d samples per block - %s, %d samples latency\n", VERY_LONG_FILTER_LENGTH, BLOCK_LENGTH, MethodName(firAuto.Method),
+         firAuto.Latency);
+  SUF_PrintArray(pDst + BLOCK_LENGTH - PRINT_LENGTH, PRINT_LENGTH);
+
+  SUF_FirAutoFree(&firAuto);    // Free the filter memory
+
+  SUF_MemoryFree(pCoeffs);    // Free memory
+  SUF_MemoryFree(pSrc);
+  SUF_MemoryFree(pDst);
+
+  return (0);
+}
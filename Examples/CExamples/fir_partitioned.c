@@ -0,0 +1,99 @@
+// SigLib Uniformly Partitioned Overlap And Save FIR Filter Example
+// A long FIR filter is split into partitions of PARTITION_LENGTH
+// coefficients. One FFT and one inverse FFT of length
+// (2 x PARTITION_LENGTH) are calculated per block so the latency is
+// one block, regardless of the filter length.
+// The results are compared with the time domain filter SDA_Fir.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define FILTER_LENGTH 16384
+#define PARTITION_LENGTH 256
+#define SAMPLE_LENGTH 32768
+
+// Declare global variables and arrays
+
+int main(void)
+{
+  SLFirPartitioned_s firPartitioned;
+  SLArrayIndex_t filterIndex;
+
+  SLData_t* pCoeffs = SUF_VectorArrayAllocate(FILTER_LENGTH);    // Allocate memory
+  SLData_t* pState = SUF_VectorArrayAllocate(FILTER_LENGTH);
+  SLData_t* pSrc = SUF_VectorArrayAllocate(SAMPLE_LENGTH);
+  SLData_t* pTimeDomainDst = SUF_VectorArrayAllocate(SAMPLE_LENGTH);
+  SLData_t* pPartitionedDst = SUF_VectorArrayAllocate(SAMPLE_LENGTH);
+
+  if ((NULL == pCoeffs) || (NULL == pState) || (NULL == pSrc) || (NULL == pTimeDomainDst) || (NULL == pPartitionedDst)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SIF_FirLowPassFilter(pCoeffs,                  // Filter coefficients array
+                       0.01,                     // Filter cut off frequency
+                       SIGLIB_HANNING_FILTER,    // Window type
+                       FILTER_LENGTH);           // Filter length
+
+  if (SIF_FirPartitioned(&firPartitioned,                           // Pointer to filter structure
+                         pCoeffs,                                   // Pointer to filter coefficients
+                         FILTER_LENGTH,                             // Filter length
+                         PARTITION_LENGTH) != SIGLIB_NO_ERROR) {    // Partition length
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SDA_SignalGenerate(pSrc,                    // Pointer to destination array
+                     SIGLIB_WHITE_NOISE,      // Signal type - random white noise
+                     SIGLIB_ONE,              // Signal peak level
+                     SIGLIB_FILL,             // Fill (overwrite) or add to existing array contents
+                     SIGLIB_ZERO,             // Signal frequency - Unused
+                     SIGLIB_ZERO,             // D.C. Offset
+                     SIGLIB_ZERO,             // Unused
+                     SIGLIB_ZERO,             // Signal end value - Unused
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     SAMPLE_LENGTH);          // Output dataset length
+
+  SIF_Fir(pState,            // Pointer to filter state array
+          &filterIndex,      // Pointer to filter index register
+          FILTER_LENGTH);    // Filter length
+
+  SDA_Fir(pSrc,              // Input array to be filtered
+          pTimeDomainDst,    // Filtered output array
+          pState,            // Pointer to filter state array
+          pCoeffs,           // Pointer to filter coefficients
+          &filterIndex,      // Pointer to filter index register
+          FILTER_LENGTH,     // Filter length
+          SAMPLE_LENGTH);    // Dataset length
+
+  SDA_FirPartitioned(pSrc,               // Pointer to source array
+                     pPartitionedDst,    // Pointer to destination array
+                     &firPartitioned,    // Pointer to filter structure
+                     SAMPLE_LENGTH);     // Number of samples to filter
+
+  // The partitioned filter output is delayed by one partition
+  SDA_Subtract2(pTimeDomainDst,                        // Pointer to source array 1
+                pPartitionedDst + PARTITION_LENGTH,    // Pointer to source array 2
+                pTimeDomainDst,                        // Pointer to destination array
+                SAMPLE_LENGTH - PARTITION_LENGTH);     // Dataset length
+
+  SLData_t maxError = SDA_AbsMax(pTimeDomainDst,                       // Pointer to source array
+                                 SAMPLE_LENGTH - PARTITION_LENGTH);    // Dataset length
+
+  printf("\n%d tap filter, %d sample partitions\n", FILTER_LENGTH, PARTITION_LENGTH);
+  printf("Maximum difference from SDA_Fir: %le\n", maxError);
+
+  SUF_FirPartitionedFree(&firPartitioned);    // Free the filter memory
+
+  SUF_MemoryFree(pCoeffs);    // Free memory
+  SUF_MemoryFree(pState);
+  SUF_MemoryFree(pSrc);
+  SUF_MemoryFree(pTimeDomainDst);
+  SUF_MemoryFree(pPartitionedDst);
+
+  return (0);
+}
@@ -0,0 +1,96 @@
+// SigLib Multi-Channel IIR Filter Example
+// A graphic equalizer of NUMBER_OF_BIQUADS peaking filters is applied
+// to NUMBER_OF_CHANNELS interleaved channels, each channel with its
+// own gains. SDA_IirMultiChannel filters one channel per SIMD lane and
+// gives the same results as SDA_Iir on each channel.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define NUMBER_OF_CHANNELS 64
+#define NUMBER_OF_BIQUADS 8
+#define SAMPLE_LENGTH 512
+#define SAMPLE_RATE_HZ 48000.
+
+// Declare global variables and arrays
+static const SLData_t centreFrequencies[NUMBER_OF_BIQUADS] = { 63., 125., 250., 500., 1000., 2000., 4000., 8000. };
+
+int main(void)
+{
+  SLData_t* pCoeffs = SUF_VectorArrayAllocate(SIGLIB_IIR_COEFFS_PER_BIQUAD * NUMBER_OF_BIQUADS * NUMBER_OF_CHANNELS);    // Allocate memory
+  SLData_t* pMultiChannelCoeffs = SUF_VectorArrayAllocate(SIGLIB_IIR_COEFFS_PER_BIQUAD * NUMBER_OF_BIQUADS * NUMBER_OF_CHANNELS);
+  SLData_t* pState = SUF_VectorArrayAllocate(SIGLIB_IIR_DELAY_SIZE * NUMBER_OF_BIQUADS * NUMBER_OF_CHANNELS);
+  SLData_t* pSingleChannelState = SUF_IirStateArrayAllocate(NUMBER_OF_BIQUADS);
+  SLData_t* pData = SUF_VectorArrayAllocate(SAMPLE_LENGTH * NUMBER_OF_CHANNELS);
+  SLData_t* pChannel = SUF_VectorArrayAllocate(SAMPLE_LENGTH);
+
+  if ((NULL == pCoeffs) || (NULL == pMultiChannelCoeffs) || (NULL == pState) || (NULL == pSingleChannelState) || (NULL == pData) ||
+      (NULL == pChannel)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  // Design the equalizer for each channel - SDA_Iir coefficient arrays, one after another
+  for (SLArrayIndex_t c = 0; c < NUMBER_OF_CHANNELS; c++) {
+    for (SLArrayIndex_t i = 0; i < NUMBER_OF_BIQUADS; i++) {
+      SIF_IirPeakingFilter(pCoeffs + (((c * NUMBER_OF_BIQUADS) + i) * SIGLIB_IIR_COEFFS_PER_BIQUAD),    // Pointer to filter coefficients
+                           centreFrequencies[i] / SAMPLE_RATE_HZ,                                       // Filter centre frequency
+                           SIGLIB_ONE,                                                                  // Filter Q factor
+                           (SLData_t)((c + i) % 13) - 6.);                                              // Filter gain (dB)
+    }
+  }
+
+  SIF_IirMultiChannel(pState,                 // Pointer to filter state array
+                      pMultiChannelCoeffs,    // Pointer to multi-channel coefficients array
+                      pCoeffs,                // Pointer to filter coefficients arrays, one per channel
+                      NUMBER_OF_BIQUADS,      // Number of biquads
+                      NUMBER_OF_CHANNELS);    // Number of channels
+
+  SDA_Zeros(pData, SAMPLE_LENGTH * NUMBER_OF_CHANNELS);
+  for (SLArrayIndex_t c = 0; c < NUMBER_OF_CHANNELS; c++) {    // Impulse on every channel
+    pData[c] = SIGLIB_ONE;
+  }
+
+  SDA_IirMultiChannel(pData,                  // Interleaved input array to be filtered
+                      pData,                  // Interleaved filtered output array
+                      pState,                 // Pointer to filter state array
+                      pMultiChannelCoeffs,    // Pointer to multi-channel coefficients array
+                      NUMBER_OF_BIQUADS,      // Number of biquads
+                      NUMBER_OF_CHANNELS,     // Number of channels
+                      SAMPLE_LENGTH);         // Number of samples per channel
+
+  // Compare the last channel with SDA_Iir
+  SIF_Iir(pSingleChannelState,                                                                        // Pointer to filter state array
+          NUMBER_OF_BIQUADS);                                                                         // Number of biquads
+  SDA_Impulse(pChannel,                                                                               // Pointer to destination array
+              SAMPLE_LENGTH);                                                                         // Output dataset length
+  SDA_Iir(pChannel,                                                                                   // Input array to be filtered
+          pChannel,                                                                                   // Filtered output array
+          pSingleChannelState,                                                                        // Pointer to filter state array
+          pCoeffs + ((NUMBER_OF_CHANNELS - 1) * NUMBER_OF_BIQUADS * SIGLIB_IIR_COEFFS_PER_BIQUAD),    // Pointer to filter coefficients array
+          NUMBER_OF_BIQUADS,                                                                          // Number of biquads
+          SAMPLE_LENGTH);                                                                             // Dataset length
+
+  SLData_t maxError = SIGLIB_ZERO;
+  for (SLArrayIndex_t n = 0; n < SAMPLE_LENGTH; n++) {
+    SLData_t Error = SDS_Abs(pData[(n * NUMBER_OF_CHANNELS) + NUMBER_OF_CHANNELS - 1] - pChannel[n]);
+    if (Error > maxError) {
+      maxError = Error;
+    }
+  }
+
+  printf("\n%d channels, %d biquads per channel\n", NUMBER_OF_CHANNELS, NUMBER_OF_BIQUADS);
+  printf("Maximum difference from SDA_Iir: %le\n", maxError);
+
+  SUF_MemoryFree(pCoeffs);    // Free memory
+  SUF_MemoryFree(pMultiChannelCoeffs);
+  SUF_MemoryFree(pState);
+  SUF_MemoryFree(pSingleChannelState);
+  SUF_MemoryFree(pData);
+  SUF_MemoryFree(pChannel);
+
+  return (0);
+}
@@ -33,11 +33,17 @@
 #define MATRIXI_COLS 3
 #define MATRIXI_SIZE (MATRIXI_ROWS * MATRIXI_COLS)
 
+#define LARGE_ROWS1 50    // Large enough for the blocked matrix multiply of SMX_Multiply2
+#define LARGE_COLUMNS1 300
+#define LARGE_COLUMNS2 37
+
 // Declare global variables and arrays
 static const SLData_t SrcReal2x2[] = {3.0, 1.0, 4.0, 2.0};
 
 static SLData_t DstReal2x2[4];
 
+static const SLData_t BadlyScaled2x2[] = {1.0, 1.0e20, 1.0, 1.0};    // Needs scaled partial pivoting
+
 static const SLComplexRect_s SrcComplex2x2[] = {
     //  {3.0, 0.0},                                             // Use these
     //  values to test the real component of the matrix inverse function
@@ -241,6 +247,54 @@ int main(void)
 
   printf("\nThe determinant of matrix D should be: 19\n");
 
+  // Invert a badly scaled matrix, the largest element in the first column is not the largest relative to its row
+  SigLibErrorCode = SMX_Inverse(BadlyScaled2x2,          // Pointer to source matrix
+                                DstReal2x2,              // Pointer to destination matrix
+                                pTempSourceArray,        // Temporary array for source
+                                pSubstituteIndex,        // Index substitution array
+                                pRowInterchangeIndex,    // Row interchange indices
+                                pScalingFactor,          // Scaling factor array
+                                2);                      // Number of rows and columns in matrix
+  if (SigLibErrorCode != SIGLIB_NO_ERROR) {
+    printf("SigLib Error Message:%s\n", SUF_StrError(SigLibErrorCode));
+  }
+  printf("\nInverse of badly scaled matrix = \n\t%le, %le\n\t%le, %le\n", DstReal2x2[0], DstReal2x2[1], DstReal2x2[2], DstReal2x2[3]);
+  printf("Inverse should be:\n\t-1.000000e-20, 1.000000e+00\n\t1.000000e-20, -1.000000e-20\n");
+
+  // The blocked matrix multiply must give the same results as the direct triple loop, whichever instruction set is selected at run time
+  SLData_t* pLarge1 = SUF_VectorArrayAllocate(LARGE_ROWS1 * LARGE_COLUMNS1);
+  SLData_t* pLarge2 = SUF_VectorArrayAllocate(LARGE_COLUMNS1 * LARGE_COLUMNS2);
+  SLData_t* pLargeProduct = SUF_VectorArrayAllocate(LARGE_ROWS1 * LARGE_COLUMNS2);
+  for (SLArrayIndex_t i = 0; i < (LARGE_ROWS1 * LARGE_COLUMNS1); i++) {
+    pLarge1[i] = (SLData_t)((i * 37) % 101) / 7.;
+  }
+  for (SLArrayIndex_t i = 0; i < (LARGE_COLUMNS1 * LARGE_COLUMNS2); i++) {
+    pLarge2[i] = (SLData_t)((i * 53) % 97) / 13. - 3.;
+  }
+  SMX_Multiply2(pLarge1,            // Pointer to source matrix 1
+                pLarge2,            // Pointer to source matrix 2
+                pLargeProduct,      // Pointer to destination matrix
+                LARGE_ROWS1,        // Number of rows matrix 1
+                LARGE_COLUMNS1,     // Number of columns matrix 1
+                LARGE_COLUMNS2);    // Number of columns matrix 2
+  SLArrayIndex_t MismatchCount = 0;
+  for (SLArrayIndex_t i = 0; i < LARGE_ROWS1; i++) {
+    for (SLArrayIndex_t j = 0; j < LARGE_COLUMNS2; j++) {
+      SLData_t Sum = SIGLIB_ZERO;
+      for (SLArrayIndex_t k = 0; k < LARGE_COLUMNS1; k++) {
+        volatile SLData_t Product = pLarge1[(i * LARGE_COLUMNS1) + k] * pLarge2[(k * LARGE_COLUMNS2) + j];    // Not contracted to an FMA
+        Sum += Product;
+      }
+      if (pLargeProduct[(i * LARGE_COLUMNS2) + j] != Sum) {
+        MismatchCount++;
+      }
+    }
+  }
+  printf("\nLarge matrix multiply: %d results differ from the direct triple loop, should be 0\n", (int)MismatchCount);
+  SUF_MemoryFree(pLarge1);
+  SUF_MemoryFree(pLarge2);
+  SUF_MemoryFree(pLargeProduct);
+
   // Create identity matrix (I)
   SMX_Identity(pMatrixi,         // Pointer to destination matrix
                MATRIXI_ROWS);    // Number of rows and columns in square matrix
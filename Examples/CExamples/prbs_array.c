@@ -0,0 +1,130 @@
+// SigLib Array PRBS Scrambler Example
+// Scrambles and descrambles a complete buffer in one call, using the array
+// versions of the PN15 and 1 + x-14 + x-17 scramblers and checks that the
+// results match the byte by byte functions.
+// Also checks the block 3GPP downlink long code generator against a bit by
+// bit generator, using a seed with bits above the 18 bit shift registers.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define BUFFER_LENGTH 4096
+#define PN9_SEQUENCE_LENGTH 511    // Bytes in one period of the PN9 sequence
+#define LONG_CODE_LENGTH 1000      // Chips in the long code comparison
+
+// Declare global variables and arrays
+static SLFixData_t Source[BUFFER_LENGTH];
+static SLFixData_t Scrambled[BUFFER_LENGTH];
+static SLFixData_t Descrambled[BUFFER_LENGTH];
+static SLFixData_t Sequence[2 * PN9_SEQUENCE_LENGTH];
+static SLComplexRect_s LongCode[LONG_CODE_LENGTH];
+
+// Bit by bit 3GPP downlink long code generator, for comparison
+static SLArrayIndex_t LongCodeGeneratorDLErrors(const SLComplexRect_s* pSrc, SLUInt32_t* pXShiftRegister, SLUInt32_t* pYShiftRegister,
+                                                const SLArrayIndex_t NumberOfSamples)
+{
+  SLUInt32_t SRXTmp = *pXShiftRegister;
+  SLUInt32_t SRYTmp = *pYShiftRegister;
+  SLArrayIndex_t Errors = 0;
+
+  for (SLArrayIndex_t i = 0; i < NumberOfSamples; i++) {
+    SLUInt32_t FXTmp = (SRXTmp >> 15U) ^ (SRXTmp >> 6U) ^ (SRXTmp >> 4U);
+    SLUInt32_t FYTmp = (SRYTmp >> 15U) ^ (SRYTmp >> 14U) ^ (SRYTmp >> 13U) ^ (SRYTmp >> 12U) ^ (SRYTmp >> 11U) ^ (SRYTmp >> 10U) ^ (SRYTmp >> 9U) ^
+                       (SRYTmp >> 8U) ^ (SRYTmp >> 6U) ^ (SRYTmp >> 5U);
+    if ((pSrc[i].real != (((SRXTmp ^ SRYTmp) & 0x1U) ? SIGLIB_MINUS_ONE : SIGLIB_ONE)) ||
+        (pSrc[i].imag != (((FXTmp ^ FYTmp) & 0x1U) ? SIGLIB_MINUS_ONE : SIGLIB_ONE))) {
+      Errors++;
+    }
+    SRXTmp |= ((SRXTmp ^ (SRXTmp >> 7U)) & 0x1U) << 18U;
+    SRXTmp >>= 1U;
+    SRYTmp |= ((SRYTmp ^ (SRYTmp >> 10U) ^ (SRYTmp >> 7U) ^ (SRYTmp >> 5U)) & 0x1U) << 18U;
+    SRYTmp >>= 1U;
+  }
+  *pXShiftRegister = SRXTmp;
+  *pYShiftRegister = SRYTmp;
+  return (Errors);
+}
+
+int main(void)
+{
+  SLUInt32_t TxShiftRegister, RxShiftRegister;
+  SLArrayIndex_t Errors;
+
+  for (SLArrayIndex_t i = 0; i < BUFFER_LENGTH; i++) {    // Generate the source data
+    Source[i] = (SLFixData_t)(rand() & 0xFF);
+  }
+
+  TxShiftRegister = 0x7FFF;    // Seed the shift registers
+  RxShiftRegister = 0x7FFF;
+  SDA_ScramblerDescramblerPN15(Source,              // Pointer to source array
+                               Scrambled,           // Pointer to destination array
+                               &TxShiftRegister,    // Shift register
+                               BUFFER_LENGTH);      // Array length
+  SDA_ScramblerDescramblerPN15(Scrambled,           // Pointer to source array
+                               Descrambled,         // Pointer to destination array
+                               &RxShiftRegister,    // Shift register
+                               BUFFER_LENGTH);      // Array length
+
+  Errors = 0;
+  TxShiftRegister = 0x7FFF;
+  for (SLArrayIndex_t i = 0; i < BUFFER_LENGTH; i++) {    // Compare with the byte by byte scrambler
+    if ((Scrambled[i] != SDS_ScramblerDescramblerPN15(Source[i], &TxShiftRegister)) || (Descrambled[i] != Source[i])) {
+      Errors++;
+    }
+  }
+  printf("PN15 scrambler errors       = %d\n", Errors);
+
+  TxShiftRegister = 0;    // Clear the shift registers
+  RxShiftRegister = 0;
+  SDA_Scrambler1417(Source,              // Pointer to source array
+                    Scrambled,           // Pointer to destination array
+                    &TxShiftRegister,    // Shift register
+                    BUFFER_LENGTH);      // Array length
+  SDA_Descrambler1417(Scrambled,           // Pointer to source array
+                      Descrambled,         // Pointer to destination array
+                      &RxShiftRegister,    // Shift register
+                      BUFFER_LENGTH);      // Array length
+
+  Errors = 0;
+  TxShiftRegister = 0;
+  for (SLArrayIndex_t i = 0; i < BUFFER_LENGTH; i++) {    // Compare with the byte by byte scrambler
+    if ((Scrambled[i] != SDS_Scrambler1417(Source[i], &TxShiftRegister)) || (Descrambled[i] != Source[i])) {
+      Errors++;
+    }
+  }
+  printf("1417 scrambler errors       = %d\n", Errors);
+
+  TxShiftRegister = 1;    // Seed the shift register
+  SDA_SequenceGeneratorPN9(Sequence,                    // Pointer to destination array
+                           &TxShiftRegister,            // Shift register
+                           2 * PN9_SEQUENCE_LENGTH);    // Array length
+
+  Errors = 0;
+  for (SLArrayIndex_t i = 0; i < PN9_SEQUENCE_LENGTH; i++) {    // 511 bytes contain 8 periods of the 511 bit sequence
+    if (Sequence[i] != Sequence[i + PN9_SEQUENCE_LENGTH]) {
+      Errors++;
+    }
+  }
+  printf("PN9 sequence period errors  = %d\n", Errors);
+
+  SLUInt32_t XShiftRegister = 0x12345678U;    // Seeds with bits above the shift registers
+  SLUInt32_t YShiftRegister = 0xFFFFFFFFU;
+  SLUInt32_t XShiftRegisterRef = XShiftRegister;
+  SLUInt32_t YShiftRegisterRef = YShiftRegister;
+  SDS_LongCodeGenerator3GPPDL(LongCode,             // Pointer to destination array
+                              &XShiftRegister,      // X shift register
+                              &YShiftRegister,      // Y shift register
+                              LONG_CODE_LENGTH);    // Array length
+
+  Errors = LongCodeGeneratorDLErrors(LongCode, &XShiftRegisterRef, &YShiftRegisterRef, LONG_CODE_LENGTH);
+  if ((XShiftRegister != XShiftRegisterRef) || (YShiftRegister != YShiftRegisterRef)) {
+    Errors++;
+  }
+  printf("3GPP DL long code errors    = %d\n", Errors);
+
+  return (0);
+}
@@ -0,0 +1,169 @@
+// SigLib Multi-channel QPSK And 16-QAM Modem Example
+// A bank of QPSK channels and a bank of 16-QAM channels are modulated and
+// demodulated, a block of symbols per call, and the received symbols are
+// compared with the transmitted symbols.
+// The channels are distributed across the parallel executor registered with
+// SUF_SetParallelFor, this example uses OpenMP when it is enabled.
+//     Baud rate - 600 Baud
+//     Sample rate - 9600 Hz
+//     Carrier freq. - 2400 Hz
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define NUMBER_OF_CHANNELS 256
+#define NUMBER_OF_LOOPS 16
+#define SYMBOLS_PER_LOOP 64    // Number of symbols per channel per call
+
+#define SAMPLE_RATE_HZ 9600.    // Sample rate
+#define BAUD_RATE 600.          // Baud rate
+
+#define CARRIER_TABLE_FREQ 100.    // Frequency of sine wave in table
+#define CARRIER_FREQ 2400.         // Frequency of carrier signal - a multiple of the sine table frequency
+
+#define RRCF_ENABLE 1                               // Root raised cosine filter on Tx and Rx
+#define RRCF_PERIOD (SAMPLE_RATE_HZ / BAUD_RATE)    // RRCF Period
+#define RRCF_ROLL_OFF 0.75                          // Root raised cosine filter roll off factor
+#define RRCF_LENGTH 81                              // Root raised cosine filter length
+#define SYMBOL_DELAY 5                              // Tx to Rx delay (# symbols)
+
+#define SYMBOL_LENGTH ((SLArrayIndex_t)(SAMPLE_RATE_HZ / BAUD_RATE))                       // Number of samples per symbol
+#define CARRIER_SINE_TABLE_SIZE ((SLArrayIndex_t)(SAMPLE_RATE_HZ / CARRIER_TABLE_FREQ))    // Number of samples in each of cos and sine table
+#define CARRIER_TABLE_INCREMENT ((SLArrayIndex_t)(CARRIER_FREQ / CARRIER_TABLE_FREQ))      // Carrier frequency
+
+#define TOTAL_SYMBOLS (NUMBER_OF_LOOPS * SYMBOLS_PER_LOOP)
+
+// Declare global variables and arrays
+
+#ifdef _OPENMP
+static void OpenMPParallelFor(SLParallelTask_t pTask, void* pContext, SLArrayIndex_t numberOfTasks)
+{
+#  pragma omp parallel for schedule(dynamic)
+  for (SLArrayIndex_t i = 0; i < numberOfTasks; i++) {
+    pTask(pContext, i);
+  }
+}
+#endif
+
+// Run the Tx and Rx banks of one modem type and return the number of symbol errors
+static SLArrayIndex_t RunModem(const SLFixData_t symbolMask, SLFixData_t* pTxSymbols, SLFixData_t* pRxSymbols, SLFixData_t* pTxHistory,
+                               SLFixData_t* pRxHistory, SLData_t* pModulatedSignal)
+{
+  SLQamModemMultiChannel_s txModem, rxModem;
+  SLFixData_t PreviousTxDiBit[NUMBER_OF_CHANNELS];    // Differential encoding variables
+  SLFixData_t PreviousRxDiBit[NUMBER_OF_CHANNELS];
+
+  for (SLArrayIndex_t c = 0; c < NUMBER_OF_CHANNELS; c++) {
+    PreviousTxDiBit[c] = 0;
+    PreviousRxDiBit[c] = 0;
+  }
+
+  if (SIF_QamModulateMultiChannel(&txModem,                                 // Pointer to modem structure
+                                  CARRIER_TABLE_FREQ / SAMPLE_RATE_HZ,      // Carrier phase increment per sample (radians / 2π)
+                                  CARRIER_SINE_TABLE_SIZE,                  // Carrier sine table size
+                                  CARRIER_TABLE_INCREMENT,                  // Carrier table increment
+                                  SYMBOL_LENGTH,                            // Samples per symbol
+                                  RRCF_PERIOD,                              // RRCF Period
+                                  RRCF_ROLL_OFF,                            // RRCF Roll off
+                                  RRCF_LENGTH,                              // RRCF size
+                                  RRCF_ENABLE,                              // RRCF enable / disable switch
+                                  NUMBER_OF_CHANNELS) != SIGLIB_NO_ERROR) {    // Number of channels
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  if (SIF_QamDemodulateMultiChannel(&rxModem,                                 // Pointer to modem structure
+                                    CARRIER_TABLE_FREQ / SAMPLE_RATE_HZ,      // Carrier phase increment per sample (radians / 2π)
+                                    CARRIER_SINE_TABLE_SIZE,                  // Carrier sine table size
+                                    CARRIER_TABLE_INCREMENT,                  // Carrier table increment
+                                    SYMBOL_LENGTH,                            // Samples per symbol
+                                    RRCF_PERIOD,                              // RRCF Period
+                                    RRCF_ROLL_OFF,                            // RRCF Roll off
+                                    RRCF_LENGTH,                              // RRCF size
+                                    RRCF_ENABLE,                              // RRCF enable / disable switch
+                                    NUMBER_OF_CHANNELS) != SIGLIB_NO_ERROR) {    // Number of channels
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  for (SLArrayIndex_t LoopCount = 0; LoopCount < NUMBER_OF_LOOPS; LoopCount++) {
+    for (SLArrayIndex_t c = 0; c < NUMBER_OF_CHANNELS; c++) {    // Random symbols for every channel
+      for (SLArrayIndex_t s = 0; s < SYMBOLS_PER_LOOP; s++) {
+        SLFixData_t TxSymbol = (SLFixData_t)rand() & symbolMask;
+        pTxHistory[(c * TOTAL_SYMBOLS) + (LoopCount * SYMBOLS_PER_LOOP) + s] = TxSymbol;
+        if (symbolMask == SIGLIB_QPSK_BIT_MASK) {    // The QPSK constellation is resolved by differential encoding
+          TxSymbol = SDS_QpskDifferentialEncode(TxSymbol, PreviousTxDiBit + c);
+        }
+        pTxSymbols[(c * SYMBOLS_PER_LOOP) + s] = TxSymbol;
+      }
+    }
+
+    if (symbolMask == SIGLIB_QPSK_BIT_MASK) {
+      SDA_QpskModulateMultiChannel(pTxSymbols, pModulatedSignal, &txModem, SYMBOLS_PER_LOOP);
+      SDA_QpskDemodulateMultiChannel(pModulatedSignal, pRxSymbols, &rxModem, SYMBOLS_PER_LOOP);
+    } else {
+      SDA_Qam16ModulateMultiChannel(pTxSymbols, pModulatedSignal, &txModem, SYMBOLS_PER_LOOP);
+      SDA_Qam16DemodulateMultiChannel(pModulatedSignal, pRxSymbols, &rxModem, SYMBOLS_PER_LOOP);
+    }
+
+    for (SLArrayIndex_t c = 0; c < NUMBER_OF_CHANNELS; c++) {    // Save the received symbols of each channel
+      for (SLArrayIndex_t s = 0; s < SYMBOLS_PER_LOOP; s++) {
+        SLFixData_t RxSymbol = pRxSymbols[(c * SYMBOLS_PER_LOOP) + s];
+        if (symbolMask == SIGLIB_QPSK_BIT_MASK) {
+          RxSymbol = SDS_QpskDifferentialDecode(RxSymbol, PreviousRxDiBit + c);
+        }
+        pRxHistory[(c * TOTAL_SYMBOLS) + (LoopCount * SYMBOLS_PER_LOOP) + s] = RxSymbol;
+      }
+    }
+  }
+
+  SLArrayIndex_t ErrorCount = 0;
+  for (SLArrayIndex_t c = 0; c < NUMBER_OF_CHANNELS; c++) {    // Compare, allowing for the Tx to Rx delay
+    for (SLArrayIndex_t s = 1; s < (TOTAL_SYMBOLS - SYMBOL_DELAY); s++) {    // The first symbol is the differential decoder reference
+      if (pTxHistory[(c * TOTAL_SYMBOLS) + s] != pRxHistory[(c * TOTAL_SYMBOLS) + s + SYMBOL_DELAY]) {
+        ErrorCount++;
+      }
+    }
+  }
+
+  SUF_QamModemMultiChannelFree(&txModem);    // Free the modem memory
+  SUF_QamModemMultiChannelFree(&rxModem);
+
+  return (ErrorCount);
+}
+
+int main(void)
+{
+  SLFixData_t* pTxSymbols = SUF_FixDataArrayAllocate(NUMBER_OF_CHANNELS * SYMBOLS_PER_LOOP);    // Allocate memory
+  SLFixData_t* pRxSymbols = SUF_FixDataArrayAllocate(NUMBER_OF_CHANNELS * SYMBOLS_PER_LOOP);
+  SLFixData_t* pTxHistory = SUF_FixDataArrayAllocate(NUMBER_OF_CHANNELS * TOTAL_SYMBOLS);
+  SLFixData_t* pRxHistory = SUF_FixDataArrayAllocate(NUMBER_OF_CHANNELS * TOTAL_SYMBOLS);
+  SLData_t* pModulatedSignal = SUF_VectorArrayAllocate(NUMBER_OF_CHANNELS * SYMBOLS_PER_LOOP * SYMBOL_LENGTH);
+
+  if ((NULL == pTxSymbols) || (NULL == pRxSymbols) || (NULL == pTxHistory) || (NULL == pRxHistory) || (NULL == pModulatedSignal)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+#ifdef _OPENMP
+  SUF_SetParallelFor(OpenMPParallelFor);    // Register the parallel executor
+#endif
+
+  printf("\n%d channels, %d symbols per channel\n", NUMBER_OF_CHANNELS, TOTAL_SYMBOLS);
+  printf("QPSK symbol errors   = %d\n",
+         RunModem(SIGLIB_QPSK_BIT_MASK, pTxSymbols, pRxSymbols, pTxHistory, pRxHistory, pModulatedSignal));
+  printf("16-QAM symbol errors = %d\n",
+         RunModem(SIGLIB_QAM16_BIT_MASK, pTxSymbols, pRxSymbols, pTxHistory, pRxHistory, pModulatedSignal));
+
+  SUF_MemoryFree(pTxSymbols);    // Free memory
+  SUF_MemoryFree(pRxSymbols);
+  SUF_MemoryFree(pTxHistory);
+  SUF_MemoryFree(pRxHistory);
+  SUF_MemoryFree(pModulatedSignal);
+
+  return (0);
+}
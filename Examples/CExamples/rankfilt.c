@@ -0,0 +1,89 @@
+// SigLib Running Median / Rank Order Filter Example
+// Impulsive noise is added to a sine wave, which is then filtered,
+// one block at a time, with a running median filter.
+// The filter window is kept in the filter structure so the output is
+// independent of the block length.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define WINDOW_LENGTH 9
+#define MEDIAN_RANK ((WINDOW_LENGTH - 1) / 2)    // Rank of the median sample, the filter delay
+#define SAMPLE_LENGTH 4000
+#define BLOCK_LENGTH 100                         // SAMPLE_LENGTH is a multiple of BLOCK_LENGTH
+#define IMPULSE_PROBABILITY 50                   // One impulse in IMPULSE_PROBABILITY samples, on average
+#define IMPULSE_LEVEL 5.0
+
+int main(void)
+{
+  SLRankFilter_s rankFilter;
+  SLData_t sinePhase = SIGLIB_ZERO;
+
+  SLData_t* pClean = SUF_VectorArrayAllocate(SAMPLE_LENGTH);    // Allocate memory
+  SLData_t* pNoisy = SUF_VectorArrayAllocate(SAMPLE_LENGTH);
+  SLData_t* pFiltered = SUF_VectorArrayAllocate(SAMPLE_LENGTH);
+
+  if ((NULL == pClean) || (NULL == pNoisy) || (NULL == pFiltered)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  if (SIF_RankFilter(&rankFilter,                          // Pointer to filter structure
+                     WINDOW_LENGTH,                        // Window length
+                     MEDIAN_RANK) != SIGLIB_NO_ERROR) {    // Rank of output sample
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SDA_SignalGenerate(pClean,                  // Pointer to destination array
+                     SIGLIB_SINE_WAVE,        // Signal type - Sine wave
+                     0.9,                     // Signal peak level
+                     SIGLIB_FILL,             // Fill (overwrite) or add to existing array contents
+                     0.005,                   // Signal frequency
+                     SIGLIB_ZERO,             // D.C. Offset
+                     SIGLIB_ZERO,             // Unused
+                     SIGLIB_ZERO,             // Signal end value - Unused
+                     &sinePhase,              // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     SAMPLE_LENGTH);          // Output dataset length
+
+  SLArrayIndex_t impulseCount = 0;
+  for (SLArrayIndex_t i = 0; i < SAMPLE_LENGTH; i++) {
+    pNoisy[i] = pClean[i];
+    if ((rand() % IMPULSE_PROBABILITY) == 0) {
+      pNoisy[i] += (rand() & 1) ? IMPULSE_LEVEL : -IMPULSE_LEVEL;
+      impulseCount++;
+    }
+  }
+
+  for (SLArrayIndex_t i = 0; i < SAMPLE_LENGTH; i += BLOCK_LENGTH) {
+    SDA_RankFilter(pNoisy + i,       // Pointer to source array
+                   pFiltered + i,    // Pointer to destination array
+                   &rankFilter,      // Pointer to filter structure
+                   BLOCK_LENGTH);    // Sample length
+  }
+
+  // Compare the filter output with the clean signal, delayed by the filter delay
+  SLData_t noisyError = SIGLIB_ZERO;
+  SLData_t filteredError = SIGLIB_ZERO;
+  for (SLArrayIndex_t i = WINDOW_LENGTH; i < SAMPLE_LENGTH; i++) {
+    noisyError = SDS_MaxMacro(noisyError, SDS_Absolute(pNoisy[i] - pClean[i]));
+    filteredError = SDS_MaxMacro(filteredError, SDS_Absolute(pFiltered[i] - pClean[i - MEDIAN_RANK]));
+  }
+
+  printf("\nWindow length = %d, %d impulses\n", WINDOW_LENGTH, impulseCount);
+  printf("Peak error before filtering = %lf\n", noisyError);
+  printf("Peak error after filtering  = %lf\n", filteredError);
+
+  SUF_RankFilterFree(&rankFilter);    // Free the filter memory
+
+  SUF_MemoryFree(pClean);    // Free memory
+  SUF_MemoryFree(pNoisy);
+  SUF_MemoryFree(pFiltered);
+
+  return (0);
+}
@@ -0,0 +1,102 @@
+// SigLib K = 7 (171,133), Rate 1/2 Convolutional Encoder / Generic Viterbi Decoder Example
+// The message is encoded with SDA_ConvEncoder, noise is added to the
+// channel symbols and the symbols are decoded with SDA_ViterbiDecoder.
+// The decoder outputs a block of bits after each trace back so the
+// remaining bits are decoded with SDA_ViterbiDecoderFlush.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define CONSTRAINT_LENGTH 7
+#define NUMBER_OF_POLYNOMIALS 2
+#define TRACE_BACK_DEPTH (5 * CONSTRAINT_LENGTH)    // Trace back depth - 5 * K
+#define MESSAGE_LENGTH 4096                         // Number of bytes in the message
+#define NOISE_LEVEL 1.2                             // Peak level of the channel noise
+#define SYMBOL_LENGTH (MESSAGE_LENGTH * SIGLIB_BYTE_LENGTH * NUMBER_OF_POLYNOMIALS)
+
+// Declare global variables and arrays
+static const SLUInt32_t Polynomials[NUMBER_OF_POLYNOMIALS] = {0171, 0133};
+
+int main(void)
+{
+  SLViterbiDecoder_s viterbiDecoder;
+  SLUInt32_t encoderState = 0;
+
+  SLChar_t* pMessage = (SLChar_t*)SUF_MemoryAllocate(MESSAGE_LENGTH);    // Allocate memory
+  SLChar_t* pDecoded = (SLChar_t*)SUF_MemoryAllocate(MESSAGE_LENGTH + SIGLIB_VITERBI_BLOCK_LENGTH);
+  SLData_t* pChannel = SUF_VectorArrayAllocate(SYMBOL_LENGTH);
+  SLData_t* pNoise = SUF_VectorArrayAllocate(SYMBOL_LENGTH);
+
+  if ((NULL == pMessage) || (NULL == pDecoded) || (NULL == pChannel) || (NULL == pNoise)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  for (SLArrayIndex_t i = 0; i < MESSAGE_LENGTH; i++) {
+    pMessage[i] = (SLChar_t)rand();
+  }
+
+  if (SIF_ViterbiDecoder(&viterbiDecoder,                           // Pointer to decoder
+                         Polynomials,                               // Pointer to polynomials
+                         NUMBER_OF_POLYNOMIALS,                     // Number of polynomials
+                         CONSTRAINT_LENGTH,                         // Constraint length
+                         TRACE_BACK_DEPTH) != SIGLIB_NO_ERROR) {    // Trace back depth
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SDA_ConvEncoder(pMessage,                 // Pointer to source bytes
+                  pChannel,                 // Pointer to destination soft decision symbols
+                  Polynomials,              // Pointer to polynomials
+                  NUMBER_OF_POLYNOMIALS,    // Number of polynomials
+                  CONSTRAINT_LENGTH,        // Constraint length
+                  &encoderState,            // Pointer to encoder state
+                  MESSAGE_LENGTH);          // Number of source bytes
+
+  SDA_SignalGenerate(pNoise,                  // Pointer to destination array
+                     SIGLIB_WHITE_NOISE,      // Signal type - random white noise
+                     NOISE_LEVEL,             // Signal peak level
+                     SIGLIB_FILL,             // Fill (overwrite) or add to existing array contents
+                     SIGLIB_ZERO,             // Signal frequency - Unused
+                     SIGLIB_ZERO,             // D.C. Offset
+                     SIGLIB_ZERO,             // Unused
+                     SIGLIB_ZERO,             // Signal end value - Unused
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     SIGLIB_NULL_DATA_PTR,    // Unused
+                     SYMBOL_LENGTH);          // Output dataset length
+
+  SDA_Add2(pChannel,          // Pointer to source array 1
+           pNoise,            // Pointer to source array 2
+           pChannel,          // Pointer to destination array
+           SYMBOL_LENGTH);    // Dataset length
+
+  SLArrayIndex_t decodedLength = SDA_ViterbiDecoder(pChannel,           // Pointer to source soft decision symbols
+                                                    pDecoded,           // Pointer to destination bytes
+                                                    &viterbiDecoder,    // Pointer to decoder
+                                                    MESSAGE_LENGTH);    // Number of source bytes
+  decodedLength += SDA_ViterbiDecoderFlush(pDecoded + decodedLength,    // Pointer to destination bytes
+                                           &viterbiDecoder);            // Pointer to decoder
+
+  SLArrayIndex_t bitErrors = 0;
+  for (SLArrayIndex_t i = 0; i < decodedLength; i++) {
+    for (SLArrayIndex_t j = 0; j < SIGLIB_BYTE_LENGTH; j++) {
+      bitErrors += (((SLUFixData_t)(pDecoded[i] ^ pMessage[i])) >> (SLUFixData_t)j) & 1U;
+    }
+  }
+
+  printf("\nK = %d, rate 1/%d, trace back depth = %d\n", CONSTRAINT_LENGTH, NUMBER_OF_POLYNOMIALS, TRACE_BACK_DEPTH);
+  printf("Decoded %d of %d bytes, %d bit errors\n", decodedLength, MESSAGE_LENGTH, bitErrors);
+
+  SUF_ViterbiDecoderFree(&viterbiDecoder);    // Free the decoder memory
+
+  SUF_MemoryFree(pMessage);    // Free memory
+  SUF_MemoryFree(pDecoded);
+  SUF_MemoryFree(pChannel);
+  SUF_MemoryFree(pNoise);
+
+  return (0);
+}
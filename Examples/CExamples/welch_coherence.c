@@ -0,0 +1,108 @@
+// SigLib Welch Power Spectrum And Coherence Example
+// A tone in noise is measured by two sensors, each with its own noise.
+// The Welch power spectrum of the first sensor and the magnitude squared
+// coherence between the two sensors are averaged over the whole capture.
+// The segments are split into shards that are distributed across the
+// parallel executor registered with SUF_SetParallelFor, this example uses
+// OpenMP when it is enabled.
+// Copyright (c) 2026 Delta Numerix All rights reserved.
+
+// Include files
+#include <stdio.h>
+#include <stdlib.h>
+#include <siglib.h>    // SigLib DSP library
+
+// Define constants
+#define SAMPLE_RATE 100000.
+#define CAPTURE_LENGTH 1000000                   // 10 seconds
+#define FFT_LENGTH 4096
+#define OVERLAP_LENGTH (FFT_LENGTH / 2)          // 50 % overlap
+#define RESULT_LENGTH ((FFT_LENGTH >> 1) + 1)    // Note the result length is N/2+1
+#define NUMBER_OF_SHARDS 8                       // Normally the number of threads
+#define TONE_FREQUENCY 1250.                     // Tone frequency (Hz)
+#define TONE_BIN ((SLArrayIndex_t)((TONE_FREQUENCY * FFT_LENGTH) / SAMPLE_RATE))
+
+// Declare global variables and arrays
+
+#ifdef _OPENMP
+static void OpenMPParallelFor(SLParallelTask_t pTask, void* pContext, SLArrayIndex_t numberOfTasks)
+{
+#  pragma omp parallel for schedule(dynamic)
+  for (SLArrayIndex_t i = 0; i < numberOfTasks; i++) {
+    pTask(pContext, i);
+  }
+}
+#endif
+
+int main(void)
+{
+  SLWelch_s welch;
+  SLData_t sinePhase = SIGLIB_ZERO;
+
+  SLData_t* pSensor1 = SUF_VectorArrayAllocate(CAPTURE_LENGTH);    // Allocate memory
+  SLData_t* pSensor2 = SUF_VectorArrayAllocate(CAPTURE_LENGTH);
+  SLData_t* pPowerSpectrum = SUF_VectorArrayAllocate(RESULT_LENGTH);
+  SLData_t* pCoherence = SUF_VectorArrayAllocate(RESULT_LENGTH);
+
+  if ((NULL == pSensor1) || (NULL == pSensor2) || (NULL == pPowerSpectrum) || (NULL == pCoherence)) {
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+#ifdef _OPENMP
+  SUF_SetParallelFor(OpenMPParallelFor);    // Register the parallel executor
+#endif
+
+  if (SIF_Welch(&welch,                                    // Pointer to Welch structure
+                SIGLIB_HANNING_FOURIER,                    // Window type
+                SIGLIB_ZERO,                               // Window coefficient
+                FFT_LENGTH,                                // FFT length
+                OVERLAP_LENGTH,                            // Overlap between segments
+                NUMBER_OF_SHARDS) != SIGLIB_NO_ERROR) {    // Number of shards
+    printf("\n\nMemory allocation failed\n\n");
+    exit(0);
+  }
+
+  SDA_SignalGenerate(pSensor1,                        // Pointer to destination array
+                     SIGLIB_SINE_WAVE,                // Signal type - Sine wave
+                     SIGLIB_HALF,                     // Signal peak level
+                     SIGLIB_FILL,                     // Fill (overwrite) or add to existing array contents
+                     TONE_FREQUENCY / SAMPLE_RATE,    // Signal frequency
+                     SIGLIB_ZERO,                     // D.C. Offset
+                     SIGLIB_ZERO,                     // Unused
+                     SIGLIB_ZERO,                     // Signal end value - Unused
+                     &sinePhase,                      // Signal phase - maintained across array boundaries
+                     SIGLIB_NULL_DATA_PTR,            // Unused
+                     CAPTURE_LENGTH);                 // Output dataset length
+  SDA_Copy(pSensor1, pSensor2, CAPTURE_LENGTH);
+
+  for (SLArrayIndex_t i = 0; i < CAPTURE_LENGTH; i++) {    // Add independent noise to each sensor
+    pSensor1[i] += ((SLData_t)rand() / (SLData_t)RAND_MAX) - SIGLIB_HALF;
+    pSensor2[i] += ((SLData_t)rand() / (SLData_t)RAND_MAX) - SIGLIB_HALF;
+  }
+
+  SLArrayIndex_t numberOfSegments = SDA_WelchPowerSpectrum(pSensor1,           // Pointer to source array
+                                                           pPowerSpectrum,     // Pointer to destination array
+                                                           &welch,             // Pointer to Welch structure
+                                                           CAPTURE_LENGTH);    // Source array length
+
+  SDA_WelchCoherence(pSensor1,           // Pointer to source array 1
+                     pSensor2,           // Pointer to source array 2
+                     pCoherence,         // Pointer to destination array
+                     &welch,             // Pointer to Welch structure
+                     CAPTURE_LENGTH);    // Source array length
+
+  printf("\n%d segments averaged\n", numberOfSegments);
+  printf("Peak power spectrum bin = %d (tone bin = %d)\n", SDA_AbsMaxIndex(pPowerSpectrum, RESULT_LENGTH), TONE_BIN);
+  printf("Coherence at the tone = %lf\n", pCoherence[TONE_BIN]);
+  printf("Mean coherence        = %lf\n", SDA_Mean(pCoherence, SIGLIB_ONE / RESULT_LENGTH, RESULT_LENGTH));
+
+  SUF_WelchFree(&welch);    // Free the Welch memory
+
+  SUF_MemoryFree(pSensor1);    // Free memory
+  SUF_MemoryFree(pSensor2);
+  SUF_MemoryFree(pPowerSpectrum);
+  SUF_MemoryFree(pCoherence);
+
+  return (0);
+}
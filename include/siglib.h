@@ -48,7 +48,20 @@ Update history:
 #  ifndef SIGLIB_ENABLE_DEBUG_LOGGING
 #    define SIGLIB_ENABLE_DEBUG_LOGGING 0    // Set to 1 to enable SUF_Debugfprintf functions in some SigLib functions
 #  endif
+#  ifndef SIGLIB_ENABLE_PROFILING
+#    define SIGLIB_ENABLE_PROFILING 0    // Set to 1 to record call counts and latency histograms for the profiled functions
+#  endif
 #  define SIGLIB_LOG_FILE "siglib_debug.log"    // Filename for SigLib logging functions
+#  ifndef SIGLIB_DEBUG_TRACE
+#    define SIGLIB_DEBUG_TRACE 0    // Set to 1 for SUF_Debugfprintf to write binary records to SIGLIB_TRACE_FILE
+#  endif
+#  ifndef SIGLIB_DEBUG_TRACE_BUFFER_LENGTH
+#    define SIGLIB_DEBUG_TRACE_BUFFER_LENGTH 1048576U    // Bytes in each per thread trace buffer - must be a power of 2
+#  endif
+#  ifndef SIGLIB_DEBUG_TRACE_HIGH_WATER
+#    define SIGLIB_DEBUG_TRACE_HIGH_WATER (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH / 2U)    // Bytes in a trace buffer that wake the background flusher
+#  endif
+#  define SIGLIB_TRACE_FILE "siglib_debug.trace"    // Filename for the SUF_Debugfprintf binary trace
 
 #  ifndef SWIG
 #    include <ctype.h>     // Include standard ctype.h file
@@ -121,6 +134,11 @@ void SIGLIB_FUNC_DECL SUF_PrintLower(const SLData_t, const SLData_t, const char*
 SLError_t SIGLIB_FUNC_DECL SUF_ClearDebugfprintf(void);
 SLError_t SIGLIB_FUNC_DECL SUF_Debugfprintf(const char* ArgumentType, ...);
 SLError_t SIGLIB_FUNC_DECL SUF_Debugvfprintf(const char* format, va_list);
+SLError_t SIGLIB_FUNC_DECL SUF_DebugFunctionfprintf(const char* pFunctionName, const char* format, ...);
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceFlush(void);
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceStartFlusher(const SLArrayIndex_t periodMs);
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceStopFlusher(void);
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceDecode(const char*, const char*, const SLFixData_t);
 SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintArray(const SLData_t*, const SLArrayIndex_t);
 SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintFixedPointArray(const SLArrayIndex_t*, const SLArrayIndex_t);
 SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintComplexArray(const SLData_t*, const SLData_t*, const SLArrayIndex_t);
@@ -134,6 +152,9 @@ SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintIIRCoefficients(const SLData_t*, SLArra
 SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintCount(const char* String);
 SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintHigher(const SLData_t, const SLData_t, const char*);
 SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintLower(const SLData_t, const SLData_t, const char*);
+#  if (SIGLIB_DEBUG_TRACE == 1)    // Record the name of the logging function in the binary trace
+#    define SUF_Debugfprintf(...) SUF_DebugFunctionfprintf(__func__, __VA_ARGS__)
+#  endif
 #  define SUF_DebugPrintInfo() SUF_Debugfprintf("SigLib Version: %2.2lf\n", SIGLIB_VERSION);
 #  define SUF_DebugPrintLine() SUF_Debugfprintf("SigLib Debug - File: %s, Line #: %d\n", __FILE__, __LINE__);
 #  define SUF_DebugPrintTime()                                                    \
@@ -143,6 +164,19 @@ SLError_t SIGLIB_FUNC_DECL SUF_DebugPrintLower(const SLData_t, const SLData_t, c
       SUF_Debugfprintf("SigLib Debug - Time: %s\n", asctime(localtime(&aclock))); \
     }
 const char* SUF_StrError(const SLError_t ErrNo);
+void SIGLIB_FUNC_DECL SUF_SetParallelFor(SLParallelFor_t);
+void SIGLIB_FUNC_DECL SUF_ParallelFor(SLParallelTask_t, void*, const SLArrayIndex_t);
+SLUInt64_t SIGLIB_FUNC_DECL SUF_ProfileTicks(void);
+void SIGLIB_FUNC_DECL SUF_ProfileRecord(const enum SLProfileFunction_t, const SLUInt64_t);
+void SIGLIB_FUNC_DECL SUF_ProfileReset(void);
+SLError_t SIGLIB_FUNC_DECL SUF_ProfileDump(const char*);
+#  if SIGLIB_ENABLE_PROFILING
+#    define SIGLIB_PROFILE_START(Function) const SLUInt64_t siglib_numerix_ProfileStartTicks = SUF_ProfileTicks()
+#    define SIGLIB_PROFILE_END(Function) SUF_ProfileRecord(Function, SUF_ProfileTicks() - siglib_numerix_ProfileStartTicks)
+#  else
+#    define SIGLIB_PROFILE_START(Function)    // Profiling compiles to nothing
+#    define SIGLIB_PROFILE_END(Function)
+#  endif
 
 // file_io.c
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinReadData(SLData_t SIGLIB_OUTPUT_PTR_DECL*, FILE*, const enum SLEndianType_t,
@@ -253,6 +287,43 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavWriteFileScaled(const SLData_t SIGLIB_INP
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_XmtReadData(SLData_t*, FILE*,
                                                 const SLArrayIndex_t);    // Functions for reading and writing .xmt files
 
+SLError_t SIGLIB_FUNC_DECL SUF_SampleFileOpen(SLSampleFile_s*,                // Pointer to sample file structure
+                                              FILE*,                          // File pointer
+                                              const enum SLSampleFormat_t,    // Sample format
+                                              const enum SLEndianType_t,      // Endian mode
+                                              const SLArrayIndex_t,           // Number of interleaved channels
+                                              const SLData_t);                // Scaling applied to samples read
+
+SLError_t SIGLIB_FUNC_DECL SUF_WavFileOpenRead(SLSampleFile_s*,    // Pointer to sample file structure
+                                               const char*,        // File name
+                                               const SLData_t);    // Scaling applied to samples read
+
+SLError_t SIGLIB_FUNC_DECL SUF_WavFileOpenWrite(SLSampleFile_s*,          // Pointer to sample file structure
+                                                const char*,              // File name
+                                                const SLWavFileInfo_s,    // WAV file info struct
+                                                const SLData_t);          // Scaling applied to samples written
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileRead(SLSampleFile_s*,                     // Pointer to sample file structure
+                                                   SLData_t SIGLIB_OUTPUT_PTR_DECL*,    // Pointer to destination array - interleaved
+                                                   const SLArrayIndex_t);               // Number of frames to read
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileReadChannels(SLSampleFile_s*,                     // Pointer to sample file structure
+                                                           SLData_t SIGLIB_OUTPUT_PTR_DECL*,    // Pointer to destination array - per channel
+                                                           const SLArrayIndex_t);               // Number of frames to read
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileWrite(SLSampleFile_s*,                          // Pointer to sample file structure
+                                                    const SLData_t SIGLIB_INPUT_PTR_DECL*,    // Pointer to source array - interleaved
+                                                    const SLArrayIndex_t);                    // Number of frames to write
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileWriteChannels(SLSampleFile_s*,                          // Pointer to sample file structure
+                                                            const SLData_t SIGLIB_INPUT_PTR_DECL*,    // Pointer to source array - per channel
+                                                            const SLArrayIndex_t);                    // Number of frames to write
+
+SLError_t SIGLIB_FUNC_DECL SUF_SampleFileSeek(SLSampleFile_s*,          // Pointer to sample file structure
+                                              const SLArrayIndex_t);    // Frame position
+
+SLError_t SIGLIB_FUNC_DECL SUF_SampleFileClose(SLSampleFile_s*);    // Pointer to sample file structure
+
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WriteWeightsIntegerCFile(const char*,                              // File name
                                                              const SLData_t SIGLIB_INPUT_PTR_DECL*,    // Layer 1 weights
                                                              const SLData_t SIGLIB_INPUT_PTR_DECL*,    // Layer 2 weights
@@ -526,6 +597,86 @@ void SIGLIB_FUNC_DECL SDA_Cfft3(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Poi
                                 SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to real destination array
                                 SLData_t* SIGLIB_OUTPUT_PTR_DECL);        // Pointer to imaginary destination array
 
+void SIGLIB_FUNC_DECL SIF_FftPlan(SLData_t* SIGLIB_OUTPUT_PTR_DECL,          // Pointer to FFT plan coefficients
+                                  SLArrayIndex_t* SIGLIB_OUTPUT_PTR_DECL,    // Bit reverse mode flag / Pointer
+                                                                             // to bit reverse address table
+                                  const SLArrayIndex_t);                     // FFT length
+
+void SIGLIB_FUNC_DECL SDA_FftExecute(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real input/output array
+                                     SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary input/output array
+                                     const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to FFT plan coefficients
+                                     const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Bit reverse mode flag / Pointer to bit
+                                                                                     // reverse address table
+                                     const SLArrayIndex_t,                           // FFT length
+                                     const SLArrayIndex_t);                          // log2 FFT length
+
+void SIGLIB_FUNC_DECL SDA_IfftExecute(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real input/output array
+                                      SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary input/output array
+                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to FFT plan coefficients
+                                      const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Bit reverse mode flag / Pointer to bit
+                                                                                      // reverse address table
+                                      const SLArrayIndex_t,                           // FFT length
+                                      const SLArrayIndex_t);                          // log2 FFT length
+
+void SIGLIB_FUNC_DECL SDA_RfftBatch(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real data for the first channel
+                                    SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary data for the first channel
+                                    SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                    SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                    const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to FFT coefficients
+                                    const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Bit reverse mode flag / Pointer to bit reverse address table
+                                    const SLArrayIndex_t,                           // Channel stride
+                                    const SLArrayIndex_t,                           // Number of channels
+                                    const SLArrayIndex_t,                           // FFT length
+                                    const SLArrayIndex_t);                          // log2 FFT length
+
+void SIGLIB_FUNC_DECL SDA_CfftBatch(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real data for the first channel
+                                    SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary data for the first channel
+                                    SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                    SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                    const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to FFT coefficients
+                                    const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Bit reverse mode flag / Pointer to bit reverse address table
+                                    const SLArrayIndex_t,                           // Channel stride
+                                    const SLArrayIndex_t,                           // Number of channels
+                                    const SLArrayIndex_t,                           // FFT length
+                                    const SLArrayIndex_t);                          // log2 FFT length
+
+void SIGLIB_FUNC_DECL SDA_CifftBatch(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real data for the first channel
+                                     SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary data for the first channel
+                                     SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                     SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                     const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to FFT coefficients
+                                     const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Bit reverse mode flag / Pointer to bit reverse address table
+                                     const SLArrayIndex_t,                           // Channel stride
+                                     const SLArrayIndex_t,                           // Number of channels
+                                     const SLArrayIndex_t,                           // FFT length
+                                     const SLArrayIndex_t);                          // log2 FFT length
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftFourStepCoeffsLength(const SLArrayIndex_t);    // FFT length
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftFourStepBitReverseLength(const SLArrayIndex_t);    // FFT length
+
+SLError_t SIGLIB_FUNC_DECL SIF_FftFourStep(SLData_t* SIGLIB_OUTPUT_PTR_DECL,          // Pointer to four-step FFT coefficients
+                                           SLArrayIndex_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to row FFT bit reverse address tables
+                                           const SLArrayIndex_t);                     // FFT length
+
+void SIGLIB_FUNC_DECL SDA_CfftFourStep(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real input/output array
+                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary input/output array
+                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to four-step FFT coefficients
+                                       const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to row FFT bit reverse address tables
+                                       const SLArrayIndex_t,                           // FFT length
+                                       const SLArrayIndex_t);                          // log2 FFT length
+
+void SIGLIB_FUNC_DECL SDA_CifftFourStep(SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real input/output array
+                                        SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary input/output array
+                                        SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                        SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                        const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to four-step FFT coefficients
+                                        const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to row FFT bit reverse address tables
+                                        const SLArrayIndex_t,                           // FFT length
+                                        const SLArrayIndex_t);                          // log2 FFT length
+
 // Generic Fourier Transform Functions - fourier.c
 
 SLError_t SIGLIB_FUNC_DECL SIF_ZoomFft(SLData_t* SIGLIB_OUTPUT_PTR_DECL,          // Pointer to real comb filter state array
@@ -864,6 +1015,50 @@ void SIGLIB_FUNC_DECL SDA_CifftArb(const SLData_t* SIGLIB_INPUT_PTR_DECL,
                                    const SLArrayIndex_t,                           // Log 2 FFT length
                                    const SLArrayIndex_t);                          // Arbitrary FFT length
 
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftArbPlanCoeffsLength(const SLArrayIndex_t);    // Arbitrary FFT length
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftArbPlanTempLength(const SLArrayIndex_t);    // Arbitrary FFT length
+
+void SIGLIB_FUNC_DECL SIF_FftArbPlan(SLArrayIndex_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to plan information
+                                     SLData_t* SIGLIB_OUTPUT_PTR_DECL,          // Pointer to plan coefficients
+                                     SLData_t* SIGLIB_INOUT_PTR_DECL,           // Pointer to real temporary array
+                                     SLData_t* SIGLIB_INOUT_PTR_DECL,           // Pointer to imaginary temporary array
+                                     const SLArrayIndex_t);                     // Arbitrary FFT length
+
+void SIGLIB_FUNC_DECL SDA_CfftArbPlan(const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to real source array
+                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to imaginary source array
+                                      SLData_t* SIGLIB_OUTPUT_PTR_DECL,               // Pointer to real destination array
+                                      SLData_t* SIGLIB_OUTPUT_PTR_DECL,               // Pointer to imaginary destination array
+                                      SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                      SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                      const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to plan information
+                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to plan coefficients
+                                      const SLArrayIndex_t);                          // Arbitrary FFT length
+
+void SIGLIB_FUNC_DECL SDA_CifftArbPlan(const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to real source array
+                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to imaginary source array
+                                       SLData_t* SIGLIB_OUTPUT_PTR_DECL,               // Pointer to real destination array
+                                       SLData_t* SIGLIB_OUTPUT_PTR_DECL,               // Pointer to imaginary destination array
+                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to real temporary array
+                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to imaginary temporary array
+                                       const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to plan information
+                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to plan coefficients
+                                       const SLArrayIndex_t);                          // Arbitrary FFT length
+
+SLError_t SIGLIB_FUNC_DECL SDA_CfftArbCached(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to real source array
+                                             const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to imaginary source array
+                                             SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to real destination array
+                                             SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to imaginary destination array
+                                             const SLArrayIndex_t);                    // Arbitrary FFT length
+
+SLError_t SIGLIB_FUNC_DECL SDA_CifftArbCached(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to real source array
+                                              const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to imaginary source array
+                                              SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to real destination array
+                                              SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to imaginary destination array
+                                              const SLArrayIndex_t);                    // Arbitrary FFT length
+
+void SIGLIB_FUNC_DECL SUF_FftArbPlanCacheFree(void);
+
 // Power spectrum functions - pspect.c
 
 void SIGLIB_FUNC_DECL SIF_FastAutoCrossPowerSpectrum(SLData_t* SIGLIB_OUTPUT_PTR_DECL,          // Pointer to FFT coefficients
@@ -1021,6 +1216,26 @@ void SIGLIB_FUNC_DECL SDA_MagnitudeSquaredCoherence(SLData_t* SIGLIB_INOUT_PTR_D
                                                     const SLArrayIndex_t,                           // log2 FFT length
                                                     const SLData_t);                                // Inverse FFT length
 
+SLError_t SIGLIB_FUNC_DECL SIF_Welch(SLWelch_s*,               // Pointer to Welch structure
+                                     const enum SLWindow_t,    // Window type
+                                     const SLData_t,           // Window coefficient
+                                     const SLArrayIndex_t,     // FFT length
+                                     const SLArrayIndex_t,     // Overlap between segments
+                                     const SLArrayIndex_t);    // Number of shards
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_WelchPowerSpectrum(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                       SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                       SLWelch_s*,                               // Pointer to Welch structure
+                                                       const SLArrayIndex_t);                    // Source array length
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_WelchCoherence(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array 1
+                                                   const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array 2
+                                                   SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                   SLWelch_s*,                               // Pointer to Welch structure
+                                                   const SLArrayIndex_t);                    // Source array length
+
+void SIGLIB_FUNC_DECL SUF_WelchFree(SLWelch_s*);    // Pointer to Welch structure
+
 // Frequency domain filtering functions - fdfilter.c
 
 void SIGLIB_FUNC_DECL SIF_FirOverlapAdd(const SLData_t* SIGLIB_OUTPUT_PTR_DECL,    // Time Domain Coefficients pointer
@@ -1175,6 +1390,37 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_RfftConvolve(SLData_t* SIGLIB_INPUT_PTR_DECL
                                                  const SLArrayIndex_t,                           // Log 2 FFT length
                                                  const SLData_t);                                // Inverse FFT length
 
+SLError_t SIGLIB_FUNC_DECL SIF_FirAuto(SLFirAuto_s*,                             // Pointer to filter structure
+                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients
+                                       const SLArrayIndex_t,                     // Filter length
+                                       const SLArrayIndex_t,                     // Maximum filter length
+                                       const SLArrayIndex_t,                     // Maximum number of samples per call
+                                       const SLArrayIndex_t,                     // Maximum added latency (samples)
+                                       const enum SLFirAutoMethod_t);            // Filtering method
+
+SLError_t SIGLIB_FUNC_DECL SIF_FirAutoCoefficients(SLFirAuto_s*,                             // Pointer to filter structure
+                                                   const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients
+                                                   const SLArrayIndex_t);                    // Filter length
+
+void SIGLIB_FUNC_DECL SDA_FirAuto(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                  SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                  SLFirAuto_s*,                             // Pointer to filter structure
+                                  const SLArrayIndex_t);                    // Number of samples to filter
+
+void SIGLIB_FUNC_DECL SUF_FirAutoFree(SLFirAuto_s*);    // Pointer to filter structure
+
+SLError_t SIGLIB_FUNC_DECL SIF_FirPartitioned(SLFirPartitioned_s*,                      // Pointer to filter structure
+                                              const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients
+                                              const SLArrayIndex_t,                     // Filter length
+                                              const SLArrayIndex_t);                    // Partition length
+
+void SIGLIB_FUNC_DECL SDA_FirPartitioned(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                         SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                         SLFirPartitioned_s*,                      // Pointer to filter structure
+                                         const SLArrayIndex_t);                    // Number of samples to filter
+
+void SIGLIB_FUNC_DECL SUF_FirPartitionedFree(SLFirPartitioned_s*);    // Pointer to filter structure
+
 // Chirp z-transform functions - chirpz.c
 
 void SIGLIB_FUNC_DECL SIF_Czt(SLData_t* SIGLIB_OUTPUT_PTR_DECL,          // Pointer to AWNr coefficients
@@ -1397,6 +1643,12 @@ void SIGLIB_FUNC_DECL SIF_FirExtendedArray(SLData_t* SIGLIB_INOUT_PTR_DECL,
                                            SLArrayIndex_t*,                          // Pointer to filter index register
                                            const SLArrayIndex_t);                    // Filter length
 
+void SIGLIB_FUNC_DECL SIF_FirExtendedArrayFromFir(SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to filter state array
+                                                  SLArrayIndex_t*,                          // Pointer to filter index register
+                                                  const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to SDA_Fir filter state array
+                                                  const SLArrayIndex_t,                     // SDA_Fir filter index
+                                                  const SLArrayIndex_t);                    // Filter length
+
 SLData_t SIGLIB_FUNC_DECL SDS_FirExtendedArray(const SLData_t,                           // Input data sample to be filtered
                                                SLData_t* SIGLIB_INOUT_PTR_DECL,          // Pointer to filter state array
                                                const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients
@@ -1652,6 +1904,20 @@ void SIGLIB_FUNC_DECL SDA_IirMac(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // In
                                  const SLArrayIndex_t,                     // Number of biquads
                                  const SLArrayIndex_t);                    // Array length
 
+void SIGLIB_FUNC_DECL SIF_IirMultiChannel(SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to filter state array
+                                          SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to multi-channel coefficients array
+                                          const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients arrays, one per channel
+                                          const SLArrayIndex_t,                     // Number of biquads
+                                          const SLArrayIndex_t);                    // Number of channels
+
+void SIGLIB_FUNC_DECL SDA_IirMultiChannel(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Interleaved input array to be filtered
+                                          SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Interleaved filtered output array
+                                          SLData_t* SIGLIB_INOUT_PTR_DECL,          // Pointer to filter state array
+                                          const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to multi-channel coefficients array
+                                          const SLArrayIndex_t,                     // Number of biquads
+                                          const SLArrayIndex_t,                     // Number of channels
+                                          const SLArrayIndex_t);                    // Number of samples per channel
+
 void SIGLIB_FUNC_DECL SIF_IirOrderN(SLData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to filter state array
                                     SLArrayIndex_t*,                     // Pointer to filter index
                                     const SLArrayIndex_t);               // Filter order
@@ -2107,6 +2373,25 @@ SLComplexRect_s SIGLIB_FUNC_DECL SDA_GoertzelDetectComplex(const SLData_t* SIGLI
 
 #endif    // End of #ifndef _HP_VEE
 
+void SIGLIB_FUNC_DECL SIF_GoertzelBank(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to normalised tone frequencies
+                                       SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to filter coefficients array
+                                       SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to filter state array
+                                       const SLArrayIndex_t,                     // Number of tones
+                                       const SLArrayIndex_t);                    // Number of channels
+
+void SIGLIB_FUNC_DECL SDA_GoertzelBank(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                       SLData_t* SIGLIB_INOUT_PTR_DECL,          // Pointer to filter state array
+                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients array
+                                       const SLArrayIndex_t,                     // Number of tones
+                                       const SLArrayIndex_t,                     // Number of channels
+                                       const SLArrayIndex_t);                    // Number of samples per channel
+
+void SIGLIB_FUNC_DECL SDA_GoertzelBankDetect(SLData_t* SIGLIB_INOUT_PTR_DECL,          // Pointer to filter state array
+                                             const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to filter coefficients array
+                                             SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                             const SLArrayIndex_t,                     // Number of tones
+                                             const SLArrayIndex_t);                    // Number of channels
+
 void SIGLIB_FUNC_DECL SIF_GaussianFirFilter(SLData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to filter coefficients
                                             const SLData_t,                      // Standard deviation of the distribution
                                             const SLArrayIndex_t);               // Filter length
@@ -2192,6 +2477,20 @@ void SIGLIB_FUNC_DECL SDA_FarrowFilter(const SLData_t* SIGLIB_INPUT_PTR_DECL,
                                        const SLArrayIndex_t,                     // Filter lengths
                                        const SLArrayIndex_t);                    // Input sample length
 
+SLError_t SIGLIB_FUNC_DECL SIF_RankFilter(SLRankFilter_s*,          // Pointer to filter structure
+                                          const SLArrayIndex_t,     // Window length
+                                          const SLArrayIndex_t);    // Rank of output sample - 0 = minimum, (window length - 1) / 2 = median
+
+SLData_t SIGLIB_FUNC_DECL SDS_RankFilter(const SLData_t,      // Source sample
+                                         SLRankFilter_s*);    // Pointer to filter structure
+
+void SIGLIB_FUNC_DECL SDA_RankFilter(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                     SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                     SLRankFilter_s*,                          // Pointer to filter structure
+                                     const SLArrayIndex_t);                    // Sample length
+
+void SIGLIB_FUNC_DECL SUF_RankFilterFree(SLRankFilter_s*);    // Pointer to filter structure
+
 // Acoustic processing functions - acoustic.c
 
 void SIGLIB_FUNC_DECL SDA_LinearMicrophoneArrayBeamPattern(const SLFixData_t,                   // Number of microphones
@@ -3236,6 +3535,32 @@ SLChar_t SIGLIB_FUNC_DECL SDS_ViterbiDecoderV32(SLComplexRect_s,          // Sou
                                                 SLFixData_t*,             // Flag is set to SIGLIB_TRUE when we are in trace back mode
                                                 const SLArrayIndex_t);    // Trace back depth
 
+void SIGLIB_FUNC_DECL SDA_ConvEncoder(const SLChar_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source bytes
+                                      SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination soft decision symbols
+                                      const SLUInt32_t*,                        // Pointer to polynomials
+                                      const SLArrayIndex_t,                     // Number of polynomials
+                                      const SLArrayIndex_t,                     // Constraint length
+                                      SLUInt32_t*,                              // Pointer to encoder state
+                                      const SLArrayIndex_t);                    // Number of source bytes
+
+SLError_t SIGLIB_FUNC_DECL SIF_ViterbiDecoder(SLViterbiDecoder_s*,      // Pointer to decoder
+                                              const SLUInt32_t*,        // Pointer to polynomials
+                                              const SLArrayIndex_t,     // Number of polynomials
+                                              const SLArrayIndex_t,     // Constraint length
+                                              const SLArrayIndex_t);    // Trace back depth
+
+void SIGLIB_FUNC_DECL SIF_ViterbiDecoderReset(SLViterbiDecoder_s*);    // Pointer to decoder
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_ViterbiDecoder(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source soft decision symbols
+                                                   SLChar_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination bytes
+                                                   SLViterbiDecoder_s*,                      // Pointer to decoder
+                                                   const SLArrayIndex_t);                    // Number of source bytes
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_ViterbiDecoderFlush(SLChar_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination bytes
+                                                        SLViterbiDecoder_s*);                // Pointer to decoder
+
+void SIGLIB_FUNC_DECL SUF_ViterbiDecoderFree(SLViterbiDecoder_s*);    // Pointer to decoder
+
 // Analog modulation functions - mod_a.c
 
 void SIGLIB_FUNC_DECL SIF_AmplitudeModulate(SLData_t* SIGLIB_OUTPUT_PTR_DECL,    // Carrier table pointer
@@ -3831,6 +4156,50 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_Qam16DifferentialEncode(const SLFixData_t,    /
 SLFixData_t SIGLIB_FUNC_DECL SDA_Qam16DifferentialDecode(const SLFixData_t,    // Mapped Rx nibble
                                                          SLFixData_t*);        // Previous Rx nibble pointer
 
+SLError_t SIGLIB_FUNC_DECL SIF_QamModulateMultiChannel(SLQamModemMultiChannel_s*,    // Pointer to modem structure
+                                                       const SLData_t,               // Carrier phase increment per sample (radians / 2π)
+                                                       const SLArrayIndex_t,         // Carrier sine table size
+                                                       const SLArrayIndex_t,         // Carrier table increment
+                                                       const SLArrayIndex_t,         // Samples per symbol
+                                                       const SLData_t,               // RRCF Period
+                                                       const SLData_t,               // RRCF Roll off
+                                                       const SLArrayIndex_t,         // RRCF size
+                                                       const SLArrayIndex_t,         // RRCF enable / disable switch
+                                                       const SLArrayIndex_t);        // Number of channels
+
+void SIGLIB_FUNC_DECL SDA_QpskModulateMultiChannel(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Tx di-bits, NumberOfSymbols per channel
+                                                   SLData_t* SIGLIB_OUTPUT_PTR_DECL,           // Destination array, one block per channel
+                                                   SLQamModemMultiChannel_s*,                  // Pointer to modem structure
+                                                   const SLArrayIndex_t);                      // Number of symbols per channel
+
+void SIGLIB_FUNC_DECL SDA_Qam16ModulateMultiChannel(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Tx nibbles, NumberOfSymbols per channel
+                                                    SLData_t* SIGLIB_OUTPUT_PTR_DECL,           // Destination array, one block per channel
+                                                    SLQamModemMultiChannel_s*,                  // Pointer to modem structure
+                                                    const SLArrayIndex_t);                      // Number of symbols per channel
+
+SLError_t SIGLIB_FUNC_DECL SIF_QamDemodulateMultiChannel(SLQamModemMultiChannel_s*,    // Pointer to modem structure
+                                                         const SLData_t,               // Carrier phase increment per sample (radians / 2π)
+                                                         const SLArrayIndex_t,         // Carrier sine table size
+                                                         const SLArrayIndex_t,         // Carrier table increment
+                                                         const SLArrayIndex_t,         // Samples per symbol
+                                                         const SLData_t,               // RRCF Period
+                                                         const SLData_t,               // RRCF Roll off
+                                                         const SLArrayIndex_t,         // RRCF size
+                                                         const SLArrayIndex_t,         // RRCF enable / disable switch
+                                                         const SLArrayIndex_t);        // Number of channels
+
+void SIGLIB_FUNC_DECL SDA_QpskDemodulateMultiChannel(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Source array, one block per channel
+                                                     SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,     // Rx di-bits, NumberOfSymbols per channel
+                                                     SLQamModemMultiChannel_s*,               // Pointer to modem structure
+                                                     const SLArrayIndex_t);                   // Number of symbols per channel
+
+void SIGLIB_FUNC_DECL SDA_Qam16DemodulateMultiChannel(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Source array, one block per channel
+                                                      SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,     // Rx nibbles, NumberOfSymbols per channel
+                                                      SLQamModemMultiChannel_s*,               // Pointer to modem structure
+                                                      const SLArrayIndex_t);                   // Number of symbols per channel
+
+void SIGLIB_FUNC_DECL SUF_QamModemMultiChannelFree(SLQamModemMultiChannel_s*);    // Pointer to modem structure
+
 void SIGLIB_FUNC_DECL SIF_OpskModulate(SLData_t* SIGLIB_OUTPUT_PTR_DECL,           // Carrier table pointer
                                        const SLData_t,                             // Carrier phase increment per sample (radians / 2π)
                                        const SLArrayIndex_t,                       // Sine table length
@@ -4184,61 +4553,159 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_IncreaseWordLength(const SLUInt8_t*,
 SLFixData_t SIGLIB_FUNC_DECL SDS_Scrambler1417(const SLFixData_t,                     // Source character
                                                SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_Scrambler1417(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                        SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                        SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                        const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Descrambler1417(const SLFixData_t,                     // Source character
                                                  SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_Descrambler1417(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                          SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                          SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                          const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Scrambler1417WithInversion(const SLFixData_t,                      // Source character
                                                             SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
                                                             SLFixData_t* SIGLIB_INOUT_PTR_DECL,     // Ones bit counter
                                                             SLFixData_t* SIGLIB_INOUT_PTR_DECL);    // Bit inversion flag
 
+void SIGLIB_FUNC_DECL SDA_Scrambler1417WithInversion(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                     SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                     SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                     SLFixData_t* SIGLIB_INOUT_PTR_DECL,          // Ones bit counter
+                                                     SLFixData_t* SIGLIB_INOUT_PTR_DECL,          // Bit inversion flag
+                                                     const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Descrambler1417WithInversion(const SLFixData_t,                      // Source character
                                                               SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
                                                               SLFixData_t* SIGLIB_INOUT_PTR_DECL,     // Ones bit counter
                                                               SLFixData_t* SIGLIB_INOUT_PTR_DECL);    // Bit inversion flag
 
+void SIGLIB_FUNC_DECL SDA_Descrambler1417WithInversion(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                       SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                       SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                       SLFixData_t* SIGLIB_INOUT_PTR_DECL,          // Ones bit counter
+                                                       SLFixData_t* SIGLIB_INOUT_PTR_DECL,          // Bit inversion flag
+                                                       const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Scrambler1823(const SLFixData_t,                     // Source character
                                                SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_Scrambler1823(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                        SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                        SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                        const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Descrambler1823(const SLFixData_t,                     // Source character
                                                  SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_Descrambler1823(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                          SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                          SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                          const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Scrambler523(const SLFixData_t,                     // Source character
                                               SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_Scrambler523(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                       SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                       SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                       const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_Descrambler523(const SLFixData_t,                     // Source character
                                                 SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_Descrambler523(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                         SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                         SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                         const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_ScramblerDescramblerPN9(const SLFixData_t,                     // Source character
                                                          SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblerPN9(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                  SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                  SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                  const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorPN9(SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorPN9(SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination array
+                                               SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
+                                               const SLArrayIndex_t);                  // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_ScramblerDescramblerPN15(const SLFixData_t,                     // Source character
                                                           SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblerPN15(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                   SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                   SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                   const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorPN15(SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorPN15(SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination array
+                                                SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
+                                                const SLArrayIndex_t);                  // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_ScramblerDescramblergCRC24(const SLFixData_t,                     // Source character
                                                             SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC24(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                     SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                     SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                     const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorgCRC24(SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC24(SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination array
+                                                  SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
+                                                  const SLArrayIndex_t);                  // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_ScramblerDescramblergCRC16(const SLFixData_t,                     // Source character
                                                             SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC16(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                     SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                     SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                     const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorgCRC16(SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC16(SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination array
+                                                  SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
+                                                  const SLArrayIndex_t);                  // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_ScramblerDescramblergCRC12(const SLFixData_t,                     // Source character
                                                             SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC12(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                     SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                     SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                     const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorgCRC12(SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC12(SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination array
+                                                  SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
+                                                  const SLArrayIndex_t);                  // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_ScramblerDescramblergCRC8(const SLFixData_t,                     // Source character
                                                            SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC8(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                    SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                                    SLUInt32_t* SIGLIB_INOUT_PTR_DECL,           // Shift register
+                                                    const SLArrayIndex_t);                       // Array length
+
 SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorgCRC8(SLUInt32_t* SIGLIB_INOUT_PTR_DECL);    // Shift register
 
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC8(SLFixData_t* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to destination array
+                                                 SLUInt32_t* SIGLIB_INOUT_PTR_DECL,      // Shift register
+                                                 const SLArrayIndex_t);                  // Array length
+
 void SIGLIB_FUNC_DECL SDS_LongCodeGenerator3GPPDL(SLComplexRect_s* SIGLIB_INOUT_PTR_DECL,    // Pointer to destination array
                                                   SLUInt32_t* SIGLIB_INOUT_PTR_DECL,         // X shift register
                                                   SLUInt32_t* SIGLIB_INOUT_PTR_DECL,         // Y shift register
@@ -4249,6 +4716,41 @@ void SIGLIB_FUNC_DECL SDS_LongCodeGenerator3GPPUL(SLComplexRect_s* SIGLIB_INOUT_
                                                   SLUInt32_t* SIGLIB_INOUT_PTR_DECL,         // Y shift register
                                                   const SLArrayIndex_t);                     // Output Array length
 
+// CRC functions - prbs.c
+
+SLError_t SIGLIB_FUNC_DECL SIF_Crc(SLCrc_s* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to CRC structure
+                                   const SLUInt32_t,                   // Generator polynomial
+                                   const SLArrayIndex_t,               // CRC width
+                                   const SLUInt32_t,                   // Initial CRC value
+                                   const SLUInt32_t,                   // Final XOR value
+                                   const SLFixData_t,                  // Reflect input bytes
+                                   const SLFixData_t);                 // Reflect output CRC
+
+SLUInt32_t SIGLIB_FUNC_DECL SDS_CrcStart(const SLCrc_s* SIGLIB_INPUT_PTR_DECL);    // Pointer to CRC structure
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_CrcUpdate(const SLUInt8_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                          const SLUInt32_t,                         // CRC register
+                                          const SLCrc_s* SIGLIB_INPUT_PTR_DECL,     // Pointer to CRC structure
+                                          const SLArrayIndex_t);                    // Array length
+
+SLUInt32_t SIGLIB_FUNC_DECL SDS_CrcFinish(const SLUInt32_t,                        // CRC register
+                                          const SLCrc_s* SIGLIB_INPUT_PTR_DECL);    // Pointer to CRC structure
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_Crc(const SLUInt8_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                    const SLCrc_s* SIGLIB_INPUT_PTR_DECL,     // Pointer to CRC structure
+                                    const SLArrayIndex_t);                    // Array length
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_CrcUpdateFixData(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                                 const SLUInt32_t,                           // CRC register
+                                                 const SLCrc_s* SIGLIB_INPUT_PTR_DECL,       // Pointer to CRC structure
+                                                 const SLArrayIndex_t);                      // Array length
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_CrcFixData(const SLFixData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                           const SLCrc_s* SIGLIB_INPUT_PTR_DECL,       // Pointer to CRC structure
+                                           const SLArrayIndex_t);                      // Array length
+
+void SIGLIB_FUNC_DECL SUF_CrcFree(SLCrc_s*);    // Pointer to CRC structure
+
 // Multiplex and demultiplexing functions - mux.c
 void SIGLIB_FUNC_DECL SDA_Multiplex(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source multiplexed array
                                     const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Input data for frame sample index
@@ -5904,6 +6406,11 @@ void SIGLIB_FUNC_DECL SDA_SortMaxToMin2(const SLData_t* SIGLIB_INPUT_PTR_DECL,
                                         SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array #2
                                         const SLArrayIndex_t);                    // Array length
 
+SLData_t SIGLIB_FUNC_DECL SDA_NthElement(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
+                                        SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination array
+                                        const SLArrayIndex_t,                     // Index of the element to select
+                                        const SLArrayIndex_t);                    // Array length
+
 void SIGLIB_FUNC_DECL SDA_SortIndexed(const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to source array
                                       const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to index array
                                       SLData_t* SIGLIB_OUTPUT_PTR_DECL,               // Pointer to destination array
@@ -6734,6 +7241,13 @@ void SIGLIB_FUNC_DECL SMX_Multiply2(const SLData_t* SIGLIB_INPUT_PTR_DECL,    //
                                     const SLArrayIndex_t,                     // Source matrix 1 # of columns
                                     const SLArrayIndex_t);                    // Source matrix 2 # of columns
 
+void SIGLIB_FUNC_DECL SMX_Multiply2Transposed(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source matrix 1
+                                              const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source matrix 2
+                                              SLData_t* SIGLIB_OUTPUT_PTR_DECL,         // Pointer to destination matrix
+                                              const SLArrayIndex_t,                     // Source matrix 1 # of rows
+                                              const SLArrayIndex_t,                     // Source matrix 1 # of columns
+                                              const SLArrayIndex_t);                    // Source matrix 2 # of rows
+
 void SIGLIB_FUNC_DECL SMX_Identity(SLData_t* SIGLIB_OUTPUT_PTR_DECL,    // Output Matrix pointer
                                    const SLArrayIndex_t);               //  Destination matrix # of rows and columns
 
@@ -6765,6 +7279,16 @@ void SIGLIB_FUNC_DECL SMX_LuSolve(const SLData_t* SIGLIB_INPUT_PTR_DECL,
                                   const SLArrayIndex_t* SIGLIB_INOUT_PTR_DECL,    // Index matrix pointer
                                   const SLArrayIndex_t);                          // Number of rows and columns in matrix
 
+SLError_t SIGLIB_FUNC_DECL SMX_LuDecomposeBlocked(SLData_t* SIGLIB_INOUT_PTR_DECL,           // Source and destination matrix pointer
+                                                  SLArrayIndex_t* SIGLIB_OUTPUT_PTR_DECL,    // Index matrix pointer
+                                                  const SLArrayIndex_t);                     // Number of rows and columns in matrix
+
+void SIGLIB_FUNC_DECL SMX_LuSolveMultiple(const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to LU decomposed matrix
+                                          SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to source and solution matrix
+                                          const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Index matrix pointer
+                                          const SLArrayIndex_t,                           // Number of rows and columns in LU matrix
+                                          const SLArrayIndex_t);                          // Number of right hand side columns
+
 void SIGLIB_FUNC_DECL SMX_CholeskyDecompose(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source matrix
                                             SLData_t* SIGLIB_INOUT_PTR_DECL,          // Pointer to destination matrix
                                             const SLArrayIndex_t);                    // Number of rows and columns in matrix
@@ -7094,6 +7618,76 @@ SDA_TwoLayerNCategoryWithBiasesNetworkPredict(const SLData_t* SIGLIB_INPUT_PTR_D
                                               const SLArrayIndex_t,                     // Layer 1 length
                                               const SLArrayIndex_t);                    // Number of categories
 
+SLError_t SIGLIB_FUNC_DECL SDA_TwoLayerNetworkFitBatch(const SLData_t* SIGLIB_INPUT_PTR_DECL,          // Pointer to training data
+                                                       const SLArrayIndex_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to categorical data
+                                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to layer 1 weights
+                                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to layer 1 biases (or NULL)
+                                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to layer 2 weights
+                                                       SLData_t* SIGLIB_INOUT_PTR_DECL,                // Pointer to layer 2 biases (or NULL)
+                                                       const enum SLActivationType_t,                  // Layer 1 activation type
+                                                       const SLData_t,                                 // Layer 1 activation alpha
+                                                       const enum SLActivationType_t,                  // Layer 2 activation type
+                                                       const SLData_t,                                 // Layer 2 activation alpha
+                                                       const SLData_t,                                 // Learning rate
+                                                       const SLArrayIndex_t,                           // Number of training sequences
+                                                       const SLArrayIndex_t,                           // Input array length
+                                                       const SLArrayIndex_t,                           // Layer 1 length
+                                                       const SLArrayIndex_t,                           // Number of categories (1 for single output)
+                                                       const SLArrayIndex_t,                           // Batch size
+                                                       const SLArrayIndex_t);                          // Number of shards per batch
+
+void SIGLIB_FUNC_DECL SDA_TwoLayerNetworkPredictBatch(const SLData_t* SIGLIB_INPUT_PTR_DECL,                  // Pointer to data to classify
+                                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,                  // Pointer to layer 1 weights
+                                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,                  // Pointer to layer 1 biases (or NULL)
+                                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,                  // Pointer to layer 2 weights
+                                                      const SLData_t* SIGLIB_INPUT_PTR_DECL,                  // Pointer to layer 2 biases (or NULL)
+                                                      SLData_t* SIGLIB_OUTPUT_PTR_DECL,                       // Pointer to layer 1 post activation
+                                                      SLData_t* SIGLIB_OUTPUT_PTR_DECL,                       // Pointer to layer 2 post activation
+                                                      SLNeuralNetworkPrediction_s* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to predictions
+                                                      const enum SLActivationType_t,                          // Layer 1 activation type
+                                                      const SLData_t,                                         // Layer 1 activation alpha
+                                                      const enum SLActivationType_t,                          // Layer 2 activation type
+                                                      const SLData_t,                                         // Layer 2 activation alpha
+                                                      const SLData_t,                                         // Classification threshold
+                                                      const SLArrayIndex_t,                                   // Input array length
+                                                      const SLArrayIndex_t,                                   // Layer 1 length
+                                                      const SLArrayIndex_t,                                   // Number of categories
+                                                      const SLArrayIndex_t);                                  // Number of sequences
+
+SLError_t SIGLIB_FUNC_DECL SIF_TwoLayerNetworkQuantize(SLTwoLayerNetworkQuantized_s*,            // Pointer to quantized network
+                                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to layer 1 weights
+                                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to layer 1 biases (or NULL)
+                                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to layer 2 weights
+                                                       const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to layer 2 biases (or NULL)
+                                                       const SLArrayIndex_t,                     // Number of weight bits (8 or 16)
+                                                       const SLArrayIndex_t,                     // Input array length
+                                                       const SLArrayIndex_t,                     // Layer 1 length
+                                                       const SLArrayIndex_t);                    // Number of categories (1 for single output)
+
+SLError_t SIGLIB_FUNC_DECL SIF_TwoLayerNetworkQuantizedInt8(SLTwoLayerNetworkQuantized_s*,            // Pointer to quantized network
+                                                            const SLInt8_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to 8 bit layer 1 weights
+                                                            const SLData_t,                           // Layer 1 weights absolute maximum
+                                                            const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to layer 1 biases (or NULL)
+                                                            const SLInt8_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to 8 bit layer 2 weights
+                                                            const SLData_t,                           // Layer 2 weights absolute maximum
+                                                            const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to layer 2 biases (or NULL)
+                                                            const SLArrayIndex_t,                     // Input array length
+                                                            const SLArrayIndex_t,                     // Layer 1 length
+                                                            const SLArrayIndex_t);                    // Number of categories (1 for single output)
+
+void SIGLIB_FUNC_DECL
+SDA_TwoLayerNetworkPredictQuantizedBatch(const SLData_t* SIGLIB_INPUT_PTR_DECL,                  // Pointer to data to classify
+                                         SLTwoLayerNetworkQuantized_s*,                          // Pointer to quantized network
+                                         SLNeuralNetworkPrediction_s* SIGLIB_OUTPUT_PTR_DECL,    // Pointer to predictions
+                                         const enum SLActivationType_t,                          // Layer 1 activation type
+                                         const SLData_t,                                         // Layer 1 activation alpha
+                                         const enum SLActivationType_t,                          // Layer 2 activation type
+                                         const SLData_t,                                         // Layer 2 activation alpha
+                                         const SLData_t,                                         // Classification threshold
+                                         const SLArrayIndex_t);                                  // Number of sequences
+
+void SIGLIB_FUNC_DECL SUF_TwoLayerNetworkQuantizedFree(SLTwoLayerNetworkQuantized_s*);    // Pointer to quantized network
+
 SLData_t SIGLIB_FUNC_DECL SDS_ActivationReLU(const SLData_t);    // Source sample
 
 void SIGLIB_FUNC_DECL SDA_ActivationReLU(const SLData_t* SIGLIB_INPUT_PTR_DECL,    // Pointer to source array
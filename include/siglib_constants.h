@@ -56,6 +56,7 @@ Update history:
 #    define SIGLIB_NULL_COMPLEX_RECT_PTR ((SLComplexRect_s*)0)      // Null pointer to SLComplexRect_s
 #    define SIGLIB_NULL_COMPLEX_POLAR_PTR ((SLComplexPolar_s*)0)    // Null pointer to SLComplexPolar_s
 #    define SIGLIB_NULL_ARRAY_INDEX_PTR ((SLArrayIndex_t*)0)        // Null pointer to SLArrayIndex_t
+#    define SIGLIB_NULL_UINT32_PTR ((SLUInt32_t*)0)                 // Null pointer to SLUInt32_t
 
 // Array index constants
 #    define SIGLIB_INVALID_ARRAY_INDEX ((SLArrayIndex_t) - 1)            // Invalid SLArrayIndex_t
@@ -170,6 +171,15 @@ Update history:
 #    define SIGLIB_IIR_MAX_NOTCH_BIQUADS ((SLArrayIndex_t)10)    // Maximum number of biquads for a notch filter
 #    define SIGLIB_IIR_COEFFS_PER_ ((SLFixData_t)5)              // Number of coefficients per biquad
 
+#    define SIGLIB_FFT_ARB_PLAN_MODE_INDEX ((SLArrayIndex_t)0)       // Arbitrary length FFT plan : FFT or CZT mode
+#    define SIGLIB_FFT_ARB_PLAN_LENGTH_INDEX ((SLArrayIndex_t)1)     // Arbitrary length FFT plan : mixed radix FFT length
+#    define SIGLIB_FFT_ARB_PLAN_STAGES_INDEX ((SLArrayIndex_t)2)     // Arbitrary length FFT plan : number of mixed radix stages
+#    define SIGLIB_FFT_ARB_PLAN_RADICES_INDEX ((SLArrayIndex_t)3)    // Arbitrary length FFT plan : radix of each stage
+#    define SIGLIB_FFT_ARB_PLAN_INFO_LENGTH ((SLArrayIndex_t)36)     // Arbitrary length FFT plan information array length
+#    define SIGLIB_FFT_ARB_PLAN_CACHE_LENGTH ((SLArrayIndex_t)8)     // Number of plans held by SDA_CfftArbCached / SDA_CifftArbCached
+
+#    define SIGLIB_FFT_BATCH_CHANNELS ((SLArrayIndex_t)8)    // Number of channels processed together by the batched FFT functions
+
 #    define SIGLIB_DTMF_STATE_LENGTH (SIGLIB_GOERTZEL_DELAY_LENGTH * ((SLFixData_t)8))    // Number of state array elements
 #    define SIGLIB_DTMF_FTABLE_LENGTH ((SLFixData_t)16)                                   // DTMF generator freq look up table length
 
@@ -194,6 +204,23 @@ Update history:
 #    define SIGLIB_VITV32_NUMBER_OF_PATH_STATES ((SLFixData_t)8)                // Total number of path states (outputs)
 #    define SIGLIB_VITV32_SUB_STATES_PER_PATH_STATE ((SLFixData_t)4)            // Number of sub-states per path state
 
+#    define SIGLIB_VITERBI_MAX_CONSTRAINT_LENGTH ((SLArrayIndex_t)9)    // Maximum constraint length of the generic Viterbi decoder
+#    define SIGLIB_VITERBI_MAX_OUTPUTS ((SLArrayIndex_t)4)              // Maximum number of polynomials - code rate 1/4
+#    define SIGLIB_VITERBI_BLOCK_LENGTH ((SLArrayIndex_t)256)           // Number of bits decoded by each trace back
+
+// Sorting constants
+#    define SIGLIB_SORT_INSERTION_LENGTH ((SLArrayIndex_t)16)     // Partitions of up to this length are insertion sorted
+#    define SIGLIB_SORT_RADIX_MIN_LENGTH ((SLArrayIndex_t)512)    // Arrays of at least this length are radix sorted
+
+// File I/O constants
+#    define SIGLIB_FILE_IO_BLOCK_LENGTH ((SLArrayIndex_t)16384)    // Bytes read or written by each block file access
+#    define SIGLIB_WAV_FORMAT_PCM 1                                // .wav file format tags
+#    define SIGLIB_WAV_FORMAT_IEEE_FLOAT 3
+#    define SIGLIB_WAV_FORMAT_EXTENSIBLE 0xFFFE
+
+// Profiling constants
+#    define SIGLIB_PROFILE_HISTOGRAM_LENGTH ((SLArrayIndex_t)40)    // Number of log2 latency histogram bins
+
 // ADPCM encoder and decoder constants
 #    define ADPCM_DEFAULT_STEP_SIZE SIGLIB_ONE
 
@@ -96,6 +96,8 @@ Update history:
 
 #    define SAI_FftLength(x) (SLArrayIndex_t) pow(SIGLIB_TWO, (const double)x)      // Returns the FFT length for a given log2(FFT length)
 #    define SAI_FftLength4(x) (SLArrayIndex_t) pow(SIGLIB_FOUR, (const double)x)    // Returns the FFT length for a given log4(FFT length)
+#    define SAI_FftPlanCoeffsLength(x) ((SLArrayIndex_t)(2 * (x)))                 // Returns the SIF_FftPlan coefficients length
+#    define SAI_FftBatchTempLength(x) ((SLArrayIndex_t)(SIGLIB_FFT_BATCH_CHANNELS * (x)))    // Returns the batched FFT temporary array length
 
 #    define SDS_BitTest(a, Mask) \
       ((((a) & (Mask)) == (Mask)) ? ((SLArrayIndex_t)1) : ((SLArrayIndex_t)0))    // Returns 1 if all bits in
@@ -307,6 +309,8 @@ Update history:
       ((SLData_t*)SUF_MemoryAllocate(((3 * ((size_t)a)) >> 2) * sizeof(SLData_t)))    // FFT twiddle factor coefficient array
 #    define SUF_FftCoefficientAllocate4(a) \
       ((SLData_t*)SUF_MemoryAllocate(((5 * ((size_t)a)) >> 2) * sizeof(SLData_t)))    // FFT twiddle factor coefficient array
+#    define SUF_FftPlanCoefficientAllocate(a) \
+      ((SLData_t*)SUF_MemoryAllocate(((size_t)SAI_FftPlanCoeffsLength(a)) * sizeof(SLData_t)))    // FFT plan twiddle factor coefficient array
 #    define SUF_FirExtendedArrayAllocate(a) \
       ((SLData_t*)SUF_MemoryAllocate((2 * ((size_t)a)) * sizeof(SLData_t)))    // FIR extended state array filter state array
 #    define SUF_IirStateArrayAllocate(a) ((SLData_t*)SUF_MemoryAllocate((2 * ((size_t)a)) * sizeof(SLData_t)))    // IIR filter state array
@@ -1135,6 +1135,14 @@ typedef double SLFloat64_t;     // 64 bit floating point values
 #      define SIGLIB_FILE_IO_SUPPORTED 1       // File I/O is supported for Debugfprintf functions
 #      define SIGLIB_CONSOLE_IO_SUPPORTED 1    // Console I/O is supported for printf functions
 
+#      ifndef SIGLIB_VECTOR_EXTENSIONS
+#        define SIGLIB_VECTOR_EXTENSIONS 1    // Use GCC vector extensions for the SIMD code paths
+#      endif
+#      if defined(__x86_64__) && defined(__GLIBC__) && !defined(SIGLIB_FUNC_MULTIVERSION)
+#        define SIGLIB_FUNC_MULTIVERSION \
+          __attribute__((target_clones("avx512f", "avx2", "default")))    // Select SSE2 / AVX2 / AVX-512 code at run time
+#      endif
+
 #      define SUF_MemoryAllocate(a) malloc((size_t)(a))    // Define host memory allocation functions
 #      define SUF_MemoryFree(a) free(a)
 
@@ -1577,6 +1585,25 @@ typedef SLFixData_t SLBool_t;        // Boolean values
 typedef SLFixData_t SLError_t;       // SigLib error code values
 typedef SLFixData_t SLStatus_t;      // SigLib status code values
 
+// SIMD vector types - used internally by the vectorized code paths
+#    ifndef SIGLIB_VECTOR_EXTENSIONS
+#      define SIGLIB_VECTOR_EXTENSIONS 0    // SIMD code paths are not supported by this compiler
+#    endif
+#    if (SIGLIB_DATA_SHORT == 1) || (SIGLIB_DATA_LONG == 1) || defined(SWIG)
+#      undef SIGLIB_VECTOR_EXTENSIONS
+#      define SIGLIB_VECTOR_EXTENSIONS 0    // SIMD code paths only support floating point data
+#    endif
+#    ifndef SIGLIB_FUNC_MULTIVERSION
+#      define SIGLIB_FUNC_MULTIVERSION    // Run-time instruction set selection not supported
+#    endif
+#    if (SIGLIB_VECTOR_EXTENSIONS == 1)
+#      define SIGLIB_VECTOR_BYTES 32    // Size of a SIMD vector - maps to 1 AVX register or 2 SSE / NEON registers
+typedef SLData_t SLDataVector_t __attribute__((vector_size(SIGLIB_VECTOR_BYTES)));    // SIMD vector of SigLib data values
+#      define SIGLIB_VECTOR_LENGTH ((SLArrayIndex_t)(SIGLIB_VECTOR_BYTES / sizeof(SLData_t)))    // Number of data values in a vector
+#      define SDV_Load(v, p) memcpy(&(v), (p), sizeof(SLDataVector_t))     // Unaligned vector load
+#      define SDV_Store(p, v) memcpy((p), &(v), sizeof(SLDataVector_t))    // Unaligned vector store
+#    endif
+
 // This section defines the data pointers for the SWIG interface
 #    ifdef SIGLIB_SWIG_SWITCH          // Is this header included by SWIG ?
 #      if (SIGLIB_SWIG_SWITCH == 1)    // No requirement for SWIG declarations for data I/O pointers
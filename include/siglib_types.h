@@ -140,6 +140,121 @@ typedef struct {       // 2D Kalman filter
   SLData_t X[2];       // State estimate [position, velocity]
 } SLKalmanFilter2D_s;
 
+typedef struct {    // Uniformly partitioned overlap and save FIR filter
+  SLArrayIndex_t FilterLength;
+  SLArrayIndex_t PartitionLength;       // Number of samples per block and per filter partition
+  SLArrayIndex_t NumberOfPartitions;    // Length of the frequency domain delay line
+  SLArrayIndex_t FilterPartitions;      // Number of partitions that hold filter coefficients
+  SLArrayIndex_t FFTLength;             // Twice the partition length
+  SLArrayIndex_t Log2FFTLength;
+  SLArrayIndex_t CurrentPartition;    // Frequency domain delay line slot of the latest input spectrum
+  SLArrayIndex_t BlockIndex;          // Number of samples in the current input block
+  SLData_t* pInput;                   // Previous input block followed by the current input block
+  SLData_t* pOutput;                  // Output block, one block behind the input block
+  SLData_t* pRealFreqCoeffs;          // Partition spectra, (PartitionLength + 1) bins per partition
+  SLData_t* pImagFreqCoeffs;
+  SLData_t* pRealDelayLine;    // Frequency domain delay line of input spectra
+  SLData_t* pImagDelayLine;
+  SLData_t* pRealTemp;
+  SLData_t* pImagTemp;
+  SLData_t* pFFTCoeffs;
+  SLArrayIndex_t* pBitReverseAddressTable;
+} SLFirPartitioned_s;
+
+typedef struct {    // Two layer neural network with quantized weights
+  SLArrayIndex_t WeightBits;    // 8 or 16
+  SLArrayIndex_t NumberOfInputNodes;
+  SLArrayIndex_t NumberOfLayer1Nodes;
+  SLArrayIndex_t NumberOfCategories;
+  void* pLayer1Weights;    // SLInt8_t or SLInt16_t weights, transposed and padded, [input nodes][layer 1 nodes]
+  void* pLayer2Weights;    // SLInt8_t or SLInt16_t weights, transposed and padded, [layer 1 nodes][categories]
+  SLData_t Layer1WeightScale;    // Weight value of one quantization step
+  SLData_t Layer2WeightScale;
+  SLData_t* pLayer1Biases;    // SIGLIB_NULL_DATA_PTR if the network does not use biases
+  SLData_t* pLayer2Biases;
+  void* pQuantizedActivations;     // Quantized inputs or layer 1 activations of the current panel of sequences
+  SLData_t* pActivations;          // Layer 1 and layer 2 activations of the current panel of sequences
+  SLData_t* pQuantizationSteps;    // Product quantization step of each sequence in the current panel
+} SLTwoLayerNetworkQuantized_s;
+
+typedef struct {    // Generic rate 1/n soft decision Viterbi decoder
+  SLArrayIndex_t ConstraintLength;
+  SLArrayIndex_t NumberOfStates;     // 2^(constraint length - 1)
+  SLArrayIndex_t NumberOfOutputs;    // Number of polynomials - code rate 1/n
+  SLArrayIndex_t TraceBackDepth;
+  SLArrayIndex_t DecisionWords;      // Number of 64 bit decision words per step
+  SLArrayIndex_t HistoryLength;      // Number of steps in the decision history - trace back depth + block length
+  SLArrayIndex_t HistoryIndex;       // Index of the next step in the decision history
+  SLArrayIndex_t PendingSteps;       // Number of steps that have not been decoded
+  SLFixData_t Symmetric;             // SIGLIB_TRUE if all polynomials tap both ends of the register
+  SLInt16_t* pBranchSigns;           // Sign of each output for each transition, [transition][output][butterfly]
+  SLInt16_t* pPathMetrics;           // Path metrics of the current step
+  SLInt16_t* pNextPathMetrics;       // Path metrics of the next step
+  SLUInt64_t* pDecisions;            // Packed survivor decision bits, [history][decision words]
+} SLViterbiDecoder_s;
+
+typedef struct {    // Running rank order filter
+  SLArrayIndex_t WindowLength;
+  SLArrayIndex_t Rank;              // Rank of the output sample in the sorted window, 0 = minimum
+  SLArrayIndex_t Index;             // Window slot of the oldest sample
+  SLData_t* pWindow;                // Window samples, in arrival order
+  SLArrayIndex_t* pHeap;            // Window slots - max heap of the (Rank + 1) smallest samples then min heap of the rest
+  SLArrayIndex_t* pHeapPosition;    // Position of each window slot in pHeap
+} SLRankFilter_s;
+
+typedef struct {    // Welch power spectrum and coherence
+  SLArrayIndex_t FFTLength;
+  SLArrayIndex_t Log2FFTLength;
+  SLArrayIndex_t SegmentStep;             // FFT length - overlap length
+  SLArrayIndex_t NumberOfShards;          // Number of groups of segments, each with its own FFT arrays and accumulators
+  SLArrayIndex_t ShardWorkspaceLength;    // FFT arrays and accumulators for one shard
+  SLData_t* pWindowCoeffs;                // Window, including the inverse coherent gain
+  SLData_t* pPlanCoeffs;                  // SIF_FftPlan coefficients
+  SLData_t* pWorkspace;
+  SLArrayIndex_t* pBitReverseAddressTable;
+} SLWelch_s;
+
+typedef struct {    // CRC engine
+  SLUInt32_t Polynomial;          // Generator polynomial, msb first, without the x^Width term
+  SLArrayIndex_t Width;           // CRC width, 1 to 32 bits
+  SLUInt32_t Init;                // Initial CRC value
+  SLUInt32_t XorOut;              // Value XORed with the final CRC
+  SLFixData_t ReflectIn;          // Input bytes are processed lsb first
+  SLFixData_t ReflectOut;         // Final CRC is bit reversed
+  SLUInt64_t FoldConstants[4];    // x^128, x^192, x^512 and x^576 modulo the polynomial, for carry-less multiply folding
+  SLUInt32_t* pTable;             // Slicing-by-8 tables, 8 x 256 entries
+} SLCrc_s;
+
+typedef struct {    // Multi-channel QPSK and 16-QAM modem
+  SLArrayIndex_t NumberOfChannels;
+  SLArrayIndex_t SamplesPerSymbol;
+  SLArrayIndex_t CarrierTableSize;
+  SLArrayIndex_t CarrierTableIncrement;
+  SLArrayIndex_t NcoLength;    // Period of the carrier phase sequence
+  SLArrayIndex_t RRCFSize;
+  SLArrayIndex_t RRCFSwitch;
+  SLArrayIndex_t PolyphaseLength;    // Number of symbols spanned by the RRC filter
+  SLArrayIndex_t WorkspaceLength;    // Sample and symbol history buffers for one channel
+  SLData_t* pCarrierTable;           // 1 + 1/4 wave overlapped sine and cosine table
+  SLData_t* pNcoCos;                 // Carrier cos and sin sequences, NcoLength + SamplesPerSymbol
+  SLData_t* pNcoSin;
+  SLData_t* pRRCFCoeffs;
+  SLData_t* pPolyphaseCoeffs;    // RRC coefficients in [symbol][phase] order, zero padded
+  SLData_t* pCarrierPhase;       // Per channel state, as used by the single channel modems
+  SLComplexRect_s* pMagn;
+  SLData_t* pRRCFIStateArray;    // RRCF state arrays, NumberOfChannels x RRCFSize
+  SLData_t* pRRCFQStateArray;
+  SLData_t* pWorkspace;
+  SLArrayIndex_t* pNcoIndex;    // Position in the carrier sequences of each carrier table phase
+  SLArrayIndex_t* pSampleClock;
+  SLArrayIndex_t* pRRCFIFilterIndex;
+  SLArrayIndex_t* pRRCFQFilterIndex;
+} SLQamModemMultiChannel_s;
+
+// Parallel execution
+typedef void (*SLParallelTask_t)(void*, SLArrayIndex_t);                     // Task function - context pointer, task index
+typedef void (*SLParallelFor_t)(SLParallelTask_t, void*, SLArrayIndex_t);    // Parallel executor - task, context pointer, number of tasks
+
 // SigLib enumerated data types
 enum SLWindow_t {    // Window types
   SIGLIB_HANNING_FOURIER,
@@ -300,6 +415,16 @@ enum SLEndianType_t {    // Endian type
   SIGLIB_BIG_ENDIAN
 };
 
+enum SLSampleFormat_t {    // Sample file data formats
+  SIGLIB_SAMPLE_UINT8,      // Offset binary, as used in 8 bit .wav files
+  SIGLIB_SAMPLE_INT8,
+  SIGLIB_SAMPLE_INT16,
+  SIGLIB_SAMPLE_INT24,
+  SIGLIB_SAMPLE_INT32,
+  SIGLIB_SAMPLE_FLOAT32,
+  SIGLIB_SAMPLE_FLOAT64
+};
+
 enum SLDeGlitchMode_t {    // Data de-glitch modes
   SIGLIB_DEGLITCH_ABOVE = 1,
   SIGLIB_DEGLITCH_BOTH = 0,
@@ -335,6 +460,75 @@ enum SLPadModeType_t {    // Array padding mode type
   SIGLIB_ARRAY_PAD_MODE_CONSTANT
 };
 
+enum SLFirAutoMethod_t {           // SDA_FirAuto filtering method
+  SIGLIB_FIR_AUTO_SELECT = 0,      // Select the fastest method from the filter and block lengths
+  SIGLIB_FIR_AUTO_TIME_DOMAIN,     // Time domain FIR filter
+  SIGLIB_FIR_AUTO_OVERLAP_SAVE,    // Overlap and save frequency domain filter
+  SIGLIB_FIR_AUTO_PARTITIONED      // Uniformly partitioned overlap and save filter, adds latency
+};
+
+enum SLProfileFunction_t {    // Functions profiled when SIGLIB_ENABLE_PROFILING = 1
+  SIGLIB_PROFILE_SDA_FIR,
+  SIGLIB_PROFILE_SDA_IIR,
+  SIGLIB_PROFILE_SDA_RFFT,
+  SIGLIB_PROFILE_SDA_CFFT,
+  SIGLIB_PROFILE_SDS_COSTAS_QAM_DEMODULATE,
+  SIGLIB_PROFILE_SDA_COSTAS_QAM_DEMODULATE,
+  SIGLIB_PROFILE_SDA_QPSK_DEMODULATE,
+  SIGLIB_PROFILE_SDA_QAM16_DEMODULATE,
+  SIGLIB_PROFILE_SDA_FSK_DEMODULATE,
+  SIGLIB_PROFILE_SDA_OPSK_DEMODULATE,
+  SIGLIB_PROFILE_SDA_BPSK_DEMODULATE,
+  SIGLIB_PROFILE_SDA_DPSK_DEMODULATE,
+  SIGLIB_PROFILE_USER_0,    // Available for application functions
+  SIGLIB_PROFILE_USER_1,
+  SIGLIB_PROFILE_USER_2,
+  SIGLIB_PROFILE_USER_3,
+  SIGLIB_PROFILE_FUNCTION_COUNT    // Number of profiled functions
+};
+
+// SigLib structures that use enumerated data types
+typedef struct {                             // Automatically selected time / frequency domain FIR filter
+  enum SLFirAutoMethod_t RequestedMethod;    // Method requested by the application
+  enum SLFirAutoMethod_t Method;             // Method in use
+  SLArrayIndex_t MaxFilterLength;
+  SLArrayIndex_t FilterLength;
+  SLArrayIndex_t BlockLength;    // Maximum number of samples per call
+  SLArrayIndex_t InputOffset;    // Offset of the filter history in the input array
+  SLArrayIndex_t FFTLength;      // Overlap and save FFT length
+  SLArrayIndex_t Log2FFTLength;
+  SLArrayIndex_t FFTBlockLength;    // Number of outputs per overlap and save FFT
+  SLData_t InverseFFTLength;
+  SLData_t* pInput;             // Filter history followed by the input samples
+  SLData_t* pReversedCoeffs;    // Time domain coefficients, in reverse order
+  SLData_t* pRealFreqCoeffs;    // Overlap and save frequency domain coefficients
+  SLData_t* pImagFreqCoeffs;
+  SLData_t* pRealTemp;
+  SLData_t* pImagTemp;
+  SLData_t* pFFTCoeffs;
+  SLArrayIndex_t* pBitReverseAddressTable;
+  SLArrayIndex_t Latency;            // Latency added by the method in use, in samples
+  SLFirPartitioned_s Partitioned;    // Uniformly partitioned filter, when a latency is allowed
+} SLFirAuto_s;
+
+typedef struct {    // Block sample file reader / writer
+  FILE* p_ioFile;
+  enum SLSampleFormat_t SampleFormat;
+  enum SLEndianType_t EndianMode;
+  SLArrayIndex_t NumberOfChannels;
+  SLArrayIndex_t BytesPerSample;     // Bytes per sample of one channel
+  SLArrayIndex_t BytesPerFrame;      // Bytes per sample of all channels
+  SLData_t Scale;                    // File sample value to SLData_t scaling
+  SLData_t InverseScale;             // SLData_t to file sample value scaling
+  SLInt64_t DataStart;               // File offset of the first frame, -1 if the file is not seekable
+  SLArrayIndex_t FrameCount;         // Number of frames in the file, -1 if not known
+  SLArrayIndex_t FramePosition;      // Next frame to be read or written
+  SLFixData_t FileOwnedFlag;         // SIGLIB_TRUE if the file is closed by SUF_SampleFileClose
+  SLFixData_t WavWriteFlag;          // SIGLIB_TRUE if the .wav header is updated by SUF_SampleFileClose
+  SLFixData_t WrapFlag;              // SIGLIB_TRUE to keep the low bits of out of range integer samples, instead of saturating
+  SLWavFileInfo_s WavInfo;
+} SLSampleFile_s;
+
 #  endif    // End of #if _SIGLIB_TYPES_H
 
 #endif    // End of #if SIGLIB
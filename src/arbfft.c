@@ -357,3 +357,768 @@ void SIGLIB_FUNC_DECL SDA_CifftArb(const SLData_t* SIGLIB_PTR_DECL pSrcReal, con
     SDA_Multiply(pImagDst, SIGLIB_MINUS_ONE, pImagDst, sampleLength);
   }
 }    // End of SDA_CifftArb()
+
+/********************************************************
+ * Function: siglib_numerix_FftArbFactorise
+ *
+ * Parameters:
+ *  const SLArrayIndex_t transformLength    - Transform length
+ *  SLArrayIndex_t *pRadices                - Pointer to radix array / NULL
+ *
+ * Return value:
+ *  Number of radix-4, 2, 3 and 5 stages or -1 if the
+ *  length has any other prime factor
+ *
+ * Description:
+ *  Factorise the transform length for the mixed radix
+ *  FFT.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_FftArbFactorise(const SLArrayIndex_t transformLength, SLArrayIndex_t* pRadices)
+{
+  static const SLArrayIndex_t Radices[] = {4, 2, 3, 5};
+  SLArrayIndex_t RemainingLength = transformLength;
+  SLArrayIndex_t NumberOfStages = 0;
+
+  for (SLArrayIndex_t i = 0; i < SAI_NumberOfElements(Radices); i++) {
+    while ((RemainingLength % Radices[i]) == 0) {
+      if (pRadices != SIGLIB_NULL_ARRAY_INDEX_PTR) {
+        pRadices[NumberOfStages] = Radices[i];
+      }
+      NumberOfStages++;
+      RemainingLength /= Radices[i];
+    }
+  }
+
+  if (RemainingLength != 1) {
+    return ((SLArrayIndex_t)-1);
+  }
+  return (NumberOfStages);
+}    // End of siglib_numerix_FftArbFactorise()
+
+/********************************************************
+ * Function: siglib_numerix_FftArbChirpLength
+ *
+ * Parameters:
+ *  const SLArrayIndex_t sampleLength   - Buffer length
+ *
+ * Return value:
+ *  Mixed radix FFT length used for the chirp z-transform
+ *
+ * Description:
+ *  Return the smallest length >= (2 * sampleLength - 1)
+ *  that only has factors of 2, 3 and 5.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_FftArbChirpLength(const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t ChirpLength = (SLArrayIndex_t)((2 * sampleLength) - 1);
+  while (siglib_numerix_FftArbFactorise(ChirpLength, SIGLIB_NULL_ARRAY_INDEX_PTR) < 0) {
+    ChirpLength++;
+  }
+  return (ChirpLength);
+}    // End of siglib_numerix_FftArbChirpLength()
+
+/********************************************************
+ * Function: siglib_numerix_FftArbStage
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,       - Real source data array pointer
+ *  const SLData_t *pSrcImag,       - Imaginary source data array pointer
+ *  SLData_t *pDstReal,             - Real destination data array pointer
+ *  SLData_t *pDstImag,             - Imaginary destination data array pointer
+ *  const SLData_t *pTwiddles,      - Stage twiddle factors (cos, sin pairs)
+ *  const SLArrayIndex_t Radix,     - Stage radix
+ *  const SLArrayIndex_t SubLength, - Length of the sub-transforms
+ *  const SLArrayIndex_t Stride     - Stride between the sub-transforms
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform one self sorting (Stockham) decimation in
+ *  frequency stage of the mixed radix FFT.
+ *  The inner loop runs over the contiguous sub-transforms
+ *  so that it is vectorised by the compiler.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FftArbStage(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                                                SLData_t* SIGLIB_PTR_DECL pDstReal, SLData_t* SIGLIB_PTR_DECL pDstImag,
+                                                                const SLData_t* SIGLIB_PTR_DECL pTwiddles, const SLArrayIndex_t Radix,
+                                                                const SLArrayIndex_t SubLength, const SLArrayIndex_t Stride)
+{
+  const SLArrayIndex_t m = SubLength / Radix;
+  const SLArrayIndex_t sm = Stride * m;
+
+  switch (Radix) {
+  case 4:
+    for (SLArrayIndex_t p = 0; p < m; p++) {
+      const SLData_t Cos1 = pTwiddles[6 * p], Sin1 = pTwiddles[6 * p + 1];
+      const SLData_t Cos2 = pTwiddles[6 * p + 2], Sin2 = pTwiddles[6 * p + 3];
+      const SLData_t Cos3 = pTwiddles[6 * p + 4], Sin3 = pTwiddles[6 * p + 5];
+      const SLData_t* SIGLIB_PTR_DECL pXr = pSrcReal + Stride * p;
+      const SLData_t* SIGLIB_PTR_DECL pXi = pSrcImag + Stride * p;
+      SLData_t* SIGLIB_PTR_DECL pYr = pDstReal + Stride * 4 * p;
+      SLData_t* SIGLIB_PTR_DECL pYi = pDstImag + Stride * 4 * p;
+      for (SLArrayIndex_t q = 0; q < Stride; q++) {
+        SLData_t s02r = pXr[q] + pXr[q + 2 * sm];
+        SLData_t s02i = pXi[q] + pXi[q + 2 * sm];
+        SLData_t d02r = pXr[q] - pXr[q + 2 * sm];
+        SLData_t d02i = pXi[q] - pXi[q + 2 * sm];
+        SLData_t s13r = pXr[q + sm] + pXr[q + 3 * sm];
+        SLData_t s13i = pXi[q + sm] + pXi[q + 3 * sm];
+        SLData_t d13r = pXr[q + sm] - pXr[q + 3 * sm];
+        SLData_t d13i = pXi[q + sm] - pXi[q + 3 * sm];
+
+        SLData_t b1r = d02r + d13i;
+        SLData_t b1i = d02i - d13r;
+        SLData_t b2r = s02r - s13r;
+        SLData_t b2i = s02i - s13i;
+        SLData_t b3r = d02r - d13i;
+        SLData_t b3i = d02i + d13r;
+
+        pYr[q] = s02r + s13r;
+        pYi[q] = s02i + s13i;
+        pYr[q + Stride] = Cos1 * b1r + Sin1 * b1i;
+        pYi[q + Stride] = Cos1 * b1i - Sin1 * b1r;
+        pYr[q + 2 * Stride] = Cos2 * b2r + Sin2 * b2i;
+        pYi[q + 2 * Stride] = Cos2 * b2i - Sin2 * b2r;
+        pYr[q + 3 * Stride] = Cos3 * b3r + Sin3 * b3i;
+        pYi[q + 3 * Stride] = Cos3 * b3i - Sin3 * b3r;
+      }
+    }
+    break;
+
+  case 2:
+    for (SLArrayIndex_t p = 0; p < m; p++) {
+      const SLData_t Cos1 = pTwiddles[2 * p], Sin1 = pTwiddles[2 * p + 1];
+      const SLData_t* SIGLIB_PTR_DECL pXr = pSrcReal + Stride * p;
+      const SLData_t* SIGLIB_PTR_DECL pXi = pSrcImag + Stride * p;
+      SLData_t* SIGLIB_PTR_DECL pYr = pDstReal + Stride * 2 * p;
+      SLData_t* SIGLIB_PTR_DECL pYi = pDstImag + Stride * 2 * p;
+      for (SLArrayIndex_t q = 0; q < Stride; q++) {
+        SLData_t b1r = pXr[q] - pXr[q + sm];
+        SLData_t b1i = pXi[q] - pXi[q + sm];
+        pYr[q] = pXr[q] + pXr[q + sm];
+        pYi[q] = pXi[q] + pXi[q + sm];
+        pYr[q + Stride] = Cos1 * b1r + Sin1 * b1i;
+        pYi[q + Stride] = Cos1 * b1i - Sin1 * b1r;
+      }
+    }
+    break;
+
+  case 3: {
+    const SLData_t Sin60 = SIGLIB_SQRT_THREE * SIGLIB_HALF;
+    for (SLArrayIndex_t p = 0; p < m; p++) {
+      const SLData_t Cos1 = pTwiddles[4 * p], Sin1 = pTwiddles[4 * p + 1];
+      const SLData_t Cos2 = pTwiddles[4 * p + 2], Sin2 = pTwiddles[4 * p + 3];
+      const SLData_t* SIGLIB_PTR_DECL pXr = pSrcReal + Stride * p;
+      const SLData_t* SIGLIB_PTR_DECL pXi = pSrcImag + Stride * p;
+      SLData_t* SIGLIB_PTR_DECL pYr = pDstReal + Stride * 3 * p;
+      SLData_t* SIGLIB_PTR_DECL pYi = pDstImag + Stride * 3 * p;
+      for (SLArrayIndex_t q = 0; q < Stride; q++) {
+        SLData_t tr = pXr[q + sm] + pXr[q + 2 * sm];
+        SLData_t ti = pXi[q + sm] + pXi[q + 2 * sm];
+        SLData_t dr = Sin60 * (pXr[q + sm] - pXr[q + 2 * sm]);
+        SLData_t di = Sin60 * (pXi[q + sm] - pXi[q + 2 * sm]);
+        SLData_t ar = pXr[q] - SIGLIB_HALF * tr;
+        SLData_t ai = pXi[q] - SIGLIB_HALF * ti;
+
+        SLData_t b1r = ar + di;
+        SLData_t b1i = ai - dr;
+        SLData_t b2r = ar - di;
+        SLData_t b2i = ai + dr;
+
+        pYr[q] = pXr[q] + tr;
+        pYi[q] = pXi[q] + ti;
+        pYr[q + Stride] = Cos1 * b1r + Sin1 * b1i;
+        pYi[q + Stride] = Cos1 * b1i - Sin1 * b1r;
+        pYr[q + 2 * Stride] = Cos2 * b2r + Sin2 * b2i;
+        pYi[q + 2 * Stride] = Cos2 * b2i - Sin2 * b2r;
+      }
+    }
+  } break;
+
+  case 5: {
+    const SLData_t c1 = SDS_Cos(SIGLIB_TWO_PI / SIGLIB_FIVE), c2 = SDS_Cos(SIGLIB_TWO * SIGLIB_TWO_PI / SIGLIB_FIVE);
+    const SLData_t s1 = SDS_Sin(SIGLIB_TWO_PI / SIGLIB_FIVE), s2 = SDS_Sin(SIGLIB_TWO * SIGLIB_TWO_PI / SIGLIB_FIVE);
+    for (SLArrayIndex_t p = 0; p < m; p++) {
+      const SLData_t* SIGLIB_PTR_DECL pW = pTwiddles + 8 * p;
+      const SLData_t* SIGLIB_PTR_DECL pXr = pSrcReal + Stride * p;
+      const SLData_t* SIGLIB_PTR_DECL pXi = pSrcImag + Stride * p;
+      SLData_t* SIGLIB_PTR_DECL pYr = pDstReal + Stride * 5 * p;
+      SLData_t* SIGLIB_PTR_DECL pYi = pDstImag + Stride * 5 * p;
+      for (SLArrayIndex_t q = 0; q < Stride; q++) {
+        SLData_t t1r = pXr[q + sm] + pXr[q + 4 * sm];
+        SLData_t t1i = pXi[q + sm] + pXi[q + 4 * sm];
+        SLData_t t2r = pXr[q + 2 * sm] + pXr[q + 3 * sm];
+        SLData_t t2i = pXi[q + 2 * sm] + pXi[q + 3 * sm];
+        SLData_t d1r = pXr[q + sm] - pXr[q + 4 * sm];
+        SLData_t d1i = pXi[q + sm] - pXi[q + 4 * sm];
+        SLData_t d2r = pXr[q + 2 * sm] - pXr[q + 3 * sm];
+        SLData_t d2i = pXi[q + 2 * sm] - pXi[q + 3 * sm];
+
+        SLData_t a1r = pXr[q] + c1 * t1r + c2 * t2r;
+        SLData_t a1i = pXi[q] + c1 * t1i + c2 * t2i;
+        SLData_t a2r = pXr[q] + c2 * t1r + c1 * t2r;
+        SLData_t a2i = pXi[q] + c2 * t1i + c1 * t2i;
+        SLData_t x1r = s1 * d1r + s2 * d2r;
+        SLData_t x1i = s1 * d1i + s2 * d2i;
+        SLData_t x2r = s2 * d1r - s1 * d2r;
+        SLData_t x2i = s2 * d1i - s1 * d2i;
+
+        SLData_t b1r = a1r + x1i;
+        SLData_t b1i = a1i - x1r;
+        SLData_t b2r = a2r + x2i;
+        SLData_t b2i = a2i - x2r;
+        SLData_t b3r = a2r - x2i;
+        SLData_t b3i = a2i + x2r;
+        SLData_t b4r = a1r - x1i;
+        SLData_t b4i = a1i + x1r;
+
+        pYr[q] = pXr[q] + t1r + t2r;
+        pYi[q] = pXi[q] + t1i + t2i;
+        pYr[q + Stride] = pW[0] * b1r + pW[1] * b1i;
+        pYi[q + Stride] = pW[0] * b1i - pW[1] * b1r;
+        pYr[q + 2 * Stride] = pW[2] * b2r + pW[3] * b2i;
+        pYi[q + 2 * Stride] = pW[2] * b2i - pW[3] * b2r;
+        pYr[q + 3 * Stride] = pW[4] * b3r + pW[5] * b3i;
+        pYi[q + 3 * Stride] = pW[4] * b3i - pW[5] * b3r;
+        pYr[q + 4 * Stride] = pW[6] * b4r + pW[7] * b4i;
+        pYi[q + 4 * Stride] = pW[6] * b4i - pW[7] * b4r;
+      }
+    }
+  } break;
+  }
+}    // End of siglib_numerix_FftArbStage()
+
+/********************************************************
+ * Function: siglib_numerix_FftArbMixedRadix
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,       - Real source data array pointer
+ *  const SLData_t *pSrcImag,       - Imaginary source data array pointer
+ *  SLData_t *pRealDst,             - Real destination data array pointer
+ *  SLData_t *pImagDst,             - Imaginary destination data array pointer
+ *  SLData_t *pRealWork,            - Real work array pointer
+ *  SLData_t *pImagWork,            - Imaginary work array pointer
+ *  const SLArrayIndex_t *pRadices, - Pointer to stage radices
+ *  const SLArrayIndex_t NumberOfStages,    - Number of stages
+ *  const SLData_t *pTwiddles,      - Twiddle factors for all stages
+ *  const SLArrayIndex_t transformLength    - Transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a mixed radix-4, 2, 3, 5 forward FFT. The
+ *  stages alternate between the destination and the work
+ *  arrays so that the results end in the destination
+ *  array, in natural order. The source and destination
+ *  arrays may be the same.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftArbMixedRadix(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                            SLData_t* SIGLIB_PTR_DECL pRealDst, SLData_t* SIGLIB_PTR_DECL pImagDst,
+                                            SLData_t* SIGLIB_PTR_DECL pRealWork, SLData_t* SIGLIB_PTR_DECL pImagWork,
+                                            const SLArrayIndex_t* SIGLIB_PTR_DECL pRadices, const SLArrayIndex_t NumberOfStages,
+                                            const SLData_t* SIGLIB_PTR_DECL pTwiddles, const SLArrayIndex_t transformLength)
+{
+  if (NumberOfStages == 0) {    // Unity length transform
+    pRealDst[0] = pSrcReal[0];
+    pImagDst[0] = pSrcImag[0];
+    return;
+  }
+
+  SLData_t *pOutReal, *pOutImag, *pNextReal, *pNextImag;
+  if ((NumberOfStages & 1) != 0) {    // Odd number of stages - first stage writes to the destination
+    if (pSrcReal == pRealDst) {       // In-place so move the source out of the way
+      SDA_Copy(pSrcReal, pRealWork, transformLength);
+      SDA_Copy(pSrcImag, pImagWork, transformLength);
+      pSrcReal = pRealWork;
+      pSrcImag = pImagWork;
+    }
+    pOutReal = pRealDst;
+    pOutImag = pImagDst;
+    pNextReal = pRealWork;
+    pNextImag = pImagWork;
+  } else {
+    pOutReal = pRealWork;
+    pOutImag = pImagWork;
+    pNextReal = pRealDst;
+    pNextImag = pImagDst;
+  }
+
+  SLArrayIndex_t SubLength = transformLength;
+  SLArrayIndex_t Stride = 1;
+  for (SLArrayIndex_t i = 0; i < NumberOfStages; i++) {
+    siglib_numerix_FftArbStage(pSrcReal, pSrcImag, pOutReal, pOutImag, pTwiddles, pRadices[i], SubLength, Stride);
+
+    pTwiddles += 2 * (pRadices[i] - 1) * (SubLength / pRadices[i]);
+    SubLength /= pRadices[i];
+    Stride *= pRadices[i];
+
+    pSrcReal = pOutReal;    // Swap the buffers for the next stage
+    pSrcImag = pOutImag;
+    pOutReal = pNextReal;
+    pOutImag = pNextImag;
+    pNextReal = (SLData_t*)pSrcReal;
+    pNextImag = (SLData_t*)pSrcImag;
+  }
+}    // End of siglib_numerix_FftArbMixedRadix()
+
+/********************************************************
+ * Function: siglib_numerix_FftArbPlanExecute
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,   - Real source data array pointer
+ *  const SLData_t *pSrcImag,   - Imaginary source data array pointer
+ *  SLData_t *pRealDst,         - Real destination data array pointer
+ *  SLData_t *pImagDst,         - Imaginary destination data array pointer
+ *  SLData_t *pRealTemp,        - Real temporary data array pointer
+ *  SLData_t *pImagTemp,        - Imaginary temporary data array pointer
+ *  const SLArrayIndex_t *pPlanInfo,    - Pointer to plan information
+ *  const SLData_t *pPlanCoeffs,        - Pointer to plan coefficients
+ *  const SLData_t Scale,       - Output scaling
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a forward arbitrary length FFT using a plan
+ *  created with SIF_FftArbPlan. The inverse transform
+ *  is calculated by swapping the real and imaginary
+ *  pointers.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftArbPlanExecute(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                             SLData_t* SIGLIB_PTR_DECL pRealDst, SLData_t* SIGLIB_PTR_DECL pImagDst,
+                                             SLData_t* SIGLIB_PTR_DECL pRealTemp, SLData_t* SIGLIB_PTR_DECL pImagTemp,
+                                             const SLArrayIndex_t* SIGLIB_PTR_DECL pPlanInfo, const SLData_t* SIGLIB_PTR_DECL pPlanCoeffs,
+                                             const SLData_t Scale, const SLArrayIndex_t sampleLength)
+{
+  const SLArrayIndex_t transformLength = pPlanInfo[SIGLIB_FFT_ARB_PLAN_LENGTH_INDEX];
+  const SLArrayIndex_t NumberOfStages = pPlanInfo[SIGLIB_FFT_ARB_PLAN_STAGES_INDEX];
+  const SLArrayIndex_t* pRadices = pPlanInfo + SIGLIB_FFT_ARB_PLAN_RADICES_INDEX;
+
+  if (pPlanInfo[SIGLIB_FFT_ARB_PLAN_MODE_INDEX] == (SLArrayIndex_t)SIGLIB_ARB_FFT_DO_FFT) {    // Mixed radix FFT
+    siglib_numerix_FftArbMixedRadix(pSrcReal, pSrcImag, pRealDst, pImagDst, pRealTemp, pImagTemp, pRadices, NumberOfStages, pPlanCoeffs,
+                                    sampleLength);
+    if (Scale != SIGLIB_ONE) {
+      SDA_ComplexScalarMultiply(pRealDst, pImagDst, Scale, pRealDst, pImagDst, sampleLength);
+    }
+  }
+
+  else {    // Chirp z-transform : one FFT, a multiply by the chirp spectrum and one inverse FFT
+    const SLData_t* pChirpReal = pPlanCoeffs + 2 * transformLength;
+    const SLData_t* pChirpImag = pChirpReal + sampleLength;
+    const SLData_t* pChirpSpectrumReal = pChirpImag + sampleLength;
+    const SLData_t* pChirpSpectrumImag = pChirpSpectrumReal + transformLength;
+    SLData_t* pRealWork = pRealTemp + transformLength;
+    SLData_t* pImagWork = pImagTemp + transformLength;
+
+    for (SLArrayIndex_t i = 0; i < sampleLength; i++) {    // Multiply by the conjugate chirp
+      SLData_t RealSrc = pSrcReal[i];
+      pRealTemp[i] = RealSrc * pChirpReal[i] + pSrcImag[i] * pChirpImag[i];
+      pImagTemp[i] = pSrcImag[i] * pChirpReal[i] - RealSrc * pChirpImag[i];
+    }
+    SDA_Zeros(pRealTemp + sampleLength, transformLength - sampleLength);
+    SDA_Zeros(pImagTemp + sampleLength, transformLength - sampleLength);
+
+    siglib_numerix_FftArbMixedRadix(pRealTemp, pImagTemp, pRealTemp, pImagTemp, pRealWork, pImagWork, pRadices, NumberOfStages, pPlanCoeffs,
+                                    transformLength);
+    SDA_ComplexMultiply2(pRealTemp, pImagTemp, pChirpSpectrumReal, pChirpSpectrumImag, pRealTemp, pImagTemp, transformLength);
+    siglib_numerix_FftArbMixedRadix(pImagTemp, pRealTemp, pImagTemp, pRealTemp, pImagWork, pRealWork, pRadices, NumberOfStages, pPlanCoeffs,
+                                    transformLength);    // IFFT
+
+    for (SLArrayIndex_t i = 0; i < sampleLength; i++) {    // Multiply by the conjugate chirp and scale
+      pRealDst[i] = Scale * (pRealTemp[i] * pChirpReal[i] + pImagTemp[i] * pChirpImag[i]);
+      pImagDst[i] = Scale * (pImagTemp[i] * pChirpReal[i] - pRealTemp[i] * pChirpImag[i]);
+    }
+  }
+}    // End of siglib_numerix_FftArbPlanExecute()
+
+/********************************************************
+ * Function: SUF_FftArbPlanCoeffsLength
+ *
+ * Parameters:
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  Length of the plan coefficient array
+ *
+ * Description:
+ *  Return the length of the coefficient array required
+ *  by SIF_FftArbPlan.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftArbPlanCoeffsLength(const SLArrayIndex_t sampleLength)
+{
+  if (siglib_numerix_FftArbFactorise(sampleLength, SIGLIB_NULL_ARRAY_INDEX_PTR) >= 0) {    // Mixed radix FFT
+    return ((SLArrayIndex_t)(2 * sampleLength));
+  }
+
+  // Chirp z-transform - twiddle factors, chirp and chirp spectrum
+  SLArrayIndex_t ChirpLength = siglib_numerix_FftArbChirpLength(sampleLength);
+  return ((SLArrayIndex_t)((4 * ChirpLength) + (2 * sampleLength)));
+}    // End of SUF_FftArbPlanCoeffsLength()
+
+/********************************************************
+ * Function: SUF_FftArbPlanTempLength
+ *
+ * Parameters:
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  Length of each of the real and imaginary temporary
+ *  arrays
+ *
+ * Description:
+ *  Return the length of the temporary arrays required
+ *  by SIF_FftArbPlan, SDA_CfftArbPlan and
+ *  SDA_CifftArbPlan.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftArbPlanTempLength(const SLArrayIndex_t sampleLength)
+{
+  if (siglib_numerix_FftArbFactorise(sampleLength, SIGLIB_NULL_ARRAY_INDEX_PTR) >= 0) {    // Mixed radix FFT
+    return (sampleLength);
+  }
+  return ((SLArrayIndex_t)(2 * siglib_numerix_FftArbChirpLength(sampleLength)));    // Chirp z-transform
+}    // End of SUF_FftArbPlanTempLength()
+
+/********************************************************
+ * Function: SIF_FftArbPlan
+ *
+ * Parameters:
+ *  SLArrayIndex_t *pPlanInfo,  - Pointer to plan information
+ *  SLData_t *pPlanCoeffs,      - Pointer to plan coefficients
+ *  SLData_t *pRealTemp,        - Real temporary data array pointer
+ *  SLData_t *pImagTemp,        - Imaginary temporary data array pointer
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Initialise an arbitrary length FFT plan.
+ *  Lengths that only have factors of 2, 3 and 5 use a
+ *  mixed radix FFT. All other lengths use the chirp
+ *  z-transform (Bluestein's algorithm), with a mixed
+ *  radix FFT of length >= (2 * sampleLength - 1) and the
+ *  chirp spectrum precalculated here.
+ *  The plan coefficient array length is given by
+ *  SUF_FftArbPlanCoeffsLength and the temporary array
+ *  lengths by SUF_FftArbPlanTempLength.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SIF_FftArbPlan(SLArrayIndex_t* SIGLIB_PTR_DECL pPlanInfo, SLData_t* SIGLIB_PTR_DECL pPlanCoeffs,
+                                     SLData_t* SIGLIB_PTR_DECL pRealTemp, SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t* pRadices = pPlanInfo + SIGLIB_FFT_ARB_PLAN_RADICES_INDEX;
+  SLArrayIndex_t transformLength;
+
+  if (siglib_numerix_FftArbFactorise(sampleLength, SIGLIB_NULL_ARRAY_INDEX_PTR) >= 0) {    // Mixed radix FFT
+    pPlanInfo[SIGLIB_FFT_ARB_PLAN_MODE_INDEX] = (SLArrayIndex_t)SIGLIB_ARB_FFT_DO_FFT;
+    transformLength = sampleLength;
+  } else {    // Chirp z-transform
+    pPlanInfo[SIGLIB_FFT_ARB_PLAN_MODE_INDEX] = (SLArrayIndex_t)SIGLIB_ARB_FFT_DO_CZT;
+    transformLength = siglib_numerix_FftArbChirpLength(sampleLength);
+  }
+  pPlanInfo[SIGLIB_FFT_ARB_PLAN_LENGTH_INDEX] = transformLength;
+  pPlanInfo[SIGLIB_FFT_ARB_PLAN_STAGES_INDEX] = siglib_numerix_FftArbFactorise(transformLength, pRadices);
+
+  // Twiddle factors for each stage : W^(p*k) for each sub-transform index p and output k = 1 .. Radix-1
+  SLData_t* pTwiddles = pPlanCoeffs;
+  SLArrayIndex_t SubLength = transformLength;
+  SLArrayIndex_t Stride = 1;
+  for (SLArrayIndex_t i = 0; i < pPlanInfo[SIGLIB_FFT_ARB_PLAN_STAGES_INDEX]; i++) {
+    SLArrayIndex_t Radix = pRadices[i];
+    for (SLArrayIndex_t p = 0; p < (SubLength / Radix); p++) {
+      for (SLArrayIndex_t k = 1; k < Radix; k++) {
+        SLUInt64_t Phase = ((SLUInt64_t)p * (SLUInt64_t)k * (SLUInt64_t)Stride) % (SLUInt64_t)transformLength;
+        SLData_t Angle = (SIGLIB_TWO_PI * (SLData_t)Phase) / (SLData_t)transformLength;
+        *pTwiddles++ = SDS_Cos(Angle);
+        *pTwiddles++ = SDS_Sin(Angle);
+      }
+    }
+    SubLength /= Radix;
+    Stride *= Radix;
+  }
+
+  if (pPlanInfo[SIGLIB_FFT_ARB_PLAN_MODE_INDEX] == (SLArrayIndex_t)SIGLIB_ARB_FFT_DO_CZT) {
+    SLData_t* pChirpReal = pPlanCoeffs + 2 * transformLength;
+    SLData_t* pChirpImag = pChirpReal + sampleLength;
+    SLData_t* pChirpSpectrumReal = pChirpImag + sampleLength;
+    SLData_t* pChirpSpectrumImag = pChirpSpectrumReal + transformLength;
+
+    // Chirp : exp(j*pi*n^2/N), n^2 is calculated modulo 2N to retain the precision for long transforms
+    for (SLArrayIndex_t i = 0; i < sampleLength; i++) {
+      SLData_t Angle = (SIGLIB_PI * (SLData_t)(((SLUInt64_t)i * (SLUInt64_t)i) % (SLUInt64_t)(2 * sampleLength))) / (SLData_t)sampleLength;
+      pChirpReal[i] = SDS_Cos(Angle);
+      pChirpImag[i] = SDS_Sin(Angle);
+    }
+
+    // Chirp spectrum, including the 1/M scaling of the inverse FFT
+    SDA_Zeros(pRealTemp, transformLength);
+    SDA_Zeros(pImagTemp, transformLength);
+    for (SLArrayIndex_t i = 0; i < sampleLength; i++) {
+      pRealTemp[i] = pChirpReal[i] / (SLData_t)transformLength;
+      pImagTemp[i] = pChirpImag[i] / (SLData_t)transformLength;
+    }
+    for (SLArrayIndex_t i = 1; i < sampleLength; i++) {
+      pRealTemp[transformLength - i] = pRealTemp[i];
+      pImagTemp[transformLength - i] = pImagTemp[i];
+    }
+    siglib_numerix_FftArbMixedRadix(pRealTemp, pImagTemp, pChirpSpectrumReal, pChirpSpectrumImag, pRealTemp + transformLength,
+                                    pImagTemp + transformLength, pRadices, pPlanInfo[SIGLIB_FFT_ARB_PLAN_STAGES_INDEX], pPlanCoeffs,
+                                    transformLength);
+  }
+}    // End of SIF_FftArbPlan()
+
+/********************************************************
+ * Function: SDA_CfftArbPlan
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,   - Real source data array pointer
+ *  const SLData_t *pSrcImag,   - Imaginary source data array pointer
+ *  SLData_t *pRealDst,         - Real destination data array pointer
+ *  SLData_t *pImagDst,         - Imaginary destination data array pointer
+ *  SLData_t *pRealTemp,        - Real temporary data array pointer
+ *  SLData_t *pImagTemp,        - Imaginary temporary data array pointer
+ *  const SLArrayIndex_t *pPlanInfo,    - Pointer to plan information
+ *  const SLData_t *pPlanCoeffs,        - Pointer to plan coefficients
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Arbitrary length complex FFT using a plan created
+ *  with SIF_FftArbPlan. The results are in natural order
+ *  and have the same scaling as SDA_CfftArb.
+ *  The source and destination arrays may be the same.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_CfftArbPlan(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                      SLData_t* SIGLIB_PTR_DECL pRealDst, SLData_t* SIGLIB_PTR_DECL pImagDst, SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                      SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLArrayIndex_t* SIGLIB_PTR_DECL pPlanInfo,
+                                      const SLData_t* SIGLIB_PTR_DECL pPlanCoeffs, const SLArrayIndex_t sampleLength)
+{
+  siglib_numerix_FftArbPlanExecute(pSrcReal, pSrcImag, pRealDst, pImagDst, pRealTemp, pImagTemp, pPlanInfo, pPlanCoeffs,
+                                   SIGLIB_ONE / (SLData_t)sampleLength, sampleLength);
+}    // End of SDA_CfftArbPlan()
+
+/********************************************************
+ * Function: SDA_CifftArbPlan
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,   - Real source data array pointer
+ *  const SLData_t *pSrcImag,   - Imaginary source data array pointer
+ *  SLData_t *pRealDst,         - Real destination data array pointer
+ *  SLData_t *pImagDst,         - Imaginary destination data array pointer
+ *  SLData_t *pRealTemp,        - Real temporary data array pointer
+ *  SLData_t *pImagTemp,        - Imaginary temporary data array pointer
+ *  const SLArrayIndex_t *pPlanInfo,    - Pointer to plan information
+ *  const SLData_t *pPlanCoeffs,        - Pointer to plan coefficients
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Arbitrary length complex inverse FFT using a plan
+ *  created with SIF_FftArbPlan. The results are in
+ *  natural order and have the same scaling as
+ *  SDA_CifftArb.
+ *  The source and destination arrays may be the same.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_CifftArbPlan(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                       SLData_t* SIGLIB_PTR_DECL pRealDst, SLData_t* SIGLIB_PTR_DECL pImagDst, SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                       SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLArrayIndex_t* SIGLIB_PTR_DECL pPlanInfo,
+                                       const SLData_t* SIGLIB_PTR_DECL pPlanCoeffs, const SLArrayIndex_t sampleLength)
+{
+  // The inverse transform is the forward transform with the real and imaginary components swapped
+  siglib_numerix_FftArbPlanExecute(pSrcImag, pSrcReal, pImagDst, pRealDst, pImagTemp, pRealTemp, pPlanInfo, pPlanCoeffs, SIGLIB_ONE,
+                                   sampleLength);
+}    // End of SDA_CifftArbPlan()
+
+// Arbitrary length FFT plan cache
+static struct {
+  SLArrayIndex_t SampleLength;                                   // Transform length, 0 for an unused entry
+  SLUInt32_t LastUsed;                                           // Value of the usage counter when the plan was last used
+  SLArrayIndex_t PlanInfo[SIGLIB_FFT_ARB_PLAN_INFO_LENGTH];      // Plan information
+  SLData_t* pPlanCoeffs;                                         // Plan coefficients, followed by the temporary arrays
+  SLData_t* pRealTemp;
+  SLData_t* pImagTemp;
+} siglib_numerix_FftArbPlanCache[SIGLIB_FFT_ARB_PLAN_CACHE_LENGTH];
+static SLUInt32_t siglib_numerix_FftArbPlanCacheCounter;
+
+/********************************************************
+ * Function: siglib_numerix_FftArbPlanCacheGet
+ *
+ * Parameters:
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  Index of the plan in the cache or -1 for a memory
+ *  allocation error
+ *
+ * Description:
+ *  Find the plan for the given length in the cache. If
+ *  there is no plan for this length then the least
+ *  recently used plan is replaced.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_FftArbPlanCacheGet(const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t Oldest = 0;
+
+  siglib_numerix_FftArbPlanCacheCounter++;
+  for (SLArrayIndex_t i = 0; i < SIGLIB_FFT_ARB_PLAN_CACHE_LENGTH; i++) {
+    if (siglib_numerix_FftArbPlanCache[i].SampleLength == sampleLength) {
+      siglib_numerix_FftArbPlanCache[i].LastUsed = siglib_numerix_FftArbPlanCacheCounter;
+      return (i);
+    }
+    if ((siglib_numerix_FftArbPlanCache[i].SampleLength == 0) ||
+        ((siglib_numerix_FftArbPlanCache[Oldest].SampleLength != 0) &&
+         ((SLUInt32_t)(siglib_numerix_FftArbPlanCacheCounter - siglib_numerix_FftArbPlanCache[i].LastUsed) >
+          (SLUInt32_t)(siglib_numerix_FftArbPlanCacheCounter - siglib_numerix_FftArbPlanCache[Oldest].LastUsed)))) {
+      Oldest = i;
+    }
+  }
+
+  // Replace the least recently used plan
+  if (siglib_numerix_FftArbPlanCache[Oldest].SampleLength != 0) {
+    SUF_MemoryFree(siglib_numerix_FftArbPlanCache[Oldest].pPlanCoeffs);
+    siglib_numerix_FftArbPlanCache[Oldest].SampleLength = 0;
+  }
+
+  SLArrayIndex_t CoeffsLength = SUF_FftArbPlanCoeffsLength(sampleLength);
+  SLArrayIndex_t TempLength = SUF_FftArbPlanTempLength(sampleLength);
+  SLData_t* pMemory = (SLData_t*)SUF_MemoryAllocate(((size_t)CoeffsLength + (2 * (size_t)TempLength)) * sizeof(SLData_t));
+  if (NULL == pMemory) {
+    return ((SLArrayIndex_t)-1);
+  }
+
+  siglib_numerix_FftArbPlanCache[Oldest].pPlanCoeffs = pMemory;
+  siglib_numerix_FftArbPlanCache[Oldest].pRealTemp = pMemory + CoeffsLength;
+  siglib_numerix_FftArbPlanCache[Oldest].pImagTemp = pMemory + CoeffsLength + TempLength;
+  SIF_FftArbPlan(siglib_numerix_FftArbPlanCache[Oldest].PlanInfo, pMemory, siglib_numerix_FftArbPlanCache[Oldest].pRealTemp,
+                 siglib_numerix_FftArbPlanCache[Oldest].pImagTemp, sampleLength);
+  siglib_numerix_FftArbPlanCache[Oldest].SampleLength = sampleLength;
+  siglib_numerix_FftArbPlanCache[Oldest].LastUsed = siglib_numerix_FftArbPlanCacheCounter;
+  return (Oldest);
+}    // End of siglib_numerix_FftArbPlanCacheGet()
+
+/********************************************************
+ * Function: SDA_CfftArbCached
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,   - Real source data array pointer
+ *  const SLData_t *pSrcImag,   - Imaginary source data array pointer
+ *  SLData_t *pRealDst,         - Real destination data array pointer
+ *  SLData_t *pImagDst,         - Imaginary destination data array pointer
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  SLError_t Error code
+ *
+ * Description:
+ *  Arbitrary length complex FFT. The plan and temporary
+ *  arrays for each length are allocated and initialised
+ *  on the first call and held in a cache of the
+ *  SIGLIB_FFT_ARB_PLAN_CACHE_LENGTH most recently used
+ *  lengths, so subsequent calls only perform the FFT.
+ *  The results have the same scaling as SDA_CfftArb.
+ *  The cache is shared so this function is not re-entrant.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SDA_CfftArbCached(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                             SLData_t* SIGLIB_PTR_DECL pRealDst, SLData_t* SIGLIB_PTR_DECL pImagDst,
+                                             const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t Plan = siglib_numerix_FftArbPlanCacheGet(sampleLength);
+  if (Plan < 0) {
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  SDA_CfftArbPlan(pSrcReal, pSrcImag, pRealDst, pImagDst, siglib_numerix_FftArbPlanCache[Plan].pRealTemp,
+                  siglib_numerix_FftArbPlanCache[Plan].pImagTemp, siglib_numerix_FftArbPlanCache[Plan].PlanInfo,
+                  siglib_numerix_FftArbPlanCache[Plan].pPlanCoeffs, sampleLength);
+  return (SIGLIB_NO_ERROR);
+}    // End of SDA_CfftArbCached()
+
+/********************************************************
+ * Function: SDA_CifftArbCached
+ *
+ * Parameters:
+ *  const SLData_t *pSrcReal,   - Real source data array pointer
+ *  const SLData_t *pSrcImag,   - Imaginary source data array pointer
+ *  SLData_t *pRealDst,         - Real destination data array pointer
+ *  SLData_t *pImagDst,         - Imaginary destination data array pointer
+ *  const SLArrayIndex_t sampleLength   - Transform length
+ *
+ * Return value:
+ *  SLError_t Error code
+ *
+ * Description:
+ *  Arbitrary length complex inverse FFT, using the plan
+ *  cache shared with SDA_CfftArbCached.
+ *  The results have the same scaling as SDA_CifftArb.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SDA_CifftArbCached(const SLData_t* SIGLIB_PTR_DECL pSrcReal, const SLData_t* SIGLIB_PTR_DECL pSrcImag,
+                                              SLData_t* SIGLIB_PTR_DECL pRealDst, SLData_t* SIGLIB_PTR_DECL pImagDst,
+                                              const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t Plan = siglib_numerix_FftArbPlanCacheGet(sampleLength);
+  if (Plan < 0) {
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  SDA_CifftArbPlan(pSrcReal, pSrcImag, pRealDst, pImagDst, siglib_numerix_FftArbPlanCache[Plan].pRealTemp,
+                   siglib_numerix_FftArbPlanCache[Plan].pImagTemp, siglib_numerix_FftArbPlanCache[Plan].PlanInfo,
+                   siglib_numerix_FftArbPlanCache[Plan].pPlanCoeffs, sampleLength);
+  return (SIGLIB_NO_ERROR);
+}    // End of SDA_CifftArbCached()
+
+/********************************************************
+ * Function: SUF_FftArbPlanCacheFree
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free all of the plans held in the arbitrary length
+ *  FFT plan cache.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_FftArbPlanCacheFree(void)
+{
+  for (SLArrayIndex_t i = 0; i < SIGLIB_FFT_ARB_PLAN_CACHE_LENGTH; i++) {
+    if (siglib_numerix_FftArbPlanCache[i].SampleLength != 0) {
+      SUF_MemoryFree(siglib_numerix_FftArbPlanCache[i].pPlanCoeffs);
+      siglib_numerix_FftArbPlanCache[i].SampleLength = 0;
+    }
+  }
+}    // End of SUF_FftArbPlanCacheFree()
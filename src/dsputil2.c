@@ -2236,6 +2236,383 @@ void SIGLIB_FUNC_DECL SDA_SetLocation(SLData_t pDst[], const SLArrayIndex_t Locn
   }
 }    // End of SDA_SetLocation()
 
+#if (SIGLIB_DATA_SHORT != 1) && (SIGLIB_DATA_FLOAT == 1)
+typedef SLUInt32_t siglib_numerix_SortKey_t;    // Radix sort key - the bits of the floating point value
+#elif (SIGLIB_DATA_SHORT != 1)
+typedef SLUInt64_t siglib_numerix_SortKey_t;
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_SortInsertion
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  const SLArrayIndex_t    - Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Insertion sort the keys, minimum first, moving the
+ *  companion array with the keys.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SortInsertion(SLData_t* pKeys, SLData_t* pCompanion, const SLArrayIndex_t Length)
+{
+  for (SLArrayIndex_t i = 1; i < Length; i++) {
+    SLData_t Key = pKeys[i];
+    SLArrayIndex_t j = i;
+    if (NULL == pCompanion) {
+      for (; (j > 0) && (pKeys[j - 1] > Key); j--) {
+        pKeys[j] = pKeys[j - 1];
+      }
+    } else {
+      SLData_t Companion = pCompanion[i];
+      for (; (j > 0) && (pKeys[j - 1] > Key); j--) {
+        pKeys[j] = pKeys[j - 1];
+        pCompanion[j] = pCompanion[j - 1];
+      }
+      pCompanion[j] = Companion;
+    }
+    pKeys[j] = Key;
+  }
+}    // End of siglib_numerix_SortInsertion()
+
+/********************************************************
+ * Function: siglib_numerix_SortSiftDown
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  SLArrayIndex_t          - Root of the sub-heap
+ *  const SLArrayIndex_t    - Heap length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Move the root of a max-heap down to its position.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SortSiftDown(SLData_t* pKeys, SLData_t* pCompanion, SLArrayIndex_t Root, const SLArrayIndex_t Length)
+{
+  for (SLArrayIndex_t Child = (2 * Root) + 1; Child < Length; Root = Child, Child = (2 * Child) + 1) {
+    if (((Child + 1) < Length) && (pKeys[Child] < pKeys[Child + 1])) {
+      Child++;
+    }
+    if (!(pKeys[Root] < pKeys[Child])) {
+      break;
+    }
+    SDS_Swap(pKeys[Root], pKeys[Child]);
+    if (NULL != pCompanion) {
+      SDS_Swap(pCompanion[Root], pCompanion[Child]);
+    }
+  }
+}    // End of siglib_numerix_SortSiftDown()
+
+/********************************************************
+ * Function: siglib_numerix_SortHeap
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  const SLArrayIndex_t    - Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Heap sort the keys, minimum first, moving the companion
+ *  array with the keys.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SortHeap(SLData_t* pKeys, SLData_t* pCompanion, const SLArrayIndex_t Length)
+{
+  for (SLArrayIndex_t i = (Length >> 1) - 1; i >= 0; i--) {
+    siglib_numerix_SortSiftDown(pKeys, pCompanion, i, Length);
+  }
+  for (SLArrayIndex_t i = Length - 1; i > 0; i--) {
+    SDS_Swap(pKeys[0], pKeys[i]);
+    if (NULL != pCompanion) {
+      SDS_Swap(pCompanion[0], pCompanion[i]);
+    }
+    siglib_numerix_SortSiftDown(pKeys, pCompanion, 0, i);
+  }
+}    // End of siglib_numerix_SortHeap()
+
+/********************************************************
+ * Function: siglib_numerix_SortPartition
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  const SLArrayIndex_t    - Array length, at least 4
+ *
+ * Return value:
+ *  SLArrayIndex_t  - Split point, between 1 and length - 1
+ *
+ * Description:
+ *  Partition the keys around the median of the first,
+ *  middle and last keys. On return all of the keys before
+ *  the split point are <= the pivot and all of the keys
+ *  from the split point are >= the pivot.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_SortPartition(SLData_t* pKeys, SLData_t* pCompanion, const SLArrayIndex_t Length)
+{
+  SLArrayIndex_t Mid = Length >> 1;
+  SLArrayIndex_t Last = Length - 1;
+  if (pKeys[Mid] < pKeys[0]) {    // Median of three, which also places sentinels at each end
+    SDS_Swap(pKeys[Mid], pKeys[0]);
+    if (NULL != pCompanion) {
+      SDS_Swap(pCompanion[Mid], pCompanion[0]);
+    }
+  }
+  if (pKeys[Last] < pKeys[Mid]) {
+    SDS_Swap(pKeys[Last], pKeys[Mid]);
+    if (NULL != pCompanion) {
+      SDS_Swap(pCompanion[Last], pCompanion[Mid]);
+    }
+    if (pKeys[Mid] < pKeys[0]) {
+      SDS_Swap(pKeys[Mid], pKeys[0]);
+      if (NULL != pCompanion) {
+        SDS_Swap(pCompanion[Mid], pCompanion[0]);
+      }
+    }
+  }
+
+  SLData_t Pivot = pKeys[Mid];
+  SLArrayIndex_t i = 0;
+  SLArrayIndex_t j = Last;
+  for (;;) {    // Hoare partition
+    do {
+      i++;
+    } while (pKeys[i] < Pivot);
+    do {
+      j--;
+    } while (Pivot < pKeys[j]);
+    if (i >= j) {
+      return (j + 1);
+    }
+    SDS_Swap(pKeys[i], pKeys[j]);
+    if (NULL != pCompanion) {
+      SDS_Swap(pCompanion[i], pCompanion[j]);
+    }
+  }
+}    // End of siglib_numerix_SortPartition()
+
+/********************************************************
+ * Function: siglib_numerix_SortIntro
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  SLArrayIndex_t          - Array length
+ *  SLArrayIndex_t          - Depth limit
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Introsort the keys, minimum first, moving the companion
+ *  array with the keys. Quicksort is used until the depth
+ *  limit is reached, when the partition is heap sorted,
+ *  and short partitions are insertion sorted.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SortIntro(SLData_t* pKeys, SLData_t* pCompanion, SLArrayIndex_t Length, SLArrayIndex_t DepthLimit)
+{
+  while (Length > SIGLIB_SORT_INSERTION_LENGTH) {
+    if (0 == DepthLimit--) {
+      siglib_numerix_SortHeap(pKeys, pCompanion, Length);
+      return;
+    }
+    SLArrayIndex_t Split = siglib_numerix_SortPartition(pKeys, pCompanion, Length);
+    if (Split < (Length - Split)) {    // Recurse on the shorter partition so the stack depth is O(log N)
+      siglib_numerix_SortIntro(pKeys, pCompanion, Split, DepthLimit);
+      pKeys += Split;
+      if (NULL != pCompanion) {
+        pCompanion += Split;
+      }
+      Length -= Split;
+    } else {
+      siglib_numerix_SortIntro(pKeys + Split, (NULL != pCompanion) ? (pCompanion + Split) : NULL, Length - Split, DepthLimit);
+      Length = Split;
+    }
+  }
+  siglib_numerix_SortInsertion(pKeys, pCompanion, Length);
+}    // End of siglib_numerix_SortIntro()
+
+#if (SIGLIB_DATA_SHORT != 1)
+/********************************************************
+ * Function: siglib_numerix_SortRadix
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  const SLArrayIndex_t    - Array length
+ *
+ * Return value:
+ *  SLError_t       - SIGLIB_MEM_ALLOC_ERROR if the temporary
+ *                    arrays could not be allocated
+ *
+ * Description:
+ *  LSD radix sort the keys, minimum first, moving the
+ *  companion array with the keys. The bits of each
+ *  floating point key are mapped to an unsigned integer
+ *  with the same order, in an integer array, and sorted
+ *  one byte per pass, the passes where all of the keys
+ *  have the same byte are skipped.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_SortRadix(SLData_t* pKeys, SLData_t* pCompanion, const SLArrayIndex_t Length)
+{
+  siglib_numerix_SortKey_t* pIntKeys = (siglib_numerix_SortKey_t*)SUF_MemoryAllocate((size_t)(2 * Length) * sizeof(siglib_numerix_SortKey_t));
+  SLData_t* pTmpCompanion = (NULL != pCompanion) ? SUF_VectorArrayAllocate(Length) : NULL;
+  SLArrayIndex_t* pCounts = (SLArrayIndex_t*)SUF_MemoryAllocate(sizeof(siglib_numerix_SortKey_t) * 256 * sizeof(SLArrayIndex_t));
+  if ((NULL == pIntKeys) || ((NULL != pCompanion) && (NULL == pTmpCompanion)) || (NULL == pCounts)) {
+    SUF_MemoryFree(pIntKeys);
+    SUF_MemoryFree(pTmpCompanion);
+    SUF_MemoryFree(pCounts);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  const SLUFixData_t Bytes = (SLUFixData_t)sizeof(siglib_numerix_SortKey_t);
+  const siglib_numerix_SortKey_t SignBit = (siglib_numerix_SortKey_t)1 << ((8U * Bytes) - 1U);
+  for (SLUFixData_t i = 0; i < (Bytes * 256U); i++) {
+    pCounts[i] = 0;
+  }
+
+  // Map the keys to ordered unsigned integers and histogram every byte
+  // The integer keys are never stored as floating point, where some bit patterns are signalling NaNs
+  for (SLArrayIndex_t i = 0; i < Length; i++) {
+    siglib_numerix_SortKey_t Key;
+    memcpy(&Key, &pKeys[i], sizeof(Key));
+    Key = (0U != (Key & SignBit)) ? ~Key : (Key | SignBit);
+    pIntKeys[i] = Key;
+    for (SLUFixData_t b = 0; b < Bytes; b++) {
+      pCounts[(b * 256U) + (SLUFixData_t)((Key >> (8U * b)) & 0xffU)]++;
+    }
+  }
+
+  siglib_numerix_SortKey_t* pSrcKeys = pIntKeys;
+  siglib_numerix_SortKey_t* pDstKeys = pIntKeys + Length;
+  SLData_t* pSrcCompanion = pCompanion;
+  SLData_t* pDstCompanion = pTmpCompanion;
+  for (SLUFixData_t b = 0; b < Bytes; b++) {
+    SLArrayIndex_t* pCount = pCounts + (b * 256U);
+    SLArrayIndex_t Offset = 0;
+    SLFixData_t SkipFlag = SIGLIB_FALSE;
+    for (SLUFixData_t d = 0; d < 256U; d++) {    // Convert the histogram to offsets
+      SLArrayIndex_t Count = pCount[d];
+      if (Count == Length) {
+        SkipFlag = SIGLIB_TRUE;
+      }
+      pCount[d] = Offset;
+      Offset += Count;
+    }
+    if (SIGLIB_TRUE == SkipFlag) {
+      continue;
+    }
+
+    for (SLArrayIndex_t i = 0; i < Length; i++) {
+      SLArrayIndex_t Index = pCount[(pSrcKeys[i] >> (8U * b)) & 0xffU]++;
+      pDstKeys[Index] = pSrcKeys[i];
+      if (NULL != pCompanion) {
+        pDstCompanion[Index] = pSrcCompanion[i];
+      }
+    }
+    siglib_numerix_SortKey_t* pTmpKeys = pSrcKeys;
+    pSrcKeys = pDstKeys;
+    pDstKeys = pTmpKeys;
+    SLData_t* pTmp = pSrcCompanion;
+    pSrcCompanion = pDstCompanion;
+    pDstCompanion = pTmp;
+  }
+
+  for (SLArrayIndex_t i = 0; i < Length; i++) {    // Map the keys back to floating point, in the destination array
+    siglib_numerix_SortKey_t Key = pSrcKeys[i];
+    Key = (0U != (Key & SignBit)) ? (Key & ~SignBit) : ~Key;
+    memcpy(&pKeys[i], &Key, sizeof(Key));
+  }
+  if ((NULL != pCompanion) && (pSrcCompanion != pCompanion)) {
+    for (SLArrayIndex_t i = 0; i < Length; i++) {
+      pCompanion[i] = pSrcCompanion[i];
+    }
+  }
+
+  SUF_MemoryFree(pIntKeys);
+  SUF_MemoryFree(pTmpCompanion);
+  SUF_MemoryFree(pCounts);
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_SortRadix()
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_Sort
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to keys
+ *  SLData_t *              - Pointer to companion array, NULL for none
+ *  const SLArrayIndex_t    - Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Sort the keys, minimum first, moving the companion
+ *  array with the keys. Arrays of at least
+ *  SIGLIB_SORT_RADIX_MIN_LENGTH samples are radix sorted,
+ *  shorter arrays, or if the radix sort can not allocate
+ *  its temporary arrays, are introsorted.
+ *
+ ********************************************************/
+
+static void siglib_numerix_Sort(SLData_t* pKeys, SLData_t* pCompanion, const SLArrayIndex_t Length)
+{
+#if (SIGLIB_DATA_SHORT != 1)
+  if ((Length >= SIGLIB_SORT_RADIX_MIN_LENGTH) && (sizeof(siglib_numerix_SortKey_t) == sizeof(SLData_t)) &&
+      (SIGLIB_NO_ERROR == siglib_numerix_SortRadix(pKeys, pCompanion, Length))) {
+    return;
+  }
+#endif
+
+  SLArrayIndex_t DepthLimit = 0;
+  for (SLArrayIndex_t i = Length; i > 1; i >>= 1) {
+    DepthLimit += 2;    // 2 * log2 (N)
+  }
+  siglib_numerix_SortIntro(pKeys, pCompanion, Length, DepthLimit);
+}    // End of siglib_numerix_Sort()
+
+/********************************************************
+ * Function: siglib_numerix_SortReverse
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to array
+ *  const SLArrayIndex_t    - Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Reverse the order of the samples in the array.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SortReverse(SLData_t* pData, const SLArrayIndex_t Length)
+{
+  for (SLArrayIndex_t i = 0, j = Length - 1; i < j; i++, j--) {
+    SDS_Swap(pData[i], pData[j]);
+  }
+}    // End of siglib_numerix_SortReverse()
+
 /********************************************************
  * Function: SDA_SortMinToMax()
  *
@@ -2249,6 +2626,10 @@ void SIGLIB_FUNC_DECL SDA_SetLocation(SLData_t pDst[], const SLArrayIndex_t Locn
  *
  * Description: Sort array, minimum first, max last.
  *
+ * Notes:
+ *  Short arrays are introsorted, long arrays are radix
+ *  sorted - see siglib_numerix_Sort().
+ *
  ********************************************************/
 
 void SIGLIB_FUNC_DECL SDA_SortMinToMax(const SLData_t pSrc[], SLData_t pDst[], const SLArrayIndex_t sampleLength)
@@ -2266,15 +2647,7 @@ void SIGLIB_FUNC_DECL SDA_SortMinToMax(const SLData_t pSrc[], SLData_t pDst[], c
     }
   }
 
-  for (SLArrayIndex_t i = 0; i < (sampleLength - 1); i++) {
-    for (SLArrayIndex_t j = (i + 1); j < sampleLength; j++) {
-      if (pDst[i] > pDst[j]) {
-        SLData_t Tmp = pDst[j];
-        pDst[j] = pDst[i];
-        pDst[i] = Tmp;
-      }
-    }
-  }
+  siglib_numerix_Sort(pDst, NULL, sampleLength);
 }    // End of SDA_SortMinToMax()
 
 /********************************************************
@@ -2288,7 +2661,7 @@ void SIGLIB_FUNC_DECL SDA_SortMinToMax(const SLData_t pSrc[], SLData_t pDst[], c
  * Return value:
  *  void
  *
- * Description: Sort array, minimum first, max last.
+ * Description: Sort array, maximum first, min last.
  *
  ********************************************************/
 
@@ -2307,15 +2680,8 @@ void SIGLIB_FUNC_DECL SDA_SortMaxToMin(const SLData_t pSrc[], SLData_t pDst[], c
     }
   }
 
-  for (SLArrayIndex_t i = 0; i < (sampleLength - 1); i++) {
-    for (SLArrayIndex_t j = (i + 1); j < sampleLength; j++) {
-      if (pDst[i] < pDst[j]) {
-        SLData_t Tmp = pDst[j];
-        pDst[j] = pDst[i];
-        pDst[i] = Tmp;
-      }
-    }
-  }
+  siglib_numerix_Sort(pDst, NULL, sampleLength);
+  siglib_numerix_SortReverse(pDst, sampleLength);
 }    // End of SDA_SortMaxToMin()
 
 /********************************************************
@@ -2359,18 +2725,7 @@ void SIGLIB_FUNC_DECL SDA_SortMinToMax2(const SLData_t pSrc1[], const SLData_t p
     }
   }
 
-  for (SLArrayIndex_t i = 0; i < (sampleLength - 1); i++) {
-    for (SLArrayIndex_t j = (i + 1); j < sampleLength; j++) {
-      if (pDst1[i] > pDst1[j]) {
-        SLData_t Tmp = pDst1[j];
-        pDst1[j] = pDst1[i];
-        pDst1[i] = Tmp;
-        Tmp = pDst2[j];
-        pDst2[j] = pDst2[i];
-        pDst2[i] = Tmp;
-      }
-    }
-  }
+  siglib_numerix_Sort(pDst1, pDst2, sampleLength);
 }    // End of SDA_SortMinToMax2()
 
 /********************************************************
@@ -2386,7 +2741,7 @@ void SIGLIB_FUNC_DECL SDA_SortMinToMax2(const SLData_t pSrc1[], const SLData_t p
  * Return value:
  *  void
  *
- * Description: Sort array, minimum first, max last.
+ * Description: Sort array #1, maximum first, min last.
  *  Perform same operations on array #2
  *
  ********************************************************/
@@ -2414,19 +2769,77 @@ void SIGLIB_FUNC_DECL SDA_SortMaxToMin2(const SLData_t pSrc1[], const SLData_t p
     }
   }
 
-  for (SLArrayIndex_t i = 0; i < (sampleLength - 1); i++) {
-    for (SLArrayIndex_t j = (i + 1); j < sampleLength; j++) {
-      if (pDst1[i] < pDst1[j]) {
-        SLData_t Tmp = pDst1[j];
-        pDst1[j] = pDst1[i];
-        pDst1[i] = Tmp;
-        Tmp = pDst2[j];
-        pDst2[j] = pDst2[i];
-        pDst2[i] = Tmp;
-      }
+  siglib_numerix_Sort(pDst1, pDst2, sampleLength);
+  siglib_numerix_SortReverse(pDst1, sampleLength);
+  siglib_numerix_SortReverse(pDst2, sampleLength);
+}    // End of SDA_SortMaxToMin2()
+
+/********************************************************
+ * Function: SDA_NthElement()
+ *
+ * Parameters:
+ *  const SLData_t pSrc[],      Pointer to source data array
+ *  SLData_t pDst[],            Pointer to destn. data array
+ *  const SLArrayIndex_t n,     Index of the element to select
+ *  const SLArrayIndex_t sampleLength); Array length
+ *
+ * Return value:
+ *  SLData_t        - The n-th smallest sample (n = 0 is the minimum)
+ *
+ * Description: Partially sort the array so that pDst[n]
+ *  holds the sample that would be at index n if the array
+ *  was sorted minimum first, all of the samples before it
+ *  are <= it and all of the samples after it are >= it.
+ *
+ * Notes:
+ *  Quickselect, with the median of three pivot, so the
+ *  expected time is O(N). If the partitioning is
+ *  unbalanced then the remaining partition is heap sorted
+ *  so the worst case is O(N log N).
+ *  This function will work in-place.
+ *
+ ********************************************************/
+
+SLData_t SIGLIB_FUNC_DECL SDA_NthElement(const SLData_t pSrc[], SLData_t pDst[], const SLArrayIndex_t n, const SLArrayIndex_t sampleLength)
+{
+#if (SIGLIB_ARRAYS_ALIGNED)
+#  ifdef __TMS320C6X__             // Defined by TI compiler
+  _nassert((int)pSrc % 8 == 0);    // Align arrays on 64 bit double word boundary for LDDW
+  _nassert((int)pDst % 8 == 0);
+#  endif
+#endif
+
+  if (pSrc != pDst) {
+    for (SLArrayIndex_t i = 0; i < sampleLength; i++) {
+      pDst[i] = pSrc[i];
     }
   }
-}    // End of SDA_SortMaxToMin2()
+
+  SLData_t* pKeys = pDst;
+  SLArrayIndex_t Length = sampleLength;
+  SLArrayIndex_t Index = n;
+  SLArrayIndex_t DepthLimit = 0;
+  for (SLArrayIndex_t i = Length; i > 1; i >>= 1) {
+    DepthLimit += 2;    // 2 * log2 (N)
+  }
+
+  while (Length > SIGLIB_SORT_INSERTION_LENGTH) {
+    if (0 == DepthLimit--) {
+      siglib_numerix_SortHeap(pKeys, NULL, Length);
+      return (pDst[n]);
+    }
+    SLArrayIndex_t Split = siglib_numerix_SortPartition(pKeys, NULL, Length);
+    if (Index < Split) {    // Continue in the partition that holds the n-th sample
+      Length = Split;
+    } else {
+      pKeys += Split;
+      Index -= Split;
+      Length -= Split;
+    }
+  }
+  siglib_numerix_SortInsertion(pKeys, NULL, Length);
+  return (pDst[n]);
+}    // End of SDA_NthElement()
 
 /********************************************************
  * Function: SDA_SortIndexed()
@@ -2443,6 +2856,8 @@ void SIGLIB_FUNC_DECL SDA_SortMaxToMin2(const SLData_t pSrc1[], const SLData_t p
  * Description: Sort the data, using the index array
  *  to provide the output location for the sample.
  *  Note: This function will not work in-place.
+ *  This is a single O(N) scatter, the index array holds
+ *  the output location of each sample.
  *
  ********************************************************/
 
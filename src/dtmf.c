@@ -40,9 +40,36 @@ Description: DSP maths utility functions, for SigLib DSP library.
 
 #include <siglib.h>    // Include SigLib header file
 
+#define SIGLIB_DTMF_DETECT_NUMBER_OF_TONES 8    // Four low frequency tones, then four high frequency tones
+
 // Global variables
-SLData_t siglib_numerix_GoertzelCoeffL0, siglib_numerix_GoertzelCoeffL1, siglib_numerix_GoertzelCoeffL2, siglib_numerix_GoertzelCoeffL3;
-SLData_t siglib_numerix_GoertzelCoeffH0, siglib_numerix_GoertzelCoeffH1, siglib_numerix_GoertzelCoeffH2, siglib_numerix_GoertzelCoeffH3;
+static SLData_t siglib_numerix_DtmfDetectCoeffs[SIGLIB_DTMF_DETECT_NUMBER_OF_TONES];    // Goertzel bank coefficients
+
+/********************************************************
+ * Function: siglib_numerix_DtmfDetectTones
+ *
+ * Parameters:
+ *  const SLData_t * SIGLIB_PTR_DECL pSrc           - Source data aray pointer
+ *  SLData_t * SIGLIB_PTR_DECL pMagn                - Tone magnitudes squared
+ *  const SLArrayIndex_t sampleLength               - Buffer length
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Detect the eight DTMF tones in a single
+ *  pass over the source array.
+ *
+ ********************************************************/
+
+static void siglib_numerix_DtmfDetectTones(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pMagn,
+                                           const SLArrayIndex_t sampleLength)
+{
+  SLData_t State[2 * SIGLIB_DTMF_DETECT_NUMBER_OF_TONES];    // Goertzel bank state, local so that detection is reentrant
+
+  SDA_Zeros(State, 2 * SIGLIB_DTMF_DETECT_NUMBER_OF_TONES);
+  SDA_GoertzelBank(pSrc, State, siglib_numerix_DtmfDetectCoeffs, SIGLIB_DTMF_DETECT_NUMBER_OF_TONES, 1, sampleLength);
+  SDA_GoertzelBankDetect(State, siglib_numerix_DtmfDetectCoeffs, pMagn, SIGLIB_DTMF_DETECT_NUMBER_OF_TONES, 1);
+}    // End of siglib_numerix_DtmfDetectTones()
 
 /********************************************************
  * Function: SIF_DtmfGenerate()
@@ -250,35 +277,21 @@ void SIGLIB_FUNC_DECL SIF_DtmfDetect(const SLData_t SampleRate, const SLArrayInd
   SLData_t siglib_numerix_InverseDTMFSampleRate = (SIGLIB_ONE / SampleRate);    // Set 1.0 / system sample rate
                                                                                 // Used in normalized frequencies below
 
-  // Initialise Goertzel filters
-  siglib_numerix_GoertzelCoeffL0 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_LF_0_NORM, sampleLength);
-  siglib_numerix_GoertzelCoeffL1 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_LF_1_NORM, sampleLength);
-  siglib_numerix_GoertzelCoeffL2 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_LF_2_NORM, sampleLength);
-  siglib_numerix_GoertzelCoeffL3 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_LF_3_NORM, sampleLength);
+  const SLData_t Frequencies[SIGLIB_DTMF_DETECT_NUMBER_OF_TONES] = {
+    SIGLIB_DTMF_DETECT_LF_0_NORM, SIGLIB_DTMF_DETECT_LF_1_NORM, SIGLIB_DTMF_DETECT_LF_2_NORM, SIGLIB_DTMF_DETECT_LF_3_NORM,
+    SIGLIB_DTMF_DETECT_HF_0_NORM, SIGLIB_DTMF_DETECT_HF_1_NORM, SIGLIB_DTMF_DETECT_HF_2_NORM, SIGLIB_DTMF_DETECT_HF_3_NORM};
 
-  siglib_numerix_GoertzelCoeffH0 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_HF_0_NORM, sampleLength);
-  siglib_numerix_GoertzelCoeffH1 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_HF_1_NORM, sampleLength);
-  siglib_numerix_GoertzelCoeffH2 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_HF_2_NORM, sampleLength);
-  siglib_numerix_GoertzelCoeffH3 = SIF_GoertzelDetect(SIGLIB_DTMF_DETECT_HF_3_NORM, sampleLength);
+  (void)sampleLength;    // The Goertzel bank coefficients only depend on the normalised frequencies
+
+  SLData_t State[2 * SIGLIB_DTMF_DETECT_NUMBER_OF_TONES];    // The detector clears its own state on each call
+
+  // Initialise Goertzel filter bank
+  SIF_GoertzelBank(Frequencies, siglib_numerix_DtmfDetectCoeffs, State, SIGLIB_DTMF_DETECT_NUMBER_OF_TONES, 1);
 
 #if SIGLIB_ENABLE_DEBUG_LOGGING
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffL0.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffL0.real,
-                   siglib_numerix_GoertzelCoeffL0.imag);
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffL1.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffL1.real,
-                   siglib_numerix_GoertzelCoeffL1.imag);
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffL2.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffL2.real,
-                   siglib_numerix_GoertzelCoeffL2.imag);
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffL3.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffL3.real,
-                   siglib_numerix_GoertzelCoeffL3.imag);
-
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffH0.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffH0.real,
-                   siglib_numerix_GoertzelCoeffH0.imag);
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffH1.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffH1.real,
-                   siglib_numerix_GoertzelCoeffH1.imag);
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffH2.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffH2.real,
-                   siglib_numerix_GoertzelCoeffH2.imag);
-  SUF_Debugfprintf("siglib_numerix_GoertzelCoeffH3.real = %lf, .imag = %lf\n", siglib_numerix_GoertzelCoeffH3.real,
-                   siglib_numerix_GoertzelCoeffH3.imag);
+  for (SLArrayIndex_t i = 0; i < SIGLIB_DTMF_DETECT_NUMBER_OF_TONES; i++) {
+    SUF_Debugfprintf("siglib_numerix_DtmfDetectCoeffs[%d] = %lf\n", (int)i, siglib_numerix_DtmfDetectCoeffs[i]);
+  }
 #endif
 }    // End of SIF_DtmfDetect()
 
@@ -299,15 +312,18 @@ void SIGLIB_FUNC_DECL SIF_DtmfDetect(const SLData_t SampleRate, const SLArrayInd
 SLStatus_t SIGLIB_FUNC_DECL SDA_DtmfDetect(SLData_t* SIGLIB_PTR_DECL pSrc, const SLArrayIndex_t sampleLength)
 {
   // Detect the individual frequency components - absolute magnitudes squared
-  SLData_t LowFreqMagn0 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL0, sampleLength);
-  SLData_t LowFreqMagn1 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL1, sampleLength);
-  SLData_t LowFreqMagn2 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL2, sampleLength);
-  SLData_t LowFreqMagn3 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL3, sampleLength);
+  SLData_t Magn[SIGLIB_DTMF_DETECT_NUMBER_OF_TONES];
+  siglib_numerix_DtmfDetectTones(pSrc, Magn, sampleLength);
 
-  SLData_t HighFreqMagn0 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH0, sampleLength);
-  SLData_t HighFreqMagn1 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH1, sampleLength);
-  SLData_t HighFreqMagn2 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH2, sampleLength);
-  SLData_t HighFreqMagn3 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH3, sampleLength);
+  SLData_t LowFreqMagn0 = Magn[0];
+  SLData_t LowFreqMagn1 = Magn[1];
+  SLData_t LowFreqMagn2 = Magn[2];
+  SLData_t LowFreqMagn3 = Magn[3];
+
+  SLData_t HighFreqMagn0 = Magn[4];
+  SLData_t HighFreqMagn1 = Magn[5];
+  SLData_t HighFreqMagn2 = Magn[6];
+  SLData_t HighFreqMagn3 = Magn[7];
 
   // Get total signal energy out of all filters / 2
   SLData_t ThirdLowFilterOutputSum = (LowFreqMagn0 + LowFreqMagn1 + LowFreqMagn2 + LowFreqMagn3) * SIGLIB_THIRD;
@@ -444,28 +460,25 @@ SLStatus_t SIGLIB_FUNC_DECL SDA_DtmfDetectAndValidate(SLData_t* SIGLIB_PTR_DECL
 
   else {    // Only detect signal if over threshold
 
+    // Detect the individual frequency components - absolute magnitudes squared
+    SLData_t Magn[SIGLIB_DTMF_DETECT_NUMBER_OF_TONES];
+    siglib_numerix_DtmfDetectTones(pSrc, Magn, sampleLength);
+
 #if SIGLIB_ENABLE_DEBUG_LOGGING
-    SUF_Debugfprintf("GoertzelDetect L0 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL0, sampleLength));
-    SUF_Debugfprintf("GoertzelDetect L1 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL1, sampleLength));
-    SUF_Debugfprintf("GoertzelDetect L2 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL2, sampleLength));
-    SUF_Debugfprintf("GoertzelDetect L3 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL3, sampleLength));
-
-    SUF_Debugfprintf("GoertzelDetect H0 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH0, sampleLength));
-    SUF_Debugfprintf("GoertzelDetect H1 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH1, sampleLength));
-    SUF_Debugfprintf("GoertzelDetect H2 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH2, sampleLength));
-    SUF_Debugfprintf("GoertzelDetect H3 = %lf\n", SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH3, sampleLength));
+    for (SLArrayIndex_t i = 0; i < SIGLIB_DTMF_DETECT_NUMBER_OF_TONES; i++) {
+      SUF_Debugfprintf("GoertzelDetect[%d] = %lf\n", (int)i, Magn[i]);
+    }
 #endif
 
-    // Detect the individual frequency components - absolute magnitudes squared
-    SLData_t LowFreqMagn0 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL0, sampleLength);
-    SLData_t LowFreqMagn1 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL1, sampleLength);
-    SLData_t LowFreqMagn2 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL2, sampleLength);
-    SLData_t LowFreqMagn3 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffL3, sampleLength);
-
-    SLData_t HighFreqMagn0 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH0, sampleLength);
-    SLData_t HighFreqMagn1 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH1, sampleLength);
-    SLData_t HighFreqMagn2 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH2, sampleLength);
-    SLData_t HighFreqMagn3 = SDA_GoertzelDetect(pSrc, siglib_numerix_GoertzelCoeffH3, sampleLength);
+    SLData_t LowFreqMagn0 = Magn[0];
+    SLData_t LowFreqMagn1 = Magn[1];
+    SLData_t LowFreqMagn2 = Magn[2];
+    SLData_t LowFreqMagn3 = Magn[3];
+
+    SLData_t HighFreqMagn0 = Magn[4];
+    SLData_t HighFreqMagn1 = Magn[5];
+    SLData_t HighFreqMagn2 = Magn[6];
+    SLData_t HighFreqMagn3 = Magn[7];
 
     // Get total signal energy out of all filters / 2
     SLData_t ThirdLowFilterOutputSum = (LowFreqMagn0 + LowFreqMagn1 + LowFreqMagn2 + LowFreqMagn3) * SIGLIB_THIRD;
@@ -41,6 +41,18 @@ and correlation functions.
 
 #include <siglib.h>    // Include SigLib header file
 
+#define SIGLIB_FIR_AUTO_MIN_LOG2_FFT_LENGTH 4    // Shortest overlap and save FFT
+#define SIGLIB_FIR_PARTITIONED_MIN_LENGTH 8      // Shortest partition length
+#ifndef SIGLIB_FIR_AUTO_FFT_COST                 // SDA_FirAuto cost model, relative to one time domain multiply-accumulate
+#  define SIGLIB_FIR_AUTO_FFT_COST 15.0          // Forward and inverse FFT, per (N log2 N)
+#endif
+#ifndef SIGLIB_FIR_AUTO_FFT_BIN_COST
+#  define SIGLIB_FIR_AUTO_FFT_BIN_COST 4.0    // Complex multiply, scaling and copies, per FFT bin
+#endif
+#ifndef SIGLIB_FIR_AUTO_PARTITION_BIN_COST
+#  define SIGLIB_FIR_AUTO_PARTITION_BIN_COST 10.0    // Partitioned filter complex multiply-accumulate, per partition, per FFT bin
+#endif
+
 /********************************************************
  * Function: SIF_FirOverlapAdd
  *
@@ -610,3 +622,773 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_RfftConvolve(SLData_t* SIGLIB_PTR_DECL pSrc1
   }
   return (resultLength);
 }    // End of SDA_RfftConvolve()
+
+/********************************************************
+ * Function: siglib_numerix_FirPartitionedMac
+ *
+ * Parameters:
+ *  const SLData_t *pSrc1Real,          - Source 1 real
+ *  const SLData_t *pSrc1Imag,          - Source 1 imaginary
+ *  const SLData_t *pSrc2Real,          - Source 2 real
+ *  const SLData_t *pSrc2Imag,          - Source 2 imaginary
+ *  SLData_t *pDstReal,                 - Accumulator real
+ *  SLData_t *pDstImag,                 - Accumulator imaginary
+ *  const SLArrayIndex_t sampleLength
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Piecewise complex multiply the contents of two arrays
+ *  and add the results to the accumulator arrays.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FirPartitionedMac(
+  const SLData_t* SIGLIB_PTR_DECL pSrc1Real, const SLData_t* SIGLIB_PTR_DECL pSrc1Imag, const SLData_t* SIGLIB_PTR_DECL pSrc2Real,
+  const SLData_t* SIGLIB_PTR_DECL pSrc2Imag, SLData_t* SIGLIB_PTR_DECL pDstReal, SLData_t* SIGLIB_PTR_DECL pDstImag,
+  const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t i = 0;
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  for (; i <= (sampleLength - SIGLIB_VECTOR_LENGTH); i += SIGLIB_VECTOR_LENGTH) {
+    SLDataVector_t Src1Real, Src1Imag, Src2Real, Src2Imag, DstReal, DstImag;
+    SDV_Load(Src1Real, pSrc1Real + i);
+    SDV_Load(Src1Imag, pSrc1Imag + i);
+    SDV_Load(Src2Real, pSrc2Real + i);
+    SDV_Load(Src2Imag, pSrc2Imag + i);
+    SDV_Load(DstReal, pDstReal + i);
+    SDV_Load(DstImag, pDstImag + i);
+    DstReal += (Src1Real * Src2Real) - (Src1Imag * Src2Imag);
+    DstImag += (Src1Real * Src2Imag) + (Src1Imag * Src2Real);
+    SDV_Store(pDstReal + i, DstReal);
+    SDV_Store(pDstImag + i, DstImag);
+  }
+#endif
+
+  for (; i < sampleLength; i++) {
+    pDstReal[i] += (pSrc1Real[i] * pSrc2Real[i]) - (pSrc1Imag[i] * pSrc2Imag[i]);
+    pDstImag[i] += (pSrc1Real[i] * pSrc2Imag[i]) + (pSrc1Imag[i] * pSrc2Real[i]);
+  }
+}    // End of siglib_numerix_FirPartitionedMac()
+
+/********************************************************
+ * Function: siglib_numerix_FirPartitionedBlock
+ *
+ * Parameters:
+ *  SLFirPartitioned_s *pFir            - Pointer to filter structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Filter one complete input block and write the results
+ *  to the output block.
+ *  The spectrum of the previous and current input blocks
+ *  is stored in the frequency domain delay line and the
+ *  output spectrum is the sum of the products of each
+ *  delayed input spectrum with the corresponding filter
+ *  partition spectrum. Only the (PartitionLength + 1)
+ *  non-redundant bins are stored and multiplied, the
+ *  upper half of the spectrum is the complex conjugate.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FirPartitionedBlock(SLFirPartitioned_s* pFir)
+{
+  const SLArrayIndex_t PartitionLength = pFir->PartitionLength;
+  const SLArrayIndex_t BinCount = PartitionLength + 1;
+  SLData_t* pRealTemp = pFir->pRealTemp;
+  SLData_t* pImagTemp = pFir->pImagTemp;
+
+  // Transform the previous and current input blocks into the next delay line slot
+  pFir->CurrentPartition = (pFir->CurrentPartition == 0) ? (pFir->NumberOfPartitions - 1) : (pFir->CurrentPartition - 1);
+  SDA_Copy(pFir->pInput, pRealTemp, pFir->FFTLength);
+  SDA_Rfft(pRealTemp, pImagTemp, pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength, pFir->Log2FFTLength);
+  SDA_Copy(pRealTemp, pFir->pRealDelayLine + (pFir->CurrentPartition * BinCount), BinCount);
+  SDA_Copy(pImagTemp, pFir->pImagDelayLine + (pFir->CurrentPartition * BinCount), BinCount);
+
+  // Multiply-accumulate each delayed input spectrum with its filter partition
+  SLArrayIndex_t Slot = pFir->CurrentPartition;
+  SDA_ComplexMultiply2(pFir->pRealDelayLine + (Slot * BinCount), pFir->pImagDelayLine + (Slot * BinCount), pFir->pRealFreqCoeffs,
+                       pFir->pImagFreqCoeffs, pRealTemp, pImagTemp, BinCount);
+  for (SLArrayIndex_t p = 1; p < pFir->FilterPartitions; p++) {
+    if (++Slot == pFir->NumberOfPartitions) {
+      Slot = 0;
+    }
+    siglib_numerix_FirPartitionedMac(pFir->pRealDelayLine + (Slot * BinCount), pFir->pImagDelayLine + (Slot * BinCount),
+                                     pFir->pRealFreqCoeffs + (p * BinCount), pFir->pImagFreqCoeffs + (p * BinCount), pRealTemp, pImagTemp,
+                                     BinCount);
+  }
+
+  for (SLArrayIndex_t i = 1; i < PartitionLength; i++) {    // Rebuild the conjugate symmetric upper half of the spectrum
+    pRealTemp[pFir->FFTLength - i] = pRealTemp[i];
+    pImagTemp[pFir->FFTLength - i] = -pImagTemp[i];
+  }
+
+  // The inverse FFT scaling is included in the filter partition spectra
+  SDA_Cifft(pRealTemp, pImagTemp, pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength, pFir->Log2FFTLength);
+  SDA_Copy(pRealTemp + PartitionLength, pFir->pOutput, PartitionLength);    // The second half is free of circular aliasing
+
+  SDA_Copy(pFir->pInput + PartitionLength, pFir->pInput, PartitionLength);    // The current block becomes the previous block
+}    // End of siglib_numerix_FirPartitionedBlock()
+
+/********************************************************
+ * Function: siglib_numerix_FirPartitionedAllocate
+ *
+ * Parameters:
+ *  SLFirPartitioned_s *pFir,           - Pointer to filter structure
+ *  const SLArrayIndex_t maxFilterLength,   - Maximum filter length
+ *  const SLArrayIndex_t partitionLength    - Partition length
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR on failure
+ *
+ * Description:
+ *  Allocate the partition spectra and the frequency
+ *  domain delay line for the maximum filter length and
+ *  initialise the FFT tables.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_FirPartitionedAllocate(SLFirPartitioned_s* pFir, const SLArrayIndex_t maxFilterLength,
+                                                       const SLArrayIndex_t partitionLength)
+{
+  const SLArrayIndex_t NumberOfPartitions = (maxFilterLength + partitionLength - 1) / partitionLength;
+  const SLArrayIndex_t FFTLength = 2 * partitionLength;
+  const SLArrayIndex_t BinCount = partitionLength + 1;
+
+  pFir->PartitionLength = partitionLength;
+  pFir->NumberOfPartitions = NumberOfPartitions;
+  pFir->FFTLength = FFTLength;
+  pFir->Log2FFTLength = SAI_FftLengthLog2(FFTLength);
+
+  pFir->pInput = (SLData_t*)SUF_MemoryAllocate(
+    (size_t)((3 * partitionLength) + (4 * NumberOfPartitions * BinCount) + (2 * FFTLength) + ((3 * FFTLength) / 4)) * sizeof(SLData_t));
+  pFir->pBitReverseAddressTable = (SLArrayIndex_t*)SUF_MemoryAllocate((size_t)FFTLength * sizeof(SLArrayIndex_t));
+  if ((SIGLIB_NULL_DATA_PTR == pFir->pInput) || (SIGLIB_NULL_ARRAY_INDEX_PTR == pFir->pBitReverseAddressTable)) {
+    SUF_FirPartitionedFree(pFir);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  pFir->pOutput = pFir->pInput + FFTLength;
+  pFir->pRealFreqCoeffs = pFir->pOutput + partitionLength;
+  pFir->pImagFreqCoeffs = pFir->pRealFreqCoeffs + (NumberOfPartitions * BinCount);
+  pFir->pRealDelayLine = pFir->pImagFreqCoeffs + (NumberOfPartitions * BinCount);
+  pFir->pImagDelayLine = pFir->pRealDelayLine + (NumberOfPartitions * BinCount);
+  pFir->pRealTemp = pFir->pImagDelayLine + (NumberOfPartitions * BinCount);
+  pFir->pImagTemp = pFir->pRealTemp + FFTLength;
+  pFir->pFFTCoeffs = pFir->pImagTemp + FFTLength;
+
+  SIF_Fft(pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, FFTLength);
+
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_FirPartitionedAllocate()
+
+/********************************************************
+ * Function: siglib_numerix_FirPartitionedCoefficients
+ *
+ * Parameters:
+ *  SLFirPartitioned_s *pFir,           - Pointer to filter structure
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients
+ *  const SLArrayIndex_t filterLength   - Filter length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Calculate the spectrum of each filter partition,
+ *  including the inverse FFT scaling. The delay line is
+ *  not changed so the coefficients can be replaced while
+ *  the filter is running.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FirPartitionedCoefficients(SLFirPartitioned_s* pFir, const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                                      const SLArrayIndex_t filterLength)
+{
+  const SLArrayIndex_t PartitionLength = pFir->PartitionLength;
+  const SLArrayIndex_t BinCount = PartitionLength + 1;
+  const SLData_t InverseFFTLength = SIGLIB_ONE / (SLData_t)pFir->FFTLength;
+
+  pFir->FilterLength = filterLength;
+  pFir->FilterPartitions = (filterLength + PartitionLength - 1) / PartitionLength;
+
+  for (SLArrayIndex_t p = 0; p < pFir->FilterPartitions; p++) {
+    SLArrayIndex_t CoeffCount = filterLength - (p * PartitionLength);    // The last partition can be shorter
+    if (CoeffCount > PartitionLength) {
+      CoeffCount = PartitionLength;
+    }
+    SDA_Multiply(pCoeffs + (p * PartitionLength), InverseFFTLength, pFir->pRealTemp, CoeffCount);
+    SDA_Zeros(pFir->pRealTemp + CoeffCount, pFir->FFTLength - CoeffCount);
+    SDA_Rfft(pFir->pRealTemp, pFir->pImagTemp, pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength, pFir->Log2FFTLength);
+    SDA_Copy(pFir->pRealTemp, pFir->pRealFreqCoeffs + (p * BinCount), BinCount);
+    SDA_Copy(pFir->pImagTemp, pFir->pImagFreqCoeffs + (p * BinCount), BinCount);
+  }
+}    // End of siglib_numerix_FirPartitionedCoefficients()
+
+/********************************************************
+ * Function: siglib_numerix_FirPartitionedClear
+ *
+ * Parameters:
+ *  SLFirPartitioned_s *pFir            - Pointer to filter structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Clear the input and output blocks and the frequency
+ *  domain delay line.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FirPartitionedClear(SLFirPartitioned_s* pFir)
+{
+  pFir->CurrentPartition = 0;
+  pFir->BlockIndex = 0;
+  SDA_Zeros(pFir->pInput, pFir->FFTLength + pFir->PartitionLength);                               // Clear the input and output blocks
+  SDA_Zeros(pFir->pRealDelayLine, 2 * pFir->NumberOfPartitions * (pFir->PartitionLength + 1));    // Clear the frequency domain delay line
+}    // End of siglib_numerix_FirPartitionedClear()
+
+/********************************************************
+ * Function: SIF_FirPartitioned
+ *
+ * Parameters:
+ *  SLFirPartitioned_s *pFir,           - Pointer to filter structure
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients
+ *  const SLArrayIndex_t filterLength,  - Filter length
+ *  const SLArrayIndex_t partitionLength    - Partition length
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description:
+ *  Initialise the uniformly partitioned overlap and save
+ *  FIR filter.
+ *  The filter is split into partitions of partitionLength
+ *  coefficients and the spectrum of each partition is
+ *  calculated with a (2 x partitionLength) point FFT.
+ *  The partition length must be a power of 2 and at least
+ *  8. It is the block length of the filter so it sets the
+ *  latency and the size of the FFTs, independently of the
+ *  filter length.
+ *  The memory is released with SUF_FirPartitionedFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_FirPartitioned(SLFirPartitioned_s* pFir, const SLData_t* SIGLIB_PTR_DECL pCoeffs, const SLArrayIndex_t filterLength,
+                                              const SLArrayIndex_t partitionLength)
+{
+  pFir->pInput = SIGLIB_NULL_DATA_PTR;
+  pFir->pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+
+  if ((filterLength < 1) || (partitionLength < SIGLIB_FIR_PARTITIONED_MIN_LENGTH) || ((partitionLength & (partitionLength - 1)) != 0)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  if (siglib_numerix_FirPartitionedAllocate(pFir, filterLength, partitionLength) != SIGLIB_NO_ERROR) {
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  siglib_numerix_FirPartitionedCoefficients(pFir, pCoeffs, filterLength);
+  siglib_numerix_FirPartitionedClear(pFir);
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_FirPartitioned()
+
+/********************************************************
+ * Function: SDA_FirPartitioned
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLFirPartitioned_s *pFir,           - Pointer to filter structure
+ *  const SLArrayIndex_t sampleLength   - Number of samples to filter
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply the uniformly partitioned overlap and save FIR
+ *  filter to the data array.
+ *  Each output is the SDA_Fir output delayed by one
+ *  partition length, so the latency is one block,
+ *  regardless of the filter length. Any number of samples
+ *  can be processed per call, one FFT and one inverse FFT
+ *  are calculated for every partitionLength samples.
+ *  The source and destination arrays can be the same.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_FirPartitioned(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, SLFirPartitioned_s* pFir,
+                                         const SLArrayIndex_t sampleLength)
+{
+  const SLArrayIndex_t PartitionLength = pFir->PartitionLength;
+
+  for (SLArrayIndex_t k = 0; k < sampleLength;) {
+    SLArrayIndex_t Count = PartitionLength - pFir->BlockIndex;
+    if (Count > (sampleLength - k)) {
+      Count = sampleLength - k;
+    }
+
+    SDA_Copy(pSrc + k, pFir->pInput + PartitionLength + pFir->BlockIndex, Count);
+    SDA_Copy(pFir->pOutput + pFir->BlockIndex, pDst + k, Count);
+    pFir->BlockIndex += Count;
+    k += Count;
+
+    if (pFir->BlockIndex == PartitionLength) {
+      siglib_numerix_FirPartitionedBlock(pFir);
+      pFir->BlockIndex = 0;
+    }
+  }
+}    // End of SDA_FirPartitioned()
+
+/********************************************************
+ * Function: SUF_FirPartitionedFree
+ *
+ * Parameters:
+ *  SLFirPartitioned_s *pFir            - Pointer to filter structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the memory allocated by SIF_FirPartitioned.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_FirPartitionedFree(SLFirPartitioned_s* pFir)
+{
+  if (SIGLIB_NULL_DATA_PTR != pFir->pInput) {
+    SUF_MemoryFree(pFir->pInput);
+    pFir->pInput = SIGLIB_NULL_DATA_PTR;
+  }
+  if (SIGLIB_NULL_ARRAY_INDEX_PTR != pFir->pBitReverseAddressTable) {
+    SUF_MemoryFree(pFir->pBitReverseAddressTable);
+    pFir->pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+  }
+}    // End of SUF_FirPartitionedFree()
+
+/********************************************************
+ * Function: siglib_numerix_FirAutoTimeDomain
+ *
+ * Parameters:
+ *  const SLData_t *pInput,             - Pointer to the oldest input sample used by the first output
+ *  const SLData_t *pReversedCoeffs,    - Pointer to the filter coefficients, in reverse order
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  const SLArrayIndex_t filterLength,
+ *  const SLArrayIndex_t sampleLength
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Time domain FIR filter on a linear input array that
+ *  holds the (filterLength - 1) previous samples followed
+ *  by the new samples. Consecutive outputs are calculated
+ *  in the SIMD lanes, so each coefficient is read once
+ *  per block of outputs and there is no circular buffer
+ *  index in the inner loop.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FirAutoTimeDomain(const SLData_t* SIGLIB_PTR_DECL pInput,
+                                                                      const SLData_t* SIGLIB_PTR_DECL pReversedCoeffs,
+                                                                      SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t filterLength,
+                                                                      const SLArrayIndex_t sampleLength)
+{
+  SLArrayIndex_t n = 0;
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  for (; n <= (sampleLength - (4 * SIGLIB_VECTOR_LENGTH)); n += (4 * SIGLIB_VECTOR_LENGTH)) {
+    const SLData_t* pBlockInput = pInput + n;
+    SLDataVector_t Sum0 = { 0 }, Sum1 = { 0 }, Sum2 = { 0 }, Sum3 = { 0 };
+    for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+      SLDataVector_t Input0, Input1, Input2, Input3;
+      SDV_Load(Input0, pBlockInput + i);
+      SDV_Load(Input1, pBlockInput + i + SIGLIB_VECTOR_LENGTH);
+      SDV_Load(Input2, pBlockInput + i + (2 * SIGLIB_VECTOR_LENGTH));
+      SDV_Load(Input3, pBlockInput + i + (3 * SIGLIB_VECTOR_LENGTH));
+      Sum0 += pReversedCoeffs[i] * Input0;
+      Sum1 += pReversedCoeffs[i] * Input1;
+      Sum2 += pReversedCoeffs[i] * Input2;
+      Sum3 += pReversedCoeffs[i] * Input3;
+    }
+    SDV_Store(pDst + n, Sum0);
+    SDV_Store(pDst + n + SIGLIB_VECTOR_LENGTH, Sum1);
+    SDV_Store(pDst + n + (2 * SIGLIB_VECTOR_LENGTH), Sum2);
+    SDV_Store(pDst + n + (3 * SIGLIB_VECTOR_LENGTH), Sum3);
+  }
+#else
+  for (; n <= (sampleLength - 4); n += 4) {
+    const SLData_t* pBlockInput = pInput + n;
+    SLData_t Sum0 = SIGLIB_ZERO, Sum1 = SIGLIB_ZERO, Sum2 = SIGLIB_ZERO, Sum3 = SIGLIB_ZERO;
+    for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+      Sum0 += pReversedCoeffs[i] * pBlockInput[i];
+      Sum1 += pReversedCoeffs[i] * pBlockInput[i + 1];
+      Sum2 += pReversedCoeffs[i] * pBlockInput[i + 2];
+      Sum3 += pReversedCoeffs[i] * pBlockInput[i + 3];
+    }
+    pDst[n] = Sum0;
+    pDst[n + 1] = Sum1;
+    pDst[n + 2] = Sum2;
+    pDst[n + 3] = Sum3;
+  }
+#endif
+
+  for (; n < sampleLength; n++) {    // Remaining outputs
+    SLData_t Sum = SIGLIB_ZERO;
+    for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+      Sum += pReversedCoeffs[i] * pInput[n + i];
+    }
+    pDst[n] = Sum;
+  }
+}    // End of siglib_numerix_FirAutoTimeDomain()
+
+/********************************************************
+ * Function: siglib_numerix_FirAutoFftCost
+ *
+ * Parameters:
+ *  const SLArrayIndex_t log2FFTLength
+ *
+ * Return value:
+ *  Modelled cost of one overlap and save FFT block
+ *
+ * Description:
+ *  Return the cost of the forward FFT, the complex
+ *  multiply, the inverse FFT and the scaling, in units of
+ *  one time domain multiply-accumulate.
+ *
+ ********************************************************/
+
+static SLData_t siglib_numerix_FirAutoFftCost(const SLArrayIndex_t log2FFTLength)
+{
+  SLData_t FFTLength = (SLData_t)((SLArrayIndex_t)1 << log2FFTLength);
+  return ((SIGLIB_FIR_AUTO_FFT_COST * FFTLength * (SLData_t)log2FFTLength) + (SIGLIB_FIR_AUTO_FFT_BIN_COST * FFTLength));
+}    // End of siglib_numerix_FirAutoFftCost()
+
+/********************************************************
+ * Function: siglib_numerix_FirAutoSelect
+ *
+ * Parameters:
+ *  SLFirAuto_s *pFir               - Pointer to filter structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Select the filtering method and the overlap and save
+ *  FFT length from the filter and block lengths.
+ *  Every FFT length from the shortest that gives one
+ *  output per FFT up to the length that processes the
+ *  whole block in one FFT is modelled, and the fastest is
+ *  compared with the time domain filter and, when a
+ *  latency is allowed, the uniformly partitioned filter.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FirAutoSelect(SLFirAuto_s* pFir)
+{
+  SLArrayIndex_t filterLength = pFir->FilterLength;
+  SLArrayIndex_t blockLength = pFir->BlockLength;
+
+  SLData_t BestFftCost = SIGLIB_ZERO;
+  for (SLArrayIndex_t log2FFTLength = SIGLIB_FIR_AUTO_MIN_LOG2_FFT_LENGTH;; log2FFTLength++) {
+    SLArrayIndex_t FFTLength = (SLArrayIndex_t)1 << log2FFTLength;
+    SLArrayIndex_t FFTBlockLength = FFTLength - (filterLength - 1);
+    if (FFTBlockLength < 1) {
+      continue;
+    }
+    if (FFTBlockLength > blockLength) {
+      FFTBlockLength = blockLength;
+    }
+    SLData_t Cost = (SLData_t)((blockLength + FFTBlockLength - 1) / FFTBlockLength) * siglib_numerix_FirAutoFftCost(log2FFTLength);
+    if ((pFir->FFTLength == 0) || (Cost < BestFftCost)) {
+      BestFftCost = Cost;
+      pFir->FFTLength = FFTLength;
+      pFir->Log2FFTLength = log2FFTLength;
+      pFir->FFTBlockLength = FFTBlockLength;
+    }
+    if (FFTBlockLength == blockLength) {    // Longer FFTs only add cost
+      break;
+    }
+  }
+
+  if (pFir->RequestedMethod == SIGLIB_FIR_AUTO_SELECT) {
+    SLData_t TimeDomainCost = (SLData_t)filterLength * (SLData_t)blockLength;
+    pFir->Method = (TimeDomainCost <= BestFftCost) ? SIGLIB_FIR_AUTO_TIME_DOMAIN : SIGLIB_FIR_AUTO_OVERLAP_SAVE;
+
+    if (SIGLIB_NULL_DATA_PTR != pFir->Partitioned.pInput) {    // One FFT and one inverse FFT per partition length samples
+      SLArrayIndex_t PartitionLength = pFir->Partitioned.PartitionLength;
+      SLArrayIndex_t FilterPartitions = (filterLength + PartitionLength - 1) / PartitionLength;
+      SLData_t PartitionedCost = ((SLData_t)blockLength / (SLData_t)PartitionLength) *
+                                 (siglib_numerix_FirAutoFftCost(pFir->Partitioned.Log2FFTLength) +
+                                  (SIGLIB_FIR_AUTO_PARTITION_BIN_COST * (SLData_t)(FilterPartitions - 1) * (SLData_t)(PartitionLength + 1)));
+      if (PartitionedCost < ((TimeDomainCost <= BestFftCost) ? TimeDomainCost : BestFftCost)) {
+        pFir->Method = SIGLIB_FIR_AUTO_PARTITIONED;
+      }
+    }
+  } else {
+    pFir->Method = pFir->RequestedMethod;
+  }
+}    // End of siglib_numerix_FirAutoSelect()
+
+/********************************************************
+ * Function: SIF_FirAutoCoefficients
+ *
+ * Parameters:
+ *  SLFirAuto_s *pFir,                  - Pointer to filter structure
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients
+ *  const SLArrayIndex_t filterLength   - Filter length
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_PARAMETER_ERROR if the filter
+ *  length is longer than the maximum filter length
+ *
+ * Description:
+ *  Load new filter coefficients, for example when the
+ *  filter is redesigned at run time, and re-select the
+ *  filtering method.
+ *  The filter length can be changed, up to the maximum
+ *  filter length given to SIF_FirAuto. The input history
+ *  is common to all of the methods so the output does not
+ *  glitch when the method changes, other than the change
+ *  in latency when the partitioned method is selected or
+ *  deselected.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_FirAutoCoefficients(SLFirAuto_s* pFir, const SLData_t* SIGLIB_PTR_DECL pCoeffs, const SLArrayIndex_t filterLength)
+{
+  if ((filterLength < 1) || (filterLength > pFir->MaxFilterLength)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  enum SLFirAutoMethod_t PreviousMethod = pFir->Method;
+  pFir->FilterLength = filterLength;
+  pFir->FFTLength = 0;
+  siglib_numerix_FirAutoSelect(pFir);
+
+  for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+    pFir->pReversedCoeffs[i] = pCoeffs[filterLength - 1 - i];
+  }
+
+  if (pFir->Method == SIGLIB_FIR_AUTO_OVERLAP_SAVE) {
+    SIF_Fft(pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength);
+    SDA_Copy(pCoeffs, pFir->pRealFreqCoeffs, filterLength);
+    SDA_Zeros(pFir->pRealFreqCoeffs + filterLength, pFir->FFTLength - filterLength);
+    SDA_Rfft(pFir->pRealFreqCoeffs, pFir->pImagFreqCoeffs, pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength,
+             pFir->Log2FFTLength);
+    pFir->InverseFFTLength = SIGLIB_ONE / (SLData_t)pFir->FFTLength;
+  } else if (pFir->Method == SIGLIB_FIR_AUTO_PARTITIONED) {
+    siglib_numerix_FirPartitionedCoefficients(&pFir->Partitioned, pCoeffs, filterLength);
+    if (PreviousMethod != SIGLIB_FIR_AUTO_PARTITIONED) {    // Rebuild the frequency domain delay line from the input history
+      siglib_numerix_FirPartitionedClear(&pFir->Partitioned);
+      SDA_FirPartitioned(pFir->pInput + pFir->InputOffset, pFir->pRealTemp, &pFir->Partitioned, pFir->MaxFilterLength - 1);
+    }
+  }
+
+  pFir->Latency = (pFir->Method == SIGLIB_FIR_AUTO_PARTITIONED) ? pFir->Partitioned.PartitionLength : 0;
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_FirAutoCoefficients()
+
+/********************************************************
+ * Function: SIF_FirAuto
+ *
+ * Parameters:
+ *  SLFirAuto_s *pFir,                  - Pointer to filter structure
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients
+ *  const SLArrayIndex_t filterLength,  - Filter length
+ *  const SLArrayIndex_t maxFilterLength,   - Maximum filter length
+ *  const SLArrayIndex_t blockLength,   - Maximum number of samples per call
+ *  const SLArrayIndex_t maxLatency,    - Maximum added latency (samples)
+ *  const enum SLFirAutoMethod_t method - Filtering method
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description:
+ *  Initialise the FIR filter that selects between the
+ *  time domain, overlap and save and uniformly
+ *  partitioned frequency domain methods. With
+ *  SIGLIB_FIR_AUTO_SELECT the method is chosen by
+ *  modelling the cost of each method from the filter
+ *  length, the block length and the available FFT
+ *  lengths, otherwise the requested method is used.
+ *  The time domain and overlap and save methods add no
+ *  latency. The partitioned method is only available
+ *  when maxLatency is at least 8 samples, it uses the
+ *  longest power of 2 partition length that fits in
+ *  maxLatency and delays the output by the partition
+ *  length, which is very much faster for long filters.
+ *  A maxLatency of 0 keeps the output aligned with
+ *  SDA_Fir.
+ *  The arrays are allocated for the maximum filter length
+ *  so the coefficients can be changed with
+ *  SIF_FirAutoCoefficients. The memory is released with
+ *  SUF_FirAutoFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_FirAuto(SLFirAuto_s* pFir, const SLData_t* SIGLIB_PTR_DECL pCoeffs, const SLArrayIndex_t filterLength,
+                                       const SLArrayIndex_t maxFilterLength, const SLArrayIndex_t blockLength, const SLArrayIndex_t maxLatency,
+                                       const enum SLFirAutoMethod_t method)
+{
+  pFir->pInput = SIGLIB_NULL_DATA_PTR;
+  pFir->pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+  pFir->Partitioned.pInput = SIGLIB_NULL_DATA_PTR;
+  pFir->Partitioned.pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+
+  if ((maxFilterLength < 1) || (blockLength < 1) ||
+      ((method == SIGLIB_FIR_AUTO_PARTITIONED) && (maxLatency < SIGLIB_FIR_PARTITIONED_MIN_LENGTH))) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  pFir->RequestedMethod = method;
+  pFir->Method = SIGLIB_FIR_AUTO_SELECT;    // No method in use yet
+  pFir->MaxFilterLength = maxFilterLength;
+  pFir->BlockLength = blockLength;
+  pFir->InputOffset = 0;
+
+  // The longest FFT is used by the longest filter, to process the whole block in one FFT
+  SLArrayIndex_t MaxFFTLength = (SLArrayIndex_t)1 << SIGLIB_FIR_AUTO_MIN_LOG2_FFT_LENGTH;
+  while (MaxFFTLength < (maxFilterLength + blockLength - 1)) {
+    MaxFFTLength <<= 1;
+  }
+
+  // Input history is compacted once per (maxFilterLength + blockLength) samples
+  SLArrayIndex_t InputLength = 2 * ((maxFilterLength - 1) + blockLength);
+  pFir->pInput = (SLData_t*)SUF_MemoryAllocate(
+    (size_t)(InputLength + maxFilterLength + (4 * MaxFFTLength) + ((3 * MaxFFTLength) / 4)) * sizeof(SLData_t));
+  pFir->pBitReverseAddressTable = (SLArrayIndex_t*)SUF_MemoryAllocate((size_t)MaxFFTLength * sizeof(SLArrayIndex_t));
+  if ((SIGLIB_NULL_DATA_PTR == pFir->pInput) || (SIGLIB_NULL_ARRAY_INDEX_PTR == pFir->pBitReverseAddressTable)) {
+    SUF_FirAutoFree(pFir);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  pFir->pReversedCoeffs = pFir->pInput + InputLength;
+  pFir->pRealFreqCoeffs = pFir->pReversedCoeffs + maxFilterLength;
+  pFir->pImagFreqCoeffs = pFir->pRealFreqCoeffs + MaxFFTLength;
+  pFir->pRealTemp = pFir->pImagFreqCoeffs + MaxFFTLength;
+  pFir->pImagTemp = pFir->pRealTemp + MaxFFTLength;
+  pFir->pFFTCoeffs = pFir->pImagTemp + MaxFFTLength;
+
+  if (maxLatency >= SIGLIB_FIR_PARTITIONED_MIN_LENGTH) {    // Longest partition that fits in the latency, no longer than the filter
+    SLArrayIndex_t PartitionLength = SIGLIB_FIR_PARTITIONED_MIN_LENGTH;
+    while (((PartitionLength << 1) <= maxLatency) && (PartitionLength < maxFilterLength)) {
+      PartitionLength <<= 1;
+    }
+    if (siglib_numerix_FirPartitionedAllocate(&pFir->Partitioned, maxFilterLength, PartitionLength) != SIGLIB_NO_ERROR) {
+      SUF_FirAutoFree(pFir);
+      return (SIGLIB_MEM_ALLOC_ERROR);
+    }
+  }
+
+  SDA_Zeros(pFir->pInput, InputLength);    // Clear the filter history
+
+  SLError_t ErrorCode = SIF_FirAutoCoefficients(pFir, pCoeffs, filterLength);
+  if (ErrorCode != SIGLIB_NO_ERROR) {
+    SUF_FirAutoFree(pFir);
+  }
+  return (ErrorCode);
+}    // End of SIF_FirAuto()
+
+/********************************************************
+ * Function: SDA_FirAuto
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLFirAuto_s *pFir,                  - Pointer to filter structure
+ *  const SLArrayIndex_t sampleLength   - Number of samples to filter
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply the FIR filter to the data array using the
+ *  method selected by SIF_FirAuto. The results are the
+ *  same as SDA_Fir, with one output per input sample,
+ *  delayed by pFir->Latency samples, which is zero
+ *  unless the partitioned method is in use.
+ *  The source and destination arrays can be the same.
+ *
+ * Notes:
+ *  The input samples are appended to a linear history
+ *  array. When the end of the array is reached the last
+ *  (maxFilterLength - 1) samples are moved to the start,
+ *  which happens at most once every
+ *  (maxFilterLength + blockLength) samples.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_FirAuto(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, SLFirAuto_s* pFir,
+                                  const SLArrayIndex_t sampleLength)
+{
+  const SLArrayIndex_t HistoryLength = pFir->MaxFilterLength - 1;
+  const SLArrayIndex_t InputLength = 2 * (HistoryLength + pFir->BlockLength);
+
+  for (SLArrayIndex_t k = 0; k < sampleLength;) {
+    SLArrayIndex_t blockLength = ((sampleLength - k) < pFir->BlockLength) ? (sampleLength - k) : pFir->BlockLength;
+
+    if ((pFir->InputOffset + HistoryLength + blockLength) > InputLength) {    // Move the history to the start of the array
+      SDA_Copy(pFir->pInput + pFir->InputOffset, pFir->pInput, HistoryLength);
+      pFir->InputOffset = 0;
+    }
+    SLData_t* pInput = pFir->pInput + pFir->InputOffset + HistoryLength;    // Position of the first new sample
+    SDA_Copy(pSrc + k, pInput, blockLength);
+
+    const SLData_t* pFilterInput = pInput - (pFir->FilterLength - 1);    // Oldest sample used by the first output
+
+    if (pFir->Method == SIGLIB_FIR_AUTO_TIME_DOMAIN) {
+      siglib_numerix_FirAutoTimeDomain(pFilterInput, pFir->pReversedCoeffs, pDst + k, pFir->FilterLength, blockLength);
+    } else if (pFir->Method == SIGLIB_FIR_AUTO_PARTITIONED) {
+      SDA_FirPartitioned(pInput, pDst + k, &pFir->Partitioned, blockLength);
+    } else {    // Overlap and save
+      for (SLArrayIndex_t n = 0; n < blockLength; n += pFir->FFTBlockLength) {
+        SLArrayIndex_t FFTBlockLength = ((blockLength - n) < pFir->FFTBlockLength) ? (blockLength - n) : pFir->FFTBlockLength;
+        SLArrayIndex_t FrameLength = FFTBlockLength + pFir->FilterLength - 1;
+
+        SDA_Copy(pFilterInput + n, pFir->pRealTemp, FrameLength);
+        SDA_Zeros(pFir->pRealTemp + FrameLength, pFir->FFTLength - FrameLength);
+        SDA_Rfft(pFir->pRealTemp, pFir->pImagTemp, pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength, pFir->Log2FFTLength);
+        SDA_ComplexMultiply2(pFir->pRealTemp, pFir->pImagTemp, pFir->pRealFreqCoeffs, pFir->pImagFreqCoeffs, pFir->pRealTemp, pFir->pImagTemp,
+                             pFir->FFTLength);
+        SDA_Cifft(pFir->pRealTemp, pFir->pImagTemp, pFir->pFFTCoeffs, pFir->pBitReverseAddressTable, pFir->FFTLength, pFir->Log2FFTLength);
+        SDA_Multiply(pFir->pRealTemp + pFir->FilterLength - 1, pFir->InverseFFTLength, pDst + k + n,
+                     FFTBlockLength);    // Scale the valid (non-aliased) outputs
+      }
+    }
+
+    pFir->InputOffset += blockLength;
+    k += blockLength;
+  }
+}    // End of SDA_FirAuto()
+
+/********************************************************
+ * Function: SUF_FirAutoFree
+ *
+ * Parameters:
+ *  SLFirAuto_s *pFir                   - Pointer to filter structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the memory allocated by SIF_FirAuto.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_FirAutoFree(SLFirAuto_s* pFir)
+{
+  if (SIGLIB_NULL_DATA_PTR != pFir->pInput) {
+    SUF_MemoryFree(pFir->pInput);
+    pFir->pInput = SIGLIB_NULL_DATA_PTR;
+  }
+  if (SIGLIB_NULL_ARRAY_INDEX_PTR != pFir->pBitReverseAddressTable) {
+    SUF_MemoryFree(pFir->pBitReverseAddressTable);
+    pFir->pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+  }
+  SUF_FirPartitionedFree(&pFir->Partitioned);
+}    // End of SUF_FirAutoFree()
@@ -40,6 +40,72 @@ Description: SigLib DSP library Fast Fourier Transform routines.
 
 #include <siglib.h>    // Include SigLib header file
 
+#define SIGLIB_FFT_BATCH_BLOCK_LENGTH 64U       // Batched FFT stages are performed in blocks of this many samples once they fit in L1
+#define SIGLIB_FFT_BATCH_MAX_LENGTH 256         // Longer batched FFTs are performed one channel at a time, which fits in L1
+#define SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH 32    // Four-step FFT transpose tile size
+#define SIGLIB_FFT_FOUR_STEP_MIN_LENGTH 16      // Shortest four-step FFT, the row FFTs must be at least 4 points
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+/********************************************************
+ * Function: siglib_numerix_FftStageVector
+ *
+ * Parameters:
+ *  SLData_t realData[],
+ *  SLData_t imagData[],
+ *  const SLData_t *pFFTSineCoeffs,
+ *  const SLData_t *pFFTCosineCoeffs,
+ *  const SLUFixData_t fftLength,
+ *  const SLUFixData_t Stride,          - Butterfly span
+ *  const SLUFixData_t AngleInc,        - Twiddle factor increment
+ *  const SLData_t SineSign             - +1 forward, -1 inverse
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform one radix-2 DIF stage using SIMD vectors.
+ *  The twiddle factors are gathered once per vector and
+ *  applied to every group in the stage.
+ *  Stride must be a multiple of SIGLIB_VECTOR_LENGTH.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FftStageVector(SLData_t realData[], SLData_t imagData[], const SLData_t* pFFTSineCoeffs,
+                                                                   const SLData_t* pFFTCosineCoeffs, const SLUFixData_t fftLength,
+                                                                   const SLUFixData_t Stride, const SLUFixData_t AngleInc,
+                                                                   const SLData_t SineSign)
+{
+  for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter += (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {
+    SLDataVector_t Cos, Sin;
+    for (SLArrayIndex_t l = 0; l < SIGLIB_VECTOR_LENGTH; l++) {
+      Cos[l] = pFFTCosineCoeffs[(BflyCounter + (SLUFixData_t)l) * AngleInc];
+      Sin[l] = SineSign * pFFTSineCoeffs[(BflyCounter + (SLUFixData_t)l) * AngleInc];
+    }
+
+    for (SLUFixData_t h = BflyCounter; h < fftLength; h += (Stride << 1U)) {
+      SLUFixData_t j = h + Stride;
+      SLDataVector_t realH, imagH, realJ, imagJ;
+      SDV_Load(realH, realData + h);
+      SDV_Load(imagH, imagData + h);
+      SDV_Load(realJ, realData + j);
+      SDV_Load(imagJ, imagData + j);
+
+      SLDataVector_t realTemp = realH - realJ;
+      SLDataVector_t imagTemp = imagH - imagJ;
+      realH = realH + realJ;
+      imagH = imagH + imagJ;
+      realJ = Cos * realTemp + Sin * imagTemp;
+      imagJ = Cos * imagTemp - Sin * realTemp;
+
+      SDV_Store(realData + h, realH);
+      SDV_Store(imagData + h, imagH);
+      SDV_Store(realData + j, realJ);
+      SDV_Store(imagData + j, imagJ);
+    }
+  }
+}    // End of siglib_numerix_FftStageVector()
+#endif
+
 /********************************************************
  * Function: SAI_FftLengthLog2
  *
@@ -142,6 +208,136 @@ void SIGLIB_FUNC_DECL SIF_Fft(SLData_t* SIGLIB_PTR_DECL pFFTCoeffs, SLArrayIndex
   }
 }    // End of SIF_Fft()
 
+/********************************************************
+ * Function: siglib_numerix_RfftHalfLength
+ *
+ * Parameters:
+ *  SLData_t realData[],
+ *  SLData_t imagData[],
+ *  const SLData_t *pFFTSineCoeffs,
+ *  const SLData_t *pFFTCosineCoeffs,
+ *  const SLArrayIndex_t *pBitReverseAddressTable,
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a real input FFT by packing the even and odd
+ *  samples into the real and imaginary parts of an N/2
+ *  point complex FFT, followed by a post-processing pass
+ *  that separates the even and odd spectra.
+ *  The N/2 point FFT uses every second entry of the N
+ *  point coefficient and bit reverse address tables.
+ *  The results are in natural order and the output is
+ *  the full N point complex spectrum, as SDA_Rfft.
+ *
+ ********************************************************/
+
+static void siglib_numerix_RfftHalfLength(SLData_t realData[], SLData_t imagData[], const SLData_t* pFFTSineCoeffs,
+                                          const SLData_t* pFFTCosineCoeffs, const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable,
+                                          const SLArrayIndex_t fftLength, const SLArrayIndex_t log2FFTLength)
+{
+  SLUFixData_t halfFFTLength = (SLUFixData_t)fftLength >> 1U;
+
+  // Pack the even samples into the real array and the odd samples into the imaginary array
+  for (SLUFixData_t i = 0; i < halfFFTLength; i++) {
+    imagData[i] = realData[(i << 1U) + 1U];
+    realData[i] = realData[i << 1U];
+  }
+
+  // N/2 point complex FFT
+  for (SLUFixData_t i = 1, Stride = halfFFTLength, AngleInc = 2U; i < (SLUFixData_t)log2FFTLength; i++) {
+    SLUFixData_t k = Stride;
+    Stride >>= 1U;
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+    if (Stride >= (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {    // Wide stages use SIMD butterflies
+      siglib_numerix_FftStageVector(realData, imagData, pFFTSineCoeffs, pFFTCosineCoeffs, halfFFTLength, Stride, AngleInc, SIGLIB_ONE);
+      AngleInc <<= 1U;
+      continue;
+    }
+#endif
+    SLArrayIndex_t Angle = 0;
+    for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
+      SLData_t Cos = pFFTCosineCoeffs[Angle];
+      SLData_t Sin = pFFTSineCoeffs[Angle];
+      Angle += AngleInc;
+
+      SLUFixData_t h = BflyCounter;
+      SLUFixData_t j = h + Stride;
+
+      for (SLUFixData_t g = k; g <= halfFFTLength; g += k, h += k, j += k) {
+        SLData_t realTemp = realData[h] - realData[j];
+        SLData_t imagTemp = imagData[h] - imagData[j];
+        realData[h] = realData[h] + realData[j];
+        imagData[h] = imagData[h] + imagData[j];
+        realData[j] = Cos * realTemp + Sin * imagTemp;
+        imagData[j] = Cos * imagTemp - Sin * realTemp;
+      }
+    }
+    AngleInc <<= 1U;
+  }
+
+  // Bit reverse reorder the N/2 point results
+  if (pBitReverseAddressTable == SIGLIB_BIT_REV_STANDARD) {    // Standard mode
+    for (SLUFixData_t j = 0, i = 0; j < halfFFTLength; j++) {
+      if (j < i) {
+        SDS_Swap(realData[i], realData[j]);
+        SDS_Swap(imagData[i], imagData[j]);
+      }
+
+      SLUFixData_t k = halfFFTLength >> 1U;
+      while ((k <= i) && (k >= 1U)) {
+        i -= k;
+        k >>= 1U;
+      }
+      i += k;
+    }
+  } else {    // Fast mode - bitrev(2i) in the N point table is the N/2 point bitrev(i)
+    for (SLUFixData_t i = 1; i < (halfFFTLength - 1U); i++) {
+      SLUFixData_t j;
+
+      if (i < (j = (SLUFixData_t) * (pBitReverseAddressTable + (i << 1U)))) {    // Only swap if necessary
+        SDS_Swap(realData[i], realData[j]);
+        SDS_Swap(imagData[i], imagData[j]);
+      }
+    }
+  }
+
+  // Separate the even and odd spectra and combine them into the N point spectrum
+  // X(k) = (Z(k) + Z*(N/2-k)) / 2 - j.W^k.(Z(k) - Z*(N/2-k)) / 2
+  SLData_t realZ0 = realData[0];
+  SLData_t imagZ0 = imagData[0];
+  realData[0] = realZ0 + imagZ0;
+  imagData[0] = SIGLIB_ZERO;
+  realData[halfFFTLength] = realZ0 - imagZ0;
+  imagData[halfFFTLength] = SIGLIB_ZERO;
+
+  for (SLUFixData_t k = 1, m = halfFFTLength - 1U; k <= m; k++, m--) {
+    SLData_t realSum = SIGLIB_HALF * (realData[k] + realData[m]);    // Even spectrum
+    SLData_t imagDiff = SIGLIB_HALF * (imagData[k] - imagData[m]);
+    SLData_t realDiff = SIGLIB_HALF * (realData[k] - realData[m]);    // Odd spectrum
+    SLData_t imagSum = SIGLIB_HALF * (imagData[k] + imagData[m]);
+
+    // Odd spectrum twiddle for bin k is (Cos - jSin) and for bin N/2-k is -(Cos + jSin)
+    SLData_t Cos = pFFTCosineCoeffs[k];
+    SLData_t Sin = pFFTSineCoeffs[k];
+    SLData_t realTwid = Cos * imagSum - Sin * realDiff;
+    SLData_t imagTwid = -(Sin * imagSum + Cos * realDiff);
+
+    realData[k] = realSum + realTwid;
+    imagData[k] = imagDiff + imagTwid;
+    realData[m] = realSum - realTwid;
+    imagData[m] = imagTwid - imagDiff;
+
+    realData[fftLength - k] = realData[k];    // Conjugate symmetric upper half
+    imagData[fftLength - k] = -imagData[k];
+    realData[fftLength - m] = realData[m];
+    imagData[fftLength - m] = -imagData[m];
+  }
+}    // End of siglib_numerix_RfftHalfLength()
+
 /********************************************************
  * Function: SDA_Rfft
  *
@@ -158,6 +354,10 @@ void SIGLIB_FUNC_DECL SIF_Fft(SLData_t* SIGLIB_PTR_DECL pFFTCoeffs, SLArrayIndex
  *
  * Description:
  *  Perform a real input FFT on the supplied data.
+ *  When the results are to be bit reverse reordered,
+ *  the FFT is calculated using an N/2 point complex FFT,
+ *  otherwise a full length radix-2 FFT is used so that
+ *  the results are in bit reversed order.
  *
  ********************************************************/
 
@@ -173,17 +373,47 @@ void SIGLIB_FUNC_DECL SDA_Rfft(SLData_t realData[], SLData_t imagData[], const S
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_RFFT);
+
   const SLData_t* pFFTSineCoeffs = pFFTCoeffs;
   const SLData_t* pFFTCosineCoeffs = pFFTCoeffs + (SLArrayIndex_t)((SLUFixData_t)fftLength >> 2U);
 
+  if ((pBitReverseAddressTable != SIGLIB_BIT_REV_NONE) && (fftLength >= 8)) {    // Natural order results - use N/2 point complex FFT
+    siglib_numerix_RfftHalfLength(realData, imagData, pFFTSineCoeffs, pFFTCosineCoeffs, pBitReverseAddressTable, fftLength, log2FFTLength);
+    SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_RFFT);
+    return;
+  }
+
   {
     SLUFixData_t j = (SLUFixData_t)fftLength >> 1U;
     SLUFixData_t Stride = j;
     SLUFixData_t h = 0;
     SLUFixData_t Angle = h;
+    SLUFixData_t BflyCounter = 0;
 
     // First stage
-    for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+    for (; (BflyCounter + (SLUFixData_t)SIGLIB_VECTOR_LENGTH) <= Stride; BflyCounter += (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {
+      SLDataVector_t realH, realJ, Cos, Sin;
+      SDV_Load(realH, realData + h);
+      SDV_Load(realJ, realData + j);
+      SDV_Load(Cos, pFFTCosineCoeffs + Angle);
+      SDV_Load(Sin, pFFTSineCoeffs + Angle);
+      SLDataVector_t realTemp = realH - realJ;
+      SLDataVector_t imagH = {0};    // Clear imaginary part
+      realH = realH + realJ;
+      realJ = Cos * realTemp;
+      SLDataVector_t imagJ = -Sin * realTemp;
+      SDV_Store(realData + h, realH);
+      SDV_Store(imagData + h, imagH);
+      SDV_Store(realData + j, realJ);
+      SDV_Store(imagData + j, imagJ);
+      Angle += (SLUFixData_t)SIGLIB_VECTOR_LENGTH;
+      h += (SLUFixData_t)SIGLIB_VECTOR_LENGTH;
+      j += (SLUFixData_t)SIGLIB_VECTOR_LENGTH;
+    }
+#endif
+    for (; BflyCounter < Stride; BflyCounter++) {
       SLData_t realTemp = realData[h] - realData[j];
       realData[h] = realData[h] + realData[j];
       imagData[h] = SIGLIB_ZERO;    // Clear imaginary part
@@ -198,6 +428,13 @@ void SIGLIB_FUNC_DECL SDA_Rfft(SLData_t realData[], SLData_t imagData[], const S
   for (SLUFixData_t i = 1, Stride = (SLUFixData_t)fftLength >> 1, AngleInc = 2U; i < (SLUFixData_t)(log2FFTLength - 1); i++) {    // Middle stages
     SLUFixData_t k = Stride;
     Stride >>= 1;
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+    if (Stride >= (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {    // Wide stages use SIMD butterflies
+      siglib_numerix_FftStageVector(realData, imagData, pFFTSineCoeffs, pFFTCosineCoeffs, (SLUFixData_t)fftLength, Stride, AngleInc, SIGLIB_ONE);
+      AngleInc <<= 1;
+      continue;
+    }
+#endif
     SLArrayIndex_t Angle = 0;
     for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
       SLData_t Cos = pFFTCosineCoeffs[Angle];
@@ -256,6 +493,7 @@ void SIGLIB_FUNC_DECL SDA_Rfft(SLData_t realData[], SLData_t imagData[], const S
       }
     }
   }
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_RFFT);
 }    // End of SDA_Rfft()
 
 /********************************************************
@@ -289,12 +527,21 @@ void SIGLIB_FUNC_DECL SDA_Cfft(SLData_t realData[], SLData_t imagData[], const S
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_CFFT);
+
   const SLData_t* pFFTSineCoeffs = pFFTCoeffs;
   const SLData_t* pFFTCosineCoeffs = pFFTCoeffs + (SLArrayIndex_t)((SLUFixData_t)fftLength >> 2U);
 
   for (SLUFixData_t i = 0, Stride = (SLUFixData_t)fftLength, AngleInc = 1U; i < (SLUFixData_t)log2FFTLength; i++) {
     SLUFixData_t k = Stride;
     Stride >>= 1;
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+    if (Stride >= (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {    // Wide stages use SIMD butterflies
+      siglib_numerix_FftStageVector(realData, imagData, pFFTSineCoeffs, pFFTCosineCoeffs, (SLUFixData_t)fftLength, Stride, AngleInc, SIGLIB_ONE);
+      AngleInc <<= 1U;
+      continue;
+    }
+#endif
     SLArrayIndex_t Angle = 0;
     for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
       SLData_t Cos = pFFTCosineCoeffs[Angle];
@@ -343,6 +590,7 @@ void SIGLIB_FUNC_DECL SDA_Cfft(SLData_t realData[], SLData_t imagData[], const S
       }
     }
   }
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_CFFT);
 }    // End of SDA_Cfft()
 
 /********************************************************
@@ -384,6 +632,14 @@ void SIGLIB_FUNC_DECL SDA_Cifft(SLData_t realData[], SLData_t imagData[], const
   for (SLUFixData_t i = 0, Stride = (SLUFixData_t)fftLength, AngleInc = 1U; i < (SLUFixData_t)log2FFTLength; i++) {
     SLUFixData_t k = Stride;
     Stride >>= 1U;
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+    if (Stride >= (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {    // Wide stages use SIMD butterflies
+      siglib_numerix_FftStageVector(realData, imagData, pFFTSineCoeffs, pFFTCosineCoeffs, (SLUFixData_t)fftLength, Stride, AngleInc,
+                                    SIGLIB_MINUS_ONE);
+      AngleInc <<= 1U;
+      continue;
+    }
+#endif
     SLArrayIndex_t Angle = 0;
     for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
       SLData_t Cos = pFFTCosineCoeffs[Angle];
@@ -1822,3 +2078,1125 @@ void SIGLIB_FUNC_DECL SDA_Cfft3(const SLData_t pSrcReal[], const SLData_t pSrcIm
   *(pDstReal + 2) = tmp1_r - (tmp2_r + tmp3_r) * SIGLIB_HALF + (tmp2_i - tmp3_i) * SIGLIB_HALF_SQRT_THREE;
   *(pDstImag + 2) = tmp1_i - (tmp2_i + tmp3_i) * SIGLIB_HALF - (tmp2_r - tmp3_r) * SIGLIB_HALF_SQRT_THREE;
 }    // End of SDA_Cfft3()
+
+/********************************************************
+ * Function: SIF_FftPlan
+ *
+ * Parameters:
+ *  SLData_t *pPlanCoeffs,                      - Plan coefficient pointer
+ *  SLArrayIndex_t *pBitReverseAddressTable,    - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t fftLength
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Initialise the FFT plan for SDA_FftExecute and
+ *  SDA_IfftExecute.
+ *  The transform is decomposed into radix-4 stages,
+ *  followed by a single radix-2 stage when log2(length)
+ *  is odd. The twiddle factors W^n, W^2n and W^3n for
+ *  each radix-4 stage are stored contiguously so that
+ *  each stage streams its own coefficients.
+ *  The plan coefficient array must be at least
+ *  SAI_FftPlanCoeffsLength(fftLength) long.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SIF_FftPlan(SLData_t* SIGLIB_PTR_DECL pPlanCoeffs, SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable,
+                                  const SLArrayIndex_t fftLength)
+{
+  // Radix-4 stages - the last stage with a quarter length of 1 has no twiddle factors
+  for (SLArrayIndex_t Quarter = fftLength >> 2; Quarter >= 2; Quarter >>= 2) {
+    SLArrayIndex_t Span = Quarter << 2;
+    for (SLArrayIndex_t i = 0; i < Quarter; i++) {
+      for (SLArrayIndex_t m = 1; m < 4; m++) {
+        SLData_t Angle = (SIGLIB_TWO_PI * ((SLData_t)(m * i))) / ((SLData_t)Span);
+        pPlanCoeffs[(2 * (m - 1)) * Quarter + i] = SDS_Cos(Angle);
+        pPlanCoeffs[(2 * (m - 1) + 1) * Quarter + i] = SDS_Sin(Angle);
+      }
+    }
+    pPlanCoeffs += 6 * Quarter;
+  }
+
+  if ((pBitReverseAddressTable != SIGLIB_BIT_REV_STANDARD) && (pBitReverseAddressTable != SIGLIB_BIT_REV_NONE)) {
+    // Generate bit-reversed address table
+    for (SLArrayIndex_t i = 0; i < fftLength; i++) {
+      pBitReverseAddressTable[i] = i;
+    }
+    SDA_IndexBitReverseReorder(pBitReverseAddressTable, pBitReverseAddressTable, fftLength);
+  }
+}    // End of SIF_FftPlan()
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+/********************************************************
+ * Function: siglib_numerix_FftPlanStageVector
+ *
+ * Parameters:
+ *  SLData_t realData[],
+ *  SLData_t imagData[],
+ *  const SLData_t *pStageCoeffs,       - Twiddle factors for this stage
+ *  const SLUFixData_t fftLength,
+ *  const SLUFixData_t Quarter,         - Quarter of the butterfly span
+ *  const SLData_t Direction            - +1 forward, -1 inverse
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform one radix-4 DIF stage of SDA_FftExecute or
+ *  SDA_IfftExecute using SIMD vectors.
+ *  Quarter must be a multiple of SIGLIB_VECTOR_LENGTH.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FftPlanStageVector(SLData_t realData[], SLData_t imagData[], const SLData_t* pStageCoeffs,
+                                                                       const SLUFixData_t fftLength, const SLUFixData_t Quarter,
+                                                                       const SLData_t Direction)
+{
+  for (SLUFixData_t g = 0; g < fftLength; g += (Quarter << 2U)) {
+    for (SLUFixData_t n = 0; n < Quarter; n += (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {
+      SLUFixData_t i0 = g + n;
+      SLUFixData_t i1 = i0 + Quarter;
+      SLUFixData_t i2 = i1 + Quarter;
+      SLUFixData_t i3 = i2 + Quarter;
+      SLDataVector_t r0, j0, r1, j1, r2, j2, r3, j3, Cos1, Sin1, Cos2, Sin2, Cos3, Sin3;
+      SDV_Load(r0, realData + i0);
+      SDV_Load(j0, imagData + i0);
+      SDV_Load(r1, realData + i1);
+      SDV_Load(j1, imagData + i1);
+      SDV_Load(r2, realData + i2);
+      SDV_Load(j2, imagData + i2);
+      SDV_Load(r3, realData + i3);
+      SDV_Load(j3, imagData + i3);
+      SDV_Load(Cos1, pStageCoeffs + n);
+      SDV_Load(Sin1, pStageCoeffs + Quarter + n);
+      SDV_Load(Cos2, pStageCoeffs + 2U * Quarter + n);
+      SDV_Load(Sin2, pStageCoeffs + 3U * Quarter + n);
+      SDV_Load(Cos3, pStageCoeffs + 4U * Quarter + n);
+      SDV_Load(Sin3, pStageCoeffs + 5U * Quarter + n);
+      Sin1 *= Direction;
+      Sin2 *= Direction;
+      Sin3 *= Direction;
+
+      SLDataVector_t t0r = r0 + r2, t0i = j0 + j2;
+      SLDataVector_t t1r = r0 - r2, t1i = j0 - j2;
+      SLDataVector_t t2r = r1 + r3, t2i = j1 + j3;
+      SLDataVector_t t3r = (r1 - r3) * Direction, t3i = (j1 - j3) * Direction;
+
+      SLDataVector_t y2r = t0r - t2r, y2i = t0i - t2i;
+      SLDataVector_t y1r = t1r + t3i, y1i = t1i - t3r;
+      SLDataVector_t y3r = t1r - t3i, y3i = t1i + t3r;
+
+      r0 = t0r + t2r;
+      j0 = t0i + t2i;
+      r1 = Cos2 * y2r + Sin2 * y2i;
+      j1 = Cos2 * y2i - Sin2 * y2r;
+      r2 = Cos1 * y1r + Sin1 * y1i;
+      j2 = Cos1 * y1i - Sin1 * y1r;
+      r3 = Cos3 * y3r + Sin3 * y3i;
+      j3 = Cos3 * y3i - Sin3 * y3r;
+
+      SDV_Store(realData + i0, r0);
+      SDV_Store(imagData + i0, j0);
+      SDV_Store(realData + i1, r1);
+      SDV_Store(imagData + i1, j1);
+      SDV_Store(realData + i2, r2);
+      SDV_Store(imagData + i2, j2);
+      SDV_Store(realData + i3, r3);
+      SDV_Store(imagData + i3, j3);
+    }
+  }
+}    // End of siglib_numerix_FftPlanStageVector()
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_FftPlanExecute
+ *
+ * Parameters:
+ *  SLData_t realData[],
+ *  SLData_t imagData[],
+ *  const SLData_t *pPlanCoeffs,                - Plan coefficient pointer
+ *  const SLArrayIndex_t *pBitReverseAddressTable, - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength,
+ *  const SLData_t Direction            - +1 forward, -1 inverse
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Execute the radix-4 / radix-2 FFT plan.
+ *  The outputs of each radix-4 butterfly are stored in
+ *  the order 0, 2, 1, 3 so that the results are in the
+ *  same bit reversed order as the radix-2 transform.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftPlanExecute(SLData_t realData[], SLData_t imagData[], const SLData_t* SIGLIB_PTR_DECL pPlanCoeffs,
+                                          const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t fftLength,
+                                          const SLArrayIndex_t log2FFTLength, const SLData_t Direction)
+{
+  // Radix-4 stages
+  for (SLUFixData_t Quarter = (SLUFixData_t)fftLength >> 2U; Quarter >= 1U; Quarter >>= 2U) {
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+    if (Quarter >= (SLUFixData_t)SIGLIB_VECTOR_LENGTH) {    // Wide stages use SIMD butterflies
+      siglib_numerix_FftPlanStageVector(realData, imagData, pPlanCoeffs, (SLUFixData_t)fftLength, Quarter, Direction);
+      pPlanCoeffs += 6U * Quarter;
+      continue;
+    }
+#endif
+    for (SLUFixData_t g = 0; g < (SLUFixData_t)fftLength; g += (Quarter << 2U)) {
+      for (SLUFixData_t n = 0; n < Quarter; n++) {
+        SLUFixData_t i0 = g + n;
+        SLUFixData_t i1 = i0 + Quarter;
+        SLUFixData_t i2 = i1 + Quarter;
+        SLUFixData_t i3 = i2 + Quarter;
+
+        SLData_t t0r = realData[i0] + realData[i2];
+        SLData_t t0i = imagData[i0] + imagData[i2];
+        SLData_t t1r = realData[i0] - realData[i2];
+        SLData_t t1i = imagData[i0] - imagData[i2];
+        SLData_t t2r = realData[i1] + realData[i3];
+        SLData_t t2i = imagData[i1] + imagData[i3];
+        SLData_t t3r = Direction * (realData[i1] - realData[i3]);
+        SLData_t t3i = Direction * (imagData[i1] - imagData[i3]);
+
+        SLData_t y2r = t0r - t2r;
+        SLData_t y2i = t0i - t2i;
+        SLData_t y1r = t1r + t3i;    // (t1 - j.t3) for the forward transform
+        SLData_t y1i = t1i - t3r;
+        SLData_t y3r = t1r - t3i;    // (t1 + j.t3) for the forward transform
+        SLData_t y3i = t1i + t3r;
+
+        realData[i0] = t0r + t2r;
+        imagData[i0] = t0i + t2i;
+        if (Quarter == 1U) {    // Last stage - all twiddle factors are 1
+          realData[i1] = y2r;
+          imagData[i1] = y2i;
+          realData[i2] = y1r;
+          imagData[i2] = y1i;
+          realData[i3] = y3r;
+          imagData[i3] = y3i;
+        } else {
+          SLData_t Cos1 = pPlanCoeffs[n];
+          SLData_t Sin1 = Direction * pPlanCoeffs[Quarter + n];
+          SLData_t Cos2 = pPlanCoeffs[2U * Quarter + n];
+          SLData_t Sin2 = Direction * pPlanCoeffs[3U * Quarter + n];
+          SLData_t Cos3 = pPlanCoeffs[4U * Quarter + n];
+          SLData_t Sin3 = Direction * pPlanCoeffs[5U * Quarter + n];
+          realData[i1] = Cos2 * y2r + Sin2 * y2i;
+          imagData[i1] = Cos2 * y2i - Sin2 * y2r;
+          realData[i2] = Cos1 * y1r + Sin1 * y1i;
+          imagData[i2] = Cos1 * y1i - Sin1 * y1r;
+          realData[i3] = Cos3 * y3r + Sin3 * y3i;
+          imagData[i3] = Cos3 * y3i - Sin3 * y3r;
+        }
+      }
+    }
+    pPlanCoeffs += 6U * Quarter;
+  }
+
+  if (log2FFTLength & 1) {    // Final radix-2 stage - Cos = 1, sin = 0
+    for (SLUFixData_t h = 0, j = 1; h < (SLUFixData_t)fftLength; h += 2, j += 2) {
+      SLData_t realTemp = realData[h] - realData[j];
+      SLData_t imagTemp = imagData[h] - imagData[j];
+      realData[h] = realData[h] + realData[j];
+      imagData[h] = imagData[h] + imagData[j];
+      realData[j] = realTemp;
+      imagData[j] = imagTemp;
+    }
+  }
+
+  // Bit reverse reorder data
+  if (pBitReverseAddressTable != SIGLIB_BIT_REV_NONE) {
+    SDA_BitReverseReorder(realData, realData, pBitReverseAddressTable, fftLength);
+    SDA_BitReverseReorder(imagData, imagData, pBitReverseAddressTable, fftLength);
+  }
+}    // End of siglib_numerix_FftPlanExecute()
+
+/********************************************************
+ * Function: SDA_FftExecute
+ *
+ * Parameters:
+ *  SLData_t realData[],
+ *  SLData_t imagData[],
+ *  const SLData_t *pPlanCoeffs,                - Plan coefficient pointer
+ *  const SLArrayIndex_t *pBitReverseAddressTable, - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength          - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a complex FFT on the supplied data using the
+ *  plan initialised by SIF_FftPlan.
+ *  The results are identical in scaling and order to
+ *  SDA_Cfft. Any power of 2 length is supported.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_FftExecute(SLData_t realData[], SLData_t imagData[], const SLData_t* SIGLIB_PTR_DECL pPlanCoeffs,
+                                     const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t fftLength,
+                                     const SLArrayIndex_t log2FFTLength)
+{
+  siglib_numerix_FftPlanExecute(realData, imagData, pPlanCoeffs, pBitReverseAddressTable, fftLength, log2FFTLength, SIGLIB_ONE);
+}    // End of SDA_FftExecute()
+
+/********************************************************
+ * Function: SDA_IfftExecute
+ *
+ * Parameters:
+ *  SLData_t realData[],
+ *  SLData_t imagData[],
+ *  const SLData_t *pPlanCoeffs,                - Plan coefficient pointer
+ *  const SLArrayIndex_t *pBitReverseAddressTable, - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength          - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a complex inverse FFT on the supplied data
+ *  using the plan initialised by SIF_FftPlan.
+ *  The results are identical in scaling and order to
+ *  SDA_Cifft.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_IfftExecute(SLData_t realData[], SLData_t imagData[], const SLData_t* SIGLIB_PTR_DECL pPlanCoeffs,
+                                      const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t fftLength,
+                                      const SLArrayIndex_t log2FFTLength)
+{
+  siglib_numerix_FftPlanExecute(realData, imagData, pPlanCoeffs, pBitReverseAddressTable, fftLength, log2FFTLength, SIGLIB_MINUS_ONE);
+}    // End of SDA_IfftExecute()
+
+/********************************************************
+ * Function: siglib_numerix_FftBatchBitReverse
+ *
+ * Parameters:
+ *  SLUFixData_t Index,
+ *  const SLUFixData_t log2FFTLength
+ *
+ * Return value:
+ *  Bit reversed index
+ *
+ * Description:
+ *  Return the bit reversed address of the index.
+ *
+ ********************************************************/
+
+static SLUFixData_t siglib_numerix_FftBatchBitReverse(SLUFixData_t Index, const SLUFixData_t log2FFTLength)
+{
+  SLUFixData_t Reversed = 0U;
+  for (SLUFixData_t i = 0; i < log2FFTLength; i++) {
+    Reversed = (Reversed << 1U) | (Index & 1U);
+    Index >>= 1U;
+  }
+  return (Reversed);
+}    // End of siglib_numerix_FftBatchBitReverse()
+
+/********************************************************
+ * Function: siglib_numerix_FftBatchStage
+ *
+ * Parameters:
+ *  SLData_t *pRealTemp,            - Real channel interleaved data
+ *  SLData_t *pImagTemp,            - Imaginary channel interleaved data
+ *  const SLData_t *pFFTSineCoeffs,
+ *  const SLData_t *pFFTCosineCoeffs,
+ *  const SLUFixData_t blockLength, - Number of samples processed
+ *  const SLUFixData_t Stride,
+ *  const SLUFixData_t AngleInc,
+ *  const SLData_t SineSign         - 1 for forward and -1 for inverse FFT
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  One radix-2 DIF stage on SIGLIB_FFT_BATCH_CHANNELS
+ *  channels whose samples are interleaved, so each
+ *  twiddle factor is read once per group of channels and
+ *  the inner loop processes one channel per SIMD lane.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FftBatchStage(SLData_t* SIGLIB_PTR_DECL pRealTemp, SLData_t* SIGLIB_PTR_DECL pImagTemp,
+                                                                  const SLData_t* pFFTSineCoeffs, const SLData_t* pFFTCosineCoeffs,
+                                                                  const SLUFixData_t blockLength, const SLUFixData_t Stride,
+                                                                  const SLUFixData_t AngleInc, const SLData_t SineSign)
+{
+  SLArrayIndex_t Angle = 0;
+  for (SLUFixData_t BflyCounter = 0; BflyCounter < Stride; BflyCounter++) {
+    SLData_t Cos = pFFTCosineCoeffs[Angle];
+    SLData_t Sin = SineSign * pFFTSineCoeffs[Angle];
+    Angle += AngleInc;
+
+    for (SLUFixData_t h = BflyCounter; h < blockLength; h += (Stride << 1U)) {
+      SLData_t* SIGLIB_PTR_DECL pHr = pRealTemp + (h * SIGLIB_FFT_BATCH_CHANNELS);
+      SLData_t* SIGLIB_PTR_DECL pHi = pImagTemp + (h * SIGLIB_FFT_BATCH_CHANNELS);
+      SLData_t* SIGLIB_PTR_DECL pJr = pHr + (Stride * SIGLIB_FFT_BATCH_CHANNELS);
+      SLData_t* SIGLIB_PTR_DECL pJi = pHi + (Stride * SIGLIB_FFT_BATCH_CHANNELS);
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+      for (SLArrayIndex_t Lane = 0; Lane < SIGLIB_FFT_BATCH_CHANNELS; Lane += SIGLIB_VECTOR_LENGTH) {
+        SLDataVector_t realH, imagH, realJ, imagJ;
+        SDV_Load(realH, pHr + Lane);
+        SDV_Load(imagH, pHi + Lane);
+        SDV_Load(realJ, pJr + Lane);
+        SDV_Load(imagJ, pJi + Lane);
+
+        SLDataVector_t realTemp = realH - realJ;
+        SLDataVector_t imagTemp = imagH - imagJ;
+        realH = realH + realJ;
+        imagH = imagH + imagJ;
+        realJ = Cos * realTemp + Sin * imagTemp;
+        imagJ = Cos * imagTemp - Sin * realTemp;
+
+        SDV_Store(pHr + Lane, realH);
+        SDV_Store(pHi + Lane, imagH);
+        SDV_Store(pJr + Lane, realJ);
+        SDV_Store(pJi + Lane, imagJ);
+      }
+#else
+      for (SLArrayIndex_t Lane = 0; Lane < SIGLIB_FFT_BATCH_CHANNELS; Lane++) {
+        SLData_t realTemp = pHr[Lane] - pJr[Lane];
+        SLData_t imagTemp = pHi[Lane] - pJi[Lane];
+        pHr[Lane] = pHr[Lane] + pJr[Lane];
+        pHi[Lane] = pHi[Lane] + pJi[Lane];
+        pJr[Lane] = Cos * realTemp + Sin * imagTemp;
+        pJi[Lane] = Cos * imagTemp - Sin * realTemp;
+      }
+#endif
+    }
+  }
+}    // End of siglib_numerix_FftBatchStage()
+
+/********************************************************
+ * Function: siglib_numerix_FftBatchStages
+ *
+ * Parameters:
+ *  SLData_t *pRealTemp,            - Real channel interleaved data
+ *  SLData_t *pImagTemp,            - Imaginary channel interleaved data
+ *  const SLData_t *pFFTSineCoeffs,
+ *  const SLData_t *pFFTCosineCoeffs,
+ *  const SLUFixData_t transformLength,
+ *  const SLUFixData_t log2TransformLength,
+ *  const SLUFixData_t FirstAngleInc,   - 1 for the N point FFT, 2 for the N/2 point FFT
+ *  const SLData_t SineSign             - 1 for forward and -1 for inverse FFT
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform all of the radix-2 DIF stages on the channel
+ *  interleaved data. Once the butterfly groups are
+ *  SIGLIB_FFT_BATCH_BLOCK_LENGTH samples or shorter, all
+ *  of the remaining stages are performed on one block
+ *  before moving to the next, so the block stays in the
+ *  L1 cache. The results are in bit reversed order.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftBatchStages(SLData_t* SIGLIB_PTR_DECL pRealTemp, SLData_t* SIGLIB_PTR_DECL pImagTemp,
+                                          const SLData_t* pFFTSineCoeffs, const SLData_t* pFFTCosineCoeffs, const SLUFixData_t transformLength,
+                                          const SLUFixData_t log2TransformLength, const SLUFixData_t FirstAngleInc, const SLData_t SineSign)
+{
+  SLUFixData_t Stride = transformLength;
+  SLUFixData_t AngleInc = FirstAngleInc;
+  SLUFixData_t Stage = 0;
+
+  for (; (Stage < log2TransformLength) && (Stride > SIGLIB_FFT_BATCH_BLOCK_LENGTH); Stage++) {    // Stages across the whole array
+    Stride >>= 1U;
+    siglib_numerix_FftBatchStage(pRealTemp, pImagTemp, pFFTSineCoeffs, pFFTCosineCoeffs, transformLength, Stride, AngleInc, SineSign);
+    AngleInc <<= 1U;
+  }
+
+  if (Stage < log2TransformLength) {    // Remaining stages, one block at a time
+    SLUFixData_t blockLength = Stride;
+    for (SLUFixData_t Block = 0; Block < transformLength; Block += blockLength) {
+      SLData_t* pBlockReal = pRealTemp + (Block * SIGLIB_FFT_BATCH_CHANNELS);
+      SLData_t* pBlockImag = pImagTemp + (Block * SIGLIB_FFT_BATCH_CHANNELS);
+      for (SLUFixData_t BlockStride = blockLength, BlockAngleInc = AngleInc, i = Stage; i < log2TransformLength; i++) {
+        BlockStride >>= 1U;
+        siglib_numerix_FftBatchStage(pBlockReal, pBlockImag, pFFTSineCoeffs, pFFTCosineCoeffs, blockLength, BlockStride, BlockAngleInc,
+                                     SineSign);
+        BlockAngleInc <<= 1U;
+      }
+    }
+  }
+}    // End of siglib_numerix_FftBatchStages()
+
+/********************************************************
+ * Function: siglib_numerix_CfftBatch
+ *
+ * Parameters:
+ *  SLData_t *pRealData,
+ *  SLData_t *pImagData,
+ *  SLData_t *pRealTemp,
+ *  SLData_t *pImagTemp,
+ *  const SLData_t *pFFTCoeffs,
+ *  const SLArrayIndex_t *pBitReverseAddressTable,
+ *  const SLArrayIndex_t channelStride,
+ *  const SLArrayIndex_t numberOfChannels,
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength,
+ *  const SLData_t SineSign
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform complex forward or inverse FFTs on groups of
+ *  SIGLIB_FFT_BATCH_CHANNELS channels. The bit reverse
+ *  reordering is performed while the results are copied
+ *  back to the channel arrays.
+ *  Lengths above SIGLIB_FFT_BATCH_MAX_LENGTH do not fit
+ *  in L1 when interleaved, so each channel is transformed
+ *  separately.
+ *
+ ********************************************************/
+
+static void siglib_numerix_CfftBatch(SLData_t* SIGLIB_PTR_DECL pRealData, SLData_t* SIGLIB_PTR_DECL pImagData, SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                     SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pFFTCoeffs,
+                                     const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t channelStride,
+                                     const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t fftLength, const SLArrayIndex_t log2FFTLength,
+                                     const SLData_t SineSign)
+{
+  if (fftLength > SIGLIB_FFT_BATCH_MAX_LENGTH) {
+    for (SLArrayIndex_t Channel = 0; Channel < numberOfChannels; Channel++) {
+      if (SineSign == SIGLIB_ONE) {
+        SDA_Cfft(pRealData + (Channel * channelStride), pImagData + (Channel * channelStride), pFFTCoeffs, pBitReverseAddressTable, fftLength,
+                 log2FFTLength);
+      } else {
+        SDA_Cifft(pRealData + (Channel * channelStride), pImagData + (Channel * channelStride), pFFTCoeffs, pBitReverseAddressTable, fftLength,
+                  log2FFTLength);
+      }
+    }
+    return;
+  }
+
+  const SLData_t* pFFTSineCoeffs = pFFTCoeffs;
+  const SLData_t* pFFTCosineCoeffs = pFFTCoeffs + (SLArrayIndex_t)((SLUFixData_t)fftLength >> 2U);
+
+  for (SLArrayIndex_t FirstChannel = 0; FirstChannel < numberOfChannels; FirstChannel += SIGLIB_FFT_BATCH_CHANNELS) {
+    SLArrayIndex_t GroupChannels =
+        ((numberOfChannels - FirstChannel) < SIGLIB_FFT_BATCH_CHANNELS) ? (numberOfChannels - FirstChannel) : SIGLIB_FFT_BATCH_CHANNELS;
+    SLData_t* pGroupReal = pRealData + (FirstChannel * channelStride);
+    SLData_t* pGroupImag = pImagData + (FirstChannel * channelStride);
+
+    if (GroupChannels < SIGLIB_FFT_BATCH_CHANNELS) {    // Clear the unused lanes
+      SDA_Zeros(pRealTemp, fftLength * SIGLIB_FFT_BATCH_CHANNELS);
+      SDA_Zeros(pImagTemp, fftLength * SIGLIB_FFT_BATCH_CHANNELS);
+    }
+
+    for (SLArrayIndex_t i = 0; i < fftLength; i++) {    // Interleave the channels
+      for (SLArrayIndex_t Lane = 0; Lane < GroupChannels; Lane++) {
+        pRealTemp[(i * SIGLIB_FFT_BATCH_CHANNELS) + Lane] = pGroupReal[(Lane * channelStride) + i];
+        pImagTemp[(i * SIGLIB_FFT_BATCH_CHANNELS) + Lane] = pGroupImag[(Lane * channelStride) + i];
+      }
+    }
+
+    siglib_numerix_FftBatchStages(pRealTemp, pImagTemp, pFFTSineCoeffs, pFFTCosineCoeffs, (SLUFixData_t)fftLength, (SLUFixData_t)log2FFTLength,
+                                  1U, SineSign);
+
+    for (SLArrayIndex_t i = 0; i < fftLength; i++) {    // De-interleave and bit reverse reorder the results
+      SLArrayIndex_t Src = i;
+      if (pBitReverseAddressTable == SIGLIB_BIT_REV_STANDARD) {
+        Src = (SLArrayIndex_t)siglib_numerix_FftBatchBitReverse((SLUFixData_t)i, (SLUFixData_t)log2FFTLength);
+      } else if (pBitReverseAddressTable != SIGLIB_BIT_REV_NONE) {
+        Src = pBitReverseAddressTable[i];
+      }
+      for (SLArrayIndex_t Lane = 0; Lane < GroupChannels; Lane++) {
+        pGroupReal[(Lane * channelStride) + i] = pRealTemp[(Src * SIGLIB_FFT_BATCH_CHANNELS) + Lane];
+        pGroupImag[(Lane * channelStride) + i] = pImagTemp[(Src * SIGLIB_FFT_BATCH_CHANNELS) + Lane];
+      }
+    }
+  }
+}    // End of siglib_numerix_CfftBatch()
+
+/********************************************************
+ * Function: SDA_RfftBatch
+ *
+ * Parameters:
+ *  SLData_t *pRealData,            - Pointer to real data for the first channel
+ *  SLData_t *pImagData,            - Pointer to imaginary data for the first channel
+ *  SLData_t *pRealTemp,            - Real temporary array pointer
+ *  SLData_t *pImagTemp,            - Imaginary temporary array pointer
+ *  const SLData_t *pFFTCoeffs,     - FFT coefficient pointer
+ *  const SLArrayIndex_t *pBitReverseAddressTable, - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t channelStride,     - Offset between the start of each channel
+ *  const SLArrayIndex_t numberOfChannels,  - Number of channels
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength      - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a real FFT on each of the channels, with the
+ *  same results as calling SDA_Rfft for each channel.
+ *  The channels are processed in groups of
+ *  SIGLIB_FFT_BATCH_CHANNELS, interleaved in the
+ *  temporary arrays so that one SIMD lane processes one
+ *  channel and the coefficient and bit reverse address
+ *  tables are read once per group. Lengths above
+ *  SIGLIB_FFT_BATCH_MAX_LENGTH, or SIGLIB_BIT_REV_NONE,
+ *  call SDA_Rfft for each channel.
+ *  The temporary arrays are of length
+ *  SAI_FftBatchTempLength(fftLength).
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_RfftBatch(SLData_t* SIGLIB_PTR_DECL pRealData, SLData_t* SIGLIB_PTR_DECL pImagData, SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                    SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pFFTCoeffs,
+                                    const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t channelStride,
+                                    const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t fftLength, const SLArrayIndex_t log2FFTLength)
+{
+  // Results in bit reversed order are only available from the full length FFT
+  if ((pBitReverseAddressTable == SIGLIB_BIT_REV_NONE) || (fftLength < 8) || (fftLength > SIGLIB_FFT_BATCH_MAX_LENGTH)) {
+    for (SLArrayIndex_t Channel = 0; Channel < numberOfChannels; Channel++) {
+      SDA_Rfft(pRealData + (Channel * channelStride), pImagData + (Channel * channelStride), pFFTCoeffs, pBitReverseAddressTable, fftLength,
+               log2FFTLength);
+    }
+    return;
+  }
+
+  const SLData_t* pFFTSineCoeffs = pFFTCoeffs;
+  const SLData_t* pFFTCosineCoeffs = pFFTCoeffs + (SLArrayIndex_t)((SLUFixData_t)fftLength >> 2U);
+  const SLArrayIndex_t halfFFTLength = fftLength >> 1;
+
+  for (SLArrayIndex_t FirstChannel = 0; FirstChannel < numberOfChannels; FirstChannel += SIGLIB_FFT_BATCH_CHANNELS) {
+    SLArrayIndex_t GroupChannels =
+        ((numberOfChannels - FirstChannel) < SIGLIB_FFT_BATCH_CHANNELS) ? (numberOfChannels - FirstChannel) : SIGLIB_FFT_BATCH_CHANNELS;
+    SLData_t* pGroupReal = pRealData + (FirstChannel * channelStride);
+    SLData_t* pGroupImag = pImagData + (FirstChannel * channelStride);
+
+    if (GroupChannels < SIGLIB_FFT_BATCH_CHANNELS) {    // Clear the unused lanes
+      SDA_Zeros(pRealTemp, halfFFTLength * SIGLIB_FFT_BATCH_CHANNELS);
+      SDA_Zeros(pImagTemp, halfFFTLength * SIGLIB_FFT_BATCH_CHANNELS);
+    }
+
+    // Interleave the channels, packing the even samples into the real array and the odd samples into the imaginary array
+    for (SLArrayIndex_t i = 0; i < halfFFTLength; i++) {
+      for (SLArrayIndex_t Lane = 0; Lane < GroupChannels; Lane++) {
+        pRealTemp[(i * SIGLIB_FFT_BATCH_CHANNELS) + Lane] = pGroupReal[(Lane * channelStride) + (i << 1)];
+        pImagTemp[(i * SIGLIB_FFT_BATCH_CHANNELS) + Lane] = pGroupReal[(Lane * channelStride) + (i << 1) + 1];
+      }
+    }
+
+    // N/2 point complex FFT
+    siglib_numerix_FftBatchStages(pRealTemp, pImagTemp, pFFTSineCoeffs, pFFTCosineCoeffs, (SLUFixData_t)halfFFTLength,
+                                  (SLUFixData_t)(log2FFTLength - 1), 2U, SIGLIB_ONE);
+
+    // Separate the even and odd spectra while de-interleaving and bit reverse reordering
+    // X(k) = (Z(k) + Z*(N/2-k)) / 2 - j.W^k.(Z(k) - Z*(N/2-k)) / 2
+    for (SLArrayIndex_t k = 0, m = halfFFTLength; k <= m; k++, m--) {
+      SLArrayIndex_t SrcK, SrcM;
+      if (pBitReverseAddressTable == SIGLIB_BIT_REV_STANDARD) {
+        SrcK = (SLArrayIndex_t)siglib_numerix_FftBatchBitReverse((SLUFixData_t)k, (SLUFixData_t)(log2FFTLength - 1));
+        SrcM = (SLArrayIndex_t)siglib_numerix_FftBatchBitReverse((SLUFixData_t)(m & (halfFFTLength - 1)), (SLUFixData_t)(log2FFTLength - 1));
+      } else {    // bitrev(2i) in the N point table is the N/2 point bitrev(i)
+        SrcK = pBitReverseAddressTable[k << 1];
+        SrcM = pBitReverseAddressTable[(m & (halfFFTLength - 1)) << 1];
+      }
+      const SLData_t* pZkr = pRealTemp + (SrcK * SIGLIB_FFT_BATCH_CHANNELS);
+      const SLData_t* pZki = pImagTemp + (SrcK * SIGLIB_FFT_BATCH_CHANNELS);
+      const SLData_t* pZmr = pRealTemp + (SrcM * SIGLIB_FFT_BATCH_CHANNELS);
+      const SLData_t* pZmi = pImagTemp + (SrcM * SIGLIB_FFT_BATCH_CHANNELS);
+
+      if (k == 0) {    // D.C. and Nyquist
+        for (SLArrayIndex_t Lane = 0; Lane < GroupChannels; Lane++) {
+          pGroupReal[(Lane * channelStride)] = pZkr[Lane] + pZki[Lane];
+          pGroupImag[(Lane * channelStride)] = SIGLIB_ZERO;
+          pGroupReal[(Lane * channelStride) + halfFFTLength] = pZkr[Lane] - pZki[Lane];
+          pGroupImag[(Lane * channelStride) + halfFFTLength] = SIGLIB_ZERO;
+        }
+        continue;
+      }
+
+      // Odd spectrum twiddle for bin k is (Cos - jSin) and for bin N/2-k is -(Cos + jSin)
+      SLData_t Cos = pFFTCosineCoeffs[k];
+      SLData_t Sin = pFFTSineCoeffs[k];
+      for (SLArrayIndex_t Lane = 0; Lane < GroupChannels; Lane++) {
+        SLData_t realSum = SIGLIB_HALF * (pZkr[Lane] + pZmr[Lane]);    // Even spectrum
+        SLData_t imagDiff = SIGLIB_HALF * (pZki[Lane] - pZmi[Lane]);
+        SLData_t realDiff = SIGLIB_HALF * (pZkr[Lane] - pZmr[Lane]);    // Odd spectrum
+        SLData_t imagSum = SIGLIB_HALF * (pZki[Lane] + pZmi[Lane]);
+
+        SLData_t realTwid = Cos * imagSum - Sin * realDiff;
+        SLData_t imagTwid = -(Sin * imagSum + Cos * realDiff);
+
+        SLData_t* pChanReal = pGroupReal + (Lane * channelStride);
+        SLData_t* pChanImag = pGroupImag + (Lane * channelStride);
+        pChanReal[k] = realSum + realTwid;
+        pChanImag[k] = imagDiff + imagTwid;
+        pChanReal[m] = realSum - realTwid;
+        pChanImag[m] = imagTwid - imagDiff;
+        pChanReal[fftLength - k] = pChanReal[k];    // Conjugate symmetric upper half
+        pChanImag[fftLength - k] = -pChanImag[k];
+        pChanReal[fftLength - m] = pChanReal[m];
+        pChanImag[fftLength - m] = -pChanImag[m];
+      }
+    }
+  }
+}    // End of SDA_RfftBatch()
+
+/********************************************************
+ * Function: SDA_CfftBatch
+ *
+ * Parameters:
+ *  SLData_t *pRealData,            - Pointer to real data for the first channel
+ *  SLData_t *pImagData,            - Pointer to imaginary data for the first channel
+ *  SLData_t *pRealTemp,            - Real temporary array pointer
+ *  SLData_t *pImagTemp,            - Imaginary temporary array pointer
+ *  const SLData_t *pFFTCoeffs,     - FFT coefficient pointer
+ *  const SLArrayIndex_t *pBitReverseAddressTable, - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t channelStride,     - Offset between the start of each channel
+ *  const SLArrayIndex_t numberOfChannels,  - Number of channels
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength      - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a complex FFT on each of the channels, with
+ *  the same results as calling SDA_Cfft for each channel.
+ *  The temporary arrays are of length
+ *  SAI_FftBatchTempLength(fftLength).
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_CfftBatch(SLData_t* SIGLIB_PTR_DECL pRealData, SLData_t* SIGLIB_PTR_DECL pImagData, SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                    SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pFFTCoeffs,
+                                    const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t channelStride,
+                                    const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t fftLength, const SLArrayIndex_t log2FFTLength)
+{
+  siglib_numerix_CfftBatch(pRealData, pImagData, pRealTemp, pImagTemp, pFFTCoeffs, pBitReverseAddressTable, channelStride, numberOfChannels,
+                           fftLength, log2FFTLength, SIGLIB_ONE);
+}    // End of SDA_CfftBatch()
+
+/********************************************************
+ * Function: SDA_CifftBatch
+ *
+ * Parameters:
+ *  SLData_t *pRealData,            - Pointer to real data for the first channel
+ *  SLData_t *pImagData,            - Pointer to imaginary data for the first channel
+ *  SLData_t *pRealTemp,            - Real temporary array pointer
+ *  SLData_t *pImagTemp,            - Imaginary temporary array pointer
+ *  const SLData_t *pFFTCoeffs,     - FFT coefficient pointer
+ *  const SLArrayIndex_t *pBitReverseAddressTable, - Bit reverse mode flag / Pointer to bit reverse address table
+ *  const SLArrayIndex_t channelStride,     - Offset between the start of each channel
+ *  const SLArrayIndex_t numberOfChannels,  - Number of channels
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength      - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a complex inverse FFT on each of the channels,
+ *  with the same results as calling SDA_Cifft for each
+ *  channel.
+ *  The temporary arrays are of length
+ *  SAI_FftBatchTempLength(fftLength).
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_CifftBatch(SLData_t* SIGLIB_PTR_DECL pRealData, SLData_t* SIGLIB_PTR_DECL pImagData, SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                     SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pFFTCoeffs,
+                                     const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseAddressTable, const SLArrayIndex_t channelStride,
+                                     const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t fftLength, const SLArrayIndex_t log2FFTLength)
+{
+  siglib_numerix_CfftBatch(pRealData, pImagData, pRealTemp, pImagTemp, pFFTCoeffs, pBitReverseAddressTable, channelStride, numberOfChannels,
+                           fftLength, log2FFTLength, SIGLIB_MINUS_ONE);
+}    // End of SDA_CifftBatch()
+
+typedef struct {         // Four-step FFT task context
+  SLData_t* pSrcReal;    // Source / in-place row data
+  SLData_t* pSrcImag;
+  SLData_t* pDstReal;    // Transpose destination
+  SLData_t* pDstImag;
+  const SLData_t* pFFTCoeffs;                // Row FFT coefficients
+  const SLArrayIndex_t* pBitReverseTable;    // Row FFT bit reverse address table
+  const SLData_t* pFineTwiddles;             // W^r, r < N1 - NULL when the rows are not twiddled
+  const SLData_t* pCoarseTwiddles;           // W^(q * N1), q < N2
+  SLArrayIndex_t Rows;
+  SLArrayIndex_t Columns;
+  SLArrayIndex_t log2Columns;
+  SLArrayIndex_t log2FineLength;    // log2 N1
+  SLData_t SineSign;                // 1 for forward and -1 for inverse FFT
+} siglib_numerix_FftFourStepContext_s;
+
+/********************************************************
+ * Function: siglib_numerix_FftFourStepSplit
+ *
+ * Parameters:
+ *  const SLArrayIndex_t log2FFTLength,
+ *  SLArrayIndex_t *pLog2N1,        - Log2 of the number of columns of the input matrix
+ *  SLArrayIndex_t *pLog2N2         - Log2 of the number of rows of the input matrix
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Split the FFT length into N1 * N2, with N1 <= N2 <= 2 * N1.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftFourStepSplit(const SLArrayIndex_t log2FFTLength, SLArrayIndex_t* pLog2N1, SLArrayIndex_t* pLog2N2)
+{
+  *pLog2N1 = log2FFTLength >> 1;
+  *pLog2N2 = log2FFTLength - *pLog2N1;
+}    // End of siglib_numerix_FftFourStepSplit()
+
+/********************************************************
+ * Function: siglib_numerix_FftFourStepTranspose
+ *
+ * Parameters:
+ *  void *pContext,                 - Task context
+ *  SLArrayIndex_t taskIndex        - Block of source rows
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Transpose SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH rows of the
+ *  real and imaginary source matrices, in square tiles so
+ *  that the source and destination lines stay in L1.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftFourStepTranspose(void* pContext, SLArrayIndex_t taskIndex)
+{
+  const siglib_numerix_FftFourStepContext_s* pCtx = (const siglib_numerix_FftFourStepContext_s*)pContext;
+  const SLArrayIndex_t Rows = pCtx->Rows;
+  const SLArrayIndex_t Columns = pCtx->Columns;
+  const SLArrayIndex_t RowStart = taskIndex * SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH;
+  const SLArrayIndex_t RowEnd =
+    ((RowStart + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH) < Rows) ? (RowStart + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH) : Rows;
+
+  for (SLArrayIndex_t ColumnStart = 0; ColumnStart < Columns; ColumnStart += SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH) {
+    const SLArrayIndex_t ColumnEnd =
+      ((ColumnStart + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH) < Columns) ? (ColumnStart + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH) : Columns;
+    for (SLArrayIndex_t i = RowStart; i < RowEnd; i++) {
+      const SLData_t* pSrcReal = pCtx->pSrcReal + (i * Columns);
+      const SLData_t* pSrcImag = pCtx->pSrcImag + (i * Columns);
+      for (SLArrayIndex_t j = ColumnStart; j < ColumnEnd; j++) {
+        pCtx->pDstReal[(j * Rows) + i] = pSrcReal[j];
+        pCtx->pDstImag[(j * Rows) + i] = pSrcImag[j];
+      }
+    }
+  }
+}    // End of siglib_numerix_FftFourStepTranspose()
+
+/********************************************************
+ * Function: siglib_numerix_FftFourStepRow
+ *
+ * Parameters:
+ *  void *pContext,                 - Task context
+ *  SLArrayIndex_t taskIndex        - Row index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform the FFT of one row with SDA_Cfft or SDA_Cifft,
+ *  in natural order, then multiply the row by the twiddle
+ *  factors W^(row * column), when they are supplied.
+ *  The twiddle factors are calculated from the product
+ *  of a fine and a coarse table so that the tables only
+ *  require N1 + N2 entries.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftFourStepRow(void* pContext, SLArrayIndex_t taskIndex)
+{
+  const siglib_numerix_FftFourStepContext_s* pCtx = (const siglib_numerix_FftFourStepContext_s*)pContext;
+  SLData_t* pReal = pCtx->pSrcReal + (taskIndex * pCtx->Columns);
+  SLData_t* pImag = pCtx->pSrcImag + (taskIndex * pCtx->Columns);
+
+  if (pCtx->SineSign > SIGLIB_ZERO) {
+    SDA_Cfft(pReal, pImag, pCtx->pFFTCoeffs, pCtx->pBitReverseTable, pCtx->Columns, pCtx->log2Columns);
+  } else {
+    SDA_Cifft(pReal, pImag, pCtx->pFFTCoeffs, pCtx->pBitReverseTable, pCtx->Columns, pCtx->log2Columns);
+  }
+
+  if (NULL != pCtx->pFineTwiddles) {
+    const SLUFixData_t FineMask = ((SLUFixData_t)1U << (SLUFixData_t)pCtx->log2FineLength) - 1U;
+    SLUFixData_t m = 0U;    // Twiddle factor index - row * column < N
+    for (SLArrayIndex_t k = 0; k < pCtx->Columns; k++, m += (SLUFixData_t)taskIndex) {
+      const SLData_t* pFine = pCtx->pFineTwiddles + (2U * (m & FineMask));
+      const SLData_t* pCoarse = pCtx->pCoarseTwiddles + (2U * (m >> (SLUFixData_t)pCtx->log2FineLength));
+      SLData_t Cos = (pFine[0] * pCoarse[0]) - (pFine[1] * pCoarse[1]);
+      SLData_t Sin = pCtx->SineSign * ((pFine[1] * pCoarse[0]) + (pFine[0] * pCoarse[1]));
+      SLData_t RealTemp = pReal[k];
+      pReal[k] = (RealTemp * Cos) + (pImag[k] * Sin);
+      pImag[k] = (pImag[k] * Cos) - (RealTemp * Sin);
+    }
+  }
+}    // End of siglib_numerix_FftFourStepRow()
+
+/********************************************************
+ * Function: SUF_FftFourStepCoeffsLength
+ *
+ * Parameters:
+ *  const SLArrayIndex_t fftLength
+ *
+ * Return value:
+ *  Length of the four-step FFT coefficient array
+ *
+ * Description:
+ *  Return the length of the coefficient array required
+ *  by SIF_FftFourStep.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftFourStepCoeffsLength(const SLArrayIndex_t fftLength)
+{
+  SLArrayIndex_t log2N1, log2N2;
+  siglib_numerix_FftFourStepSplit(SAI_FftLengthLog2(fftLength), &log2N1, &log2N2);
+  SLArrayIndex_t N1 = (SLArrayIndex_t)1 << log2N1;
+  SLArrayIndex_t N2 = (SLArrayIndex_t)1 << log2N2;
+
+  // Row FFT coefficients for both lengths, fine and coarse complex twiddle factors
+  return ((SLArrayIndex_t)(((3 * N2) / 4) + ((3 * N1) / 4) + (2 * N1) + (2 * N2)));
+}    // End of SUF_FftFourStepCoeffsLength()
+
+/********************************************************
+ * Function: SUF_FftFourStepBitReverseLength
+ *
+ * Parameters:
+ *  const SLArrayIndex_t fftLength
+ *
+ * Return value:
+ *  Length of the four-step FFT bit reverse address table
+ *
+ * Description:
+ *  Return the length of the bit reverse address table
+ *  array required by SIF_FftFourStep.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_FftFourStepBitReverseLength(const SLArrayIndex_t fftLength)
+{
+  SLArrayIndex_t log2N1, log2N2;
+  siglib_numerix_FftFourStepSplit(SAI_FftLengthLog2(fftLength), &log2N1, &log2N2);
+
+  return ((SLArrayIndex_t)(((SLArrayIndex_t)1 << log2N1) + ((SLArrayIndex_t)1 << log2N2)));
+}    // End of SUF_FftFourStepBitReverseLength()
+
+/********************************************************
+ * Function: SIF_FftFourStep
+ *
+ * Parameters:
+ *  SLData_t *pCoeffs,                  - Pointer to four-step FFT coefficients
+ *  SLArrayIndex_t *pBitReverseTables,  - Pointer to row FFT bit reverse address tables
+ *  const SLArrayIndex_t fftLength
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Initialise the four-step FFT. The length N is split
+ *  into N1 * N2 and the arrays hold the SIF_Fft
+ *  coefficients and bit reverse address tables for the
+ *  N2 and N1 point row FFTs, followed by the W^r and
+ *  W^(q * N1) twiddle factors.
+ *  The coefficient array length is given by
+ *  SUF_FftFourStepCoeffsLength and the bit reverse table
+ *  length by SUF_FftFourStepBitReverseLength.
+ *  The FFT length must be a power of 2 of at least 16,
+ *  otherwise SIGLIB_PARAMETER_ERROR is returned.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_FftFourStep(SLData_t* SIGLIB_PTR_DECL pCoeffs, SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseTables,
+                                           const SLArrayIndex_t fftLength)
+{
+  if ((fftLength < SIGLIB_FFT_FOUR_STEP_MIN_LENGTH) || ((fftLength & (fftLength - 1)) != 0)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  SLArrayIndex_t log2N1, log2N2;
+  siglib_numerix_FftFourStepSplit(SAI_FftLengthLog2(fftLength), &log2N1, &log2N2);
+  SLArrayIndex_t N1 = (SLArrayIndex_t)1 << log2N1;
+  SLArrayIndex_t N2 = (SLArrayIndex_t)1 << log2N2;
+
+  SIF_Fft(pCoeffs, pBitReverseTables, N2);                          // Row FFTs of length N2
+  SIF_Fft(pCoeffs + ((3 * N2) / 4), pBitReverseTables + N2, N1);    // Row FFTs of length N1
+
+  SLData_t* pFineTwiddles = pCoeffs + ((3 * N2) / 4) + ((3 * N1) / 4);
+  SLData_t* pCoarseTwiddles = pFineTwiddles + (2 * N1);
+  for (SLArrayIndex_t r = 0; r < N1; r++) {
+    SLData_t Angle = (SIGLIB_TWO_PI * (SLData_t)r) / (SLData_t)fftLength;
+    pFineTwiddles[2 * r] = SDS_Cos(Angle);
+    pFineTwiddles[(2 * r) + 1] = SDS_Sin(Angle);
+  }
+  for (SLArrayIndex_t q = 0; q < N2; q++) {
+    SLData_t Angle = (SIGLIB_TWO_PI * (SLData_t)q) / (SLData_t)N2;    // W^(q * N1) with N = N1 * N2
+    pCoarseTwiddles[2 * q] = SDS_Cos(Angle);
+    pCoarseTwiddles[(2 * q) + 1] = SDS_Sin(Angle);
+  }
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_FftFourStep()
+
+/********************************************************
+ * Function: siglib_numerix_FftFourStep
+ *
+ * Parameters:
+ *  SLData_t realData[],            - Real data array pointer
+ *  SLData_t imagData[],            - Imaginary data array pointer
+ *  SLData_t *pRealTemp,            - Real temporary array pointer
+ *  SLData_t *pImagTemp,            - Imaginary temporary array pointer
+ *  const SLData_t *pCoeffs,        - Pointer to four-step FFT coefficients
+ *  const SLArrayIndex_t *pBitReverseTables,    - Pointer to row FFT bit reverse address tables
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength,
+ *  const SLData_t SineSign         - 1 for forward and -1 for inverse FFT
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Four-step FFT. The input is treated as an N2 x N1
+ *  matrix, which is transposed, N2 point FFTs are
+ *  performed on the rows and multiplied by the twiddle
+ *  factors, the matrix is transposed back and N1 point
+ *  FFTs are performed on the rows. The final transpose
+ *  returns the results in natural order.
+ *  Each row FFT fits in cache and the rows and transpose
+ *  blocks are distributed with SUF_ParallelFor.
+ *
+ ********************************************************/
+
+static void siglib_numerix_FftFourStep(SLData_t realData[], SLData_t imagData[], SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                       SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                       const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseTables, const SLArrayIndex_t fftLength,
+                                       const SLArrayIndex_t log2FFTLength, const SLData_t SineSign)
+{
+  SLArrayIndex_t log2N1, log2N2;
+  siglib_numerix_FftFourStepSplit(log2FFTLength, &log2N1, &log2N2);
+  SLArrayIndex_t N1 = (SLArrayIndex_t)1 << log2N1;
+  SLArrayIndex_t N2 = (SLArrayIndex_t)1 << log2N2;
+
+  siglib_numerix_FftFourStepContext_s Ctx;
+  Ctx.log2FineLength = log2N1;
+  Ctx.SineSign = SineSign;
+
+  // Transpose the N2 x N1 input to N1 x N2
+  Ctx.pSrcReal = realData;
+  Ctx.pSrcImag = imagData;
+  Ctx.pDstReal = pRealTemp;
+  Ctx.pDstImag = pImagTemp;
+  Ctx.Rows = N2;
+  Ctx.Columns = N1;
+  SUF_ParallelFor(siglib_numerix_FftFourStepTranspose, &Ctx, (N2 + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH - 1) / SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH);
+
+  // N2 point FFTs on the N1 rows, multiplied by the twiddle factors
+  Ctx.pSrcReal = pRealTemp;
+  Ctx.pSrcImag = pImagTemp;
+  Ctx.pFFTCoeffs = pCoeffs;
+  Ctx.pBitReverseTable = pBitReverseTables;
+  Ctx.pFineTwiddles = pCoeffs + ((3 * N2) / 4) + ((3 * N1) / 4);
+  Ctx.pCoarseTwiddles = Ctx.pFineTwiddles + (2 * N1);
+  Ctx.Columns = N2;
+  Ctx.log2Columns = log2N2;
+  SUF_ParallelFor(siglib_numerix_FftFourStepRow, &Ctx, N1);
+
+  // Transpose the N1 x N2 result to N2 x N1
+  Ctx.pDstReal = realData;
+  Ctx.pDstImag = imagData;
+  Ctx.Rows = N1;
+  SUF_ParallelFor(siglib_numerix_FftFourStepTranspose, &Ctx, (N1 + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH - 1) / SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH);
+
+  // N1 point FFTs on the N2 rows
+  Ctx.pSrcReal = realData;
+  Ctx.pSrcImag = imagData;
+  Ctx.pFFTCoeffs = pCoeffs + ((3 * N2) / 4);
+  Ctx.pBitReverseTable = pBitReverseTables + N2;
+  Ctx.pFineTwiddles = NULL;
+  Ctx.Columns = N1;
+  Ctx.log2Columns = log2N1;
+  SUF_ParallelFor(siglib_numerix_FftFourStepRow, &Ctx, N2);
+
+  // Transpose the N2 x N1 result to natural order
+  Ctx.pDstReal = pRealTemp;
+  Ctx.pDstImag = pImagTemp;
+  Ctx.Rows = N2;
+  SUF_ParallelFor(siglib_numerix_FftFourStepTranspose, &Ctx, (N2 + SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH - 1) / SIGLIB_FFT_FOUR_STEP_BLOCK_LENGTH);
+
+  SDA_Copy(pRealTemp, realData, fftLength);
+  SDA_Copy(pImagTemp, imagData, fftLength);
+}    // End of siglib_numerix_FftFourStep()
+
+/********************************************************
+ * Function: SDA_CfftFourStep
+ *
+ * Parameters:
+ *  SLData_t realData[],            - Real data array pointer
+ *  SLData_t imagData[],            - Imaginary data array pointer
+ *  SLData_t *pRealTemp,            - Real temporary array pointer
+ *  SLData_t *pImagTemp,            - Imaginary temporary array pointer
+ *  const SLData_t *pCoeffs,        - Pointer to four-step FFT coefficients
+ *  const SLArrayIndex_t *pBitReverseTables,    - Pointer to row FFT bit reverse address tables
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength  - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a complex FFT on the supplied data using the
+ *  four-step algorithm, for transforms that are too large
+ *  for the cache. The results are in natural order and
+ *  are the same as SDA_Cfft with bit reverse reordering.
+ *  The temporary arrays are of length fftLength and the
+ *  minimum FFT length is 16.
+ *  The row FFTs and transposes are distributed across
+ *  the executor registered with SUF_SetParallelFor.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_CfftFourStep(SLData_t realData[], SLData_t imagData[], SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                       SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                       const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseTables, const SLArrayIndex_t fftLength,
+                                       const SLArrayIndex_t log2FFTLength)
+{
+  siglib_numerix_FftFourStep(realData, imagData, pRealTemp, pImagTemp, pCoeffs, pBitReverseTables, fftLength, log2FFTLength, SIGLIB_ONE);
+}    // End of SDA_CfftFourStep()
+
+/********************************************************
+ * Function: SDA_CifftFourStep
+ *
+ * Parameters:
+ *  SLData_t realData[],            - Real data array pointer
+ *  SLData_t imagData[],            - Imaginary data array pointer
+ *  SLData_t *pRealTemp,            - Real temporary array pointer
+ *  SLData_t *pImagTemp,            - Imaginary temporary array pointer
+ *  const SLData_t *pCoeffs,        - Pointer to four-step FFT coefficients
+ *  const SLArrayIndex_t *pBitReverseTables,    - Pointer to row FFT bit reverse address tables
+ *  const SLArrayIndex_t fftLength,
+ *  const SLArrayIndex_t log2FFTLength  - Log base2 transform length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Perform a complex inverse FFT on the supplied data
+ *  using the four-step algorithm. The results are in
+ *  natural order and are the same as SDA_Cifft with bit
+ *  reverse reordering.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_CifftFourStep(SLData_t realData[], SLData_t imagData[], SLData_t* SIGLIB_PTR_DECL pRealTemp,
+                                        SLData_t* SIGLIB_PTR_DECL pImagTemp, const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                        const SLArrayIndex_t* SIGLIB_PTR_DECL pBitReverseTables, const SLArrayIndex_t fftLength,
+                                        const SLArrayIndex_t log2FFTLength)
+{
+  siglib_numerix_FftFourStep(realData, imagData, pRealTemp, pImagTemp, pCoeffs, pBitReverseTables, fftLength, log2FFTLength,
+                             SIGLIB_MINUS_ONE);
+}    // End of SDA_CifftFourStep()
@@ -38,15 +38,884 @@ Description: SigLib DSP library file I/O functions.
 
 #define SIGLIB_SRC_FILE_FILE_IO 1    // Defines the source file that this code is being used in
 
+#ifndef _LARGEFILE_SOURCE
+#  define _LARGEFILE_SOURCE 1    // Declare fseeko() and ftello()
+#endif
+#ifndef _FILE_OFFSET_BITS
+#  define _FILE_OFFSET_BITS 64    // 64 bit file offsets on 32 bit POSIX systems
+#endif
+
 #include <siglib.h>    // Include SigLib header file
 #include <string.h>
 
-#if SIGLIB_FILE_IO_SUPPORTED
+#if SIGLIB_FILE_IO_SUPPORTED
+
+// 64 bit file offsets, so that files larger than 2 GB can be seeked where long is 32 bits
+#  if defined(_WIN32)
+#    define SIGLIB_FILE_SEEK(p_ioFile, offset, origin) _fseeki64(p_ioFile, (__int64)(offset), origin)
+#    define SIGLIB_FILE_TELL(p_ioFile) ((SLInt64_t)_ftelli64(p_ioFile))
+#  elif defined(__unix__) || defined(__APPLE__)
+#    include <sys/types.h>    // off_t
+#    define SIGLIB_FILE_SEEK(p_ioFile, offset, origin) fseeko(p_ioFile, (off_t)(offset), origin)
+#    define SIGLIB_FILE_TELL(p_ioFile) ((SLInt64_t)ftello(p_ioFile))
+#  else
+#    define SIGLIB_FILE_SEEK(p_ioFile, offset, origin) fseek(p_ioFile, (long)(offset), origin)
+#    define SIGLIB_FILE_TELL(p_ioFile) ((SLInt64_t)ftell(p_ioFile))
+#  endif
+
+/********************************************************
+ * Function: siglib_numerix_SampleLoad
+ *
+ * Parameters:
+ *  const unsigned char *pSrc,          - Pointer to sample bytes
+ *  const SLArrayIndex_t byteCount,     - Number of bytes in sample
+ *  const SLFixData_t bigEndianFlag     - SIGLIB_TRUE for big endian data
+ *
+ * Return value:
+ *  SLUInt64_t - Sample bits
+ *
+ * Description: Assemble the bytes of one file sample.
+ *
+ ********************************************************/
+
+static SLUInt64_t siglib_numerix_SampleLoad(const unsigned char* pSrc, const SLArrayIndex_t byteCount, const SLFixData_t bigEndianFlag)
+{
+  SLUInt64_t Word = 0;
+  for (SLArrayIndex_t k = 0; k < byteCount; k++) {
+    const SLUInt64_t Byte = (SLUInt64_t)pSrc[(bigEndianFlag == SIGLIB_TRUE) ? (byteCount - 1 - k) : k];
+    Word |= Byte << (8 * k);
+  }
+  return (Word);
+}    // End of siglib_numerix_SampleLoad()
+
+/********************************************************
+ * Function: siglib_numerix_SampleStore
+ *
+ * Parameters:
+ *  unsigned char *pDst,                - Pointer to sample bytes
+ *  const SLArrayIndex_t byteCount,     - Number of bytes in sample
+ *  const SLUInt64_t word,              - Sample bits
+ *  const SLFixData_t bigEndianFlag     - SIGLIB_TRUE for big endian data
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Split one file sample into bytes.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SampleStore(unsigned char* pDst, const SLArrayIndex_t byteCount, const SLUInt64_t word, const SLFixData_t bigEndianFlag)
+{
+  for (SLArrayIndex_t k = 0; k < byteCount; k++) {
+    pDst[(bigEndianFlag == SIGLIB_TRUE) ? (byteCount - 1 - k) : k] = (unsigned char)(word >> (8 * k));
+  }
+}    // End of siglib_numerix_SampleStore()
+
+/********************************************************
+ * Function: siglib_numerix_SampleClip
+ *
+ * Parameters:
+ *  const SLData_t sample,              - Sample
+ *  const SLData_t minimum,             - Minimum value
+ *  const SLData_t maximum              - Maximum value
+ *
+ * Return value:
+ *  SLData_t - Clipped sample
+ *
+ * Description: Limit a sample to the range of the file
+ *  word length.
+ *
+ ********************************************************/
+
+static SLData_t siglib_numerix_SampleClip(const SLData_t sample, const SLData_t minimum, const SLData_t maximum)
+{
+  return ((sample < minimum) ? minimum : ((sample > maximum) ? maximum : sample));
+}    // End of siglib_numerix_SampleClip()
+
+/********************************************************
+ * Function: siglib_numerix_SampleDecode
+ *
+ * Parameters:
+ *  const unsigned char *pSrc,          - Pointer to file data
+ *  const SLArrayIndex_t srcStride,     - Bytes between samples
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  const SLArrayIndex_t sampleCount,   - Number of samples
+ *  const SLSampleFile_s *pFile         - Pointer to sample file structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Convert and scale a block of file samples.
+ *  The conversion loops are independent for each sample
+ *  so the compiler can vectorize them.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SampleDecode(const unsigned char* pSrc, const SLArrayIndex_t srcStride, SLData_t* SIGLIB_PTR_DECL pDst,
+                                        const SLArrayIndex_t sampleCount, const SLSampleFile_s* pFile)
+{
+  const SLData_t Scale = pFile->Scale;
+  const SLFixData_t BigEndianFlag = (pFile->EndianMode == SIGLIB_BIG_ENDIAN) ? SIGLIB_TRUE : SIGLIB_FALSE;
+
+  switch (pFile->SampleFormat) {
+    case SIGLIB_SAMPLE_UINT8:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        pDst[i] = (SLData_t)((SLInt32_t)pSrc[i * srcStride] - 128) * Scale;
+      }
+      break;
+    case SIGLIB_SAMPLE_INT8:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        pDst[i] = (SLData_t)(SLInt8_t)pSrc[i * srcStride] * Scale;
+      }
+      break;
+    case SIGLIB_SAMPLE_INT16:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        pDst[i] = (SLData_t)(SLInt16_t)siglib_numerix_SampleLoad(pSrc + (i * srcStride), 2, BigEndianFlag) * Scale;
+      }
+      break;
+    case SIGLIB_SAMPLE_INT24:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const SLUInt32_t Word = (SLUInt32_t)siglib_numerix_SampleLoad(pSrc + (i * srcStride), 3, BigEndianFlag) << 8;
+        pDst[i] = (SLData_t)((SLInt32_t)Word >> 8) * Scale;    // Sign extend
+      }
+      break;
+    case SIGLIB_SAMPLE_INT32:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        pDst[i] = (SLData_t)(SLInt32_t)siglib_numerix_SampleLoad(pSrc + (i * srcStride), 4, BigEndianFlag) * Scale;
+      }
+      break;
+    case SIGLIB_SAMPLE_FLOAT32:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const SLUInt32_t Word = (SLUInt32_t)siglib_numerix_SampleLoad(pSrc + (i * srcStride), 4, BigEndianFlag);
+        float Sample;
+        memcpy(&Sample, &Word, sizeof(Sample));
+        pDst[i] = (SLData_t)Sample * Scale;
+      }
+      break;
+    case SIGLIB_SAMPLE_FLOAT64:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const SLUInt64_t Word = siglib_numerix_SampleLoad(pSrc + (i * srcStride), 8, BigEndianFlag);
+        double Sample;
+        memcpy(&Sample, &Word, sizeof(Sample));
+        pDst[i] = (SLData_t)Sample * Scale;
+      }
+      break;
+  }
+}    // End of siglib_numerix_SampleDecode()
+
+/********************************************************
+ * Function: siglib_numerix_SampleEncode
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  unsigned char *pDst,                - Pointer to file data
+ *  const SLArrayIndex_t dstStride,     - Bytes between samples
+ *  const SLArrayIndex_t sampleCount,   - Number of samples
+ *  const SLSampleFile_s *pFile         - Pointer to sample file structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Scale and convert a block of samples to
+ *  the file format. Integer samples are truncated and
+ *  clipped to the range of the word length, or when
+ *  pFile->WrapFlag is set, clipped to 32 bits and the low
+ *  bits are kept, as the original file functions did.
+ *
+ ********************************************************/
+
+static void siglib_numerix_SampleEncode(const SLData_t* SIGLIB_PTR_DECL pSrc, unsigned char* pDst, const SLArrayIndex_t dstStride,
+                                        const SLArrayIndex_t sampleCount, const SLSampleFile_s* pFile)
+{
+  const SLData_t InverseScale = pFile->InverseScale;
+  const SLFixData_t BigEndianFlag = (pFile->EndianMode == SIGLIB_BIG_ENDIAN) ? SIGLIB_TRUE : SIGLIB_FALSE;
+  const SLFixData_t WrapFlag = pFile->WrapFlag;
+
+  switch (pFile->SampleFormat) {
+    case SIGLIB_SAMPLE_UINT8: {
+      const SLData_t Min = (SIGLIB_TRUE == WrapFlag) ? -2147483648.0 : 0.0;
+      const SLData_t Max = (SIGLIB_TRUE == WrapFlag) ? 2147483647.0 : 255.0;
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        pDst[i * dstStride] = (unsigned char)(SLUInt32_t)(SLInt32_t)siglib_numerix_SampleClip((pSrc[i] * InverseScale) + 128.0, Min, Max);
+      }
+    } break;
+    case SIGLIB_SAMPLE_INT8: {
+      const SLData_t Min = (SIGLIB_TRUE == WrapFlag) ? -2147483648.0 : -128.0;
+      const SLData_t Max = (SIGLIB_TRUE == WrapFlag) ? 2147483647.0 : 127.0;
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        pDst[i * dstStride] = (unsigned char)(SLUInt32_t)(SLInt32_t)siglib_numerix_SampleClip(pSrc[i] * InverseScale, Min, Max);
+      }
+    } break;
+    case SIGLIB_SAMPLE_INT16: {
+      const SLData_t Min = (SIGLIB_TRUE == WrapFlag) ? -2147483648.0 : -32768.0;
+      const SLData_t Max = (SIGLIB_TRUE == WrapFlag) ? 2147483647.0 : 32767.0;
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const SLInt32_t Sample = (SLInt32_t)siglib_numerix_SampleClip(pSrc[i] * InverseScale, Min, Max);
+        siglib_numerix_SampleStore(pDst + (i * dstStride), 2, (SLUInt64_t)(SLUInt16_t)Sample, BigEndianFlag);
+      }
+    } break;
+    case SIGLIB_SAMPLE_INT24: {
+      const SLData_t Min = (SIGLIB_TRUE == WrapFlag) ? -2147483648.0 : -8388608.0;
+      const SLData_t Max = (SIGLIB_TRUE == WrapFlag) ? 2147483647.0 : 8388607.0;
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const SLInt32_t Sample = (SLInt32_t)siglib_numerix_SampleClip(pSrc[i] * InverseScale, Min, Max);
+        siglib_numerix_SampleStore(pDst + (i * dstStride), 3, (SLUInt64_t)(SLUInt32_t)Sample, BigEndianFlag);
+      }
+    } break;
+    case SIGLIB_SAMPLE_INT32:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const SLInt32_t Sample = (SLInt32_t)siglib_numerix_SampleClip(pSrc[i] * InverseScale, -2147483648.0, 2147483647.0);
+        siglib_numerix_SampleStore(pDst + (i * dstStride), 4, (SLUInt64_t)(SLUInt32_t)Sample, BigEndianFlag);
+      }
+      break;
+    case SIGLIB_SAMPLE_FLOAT32:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const float Sample = (float)(pSrc[i] * InverseScale);
+        SLUInt32_t Word;
+        memcpy(&Word, &Sample, sizeof(Word));
+        siglib_numerix_SampleStore(pDst + (i * dstStride), 4, (SLUInt64_t)Word, BigEndianFlag);
+      }
+      break;
+    case SIGLIB_SAMPLE_FLOAT64:
+      for (SLArrayIndex_t i = 0; i < sampleCount; i++) {
+        const double Sample = (double)(pSrc[i] * InverseScale);
+        SLUInt64_t Word;
+        memcpy(&Word, &Sample, sizeof(Word));
+        siglib_numerix_SampleStore(pDst + (i * dstStride), 8, Word, BigEndianFlag);
+      }
+      break;
+  }
+}    // End of siglib_numerix_SampleEncode()
+
+/********************************************************
+ * Function: siglib_numerix_SampleFileRead
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLArrayIndex_t frameCount,          - Number of frames to read
+ *  const SLFixData_t deinterleaveFlag  - SIGLIB_TRUE to write the channels to separate arrays
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of frames read
+ *
+ * Description: Read frames from the file in blocks of up
+ *  to SIGLIB_FILE_IO_BLOCK_LENGTH bytes.
+ *  The file is not read beyond the last requested frame
+ *  so the file position always matches the frame position.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_SampleFileRead(SLSampleFile_s* pFile, SLData_t* SIGLIB_PTR_DECL pDst, SLArrayIndex_t frameCount,
+                                                    const SLFixData_t deinterleaveFlag)
+{
+  unsigned char Buffer[SIGLIB_FILE_IO_BLOCK_LENGTH];
+  const SLArrayIndex_t NumberOfChannels = pFile->NumberOfChannels;
+  const SLArrayIndex_t BytesPerFrame = pFile->BytesPerFrame;
+  const SLArrayIndex_t ChannelLength = frameCount;    // Length of each deinterleaved destination array
+  SLArrayIndex_t FramesRead = 0;
+
+  if ((pFile->FrameCount >= 0) && (frameCount > (pFile->FrameCount - pFile->FramePosition))) {
+    frameCount = pFile->FrameCount - pFile->FramePosition;
+  }
+
+  while (FramesRead < frameCount) {
+    SLArrayIndex_t Frames = SIGLIB_FILE_IO_BLOCK_LENGTH / BytesPerFrame;
+    if (Frames > (frameCount - FramesRead)) {
+      Frames = frameCount - FramesRead;
+    }
+    const size_t RequestedBytes = (size_t)Frames * (size_t)BytesPerFrame;
+    const size_t Bytes = fread(Buffer, 1, RequestedBytes, pFile->p_ioFile);
+    Frames = (SLArrayIndex_t)(Bytes / (size_t)BytesPerFrame);
+
+    if (deinterleaveFlag == SIGLIB_TRUE) {
+      for (SLArrayIndex_t Channel = 0; Channel < NumberOfChannels; Channel++) {
+        siglib_numerix_SampleDecode(Buffer + (Channel * pFile->BytesPerSample), BytesPerFrame, pDst + (Channel * ChannelLength) + FramesRead,
+                                    Frames, pFile);
+      }
+    } else {
+      siglib_numerix_SampleDecode(Buffer, pFile->BytesPerSample, pDst + (FramesRead * NumberOfChannels), Frames * NumberOfChannels, pFile);
+    }
+    FramesRead += Frames;
+
+    if (Bytes != RequestedBytes) {    // End of file
+      break;
+    }
+  }
+
+  pFile->FramePosition += FramesRead;
+  return (FramesRead);
+}    // End of siglib_numerix_SampleFileRead()
+
+/********************************************************
+ * Function: siglib_numerix_SampleFileWrite
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  const SLArrayIndex_t frameCount,    - Number of frames to write
+ *  const SLFixData_t interleaveFlag    - SIGLIB_TRUE to read the channels from separate arrays
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of frames written
+ *
+ * Description: Write frames to the file in blocks of up
+ *  to SIGLIB_FILE_IO_BLOCK_LENGTH bytes.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_SampleFileWrite(SLSampleFile_s* pFile, const SLData_t* SIGLIB_PTR_DECL pSrc, const SLArrayIndex_t frameCount,
+                                                     const SLFixData_t interleaveFlag)
+{
+  unsigned char Buffer[SIGLIB_FILE_IO_BLOCK_LENGTH];
+  const SLArrayIndex_t NumberOfChannels = pFile->NumberOfChannels;
+  const SLArrayIndex_t BytesPerFrame = pFile->BytesPerFrame;
+  SLArrayIndex_t FramesWritten = 0;
+
+  while (FramesWritten < frameCount) {
+    SLArrayIndex_t Frames = SIGLIB_FILE_IO_BLOCK_LENGTH / BytesPerFrame;
+    if (Frames > (frameCount - FramesWritten)) {
+      Frames = frameCount - FramesWritten;
+    }
+
+    if (interleaveFlag == SIGLIB_TRUE) {
+      for (SLArrayIndex_t Channel = 0; Channel < NumberOfChannels; Channel++) {
+        siglib_numerix_SampleEncode(pSrc + (Channel * frameCount) + FramesWritten, Buffer + (Channel * pFile->BytesPerSample), BytesPerFrame,
+                                    Frames, pFile);
+      }
+    } else {
+      siglib_numerix_SampleEncode(pSrc + (FramesWritten * NumberOfChannels), Buffer, pFile->BytesPerSample, Frames * NumberOfChannels, pFile);
+    }
+
+    const size_t RequestedBytes = (size_t)Frames * (size_t)BytesPerFrame;
+    const size_t Bytes = fwrite(Buffer, 1, RequestedBytes, pFile->p_ioFile);
+    FramesWritten += (SLArrayIndex_t)(Bytes / (size_t)BytesPerFrame);
+
+    if (Bytes != RequestedBytes) {    // Write error
+      break;
+    }
+  }
+
+  pFile->FramePosition += FramesWritten;
+  if ((pFile->FrameCount >= 0) && (pFile->FramePosition > pFile->FrameCount)) {
+    pFile->FrameCount = pFile->FramePosition;
+  }
+  return (FramesWritten);
+}    // End of siglib_numerix_SampleFileWrite()
+
+/********************************************************
+ * Function: siglib_numerix_WavSampleFormat
+ *
+ * Parameters:
+ *  const SLWavFileInfo_s wavInfo,      - WAV file info struct
+ *  enum SLSampleFormat_t *pFormat      - Pointer to sample format
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_PARAMETER_ERROR for unsupported
+ *  word lengths
+ *
+ * Description: Return the sample format of a .wav file.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_WavSampleFormat(const SLWavFileInfo_s wavInfo, enum SLSampleFormat_t* pFormat)
+{
+  if (wavInfo.DataFormat == SIGLIB_WAV_FORMAT_IEEE_FLOAT) {
+    if (wavInfo.WordLength == 32) {
+      *pFormat = SIGLIB_SAMPLE_FLOAT32;
+    } else if (wavInfo.WordLength == 64) {
+      *pFormat = SIGLIB_SAMPLE_FLOAT64;
+    } else {
+      return (SIGLIB_PARAMETER_ERROR);
+    }
+  } else if (wavInfo.WordLength == 8) {
+    *pFormat = SIGLIB_SAMPLE_UINT8;
+  } else if (wavInfo.WordLength == 16) {
+    *pFormat = SIGLIB_SAMPLE_INT16;
+  } else if (wavInfo.WordLength == 24) {
+    *pFormat = SIGLIB_SAMPLE_INT24;
+  } else if (wavInfo.WordLength == 32) {
+    *pFormat = SIGLIB_SAMPLE_INT32;
+  } else {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_WavSampleFormat()
+
+/********************************************************
+ * Function: siglib_numerix_WavParseHeader
+ *
+ * Parameters:
+ *  FILE *p_ioFile,                     - File pointer
+ *  SLWavFileInfo_s *pWavInfo           - Pointer to WAV file info struct
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_FILE_ERROR if the file is not a
+ *  .wav file
+ *
+ * Description: Read the RIFF chunks of a .wav file up to
+ *  the start of the data chunk. The format chunk of PCM,
+ *  IEEE float and extensible format files is decoded, all
+ *  other chunks are skipped.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_WavParseHeader(FILE* p_ioFile, SLWavFileInfo_s* pWavInfo)
+{
+  unsigned char Header[40];
+  SLFixData_t FormatFound = SIGLIB_FALSE;
+
+  rewind(p_ioFile);
+
+  if ((fread(Header, 1, 12, p_ioFile) != 12) || (memcmp(Header, "RIFF", 4) != 0) || (memcmp(Header + 8, "WAVE", 4) != 0)) {
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  for (;;) {
+    if (fread(Header, 1, 8, p_ioFile) != 8) {    // End of file before the data chunk
+      return (SIGLIB_FILE_ERROR);
+    }
+    const SLUInt32_t ChunkLength = (SLUInt32_t)siglib_numerix_SampleLoad(Header + 4, 4, SIGLIB_FALSE);
+
+    if (memcmp(Header, "data", 4) == 0) {
+      if ((FormatFound == SIGLIB_FALSE) || (pWavInfo->BytesPerSample <= 0)) {
+        return (SIGLIB_FILE_ERROR);
+      }
+      pWavInfo->NumberOfSamples = (SLInt32_t)(ChunkLength / (SLUInt32_t)pWavInfo->BytesPerSample);
+      return (SIGLIB_NO_ERROR);
+    }
+
+    SLUInt32_t SkipLength = ChunkLength + (ChunkLength & 1U);    // Chunks are padded to an even length
+    if (memcmp(Header, "fmt ", 4) == 0) {
+      if (ChunkLength < 16) {
+        return (SIGLIB_FILE_ERROR);
+      }
+      const SLUInt32_t ReadLength = (ChunkLength < (SLUInt32_t)sizeof(Header)) ? ChunkLength : (SLUInt32_t)sizeof(Header);
+      if (fread(Header, 1, ReadLength, p_ioFile) != ReadLength) {
+        return (SIGLIB_FILE_ERROR);
+      }
+      pWavInfo->DataFormat = (SLInt32_t)siglib_numerix_SampleLoad(Header, 2, SIGLIB_FALSE);
+      if ((pWavInfo->DataFormat == SIGLIB_WAV_FORMAT_EXTENSIBLE) && (ReadLength >= 26)) {
+        pWavInfo->DataFormat = (SLInt32_t)siglib_numerix_SampleLoad(Header + 24, 2, SIGLIB_FALSE);    // Sub-format
+      }
+      pWavInfo->NumberOfChannels = (SLInt32_t)siglib_numerix_SampleLoad(Header + 2, 2, SIGLIB_FALSE);
+      pWavInfo->SampleRate = (SLInt32_t)siglib_numerix_SampleLoad(Header + 4, 4, SIGLIB_FALSE);
+      pWavInfo->BytesPerSample = (SLInt32_t)siglib_numerix_SampleLoad(Header + 12, 2, SIGLIB_FALSE);
+      pWavInfo->WordLength = (SLInt32_t)siglib_numerix_SampleLoad(Header + 14, 2, SIGLIB_FALSE);
+      FormatFound = SIGLIB_TRUE;
+      SkipLength -= ReadLength;
+    }
+
+    if ((SkipLength != 0) && (SIGLIB_FILE_SEEK(p_ioFile, SkipLength, SEEK_CUR) != 0)) {
+      return (SIGLIB_FILE_ERROR);
+    }
+  }
+}    // End of siglib_numerix_WavParseHeader()
+
+/********************************************************
+ * Function: SUF_SampleFileOpen
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  FILE *p_ioFile,                     - File pointer
+ *  const enum SLSampleFormat_t,        - Sample format
+ *  const enum SLEndianType_t,          - Endian mode
+ *  const SLArrayIndex_t numberOfChannels,  - Number of interleaved channels
+ *  const SLData_t scale                - Scaling applied to samples read
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description: Initialise a block sample file cursor on
+ *  an open file, starting at the current file position.
+ *  Samples read from the file are multiplied by scale and
+ *  samples written to the file are divided by scale, e.g.
+ *  a scale of 1/32768 maps 16 bit samples to +/- 1.0.
+ *  The file is not closed by SUF_SampleFileClose.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_SampleFileOpen(SLSampleFile_s* pFile, FILE* p_ioFile, const enum SLSampleFormat_t sampleFormat,
+                                              const enum SLEndianType_t endianMode, const SLArrayIndex_t numberOfChannels, const SLData_t scale)
+{
+  static const SLArrayIndex_t BytesPerSample[] = {1, 1, 2, 3, 4, 4, 8};    // Indexed by SLSampleFormat_t
+
+  pFile->p_ioFile = p_ioFile;
+  pFile->FileOwnedFlag = SIGLIB_FALSE;
+  pFile->WavWriteFlag = SIGLIB_FALSE;
+  pFile->WrapFlag = SIGLIB_FALSE;
+
+  if ((NULL == p_ioFile) || ((SLArrayIndex_t)sampleFormat < 0) || ((SLArrayIndex_t)sampleFormat > (SLArrayIndex_t)SIGLIB_SAMPLE_FLOAT64) ||
+      (numberOfChannels < 1) || (numberOfChannels > (SIGLIB_FILE_IO_BLOCK_LENGTH / 8)) || (scale == SIGLIB_ZERO)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  pFile->SampleFormat = sampleFormat;
+  pFile->EndianMode = endianMode;
+  pFile->NumberOfChannels = numberOfChannels;
+  pFile->BytesPerSample = BytesPerSample[sampleFormat];
+  pFile->BytesPerFrame = pFile->BytesPerSample * numberOfChannels;
+  pFile->Scale = scale;
+  pFile->InverseScale = SIGLIB_ONE / scale;
+  pFile->DataStart = SIGLIB_FILE_TELL(p_ioFile);
+  pFile->FrameCount = -1;
+  pFile->FramePosition = 0;
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SUF_SampleFileOpen()
+
+/********************************************************
+ * Function: SUF_WavFileOpenRead
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  const char *filename,               - File name
+ *  const SLData_t scale                - Scaling applied to samples read
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_FILE_ERROR or SIGLIB_PARAMETER_ERROR
+ *  on failure
+ *
+ * Description: Open a .wav file for block reading.
+ *  8, 16, 24 and 32 bit PCM and 32 and 64 bit IEEE float
+ *  files are supported. The header information is
+ *  returned in pFile->WavInfo, WavInfo.NumberOfSamples is
+ *  the number of frames (samples per channel).
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_WavFileOpenRead(SLSampleFile_s* pFile, const char* filename, const SLData_t scale)
+{
+  enum SLSampleFormat_t SampleFormat;
+  SLWavFileInfo_s wavInfo;
+
+  FILE* p_ioFile = fopen(filename, "rb");
+  if (NULL == p_ioFile) {
+    pFile->p_ioFile = NULL;
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  SLError_t ErrorCode = siglib_numerix_WavParseHeader(p_ioFile, &wavInfo);
+  if (SIGLIB_NO_ERROR == ErrorCode) {
+    ErrorCode = siglib_numerix_WavSampleFormat(wavInfo, &SampleFormat);
+  }
+  if (SIGLIB_NO_ERROR == ErrorCode) {
+    ErrorCode = SUF_SampleFileOpen(pFile, p_ioFile, SampleFormat, SIGLIB_LITTLE_ENDIAN, wavInfo.NumberOfChannels, scale);
+  }
+  if (SIGLIB_NO_ERROR != ErrorCode) {
+    fclose(p_ioFile);
+    pFile->p_ioFile = NULL;
+    return (ErrorCode);
+  }
+
+  pFile->FileOwnedFlag = SIGLIB_TRUE;
+  pFile->FrameCount = wavInfo.NumberOfSamples;
+  pFile->WavInfo = wavInfo;
+  return (SIGLIB_NO_ERROR);
+}    // End of SUF_WavFileOpenRead()
+
+/********************************************************
+ * Function: SUF_WavFileOpenWrite
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  const char *filename,               - File name
+ *  const SLWavFileInfo_s wavInfo,      - WAV file info struct
+ *  const SLData_t scale                - Scaling applied to samples written
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_FILE_ERROR or SIGLIB_PARAMETER_ERROR
+ *  on failure
+ *
+ * Description: Create a .wav file for block writing.
+ *  The sample rate, number of channels, word length and
+ *  data format are taken from wavInfo. The header is
+ *  updated with the number of frames written by
+ *  SUF_SampleFileClose.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_WavFileOpenWrite(SLSampleFile_s* pFile, const char* filename, const SLWavFileInfo_s wavInfo, const SLData_t scale)
+{
+  enum SLSampleFormat_t SampleFormat;
+
+  pFile->p_ioFile = NULL;
+  if ((siglib_numerix_WavSampleFormat(wavInfo, &SampleFormat) != SIGLIB_NO_ERROR) || (wavInfo.NumberOfChannels < 1)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  FILE* p_ioFile = fopen(filename, "wb");
+  if (NULL == p_ioFile) {
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  pFile->WavInfo = wavInfo;
+  pFile->WavInfo.NumberOfSamples = 0;
+  pFile->WavInfo.BytesPerSample = (wavInfo.WordLength >> 3) * wavInfo.NumberOfChannels;    // Bytes per frame
+  SUF_WavWriteHeader(p_ioFile, pFile->WavInfo);
+
+  SLError_t ErrorCode = SUF_SampleFileOpen(pFile, p_ioFile, SampleFormat, SIGLIB_LITTLE_ENDIAN, wavInfo.NumberOfChannels, scale);
+  if (SIGLIB_NO_ERROR != ErrorCode) {
+    fclose(p_ioFile);
+    pFile->p_ioFile = NULL;
+    return (ErrorCode);
+  }
+
+  pFile->FileOwnedFlag = SIGLIB_TRUE;
+  pFile->WavWriteFlag = SIGLIB_TRUE;
+  pFile->FrameCount = 0;
+  return (SIGLIB_NO_ERROR);
+}    // End of SUF_WavFileOpenWrite()
+
+/********************************************************
+ * Function: SUF_SampleFileRead
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  const SLArrayIndex_t frameCount     - Number of frames to read
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of frames read
+ *
+ * Description: Read the next frames from the file, with
+ *  the channels interleaved in the destination array.
+ *  Fewer frames are returned at the end of the file.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileRead(SLSampleFile_s* pFile, SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t frameCount)
+{
+  return (siglib_numerix_SampleFileRead(pFile, pDst, frameCount, SIGLIB_FALSE));
+}    // End of SUF_SampleFileRead()
+
+/********************************************************
+ * Function: SUF_SampleFileReadChannels
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  const SLArrayIndex_t frameCount     - Number of frames to read
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of frames read
+ *
+ * Description: Read the next frames from the file and
+ *  deinterleave the channels. Channel n is written to
+ *  pDst[n * frameCount], the destination array length is
+ *  (number of channels * frameCount).
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileReadChannels(SLSampleFile_s* pFile, SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t frameCount)
+{
+  return (siglib_numerix_SampleFileRead(pFile, pDst, frameCount, SIGLIB_TRUE));
+}    // End of SUF_SampleFileReadChannels()
+
+/********************************************************
+ * Function: SUF_SampleFileWrite
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  const SLArrayIndex_t frameCount     - Number of frames to write
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of frames written
+ *
+ * Description: Write frames to the file, with the
+ *  channels interleaved in the source array.
+ *  Integer samples outside the range of the file word
+ *  length are saturated.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileWrite(SLSampleFile_s* pFile, const SLData_t* SIGLIB_PTR_DECL pSrc, const SLArrayIndex_t frameCount)
+{
+  return (siglib_numerix_SampleFileWrite(pFile, pSrc, frameCount, SIGLIB_FALSE));
+}    // End of SUF_SampleFileWrite()
+
+/********************************************************
+ * Function: SUF_SampleFileWriteChannels
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  const SLArrayIndex_t frameCount     - Number of frames to write
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of frames written
+ *
+ * Description: Interleave the channels and write them to
+ *  the file. Channel n is read from pSrc[n * frameCount].
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SUF_SampleFileWriteChannels(SLSampleFile_s* pFile, const SLData_t* SIGLIB_PTR_DECL pSrc,
+                                                            const SLArrayIndex_t frameCount)
+{
+  return (siglib_numerix_SampleFileWrite(pFile, pSrc, frameCount, SIGLIB_TRUE));
+}    // End of SUF_SampleFileWriteChannels()
+
+/********************************************************
+ * Function: SUF_SampleFileSeek
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile,              - Pointer to sample file structure
+ *  const SLArrayIndex_t framePosition  - Frame position
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_FILE_ERROR if the file is not
+ *  seekable, SIGLIB_PARAMETER_ERROR if the position is
+ *  out of range
+ *
+ * Description: Move the cursor to a frame in the file.
+ *  The position of the next frame is pFile->FramePosition.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_SampleFileSeek(SLSampleFile_s* pFile, const SLArrayIndex_t framePosition)
+{
+  if ((framePosition < 0) || ((pFile->FrameCount >= 0) && (framePosition > pFile->FrameCount))) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+  if ((pFile->DataStart < 0) ||
+      (SIGLIB_FILE_SEEK(pFile->p_ioFile, pFile->DataStart + ((SLInt64_t)framePosition * (SLInt64_t)pFile->BytesPerFrame), SEEK_SET) != 0)) {
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  pFile->FramePosition = framePosition;
+  return (SIGLIB_NO_ERROR);
+}    // End of SUF_SampleFileSeek()
+
+/********************************************************
+ * Function: SUF_SampleFileClose
+ *
+ * Parameters:
+ *  SLSampleFile_s *pFile               - Pointer to sample file structure
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_FILE_ERROR if the file could not be
+ *  closed
+ *
+ * Description: Close a block sample file. Files created
+ *  by SUF_WavFileOpenWrite have the header updated with
+ *  the number of frames written. Files opened by
+ *  SUF_WavFileOpenRead and SUF_WavFileOpenWrite are
+ *  closed.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_SampleFileClose(SLSampleFile_s* pFile)
+{
+  SLError_t ErrorCode = SIGLIB_NO_ERROR;
+
+  if (NULL == pFile->p_ioFile) {
+    return (SIGLIB_NO_ERROR);
+  }
+
+  if (pFile->WavWriteFlag == SIGLIB_TRUE) {
+    pFile->WavInfo.NumberOfSamples = pFile->FrameCount;
+    SUF_WavWriteHeader(pFile->p_ioFile, pFile->WavInfo);
+    pFile->WavWriteFlag = SIGLIB_FALSE;
+  }
+  if ((pFile->FileOwnedFlag == SIGLIB_TRUE) && (fclose(pFile->p_ioFile) != 0)) {
+    ErrorCode = SIGLIB_FILE_ERROR;
+  }
+
+  pFile->p_ioFile = NULL;
+  return (ErrorCode);
+}    // End of SUF_SampleFileClose()
+
+/********************************************************
+ * Function: siglib_numerix_BinSampleFormat
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  enum SLSampleFormat_t - Sample format of SLData_t
+ *
+ * Description: Return the sample format of .bin files,
+ *  which contain SLData_t samples.
+ *
+ ********************************************************/
+
+static enum SLSampleFormat_t siglib_numerix_BinSampleFormat(void)
+{
+  if (sizeof(SLData_t) == 8) {
+    return (SIGLIB_SAMPLE_FLOAT64);
+  } else if (sizeof(SLData_t) == 4) {
+    return (SIGLIB_SAMPLE_FLOAT32);
+  }
+  return (SIGLIB_SAMPLE_INT16);
+}    // End of siglib_numerix_BinSampleFormat()
+
+/********************************************************
+ * Function: siglib_numerix_RawSampleFormat
+ *
+ * Parameters:
+ *  const SLArrayIndex_t wordLength     - Word length
+ *
+ * Return value:
+ *  enum SLSampleFormat_t - Sample format, out of range
+ *  for unsupported word lengths
+ *
+ * Description: Return the sample format of 8, 16, 24 or
+ *  32 bit .pcm files.
+ *
+ ********************************************************/
+
+static enum SLSampleFormat_t siglib_numerix_RawSampleFormat(const SLArrayIndex_t wordLength)
+{
+  switch (wordLength >> 3) {
+    case 1:
+      return (SIGLIB_SAMPLE_INT8);
+    case 2:
+      return (SIGLIB_SAMPLE_INT16);
+    case 3:
+      return (SIGLIB_SAMPLE_INT24);
+    case 4:
+      return (SIGLIB_SAMPLE_INT32);
+    default:
+      return ((enum SLSampleFormat_t)-1);
+  }
+}    // End of siglib_numerix_RawSampleFormat()
+
+/********************************************************
+ * Function: siglib_numerix_FileLength
+ *
+ * Parameters:
+ *  const char *filename,               - File name
+ *  const SLArrayIndex_t bytesPerSample - Bytes per sample
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of whole samples in the file,
+ *  -1 for file read error
+ *
+ * Description: Return the number of samples in a binary
+ *  file, from the file length.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_FileLength(const char* filename, const SLArrayIndex_t bytesPerSample)
+{
+  FILE* p_ioFile = fopen(filename, "rb");
+  if (NULL == p_ioFile) {
+    return (-1);
+  }
+
+  SLInt64_t FileLength = -1;
+  if (SIGLIB_FILE_SEEK(p_ioFile, 0, SEEK_END) == 0) {
+    FileLength = SIGLIB_FILE_TELL(p_ioFile);
+  }
 
-typedef union {    // SigLib data type to char array union
-  SLData_t s;
-  char c[8];
-} u_SLData_t_char_t;
+  fclose(p_ioFile);
+  if (FileLength < 0) {
+    return (-1);
+  }
+  return ((SLArrayIndex_t)(FileLength / (SLInt64_t)bytesPerSample));
+}    // End of siglib_numerix_FileLength()
 
 /********************************************************
  * Function: SUF_BinReadData
@@ -67,30 +936,13 @@ typedef union {    // SigLib data type to char array union
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinReadData(SLData_t* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const enum SLEndianType_t endianMode,
                                                 const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount = 0;
-  char s2c_buffer[8];
-  u_SLData_t_char_t s2c;
+  SLSampleFile_s SampleFile;
 
-  while ((SLArrayIndex_t)fread(s2c_buffer, 1, sizeof(SLData_t), p_ioFile) == sizeof(SLData_t)) {
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c.c[i] = s2c_buffer[sizeof(SLData_t) - 1 - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c.c[i] = s2c_buffer[i];
-      }
-    }
-    *BPtr++ = s2c.s;
-
-    sampleCount++;
-    if (sampleCount == arrayLength) {
-      return (sampleCount);
-    }
-  }
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, siglib_numerix_BinSampleFormat(), endianMode, 1, SIGLIB_ONE);
+  SLArrayIndex_t sampleCount = SUF_SampleFileRead(&SampleFile, BPtr, arrayLength);
 
   for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // Zero pad array
-    *BPtr++ = 0.0;
+    BPtr[i] = 0.0;
   }
 
   return (sampleCount);
@@ -115,26 +967,10 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinReadData(SLData_t* SIGLIB_PTR_DECL BPtr,
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinWriteData(const SLData_t* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const enum SLEndianType_t endianMode,
                                                  const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount;
-  char s2c_buffer[8];
-  u_SLData_t_char_t s2c;
-
-  for (sampleCount = 0; sampleCount < arrayLength; sampleCount++) {
-    s2c.s = *BPtr++;
-
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c_buffer[i] = s2c.c[sizeof(SLData_t) - 1 - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c_buffer[i] = s2c.c[i];
-      }
-    }
-    fwrite(s2c_buffer, 1, sizeof(SLData_t), p_ioFile);
-  }
+  SLSampleFile_s SampleFile;
 
-  return (sampleCount);
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, siglib_numerix_BinSampleFormat(), endianMode, 1, SIGLIB_ONE);
+  return (SUF_SampleFileWrite(&SampleFile, BPtr, arrayLength));
 }    // End of SUF_BinWriteData()
 
 /********************************************************
@@ -157,38 +993,14 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinWriteData(const SLData_t* SIGLIB_PTR_DECL
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinReadFile(SLData_t* SIGLIB_PTR_DECL BPtr, const char* filename, const enum SLEndianType_t endianMode,
                                                 const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount = 0;
   FILE* p_ioFile;
 
-  p_ioFile = fopen(filename, "r");
+  p_ioFile = fopen(filename, "rb");
   if (NULL == p_ioFile) {
     return (-1);
   }
 
-  char s2c_buffer[8];
-  u_SLData_t_char_t s2c;
-
-  while ((SLArrayIndex_t)fread(s2c_buffer, 1, sizeof(SLData_t), p_ioFile) == sizeof(SLData_t)) {
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c.c[i] = s2c_buffer[sizeof(SLData_t) - 1 - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c.c[i] = s2c_buffer[i];
-      }
-    }
-    *BPtr++ = s2c.s;
-    sampleCount++;
-
-    if (sampleCount == arrayLength) {
-      return (sampleCount);
-    }
-  }
-
-  for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // Zero pad array
-    *BPtr++ = 0.0;
-  }
+  SLArrayIndex_t sampleCount = SUF_BinReadData(BPtr, p_ioFile, endianMode, arrayLength);
 
   fclose(p_ioFile);
   return (sampleCount);
@@ -214,31 +1026,14 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinReadFile(SLData_t* SIGLIB_PTR_DECL BPtr,
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinWriteFile(const SLData_t* SIGLIB_PTR_DECL BPtr, const char* filename, const enum SLEndianType_t endianMode,
                                                  const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount;
   FILE* p_ioFile;
 
-  p_ioFile = fopen(filename, "w");
+  p_ioFile = fopen(filename, "wb");
   if (NULL == p_ioFile) {
     return (-1);
   }
 
-  char s2c_buffer[8];
-  u_SLData_t_char_t s2c;
-
-  for (sampleCount = 0; sampleCount < arrayLength; sampleCount++) {
-    s2c.s = *BPtr++;
-
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c_buffer[i] = s2c.c[sizeof(SLData_t) - 1 - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)sizeof(SLData_t); i++) {
-        s2c_buffer[i] = s2c.c[i];
-      }
-    }
-    fwrite(s2c_buffer, 1, sizeof(SLData_t), p_ioFile);
-  }
+  SLArrayIndex_t sampleCount = SUF_BinWriteData(BPtr, p_ioFile, endianMode, arrayLength);
 
   fclose(p_ioFile);
   return (sampleCount);
@@ -259,29 +1054,9 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinWriteFile(const SLData_t* SIGLIB_PTR_DECL
 
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_BinFileLength(const char* filename)
 {
-  SLArrayIndex_t sampleCount = 0;
-  FILE* p_ioFile;
-
-  p_ioFile = fopen(filename, "r");
-  if (NULL == p_ioFile) {
-    return (-1);
-  }
-
-  char s2c_buffer[8];
-
-  while ((SLArrayIndex_t)fread(s2c_buffer, 1, sizeof(SLData_t), p_ioFile) == sizeof(SLData_t)) {
-    sampleCount++;
-  }
-
-  fclose(p_ioFile);
-  return (sampleCount);
+  return (siglib_numerix_FileLength(filename, (SLArrayIndex_t)sizeof(SLData_t)));
 }    // End of SUF_BinFileLength()
 
-typedef union {    // SigLib fixed point data type to char array union
-  SLInt32_t s;
-  char c[4];
-} u_SLInt32_t_char_t;
-
 /********************************************************
  * Function: SUF_RawReadData
  *
@@ -302,35 +1077,15 @@ typedef union {    // SigLib fixed point data type to char array union
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawReadData(SLData_t* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const enum SLEndianType_t endianMode,
                                                 const SLArrayIndex_t wordLength, const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount = 0;
-  char s2c_buffer[8];
-  u_SLInt32_t_char_t s2c;
+  SLSampleFile_s SampleFile;
 
-  SLArrayIndex_t numBytesInWord = wordLength >> 3;
-  if (numBytesInWord <= 0) {
+  if (SUF_SampleFileOpen(&SampleFile, p_ioFile, siglib_numerix_RawSampleFormat(wordLength), endianMode, 1, SIGLIB_ONE) != SIGLIB_NO_ERROR) {
     return (-1);
   }
-
-  while ((SLArrayIndex_t)fread(s2c_buffer, 1, numBytesInWord, p_ioFile) == numBytesInWord) {
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c.c[i] = s2c_buffer[(numBytesInWord - 1) - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c.c[i] = s2c_buffer[i];
-      }
-    }
-    *BPtr++ = (SLData_t)((s2c.s << (8 * (4 - numBytesInWord))) >> (8 * (4 - numBytesInWord)));    // Sign extend and write data
-
-    sampleCount++;
-    if (sampleCount == arrayLength) {
-      return (sampleCount);
-    }
-  }
+  SLArrayIndex_t sampleCount = SUF_SampleFileRead(&SampleFile, BPtr, arrayLength);
 
   for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // Zero pad array
-    *BPtr++ = 0.0;
+    BPtr[i] = 0.0;
   }
 
   return (sampleCount);
@@ -356,31 +1111,13 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawReadData(SLData_t* SIGLIB_PTR_DECL BPtr,
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawWriteData(const SLData_t* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const enum SLEndianType_t endianMode,
                                                  const SLArrayIndex_t wordLength, const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount;
-  char s2c_buffer[8];
-  u_SLInt32_t_char_t s2c;
+  SLSampleFile_s SampleFile;
 
-  SLArrayIndex_t numBytesInWord = wordLength >> 3;
-  if (numBytesInWord <= 0) {
+  if (SUF_SampleFileOpen(&SampleFile, p_ioFile, siglib_numerix_RawSampleFormat(wordLength), endianMode, 1, SIGLIB_ONE) != SIGLIB_NO_ERROR) {
     return (-1);
   }
-
-  for (sampleCount = 0; sampleCount < arrayLength; sampleCount++) {
-    s2c.s = (SLInt32_t)*BPtr++;
-
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c_buffer[i] = s2c.c[(numBytesInWord - 1) - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c_buffer[i] = s2c.c[i];
-      }
-    }
-    fwrite(s2c_buffer, 1, numBytesInWord, p_ioFile);
-  }
-
-  return (sampleCount);
+  SampleFile.WrapFlag = SIGLIB_TRUE;    // Keep the low bits of out of range samples, as this function always has
+  return (SUF_SampleFileWrite(&SampleFile, BPtr, arrayLength));
 }    // End of SUF_RawWriteData()
 
 /********************************************************
@@ -403,44 +1140,14 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawWriteData(const SLData_t* SIGLIB_PTR_DECL
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawReadFile(SLData_t* SIGLIB_PTR_DECL BPtr, const char* filename, const enum SLEndianType_t endianMode,
                                                 const SLArrayIndex_t wordLength, const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount = 0;
   FILE* p_ioFile;
 
-  p_ioFile = fopen(filename, "r");
+  p_ioFile = fopen(filename, "rb");
   if (NULL == p_ioFile) {
     return (-1);
   }
 
-  char s2c_buffer[4];
-  u_SLInt32_t_char_t s2c;
-
-  SLArrayIndex_t numBytesInWord = wordLength >> 3;
-  if (numBytesInWord <= 0) {
-    return (-1);
-  }
-
-  while ((SLArrayIndex_t)fread(s2c_buffer, 1, numBytesInWord, p_ioFile) == numBytesInWord) {
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c.c[i] = s2c_buffer[(numBytesInWord - 1) - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c.c[i] = s2c_buffer[i];
-      }
-    }
-
-    *BPtr++ = (SLData_t)((s2c.s << (8 * (4 - numBytesInWord))) >> (8 * (4 - numBytesInWord)));    // Sign extend and write data
-
-    sampleCount++;
-    if (sampleCount == arrayLength) {
-      return (sampleCount);
-    }
-  }
-
-  for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // Zero pad array
-    *BPtr++ = 0.0;
-  }
+  SLArrayIndex_t sampleCount = SUF_RawReadData(BPtr, p_ioFile, endianMode, wordLength, arrayLength);
 
   fclose(p_ioFile);
   return (sampleCount);
@@ -466,36 +1173,14 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawReadFile(SLData_t* SIGLIB_PTR_DECL BPtr,
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawWriteFile(const SLData_t* SIGLIB_PTR_DECL BPtr, const char* filename, const enum SLEndianType_t endianMode,
                                                  const SLArrayIndex_t wordLength, const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount;
   FILE* p_ioFile;
 
-  p_ioFile = fopen(filename, "w");
+  p_ioFile = fopen(filename, "wb");
   if (NULL == p_ioFile) {
     return (-1);
   }
 
-  char s2c_buffer[4];
-  u_SLInt32_t_char_t s2c;
-
-  SLArrayIndex_t numBytesInWord = wordLength >> 3;
-  if (numBytesInWord <= 0) {
-    return (-1);
-  }
-
-  for (sampleCount = 0; sampleCount < arrayLength; sampleCount++) {
-    s2c.s = (SLInt32_t)*BPtr++;
-
-    if (endianMode == SIGLIB_BIG_ENDIAN) {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c_buffer[i] = s2c.c[(numBytesInWord - 1) - i];
-      }
-    } else {
-      for (SLArrayIndex_t i = 0; i < numBytesInWord; i++) {
-        s2c_buffer[i] = s2c.c[i];
-      }
-    }
-    fwrite(s2c_buffer, 1, numBytesInWord, p_ioFile);
-  }
+  SLArrayIndex_t sampleCount = SUF_RawWriteData(BPtr, p_ioFile, endianMode, wordLength, arrayLength);
 
   fclose(p_ioFile);
   return (sampleCount);
@@ -517,27 +1202,12 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawWriteFile(const SLData_t* SIGLIB_PTR_DECL
 
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_RawFileLength(const char* filename, const SLArrayIndex_t wordLength)
 {
-  SLArrayIndex_t sampleCount = 0;
-  FILE* p_ioFile;
-
-  p_ioFile = fopen(filename, "r");
-  if (NULL == p_ioFile) {
-    return (-1);
-  }
-
-  char s2c_buffer[4];
-
   SLArrayIndex_t numBytesInWord = wordLength >> 3;
   if (numBytesInWord <= 0) {
     return (-1);
   }
 
-  while ((SLArrayIndex_t)fread(s2c_buffer, 1, numBytesInWord, p_ioFile) == numBytesInWord) {
-    sampleCount++;
-  }
-
-  fclose(p_ioFile);
-  return (sampleCount);
+  return (siglib_numerix_FileLength(filename, numBytesInWord));
 }    // End of SUF_RawFileLength()
 
 /********************************************************
@@ -1252,53 +1922,18 @@ void SIGLIB_FUNC_DECL SUF_WavWriteLong(const SLArrayIndex_t, FILE*);
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavReadData(SLData_t* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const SLWavFileInfo_s wavInfo,
                                                 const SLArrayIndex_t arrayLength)
 {
-  SLArrayIndex_t sampleCount = 0;
-  SLArrayIndex_t Word;
-  unsigned char Char;
-
-  for (SLArrayIndex_t i = 0; i < arrayLength; i++) {    // Read data 32, 16 or 8 bits at a time
-    if (wavInfo.WordLength == 32) {
-      Word = (SLArrayIndex_t)SUF_WavReadLong(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = 0.0;
-      }
-
-      else {
-        *BPtr++ = (SLData_t)Word;
-        sampleCount++;
-      }
-    }
+  SLSampleFile_s SampleFile;
+  enum SLSampleFormat_t SampleFormat;
 
-    if (wavInfo.WordLength == 16) {
-      Word = (SLArrayIndex_t)SUF_WavReadWord(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = 0.0;
-      }
-
-      else {
-        *BPtr++ = (SLData_t)Word;
-        sampleCount++;
-      }
-    }
-
-    else if (wavInfo.WordLength == 8) {
-      Char = (unsigned char)getc(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = 0.0;
-      }
+  if (siglib_numerix_WavSampleFormat(wavInfo, &SampleFormat) != SIGLIB_NO_ERROR) {    // Invalid word length error!
+    return (0);
+  }
 
-      else {
-        *BPtr++ = ((SLData_t)Char) - 128.0;
-        sampleCount++;
-      }
-    }
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, SampleFormat, SIGLIB_LITTLE_ENDIAN, 1, SIGLIB_ONE);
+  SLArrayIndex_t sampleCount = SUF_SampleFileRead(&SampleFile, BPtr, arrayLength);
 
-    else {    // Invalid word length error!
-      return (0);
-    }
+  for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // EOF - zero pad array
+    BPtr[i] = 0.0;
   }
 
   return (sampleCount);
@@ -1323,23 +1958,16 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavReadData(SLData_t* SIGLIB_PTR_DECL BPtr,
 void SIGLIB_FUNC_DECL SUF_WavWriteData(const SLData_t* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const SLWavFileInfo_s wavInfo,
                                        const SLArrayIndex_t arrayLength)
 {
-  for (SLArrayIndex_t i = 0; i < arrayLength; i++) {    // Read data 32, 16 or 8 bits at a time
-    if (wavInfo.WordLength == 32) {
-      SUF_WavWriteLong((SLArrayIndex_t) * (BPtr + i), p_ioFile);
-    }
+  SLSampleFile_s SampleFile;
+  enum SLSampleFormat_t SampleFormat;
 
-    else if (wavInfo.WordLength == 16) {
-      SUF_WavWriteWord((short)*(BPtr + i), p_ioFile);
-    }
-
-    else if (wavInfo.WordLength == 8) {
-      putc(((short)(*(BPtr + i) + 128.0)) & 0x0ff, p_ioFile);
-    }
-
-    else {    // Invalid word length error!
-      return;
-    }
+  if (siglib_numerix_WavSampleFormat(wavInfo, &SampleFormat) != SIGLIB_NO_ERROR) {    // Invalid word length error!
+    return;
   }
+
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, SampleFormat, SIGLIB_LITTLE_ENDIAN, 1, SIGLIB_ONE);
+  SampleFile.WrapFlag = SIGLIB_TRUE;    // Keep the low bits of out of range samples, as this function always has
+  SUF_SampleFileWrite(&SampleFile, BPtr, arrayLength);
 }    // End of SUF_WavWriteData()
 
 /********************************************************
@@ -1362,42 +1990,35 @@ void SIGLIB_FUNC_DECL SUF_WavWriteData(const SLData_t* SIGLIB_PTR_DECL BPtr, FIL
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavReadData16(short* SIGLIB_PTR_DECL BPtr, FILE* p_ioFile, const SLWavFileInfo_s wavInfo,
                                                   const SLArrayIndex_t arrayLength)
 {
+  SLSampleFile_s SampleFile;
+  SLData_t Block[SIGLIB_FILE_IO_BLOCK_LENGTH / 8];
   SLArrayIndex_t sampleCount = 0;
-  short Word;
-  char Char;
 
-  for (SLArrayIndex_t i = 0; i < arrayLength; i++) {    // Read data 16 or 8 bits at a time
-    if (wavInfo.WordLength == 16) {
-      Word = SUF_WavReadWord(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = (short)0;
-      }
+  if ((wavInfo.WordLength != 16) && (wavInfo.WordLength != 8)) {    // Invalid word length error!
+    return (0);
+  }
 
-      else {
-        *BPtr++ = (short)Word;
-        sampleCount++;
-      }
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, (wavInfo.WordLength == 16) ? SIGLIB_SAMPLE_INT16 : SIGLIB_SAMPLE_INT8, SIGLIB_LITTLE_ENDIAN, 1,
+                     SIGLIB_ONE);
+  while (sampleCount < arrayLength) {
+    SLArrayIndex_t BlockLength = arrayLength - sampleCount;
+    if (BlockLength > (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t))) {
+      BlockLength = (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t));
     }
-
-    else if (wavInfo.WordLength == 8) {
-      Char = (char)getc(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = (short)0;
-      }
-
-      else {
-        *BPtr++ = (short)Char;
-        sampleCount++;
-      }
+    const SLArrayIndex_t SamplesRead = SUF_SampleFileRead(&SampleFile, Block, BlockLength);
+    for (SLArrayIndex_t i = 0; i < SamplesRead; i++) {
+      BPtr[sampleCount + i] = (short)Block[i];
     }
-
-    else {    // Invalid word length error!
-      return (0);
+    sampleCount += SamplesRead;
+    if (SamplesRead != BlockLength) {    // EOF
+      break;
     }
   }
 
+  for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // EOF - zero pad array
+    BPtr[i] = (short)0;
+  }
+
   return (sampleCount);
 }    // End of SUF_WavReadData16()
 
@@ -1414,23 +2035,35 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavReadData16(short* SIGLIB_PTR_DECL BPtr, F
  *  SLArrayIndex_t sampleCount   - Number of samples written
  *
  * Description: Write an array of 16 bit data to a .WAV file.
+ *  Samples outside the range of the file word length
+ *  keep their low bits.
  *
  ********************************************************/
 
 void SIGLIB_FUNC_DECL SUF_WavWriteData16(const short* BPtr, FILE* p_ioFile, const SLWavFileInfo_s wavInfo, const SLArrayIndex_t arrayLength)
 {
-  for (SLArrayIndex_t i = 0; i < arrayLength; i++) {    // Write data 16 or 8 bits at a time
-    if (wavInfo.WordLength == 16) {
-      SUF_WavWriteWord((short)*(BPtr + i), p_ioFile);
-    }
+  SLSampleFile_s SampleFile;
+  SLData_t Block[SIGLIB_FILE_IO_BLOCK_LENGTH / 8];
 
-    else if (wavInfo.WordLength == 8) {
-      putc(((short)*(BPtr + i)) & 0x0ff, p_ioFile);
-    }
+  if ((wavInfo.WordLength != 16) && (wavInfo.WordLength != 8)) {    // Invalid word length error!
+    return;
+  }
 
-    else {    // Invalid word length error!
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, (wavInfo.WordLength == 16) ? SIGLIB_SAMPLE_INT16 : SIGLIB_SAMPLE_INT8, SIGLIB_LITTLE_ENDIAN, 1,
+                     SIGLIB_ONE);
+  SampleFile.WrapFlag = SIGLIB_TRUE;    // Keep the low bits of out of range samples, as this function always has
+  for (SLArrayIndex_t sampleCount = 0; sampleCount < arrayLength;) {
+    SLArrayIndex_t BlockLength = arrayLength - sampleCount;
+    if (BlockLength > (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t))) {
+      BlockLength = (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t));
+    }
+    for (SLArrayIndex_t i = 0; i < BlockLength; i++) {
+      Block[i] = (SLData_t)BPtr[sampleCount + i];
+    }
+    if (SUF_SampleFileWrite(&SampleFile, Block, BlockLength) != BlockLength) {    // Write error
       return;
     }
+    sampleCount += BlockLength;
   }
 }    // End of SUF_WavWriteData16()
 
@@ -1454,42 +2087,35 @@ void SIGLIB_FUNC_DECL SUF_WavWriteData16(const short* BPtr, FILE* p_ioFile, cons
 SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavReadData32(SLArrayIndex_t* BPtr, FILE* p_ioFile, const SLWavFileInfo_s wavInfo,
                                                   const SLArrayIndex_t arrayLength)
 {
+  SLSampleFile_s SampleFile;
+  SLData_t Block[SIGLIB_FILE_IO_BLOCK_LENGTH / 8];
   SLArrayIndex_t sampleCount = 0;
-  short Word;
-  char Char;
 
-  for (SLArrayIndex_t i = 0; i < arrayLength; i++) {    // Read the data 16 or 8 bits at a time
-    if (wavInfo.WordLength == 16) {
-      Word = SUF_WavReadWord(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = (SLArrayIndex_t)0;
-      }
+  if ((wavInfo.WordLength != 16) && (wavInfo.WordLength != 8)) {    // Invalid word length error!
+    return (0);
+  }
 
-      else {
-        *BPtr++ = (SLArrayIndex_t)Word;
-        sampleCount++;
-      }
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, (wavInfo.WordLength == 16) ? SIGLIB_SAMPLE_INT16 : SIGLIB_SAMPLE_INT8, SIGLIB_LITTLE_ENDIAN, 1,
+                     SIGLIB_ONE);
+  while (sampleCount < arrayLength) {
+    SLArrayIndex_t BlockLength = arrayLength - sampleCount;
+    if (BlockLength > (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t))) {
+      BlockLength = (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t));
     }
-
-    else if (wavInfo.WordLength == 8) {
-      Char = (char)getc(p_ioFile);
-
-      if (feof(p_ioFile)) {    // EOF error!
-        *BPtr++ = (SLArrayIndex_t)0;
-      }
-
-      else {
-        *BPtr++ = (SLArrayIndex_t)Char;
-        sampleCount++;
-      }
+    const SLArrayIndex_t SamplesRead = SUF_SampleFileRead(&SampleFile, Block, BlockLength);
+    for (SLArrayIndex_t i = 0; i < SamplesRead; i++) {
+      BPtr[sampleCount + i] = (SLArrayIndex_t)Block[i];
     }
-
-    else {    // Invalid word length error!
-      return (0);
+    sampleCount += SamplesRead;
+    if (SamplesRead != BlockLength) {    // EOF
+      break;
     }
   }
 
+  for (SLArrayIndex_t i = sampleCount; i < arrayLength; i++) {    // EOF - zero pad array
+    BPtr[i] = (SLArrayIndex_t)0;
+  }
+
   return (sampleCount);
 }    // End of SUF_WavReadData32()
 
@@ -1506,24 +2132,36 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SUF_WavReadData32(SLArrayIndex_t* BPtr, FILE* p_
  *  SLArrayIndex_t sampleCount     - Number of samples written
  *
  * Description: Write an array of 32 bit data to a .WAV file.
+ *  Samples outside the range of the file word length
+ *  keep their low bits.
  *
  ********************************************************/
 
 void SIGLIB_FUNC_DECL SUF_WavWriteData32(const SLArrayIndex_t* BPtr, FILE* p_ioFile, const SLWavFileInfo_s wavInfo,
                                          const SLArrayIndex_t arrayLength)
 {
-  for (SLArrayIndex_t i = 0; i < arrayLength; i++) {    // Write data 16 or 8 bits at a time
-    if (wavInfo.WordLength == 16) {
-      SUF_WavWriteWord((short)*(BPtr + i), p_ioFile);
-    }
+  SLSampleFile_s SampleFile;
+  SLData_t Block[SIGLIB_FILE_IO_BLOCK_LENGTH / 8];
 
-    else if (wavInfo.WordLength == 8) {
-      putc(((short)*(BPtr + i)) & 0x0ff, p_ioFile);
-    }
+  if ((wavInfo.WordLength != 16) && (wavInfo.WordLength != 8)) {    // Invalid word length error!
+    return;
+  }
 
-    else {    // Invalid word length error!
+  SUF_SampleFileOpen(&SampleFile, p_ioFile, (wavInfo.WordLength == 16) ? SIGLIB_SAMPLE_INT16 : SIGLIB_SAMPLE_INT8, SIGLIB_LITTLE_ENDIAN, 1,
+                     SIGLIB_ONE);
+  SampleFile.WrapFlag = SIGLIB_TRUE;    // Keep the low bits of out of range samples, as this function always has
+  for (SLArrayIndex_t sampleCount = 0; sampleCount < arrayLength;) {
+    SLArrayIndex_t BlockLength = arrayLength - sampleCount;
+    if (BlockLength > (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t))) {
+      BlockLength = (SLArrayIndex_t)(sizeof(Block) / sizeof(SLData_t));
+    }
+    for (SLArrayIndex_t i = 0; i < BlockLength; i++) {
+      Block[i] = (SLData_t)BPtr[sampleCount + i];
+    }
+    if (SUF_SampleFileWrite(&SampleFile, Block, BlockLength) != BlockLength) {    // Write error
       return;
     }
+    sampleCount += BlockLength;
   }
 }    // End of SUF_WavWriteData32()
 
@@ -1633,86 +2271,16 @@ void SIGLIB_FUNC_DECL SUF_WavWriteLong(const SLArrayIndex_t LongWord, FILE* p_io
 
 SLWavFileInfo_s SIGLIB_FUNC_DECL SUF_WavReadHeader(FILE* p_ioFile)
 {
-  SLArrayIndex_t LongWord;
-  short Word;
-  char String[10];
   SLWavFileInfo_s wavInfo;
-  short DataSectionFound = 0;
 
   wavInfo.NumberOfChannels = 0;    // 0 is an error
 
-  rewind(p_ioFile);
-
-  size_t numItems = fread(String, 1, 4, p_ioFile);
-  if (numItems != 4) {
-    fclose(p_ioFile);
-    wavInfo.NumberOfSamples = 0;
-    return (wavInfo);
-  }
-  *(String + 4) = 0;
-  if (strcmp(String, "RIFF") != 0) {    // Check for RIFF header
-    fclose(p_ioFile);
-    wavInfo.NumberOfSamples = 0;
-    return (wavInfo);
-  }
-
-  LongWord = SUF_WavReadLong(p_ioFile);    // Read waveform length (bytes)
-
-  numItems = fread(String, 1, 8, p_ioFile);
-  if (numItems != 8) {
-    fclose(p_ioFile);
-    wavInfo.NumberOfSamples = 0;
-    return (wavInfo);
-  }
-  *(String + 8) = 0;
-  if (strcmp(String, "WAVEfmt ") != 0) {    // Check for WAVEfmt header
-    fclose(p_ioFile);
-    wavInfo.NumberOfSamples = 0;
-    return (wavInfo);
-  }
-
-  LongWord = SUF_WavReadLong(p_ioFile);    // Read format section length (bytes)
-
-  Word = SUF_WavReadWord(p_ioFile);
-  if (Word != 1) {    // Check format "1" = PCM data
+  if ((siglib_numerix_WavParseHeader(p_ioFile, &wavInfo) != SIGLIB_NO_ERROR) ||
+      ((wavInfo.DataFormat != SIGLIB_WAV_FORMAT_PCM) && (wavInfo.DataFormat != SIGLIB_WAV_FORMAT_IEEE_FLOAT))) {
     fclose(p_ioFile);
     wavInfo.NumberOfSamples = 0;
     return (wavInfo);
   }
-  wavInfo.DataFormat = Word;
-
-  Word = SUF_WavReadWord(p_ioFile);    // Read number of channels
-  wavInfo.NumberOfChannels = Word;
-
-  LongWord = SUF_WavReadLong(p_ioFile);    // Read sample rate (Hz)
-  wavInfo.SampleRate = LongWord;
-
-  LongWord = SUF_WavReadLong(p_ioFile);    // Read data rate (bytes per second)
-
-  Word = SUF_WavReadWord(p_ioFile);    // Read bytes per sample
-  wavInfo.BytesPerSample = Word;
-
-  Word = SUF_WavReadWord(p_ioFile);    // Read bits per sample
-  wavInfo.WordLength = Word;
-
-  *(String + 4) = 0;
-  do {
-    *String = *(String + 1);    // Scan for data section header
-    *(String + 1) = *(String + 2);
-    *(String + 2) = *(String + 3);
-    *(String + 3) = (char)getc(p_ioFile);
-    if (strcmp(String, "data") == 0)
-      DataSectionFound = 1;
-
-    if (feof(p_ioFile)) {    // EOF error!
-      fclose(p_ioFile);
-      wavInfo.NumberOfSamples = 0;
-      return (wavInfo);
-    }
-  } while (!DataSectionFound);
-
-  LongWord = SUF_WavReadLong(p_ioFile);    // Read data section length (bytes)
-  wavInfo.NumberOfSamples = LongWord / ((SLArrayIndex_t)wavInfo.BytesPerSample);
 
   return (wavInfo);
 }    // End of SUF_WavReadHeader()
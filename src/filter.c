@@ -510,6 +510,196 @@ SLComplexRect_s SIGLIB_FUNC_DECL SDA_GoertzelDetectComplex(const SLData_t* SIGLI
   return (Result);    // Calculate and return final stage
 }    // End of SDA_GoertzelDetectComplex()
 
+/********************************************************
+ * Function: SIF_GoertzelBank
+ *
+ * Parameters:
+ *  const SLData_t *pFrequencies,       - Pointer to normalised tone frequencies
+ *  SLData_t *pCoeffs,                  - Pointer to filter coefficients array
+ *  SLData_t *pState,                   - Pointer to filter state array
+ *  const SLArrayIndex_t numberOfTones,
+ *  const SLArrayIndex_t numberOfChannels
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Initialise a bank of Goertzel filters,
+ *  one for each tone, that are applied to each channel.
+ *  The coefficient array length is numberOfTones and
+ *  the state array length is
+ *  2 * numberOfTones * numberOfChannels.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SIF_GoertzelBank(const SLData_t* SIGLIB_PTR_DECL pFrequencies, SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                       SLData_t* SIGLIB_PTR_DECL pState, const SLArrayIndex_t numberOfTones,
+                                       const SLArrayIndex_t numberOfChannels)
+{
+  for (SLArrayIndex_t t = 0; t < numberOfTones; t++) {
+    pCoeffs[t] = SIGLIB_TWO * SDS_Cos(SIGLIB_TWO * SIGLIB_PI * pFrequencies[t]);    // 2 * cos (w), as used in the recurrence
+  }
+
+  for (SLArrayIndex_t i = 0; i < (2 * numberOfTones * numberOfChannels); i++) {    // Initialise the filter state array to 0
+    pState[i] = SIGLIB_ZERO;
+  }
+}    // End of SIF_GoertzelBank()
+
+/********************************************************
+ * Function: siglib_numerix_GoertzelBankChannel
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLData_t *pState,                   - Pointer to channel state
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients
+ *  const SLArrayIndex_t numberOfTones,
+ *  const SLArrayIndex_t sampleLength
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply the Goertzel recurrence for every tone to one
+ *  channel. Each SIMD lane holds the state of one tone
+ *  and two vectors of tones are updated together, so
+ *  that there are two independent dependency chains and
+ *  up to 2 * SIGLIB_VECTOR_LENGTH tones are evaluated in
+ *  a single pass over the source array.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_GoertzelBankChannel(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pState,
+                                                                        const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                                                        const SLArrayIndex_t numberOfTones, const SLArrayIndex_t sampleLength)
+{
+  SLData_t* pS0 = pState;
+  SLData_t* pS1 = pS0 + numberOfTones;
+  SLArrayIndex_t t = 0;
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  for (; t <= (numberOfTones - (2 * SIGLIB_VECTOR_LENGTH)); t += (2 * SIGLIB_VECTOR_LENGTH)) {
+    SLDataVector_t Ca, S0a, S1a, Cb, S0b, S1b;
+    SDV_Load(Ca, pCoeffs + t);
+    SDV_Load(S0a, pS0 + t);
+    SDV_Load(S1a, pS1 + t);
+    SDV_Load(Cb, pCoeffs + t + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(S0b, pS0 + t + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(S1b, pS1 + t + SIGLIB_VECTOR_LENGTH);
+
+    for (SLArrayIndex_t n = 0; n < sampleLength; n++) {
+      SLDataVector_t Tmpa = S0a;
+      SLDataVector_t Tmpb = S0b;
+      S0a = pSrc[n] + (Ca * Tmpa) - S1a;
+      S0b = pSrc[n] + (Cb * Tmpb) - S1b;
+      S1a = Tmpa;
+      S1b = Tmpb;
+    }
+
+    SDV_Store(pS0 + t, S0a);
+    SDV_Store(pS1 + t, S1a);
+    SDV_Store(pS0 + t + SIGLIB_VECTOR_LENGTH, S0b);
+    SDV_Store(pS1 + t + SIGLIB_VECTOR_LENGTH, S1b);
+  }
+
+  for (; t <= (numberOfTones - SIGLIB_VECTOR_LENGTH); t += SIGLIB_VECTOR_LENGTH) {
+    SLDataVector_t C, S0, S1;
+    SDV_Load(C, pCoeffs + t);
+    SDV_Load(S0, pS0 + t);
+    SDV_Load(S1, pS1 + t);
+
+    for (SLArrayIndex_t n = 0; n < sampleLength; n++) {
+      SLDataVector_t Tmp = S0;
+      S0 = pSrc[n] + (C * Tmp) - S1;
+      S1 = Tmp;
+    }
+
+    SDV_Store(pS0 + t, S0);
+    SDV_Store(pS1 + t, S1);
+  }
+#endif
+
+  if (t < numberOfTones) {    // Remaining tones
+    for (SLArrayIndex_t n = 0; n < sampleLength; n++) {
+      for (SLArrayIndex_t k = t; k < numberOfTones; k++) {
+        SLData_t Tmp = pS0[k];
+        pS0[k] = pSrc[n] + (pCoeffs[k] * Tmp) - pS1[k];
+        pS1[k] = Tmp;
+      }
+    }
+  }
+}    // End of siglib_numerix_GoertzelBankChannel()
+
+/********************************************************
+ * Function: SDA_GoertzelBank
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLData_t *pState,                   - Pointer to filter state array
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients array
+ *  const SLArrayIndex_t numberOfTones,
+ *  const SLArrayIndex_t numberOfChannels,
+ *  const SLArrayIndex_t sampleLength   - Number of samples per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Apply the bank of Goertzel filters to
+ *  each channel of the source array. The channels are
+ *  stored one after the other, channel n starts at
+ *  pSrc[n * sampleLength].
+ *  The filter state is maintained across calls so a
+ *  detection period can be split over several arrays.
+ *  The results are the same as calling
+ *  SDA_GoertzelDetect for each tone and each channel.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_GoertzelBank(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pState,
+                                       const SLData_t* SIGLIB_PTR_DECL pCoeffs, const SLArrayIndex_t numberOfTones,
+                                       const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t sampleLength)
+{
+  for (SLArrayIndex_t c = 0; c < numberOfChannels; c++) {
+    siglib_numerix_GoertzelBankChannel(pSrc + (c * sampleLength), pState + (c * 2 * numberOfTones), pCoeffs, numberOfTones,
+                                       sampleLength);
+  }
+}    // End of SDA_GoertzelBank()
+
+/********************************************************
+ * Function: SDA_GoertzelBankDetect
+ *
+ * Parameters:
+ *  SLData_t *pState,                   - Pointer to filter state array
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients array
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  const SLArrayIndex_t numberOfTones,
+ *  const SLArrayIndex_t numberOfChannels
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Calculate the filtered signal energy
+ *  squared for each tone and each channel, at the end
+ *  of the detection period, and reset the filter state
+ *  for the next period.
+ *  The result for tone t of channel n is written to
+ *  pDst[(n * numberOfTones) + t].
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_GoertzelBankDetect(SLData_t* SIGLIB_PTR_DECL pState, const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                             SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t numberOfTones,
+                                             const SLArrayIndex_t numberOfChannels)
+{
+  for (SLArrayIndex_t c = 0; c < numberOfChannels; c++) {
+    SLData_t* pS0 = pState + (c * 2 * numberOfTones);
+    SLData_t* pS1 = pS0 + numberOfTones;
+    for (SLArrayIndex_t t = 0; t < numberOfTones; t++) {
+      *pDst++ = (pS0[t] * pS0[t]) - (pCoeffs[t] * pS0[t] * pS1[t]) + (pS1[t] * pS1[t]);    // Square magnitude sum
+      pS0[t] = SIGLIB_ZERO;
+      pS1[t] = SIGLIB_ZERO;
+    }
+  }
+}    // End of SDA_GoertzelBankDetect()
+
 /********************************************************
  * Function: SIF_GaussianFirFilter
  *
@@ -1322,3 +1512,293 @@ void SIGLIB_FUNC_DECL SDA_FarrowFilter(const SLData_t* SIGLIB_PTR_DECL pSrc, SLD
   *pFilterIndex = j;    // Store index for next iteration
 
 }    // End of SDA_FarrowFilter()
+
+/********************************************************
+ * Function: siglib_numerix_RankSiftUp
+ *
+ * Parameters:
+ *  const SLData_t *pWindow,             Pointer to window samples
+ *  SLArrayIndex_t *pHeap,               Pointer to first entry in heap
+ *  SLArrayIndex_t *pHeapPosition,       Pointer to heap position array
+ *  const SLArrayIndex_t heapOffset,     Offset of heap in heap array
+ *  SLArrayIndex_t i,                    Heap entry to move
+ *  const SLFixData_t maxHeapFlag        SIGLIB_TRUE for a max heap
+ *
+ * Return value:
+ *  SLArrayIndex_t - New heap entry
+ *
+ * Description: Move a heap entry towards the root until
+ *  the heap order is restored.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_RankSiftUp(const SLData_t* SIGLIB_PTR_DECL pWindow, SLArrayIndex_t* SIGLIB_PTR_DECL pHeap,
+                                                SLArrayIndex_t* SIGLIB_PTR_DECL pHeapPosition, const SLArrayIndex_t heapOffset, SLArrayIndex_t i,
+                                                const SLFixData_t maxHeapFlag)
+{
+  const SLArrayIndex_t Slot = pHeap[i];
+  const SLData_t Value = pWindow[Slot];
+
+  while (i > 0) {
+    const SLArrayIndex_t Parent = (i - 1) >> 1;
+    const SLData_t ParentValue = pWindow[pHeap[Parent]];
+    if ((maxHeapFlag == SIGLIB_TRUE) ? (Value <= ParentValue) : (Value >= ParentValue)) {
+      break;
+    }
+    pHeap[i] = pHeap[Parent];
+    pHeapPosition[pHeap[i]] = i + heapOffset;
+    i = Parent;
+  }
+  pHeap[i] = Slot;
+  pHeapPosition[Slot] = i + heapOffset;
+  return (i);
+}    // End of siglib_numerix_RankSiftUp()
+
+/********************************************************
+ * Function: siglib_numerix_RankSiftDown
+ *
+ * Parameters:
+ *  const SLData_t *pWindow,             Pointer to window samples
+ *  SLArrayIndex_t *pHeap,               Pointer to first entry in heap
+ *  SLArrayIndex_t *pHeapPosition,       Pointer to heap position array
+ *  const SLArrayIndex_t heapOffset,     Offset of heap in heap array
+ *  const SLArrayIndex_t heapLength,     Number of entries in heap
+ *  SLArrayIndex_t i,                    Heap entry to move
+ *  const SLFixData_t maxHeapFlag        SIGLIB_TRUE for a max heap
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Move a heap entry away from the root until
+ *  the heap order is restored.
+ *
+ ********************************************************/
+
+static void siglib_numerix_RankSiftDown(const SLData_t* SIGLIB_PTR_DECL pWindow, SLArrayIndex_t* SIGLIB_PTR_DECL pHeap,
+                                        SLArrayIndex_t* SIGLIB_PTR_DECL pHeapPosition, const SLArrayIndex_t heapOffset,
+                                        const SLArrayIndex_t heapLength, SLArrayIndex_t i, const SLFixData_t maxHeapFlag)
+{
+  const SLArrayIndex_t Slot = pHeap[i];
+  const SLData_t Value = pWindow[Slot];
+
+  for (;;) {
+    SLArrayIndex_t Child = (2 * i) + 1;
+    if (Child >= heapLength) {
+      break;
+    }
+    SLData_t ChildValue = pWindow[pHeap[Child]];
+    if (Child + 1 < heapLength) {
+      const SLData_t RightValue = pWindow[pHeap[Child + 1]];
+      if ((maxHeapFlag == SIGLIB_TRUE) ? (RightValue > ChildValue) : (RightValue < ChildValue)) {
+        Child++;
+        ChildValue = RightValue;
+      }
+    }
+    if ((maxHeapFlag == SIGLIB_TRUE) ? (ChildValue <= Value) : (ChildValue >= Value)) {
+      break;
+    }
+    pHeap[i] = pHeap[Child];
+    pHeapPosition[pHeap[i]] = i + heapOffset;
+    i = Child;
+  }
+  pHeap[i] = Slot;
+  pHeapPosition[Slot] = i + heapOffset;
+}    // End of siglib_numerix_RankSiftDown()
+
+/********************************************************
+ * Function: siglib_numerix_RankFilterUpdate
+ *
+ * Parameters:
+ *  const SLData_t src,                  Source sample
+ *  SLRankFilter_s *pFilter              Pointer to filter structure
+ *
+ * Return value:
+ *  SLData_t - Sample of the requested rank in the window
+ *
+ * Description: Replace the oldest sample in the window
+ *  with the source sample and restore the two heaps.
+ *
+ ********************************************************/
+
+static SLData_t siglib_numerix_RankFilterUpdate(const SLData_t src, SLRankFilter_s* pFilter)
+{
+  SLData_t* pWindow = pFilter->pWindow;
+  SLArrayIndex_t* pHeap = pFilter->pHeap;
+  SLArrayIndex_t* pHeapPosition = pFilter->pHeapPosition;
+  const SLArrayIndex_t LowLength = pFilter->Rank + 1;    // Lower samples are in a max heap, the root is the output
+  const SLArrayIndex_t HighLength = pFilter->WindowLength - LowLength;
+  SLArrayIndex_t* pHighHeap = pHeap + LowLength;
+
+  const SLArrayIndex_t Slot = pFilter->Index;
+  if (++pFilter->Index == pFilter->WindowLength) {
+    pFilter->Index = 0;
+  }
+
+  const SLData_t OldValue = pWindow[Slot];
+  pWindow[Slot] = src;
+  if (src == OldValue) {    // The heaps are unchanged
+    return (pWindow[pHeap[0]]);
+  }
+
+  const SLArrayIndex_t Position = pHeapPosition[Slot];
+  if (Position < LowLength) {
+    // The new sample replaces a lower sample, if it is larger than the smallest higher
+    // sample then it is the root of the lower heap and is exchanged with that sample
+    if (siglib_numerix_RankSiftUp(pWindow, pHeap, pHeapPosition, 0, Position, SIGLIB_TRUE) == Position) {
+      siglib_numerix_RankSiftDown(pWindow, pHeap, pHeapPosition, 0, LowLength, Position, SIGLIB_TRUE);
+    }
+    if ((HighLength > 0) && (pWindow[pHeap[0]] > pWindow[pHighHeap[0]])) {
+      SDS_Swap(pHeap[0], pHighHeap[0]);
+      pHeapPosition[pHeap[0]] = 0;
+      pHeapPosition[pHighHeap[0]] = LowLength;
+      siglib_numerix_RankSiftDown(pWindow, pHighHeap, pHeapPosition, LowLength, HighLength, 0, SIGLIB_FALSE);
+    }
+  } else {
+    const SLArrayIndex_t HighPosition = Position - LowLength;
+    if (siglib_numerix_RankSiftUp(pWindow, pHighHeap, pHeapPosition, LowLength, HighPosition, SIGLIB_FALSE) == HighPosition) {
+      siglib_numerix_RankSiftDown(pWindow, pHighHeap, pHeapPosition, LowLength, HighLength, HighPosition, SIGLIB_FALSE);
+    }
+    if (pWindow[pHighHeap[0]] < pWindow[pHeap[0]]) {
+      SDS_Swap(pHeap[0], pHighHeap[0]);
+      pHeapPosition[pHeap[0]] = 0;
+      pHeapPosition[pHighHeap[0]] = LowLength;
+      siglib_numerix_RankSiftDown(pWindow, pHeap, pHeapPosition, 0, LowLength, 0, SIGLIB_TRUE);
+    }
+  }
+
+  return (pWindow[pHeap[0]]);
+}    // End of siglib_numerix_RankFilterUpdate()
+
+/********************************************************
+ * Function: SIF_RankFilter
+ *
+ * Parameters:
+ *  SLRankFilter_s *pFilter,             Pointer to filter structure
+ *  const SLArrayIndex_t windowLength,   Window length
+ *  const SLArrayIndex_t rank            Rank of output sample
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description: Initialise the running rank order filter.
+ *  Each output is the sample of the given rank in the
+ *  sorted window of the most recent windowLength
+ *  samples. A rank of 0 gives the minimum, (windowLength - 1)
+ *  gives the maximum and (windowLength - 1) / 2 gives the
+ *  median of an odd length window.
+ *  The window is initialised to zero, like the state of
+ *  an FIR filter. The memory is released with
+ *  SUF_RankFilterFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_RankFilter(SLRankFilter_s* pFilter, const SLArrayIndex_t windowLength, const SLArrayIndex_t rank)
+{
+  pFilter->pWindow = SIGLIB_NULL_DATA_PTR;
+  pFilter->pHeap = SIGLIB_NULL_ARRAY_INDEX_PTR;
+
+  if ((windowLength < 1) || (rank < 0) || (rank >= windowLength)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  pFilter->pWindow = SUF_VectorArrayAllocate(windowLength);
+  pFilter->pHeap = (SLArrayIndex_t*)SUF_MemoryAllocate(2 * (size_t)windowLength * sizeof(SLArrayIndex_t));
+  if ((SIGLIB_NULL_DATA_PTR == pFilter->pWindow) || (SIGLIB_NULL_ARRAY_INDEX_PTR == pFilter->pHeap)) {
+    SUF_RankFilterFree(pFilter);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  pFilter->pHeapPosition = pFilter->pHeap + windowLength;
+
+  pFilter->WindowLength = windowLength;
+  pFilter->Rank = rank;
+  pFilter->Index = 0;
+
+  for (SLArrayIndex_t i = 0; i < windowLength; i++) {    // A window of equal samples is ordered
+    pFilter->pWindow[i] = SIGLIB_ZERO;
+    pFilter->pHeap[i] = i;
+    pFilter->pHeapPosition[i] = i;
+  }
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_RankFilter()
+
+/********************************************************
+ * Function: SDS_RankFilter
+ *
+ * Parameters:
+ *  const SLData_t src,                  Source sample
+ *  SLRankFilter_s *pFilter              Pointer to filter structure
+ *
+ * Return value:
+ *  SLData_t - Filtered sample
+ *
+ * Description: Apply the running rank order filter to the
+ *  data sample. The sample replaces the oldest sample in
+ *  the window in O(log(windowLength)) operations.
+ *
+ ********************************************************/
+
+SLData_t SIGLIB_FUNC_DECL SDS_RankFilter(const SLData_t src, SLRankFilter_s* pFilter)
+{
+  return (siglib_numerix_RankFilterUpdate(src, pFilter));
+}    // End of SDS_RankFilter()
+
+/********************************************************
+ * Function: SDA_RankFilter
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,                Pointer to source array
+ *  SLData_t *pDst,                      Pointer to destination array
+ *  SLRankFilter_s *pFilter,             Pointer to filter structure
+ *  const SLArrayIndex_t sampleLength    Sample length
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Apply the running rank order filter to the
+ *  data array. The window is kept in the filter structure
+ *  so consecutive arrays are filtered as one stream.
+ *  The source and destination arrays can be the same.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_RankFilter(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, SLRankFilter_s* pFilter,
+                                     const SLArrayIndex_t sampleLength)
+{
+#if (SIGLIB_ARRAYS_ALIGNED)
+#  ifdef __TMS320C6X__             // Defined by TI compiler
+  _nassert((int)pSrc % 8 == 0);    // Align arrays on 64 bit double word boundary for LDDW
+  _nassert((int)pDst % 8 == 0);
+#  endif
+#endif
+
+  for (SLArrayIndex_t i = 0; i < sampleLength; i++) {
+    pDst[i] = siglib_numerix_RankFilterUpdate(pSrc[i], pFilter);
+  }
+}    // End of SDA_RankFilter()
+
+/********************************************************
+ * Function: SUF_RankFilterFree
+ *
+ * Parameters:
+ *  SLRankFilter_s *pFilter              Pointer to filter structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Free the memory allocated by SIF_RankFilter.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_RankFilterFree(SLRankFilter_s* pFilter)
+{
+  if (SIGLIB_NULL_DATA_PTR != pFilter->pWindow) {
+    SUF_MemoryFree(pFilter->pWindow);
+    pFilter->pWindow = SIGLIB_NULL_DATA_PTR;
+  }
+  if (SIGLIB_NULL_ARRAY_INDEX_PTR != pFilter->pHeap) {
+    SUF_MemoryFree(pFilter->pHeap);
+    pFilter->pHeap = SIGLIB_NULL_ARRAY_INDEX_PTR;
+  }
+}    // End of SUF_RankFilterFree()
@@ -40,6 +40,12 @@ Description: SigLib DSP library FIR filter routines.
 
 #include <siglib.h>    // Include SigLib header file
 
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+#  define SIGLIB_FIR_BLOCK_LENGTH (4 * SIGLIB_VECTOR_LENGTH)    // Number of outputs calculated together by the block FIR kernel
+#else
+#  define SIGLIB_FIR_BLOCK_LENGTH 4
+#endif
+
 /********************************************************
  * Function: SIF_Fir
  *
@@ -147,6 +153,8 @@ void SIGLIB_FUNC_DECL SDA_Fir(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t pDs
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_FIR);
+
   SLArrayIndex_t j = *pFilterIndex;    // Initialise local filter index
 
   for (SLArrayIndex_t k = 0; k < sampleLength; k++) {
@@ -166,6 +174,7 @@ void SIGLIB_FUNC_DECL SDA_Fir(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t pDs
     *pDst++ = sum;
   }
   *pFilterIndex = j;    // Store index for next iteration
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_FIR);
 }    // End of SDA_Fir()
 
 /********************************************************
@@ -849,6 +858,42 @@ void SIGLIB_FUNC_DECL SIF_FirExtendedArray(SLData_t* SIGLIB_PTR_DECL pState, con
   *pFilterIndex = SIGLIB_AI_ZERO;    // Initilaise filter index
 }    // End of SIF_FirExtendedArray()
 
+/********************************************************
+ * Function: SIF_FirExtendedArrayFromFir
+ *
+ * Parameters:
+ *  SLData_t *pState,                   Pointer to extended array filter state array
+ *  SLArrayIndex_t * pFilterIndex,      Pointer to extended array filter index
+ *  const SLData_t *pFirState,          Pointer to SDA_Fir filter state array
+ *  const SLArrayIndex_t firFilterIndex,    SDA_Fir filter index
+ *  const SLArrayIndex_t filterLength   Filter length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Initialise the extended array FIR filter state from
+ *  the state of a filter that is running with SDS_Fir or
+ *  SDA_Fir, so that a running filter can be moved to
+ *  SDA_FirExtendedArray without a discontinuity.
+ *  Both state arrays store the newest sample at the
+ *  lowest address, the extended array state is length
+ *  (2 * filterLength).
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SIF_FirExtendedArrayFromFir(SLData_t* SIGLIB_PTR_DECL pState, SLArrayIndex_t* pFilterIndex,
+                                                  const SLData_t* SIGLIB_PTR_DECL pFirState, const SLArrayIndex_t firFilterIndex,
+                                                  const SLArrayIndex_t filterLength)
+{
+  for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+    pState[i] = pFirState[i];
+    pState[i + filterLength] = pFirState[i];
+  }
+
+  *pFilterIndex = filterLength - 1 - firFilterIndex;    // SDA_Fir writes the next sample at firFilterIndex
+}    // End of SIF_FirExtendedArrayFromFir()
+
 /********************************************************
  * Function: SDS_FirExtendedArray
  *
@@ -899,6 +944,74 @@ SLData_t SIGLIB_FUNC_DECL SDS_FirExtendedArray(const SLData_t Src, SLData_t* pSt
   return sum;
 }    // End of SDS_FirExtendedArray()
 
+/********************************************************
+ * Function: siglib_numerix_FirExtendedArrayBlock
+ *
+ * Parameters:
+ *  const SLData_t *pState,             Pointer to the oldest output's first state sample
+ *  const SLData_t *pCoeffs,            Pointer to filter coefficients
+ *  SLData_t *pDst,                     Pointer to destination array
+ *  const SLArrayIndex_t filterLength   Filter length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Calculate SIGLIB_FIR_BLOCK_LENGTH outputs of the
+ *  extended array FIR filter. The state array holds the
+ *  newest sample at the lowest address so output k uses
+ *  the state from (SIGLIB_FIR_BLOCK_LENGTH - 1 - k).
+ *  Each coefficient is read once per block and multiplied
+ *  by a contiguous run of the state array, with one
+ *  output per SIMD lane, so there is no index wrapping
+ *  in the inner loop.
+ *  Each output sums the taps in the same order as
+ *  SDS_FirExtendedArray.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_FirExtendedArrayBlock(const SLData_t* SIGLIB_PTR_DECL pState,
+                                                                          const SLData_t* SIGLIB_PTR_DECL pCoeffs, SLData_t* SIGLIB_PTR_DECL pDst,
+                                                                          const SLArrayIndex_t filterLength)
+{
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  SLDataVector_t Sum0 = { 0 }, Sum1 = { 0 }, Sum2 = { 0 }, Sum3 = { 0 };
+
+  for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+    SLDataVector_t State0, State1, State2, State3;
+    SDV_Load(State0, pState + i);
+    SDV_Load(State1, pState + i + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(State2, pState + i + (2 * SIGLIB_VECTOR_LENGTH));
+    SDV_Load(State3, pState + i + (3 * SIGLIB_VECTOR_LENGTH));
+    Sum0 += pCoeffs[i] * State0;
+    Sum1 += pCoeffs[i] * State1;
+    Sum2 += pCoeffs[i] * State2;
+    Sum3 += pCoeffs[i] * State3;
+  }
+
+  for (SLArrayIndex_t l = 0; l < SIGLIB_VECTOR_LENGTH; l++) {    // Newest output is in the last lane
+    pDst[SIGLIB_FIR_BLOCK_LENGTH - 1 - l] = Sum0[l];
+    pDst[(3 * SIGLIB_VECTOR_LENGTH) - 1 - l] = Sum1[l];
+    pDst[(2 * SIGLIB_VECTOR_LENGTH) - 1 - l] = Sum2[l];
+    pDst[SIGLIB_VECTOR_LENGTH - 1 - l] = Sum3[l];
+  }
+#else
+  SLData_t Sum0 = SIGLIB_ZERO, Sum1 = SIGLIB_ZERO, Sum2 = SIGLIB_ZERO, Sum3 = SIGLIB_ZERO;
+
+  for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+    Sum0 += pCoeffs[i] * pState[i];
+    Sum1 += pCoeffs[i] * pState[i + 1];
+    Sum2 += pCoeffs[i] * pState[i + 2];
+    Sum3 += pCoeffs[i] * pState[i + 3];
+  }
+
+  pDst[0] = Sum3;
+  pDst[1] = Sum2;
+  pDst[2] = Sum1;
+  pDst[3] = Sum0;
+#endif
+}    // End of siglib_numerix_FirExtendedArrayBlock()
+
 /********************************************************
  * Function: SDA_FirExtendedArray
  *
@@ -916,6 +1029,18 @@ SLData_t SIGLIB_FUNC_DECL SDS_FirExtendedArray(const SLData_t Src, SLData_t* pSt
  *
  * Description: Apply the FIR filter to the data array
  *
+ * Notes:
+ *  The samples are processed in blocks of
+ *  SIGLIB_FIR_BLOCK_LENGTH. The block's samples are
+ *  written to the lower half of the state array, all of
+ *  the outputs are calculated and then the samples are
+ *  copied to the upper half, which still holds the oldest
+ *  samples required by the earlier outputs in the block.
+ *  Blocks do not cross the point where the filter index
+ *  wraps, so the state and filter index are the same as
+ *  for SDS_FirExtendedArray and the functions can be
+ *  mixed on the same filter.
+ *
  ********************************************************/
 
 void SIGLIB_FUNC_DECL SDA_FirExtendedArray(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t pDst[], SLData_t pState[], const SLData_t pCoeffs[],
@@ -932,24 +1057,43 @@ void SIGLIB_FUNC_DECL SDA_FirExtendedArray(const SLData_t* SIGLIB_PTR_DECL pSrc,
 
   SLArrayIndex_t localFilterIndex = *pFilterIndex;
 
-  for (SLArrayIndex_t k = 0; k < sampleLength; k++) {
-    SLArrayIndex_t j = filterLength - localFilterIndex - 1;    // Initialize local state array offset
+  for (SLArrayIndex_t k = 0; k < sampleLength;) {
+    SLArrayIndex_t j = filterLength - localFilterIndex - 1;    // State array offset of the first sample in the block
 
-    pState[j] = *pSrc;    // Save input data in state array
-    pState[j + filterLength] = *pSrc++;
+    SLArrayIndex_t blockLength = sampleLength - k;    // Limit the block to the samples before the filter index wraps
+    if (blockLength > (j + 1)) {
+      blockLength = j + 1;
+    }
+    if (blockLength > SIGLIB_FIR_BLOCK_LENGTH) {
+      blockLength = SIGLIB_FIR_BLOCK_LENGTH;
+    }
 
-    SLData_t sum = SIGLIB_ZERO;    // Pre-initialise sum
+    for (SLArrayIndex_t m = 0; m < blockLength; m++) {    // Save input data in lower half of the state array
+      pState[j - m] = pSrc[k + m];
+    }
 
-    for (SLArrayIndex_t i = 0; i < filterLength; i++, j++) {
-      sum += pCoeffs[i] * pState[j];    // Convolve data
+    if (blockLength == SIGLIB_FIR_BLOCK_LENGTH) {
+      siglib_numerix_FirExtendedArrayBlock(pState + j - (SIGLIB_FIR_BLOCK_LENGTH - 1), pCoeffs, pDst + k, filterLength);
+    } else {
+      for (SLArrayIndex_t m = 0; m < blockLength; m++) {
+        const SLData_t* pBlockState = pState + j - m;
+        SLData_t sum = SIGLIB_ZERO;    // Pre-initialise sum
+        for (SLArrayIndex_t i = 0; i < filterLength; i++) {
+          sum += pCoeffs[i] * pBlockState[i];    // Convolve data
+        }
+        pDst[k + m] = sum;
+      }
     }
 
-    localFilterIndex++;    // Update and manage local filter index
+    for (SLArrayIndex_t m = 0; m < blockLength; m++) {    // Copy input data to upper half of the state array
+      pState[j - m + filterLength] = pState[j - m];
+    }
+
+    localFilterIndex += blockLength;    // Update and manage local filter index
     if (localFilterIndex == filterLength) {
       localFilterIndex = 0;
     }
-
-    *pDst++ = sum;
+    k += blockLength;
   }
 
   *pFilterIndex = localFilterIndex;    // Store index for next iteration
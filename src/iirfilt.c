@@ -133,6 +133,8 @@ void SIGLIB_FUNC_DECL SDA_Iir(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SI
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_IIR);
+
   for (SLArrayIndex_t j = 0; j < sampleLength; j++) {
     SLData_t TempInputData = *pSrc++;
 
@@ -151,6 +153,7 @@ void SIGLIB_FUNC_DECL SDA_Iir(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SI
     pCoeffs -= (SIGLIB_IIR_COEFFS_PER_BIQUAD * numberOfBiquads);
     *pDst++ = TempInputData;
   }
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_IIR);
 }    // End of SDA_Iir()
 
 /********************************************************
@@ -246,6 +249,181 @@ void SIGLIB_FUNC_DECL SDA_IirMac(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t*
   }
 }    // End of SDA_IirMac()
 
+/********************************************************
+ * Function: SIF_IirMultiChannel
+ *
+ * Parameters:
+ *  SLData_t *pState,                   - Pointer to filter state array
+ *  SLData_t *pMultiChannelCoeffs,      - Pointer to multi-channel coefficients array
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients arrays
+ *  const SLArrayIndex_t numberOfBiquads,
+ *  const SLArrayIndex_t numberOfChannels
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Initialise the multi-channel IIR filter function.
+ *  The source coefficients are numberOfChannels SDA_Iir
+ *  coefficient arrays, one after another, which are
+ *  reordered to structure of arrays format:
+ *  [biquad][coefficient][channel].
+ *  The state array is of length
+ *  (numberOfBiquads x SIGLIB_IIR_DELAY_SIZE x
+ *  numberOfChannels) and the multi-channel coefficients
+ *  array is of length (numberOfBiquads x
+ *  SIGLIB_IIR_COEFFS_PER_BIQUAD x numberOfChannels).
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SIF_IirMultiChannel(SLData_t* SIGLIB_PTR_DECL pState, SLData_t* SIGLIB_PTR_DECL pMultiChannelCoeffs,
+                                          const SLData_t* SIGLIB_PTR_DECL pCoeffs, const SLArrayIndex_t numberOfBiquads,
+                                          const SLArrayIndex_t numberOfChannels)
+{
+  for (SLArrayIndex_t c = 0; c < numberOfChannels; c++) {
+    for (SLArrayIndex_t i = 0; i < numberOfBiquads; i++) {
+      for (SLArrayIndex_t k = 0; k < SIGLIB_IIR_COEFFS_PER_BIQUAD; k++) {
+        pMultiChannelCoeffs[(((i * SIGLIB_IIR_COEFFS_PER_BIQUAD) + k) * numberOfChannels) + c] =
+          pCoeffs[(((c * numberOfBiquads) + i) * SIGLIB_IIR_COEFFS_PER_BIQUAD) + k];
+      }
+    }
+  }
+
+  for (SLArrayIndex_t i = 0; i < (numberOfBiquads * SIGLIB_IIR_DELAY_SIZE * numberOfChannels); i++) {    // Initialise the filter state array to 0
+    pState[i] = SIGLIB_ZERO;
+  }
+}    // End of SIF_IirMultiChannel()
+
+/********************************************************
+ * Function: siglib_numerix_IirMultiChannelBiquad
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to interleaved source array
+ *  SLData_t *pDst,                     - Pointer to interleaved destination array
+ *  SLData_t *pState,                   - Pointer to biquad state
+ *  const SLData_t *pCoeffs,            - Pointer to biquad coefficients
+ *  const SLArrayIndex_t numberOfChannels,
+ *  const SLArrayIndex_t sampleLength   - Number of samples per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply one direct form II biquad to each channel of
+ *  the interleaved data array. Two vectors of channels
+ *  are filtered together, so that there are two
+ *  independent dependency chains, and the coefficients
+ *  and state are kept in registers for the whole array.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_IirMultiChannelBiquad(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst,
+                                                                          SLData_t* SIGLIB_PTR_DECL pState,
+                                                                          const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                                                          const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t sampleLength)
+{
+  const SLData_t* pB0 = pCoeffs;
+  const SLData_t* pB1 = pB0 + numberOfChannels;
+  const SLData_t* pB2 = pB1 + numberOfChannels;
+  const SLData_t* pA1 = pB2 + numberOfChannels;
+  const SLData_t* pA2 = pA1 + numberOfChannels;
+  SLData_t* pS0 = pState;
+  SLData_t* pS1 = pS0 + numberOfChannels;
+  SLArrayIndex_t c = 0;
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  for (; c <= (numberOfChannels - (2 * SIGLIB_VECTOR_LENGTH)); c += (2 * SIGLIB_VECTOR_LENGTH)) {
+    SLDataVector_t B0a, B1a, B2a, A1a, A2a, S0a, S1a, B0b, B1b, B2b, A1b, A2b, S0b, S1b;
+    SDV_Load(B0a, pB0 + c);
+    SDV_Load(B1a, pB1 + c);
+    SDV_Load(B2a, pB2 + c);
+    SDV_Load(A1a, pA1 + c);
+    SDV_Load(A2a, pA2 + c);
+    SDV_Load(S0a, pS0 + c);
+    SDV_Load(S1a, pS1 + c);
+    SDV_Load(B0b, pB0 + c + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(B1b, pB1 + c + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(B2b, pB2 + c + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(A1b, pA1 + c + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(A2b, pA2 + c + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(S0b, pS0 + c + SIGLIB_VECTOR_LENGTH);
+    SDV_Load(S1b, pS1 + c + SIGLIB_VECTOR_LENGTH);
+
+    for (SLArrayIndex_t n = 0; n < sampleLength; n++) {
+      SLDataVector_t Xa, Xb;
+      SDV_Load(Xa, pSrc + (n * numberOfChannels) + c);
+      SDV_Load(Xb, pSrc + (n * numberOfChannels) + c + SIGLIB_VECTOR_LENGTH);
+      SLDataVector_t Wa = Xa - (A1a * S0a) - (A2a * S1a);    // Feedback
+      SLDataVector_t Wb = Xb - (A1b * S0b) - (A2b * S1b);
+      SLDataVector_t Ya = (B0a * Wa) + (B1a * S0a) + (B2a * S1a);    // Feedforward
+      SLDataVector_t Yb = (B0b * Wb) + (B1b * S0b) + (B2b * S1b);
+      SDV_Store(pDst + (n * numberOfChannels) + c, Ya);
+      SDV_Store(pDst + (n * numberOfChannels) + c + SIGLIB_VECTOR_LENGTH, Yb);
+      S1a = S0a;    // Move delayed samples
+      S0a = Wa;
+      S1b = S0b;
+      S0b = Wb;
+    }
+
+    SDV_Store(pS0 + c, S0a);
+    SDV_Store(pS1 + c, S1a);
+    SDV_Store(pS0 + c + SIGLIB_VECTOR_LENGTH, S0b);
+    SDV_Store(pS1 + c + SIGLIB_VECTOR_LENGTH, S1b);
+  }
+#endif
+
+  if (c < numberOfChannels) {    // Remaining channels
+    for (SLArrayIndex_t n = 0; n < sampleLength; n++) {
+      for (SLArrayIndex_t k = c; k < numberOfChannels; k++) {
+        SLData_t feedbackSumOfProducts = pSrc[(n * numberOfChannels) + k] - (pA1[k] * pS0[k]) - (pA2[k] * pS1[k]);    // Feedback
+        pDst[(n * numberOfChannels) + k] = (pB0[k] * feedbackSumOfProducts) + (pB1[k] * pS0[k]) + (pB2[k] * pS1[k]);    // Feedforward
+        pS1[k] = pS0[k];    // Move delayed samples
+        pS0[k] = feedbackSumOfProducts;
+      }
+    }
+  }
+}    // End of siglib_numerix_IirMultiChannelBiquad()
+
+/********************************************************
+ * Function: SDA_IirMultiChannel
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to interleaved source array
+ *  SLData_t *pDst,                     - Pointer to interleaved destination array
+ *  SLData_t *pState,                   - Pointer to filter state array
+ *  const SLData_t *pMultiChannelCoeffs,    - Pointer to multi-channel coefficients array
+ *  const SLArrayIndex_t numberOfBiquads,
+ *  const SLArrayIndex_t numberOfChannels,
+ *  const SLArrayIndex_t sampleLength   - Number of samples per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply cascaded direct form II IIR filters to each
+ *  channel of the interleaved data array, with the same
+ *  results as calling SDA_Iir for each channel.
+ *  Each SIMD lane filters one channel so the serial
+ *  dependency between consecutive samples is spread over
+ *  the channels, rather than limiting the throughput of
+ *  a single channel. The cascade is applied one biquad at
+ *  a time across the whole array.
+ *  The source and destination arrays can be the same.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_IirMultiChannel(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, SLData_t* SIGLIB_PTR_DECL pState,
+                                          const SLData_t* SIGLIB_PTR_DECL pMultiChannelCoeffs, const SLArrayIndex_t numberOfBiquads,
+                                          const SLArrayIndex_t numberOfChannels, const SLArrayIndex_t sampleLength)
+{
+  for (SLArrayIndex_t i = 0; i < numberOfBiquads; i++) {
+    const SLData_t* pBiquadSrc = (i == 0) ? pSrc : pDst;    // The first biquad reads the source, the rest filter in-place
+    siglib_numerix_IirMultiChannelBiquad(pBiquadSrc, pDst, pState + (i * SIGLIB_IIR_DELAY_SIZE * numberOfChannels),
+                                         pMultiChannelCoeffs + (i * SIGLIB_IIR_COEFFS_PER_BIQUAD * numberOfChannels), numberOfChannels,
+                                         sampleLength);
+  }
+}    // End of SDA_IirMultiChannel()
+
 /********************************************************
 * Function: SIF_IirOrderN
 *
@@ -1065,6 +1065,1189 @@ SLNeuralNetworkPrediction_s SIGLIB_FUNC_DECL SDA_TwoLayerNCategoryWithBiasesNetw
   return (prediction);    // Category encoding: 0 to N-1
 }    // End of SDA_TwoLayerNCategoryWithBiasesNetworkPredict()
 
+/********************************************************
+ * Function: siglib_numerix_ActivationArray
+ *
+ * Parameters:
+ *  const SLData_t *                - Pointer to source array
+ *  SLData_t *                      - Pointer to destination array
+ *  const enum SLActivationType_t   - Activation type
+ *  const SLData_t                  - Activation alpha
+ *  const SLArrayIndex_t            - Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply the selected activation function to an array.
+ *
+ ********************************************************/
+
+static void siglib_numerix_ActivationArray(const SLData_t* pSrc, SLData_t* pDst, const enum SLActivationType_t activationType,
+                                           const SLData_t activationAlpha, const SLArrayIndex_t arrayLength)
+{
+  switch (activationType) {    // Choose required activation function
+  case SIGLIB_ACTIVATION_TYPE_LEAKY_RELU:
+    SDA_ActivationLeakyReLU(pSrc, activationAlpha, pDst, arrayLength);
+    break;
+  case SIGLIB_ACTIVATION_TYPE_LOGISTIC:
+    SDA_ActivationLogistic(pSrc, pDst, arrayLength);
+    break;
+  case SIGLIB_ACTIVATION_TYPE_TANH:
+    SDA_ActivationTanH(pSrc, pDst, arrayLength);
+    break;
+  case SIGLIB_ACTIVATION_TYPE_RELU:
+  default:
+    SDA_ActivationReLU(pSrc, pDst, arrayLength);
+    break;
+  }
+}    // End of siglib_numerix_ActivationArray()
+
+/********************************************************
+ * Function: siglib_numerix_ActivationDerivativeArray
+ *
+ * Parameters:
+ *  const SLData_t *                - Pointer to source array
+ *  SLData_t *                      - Pointer to destination array
+ *  const enum SLActivationType_t   - Activation type
+ *  const SLData_t                  - Activation alpha
+ *  const SLArrayIndex_t            - Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Apply the derivative of the selected activation
+ *  function to an array.
+ *
+ ********************************************************/
+
+static void siglib_numerix_ActivationDerivativeArray(const SLData_t* pSrc, SLData_t* pDst, const enum SLActivationType_t activationType,
+                                                     const SLData_t activationAlpha, const SLArrayIndex_t arrayLength)
+{
+  switch (activationType) {    // Choose required activation derivative function
+  case SIGLIB_ACTIVATION_TYPE_LEAKY_RELU:
+    SDA_ActivationLeakyReLUDerivative(pSrc, activationAlpha, pDst, arrayLength);
+    break;
+  case SIGLIB_ACTIVATION_TYPE_LOGISTIC:
+    SDA_ActivationLogisticDerivative(pSrc, pDst, arrayLength);
+    break;
+  case SIGLIB_ACTIVATION_TYPE_TANH:
+    SDA_ActivationTanHDerivative(pSrc, pDst, arrayLength);
+    break;
+  case SIGLIB_ACTIVATION_TYPE_RELU:
+  default:
+    SDA_ActivationReLUDerivative(pSrc, pDst, arrayLength);
+    break;
+  }
+}    // End of siglib_numerix_ActivationDerivativeArray()
+
+typedef struct {    // Mini-batch training state, shared by the shards
+  const SLData_t* pTrainingData;
+  const SLArrayIndex_t* pCategoricalValues;
+  const SLData_t* pLayer1Biases;
+  const SLData_t* pLayer2Weights;
+  const SLData_t* pLayer2Biases;
+  const SLData_t* pLayer1WeightsTransposed;
+  const SLData_t* pLayer2WeightsTransposed;
+  SLData_t* pWorkspace;
+  enum SLActivationType_t Layer1ActivationType;
+  SLData_t Layer1ActivationAlpha;
+  enum SLActivationType_t Layer2ActivationType;
+  SLData_t Layer2ActivationAlpha;
+  SLArrayIndex_t NumberOfInputNodes;
+  SLArrayIndex_t NumberOfLayer1Nodes;
+  SLArrayIndex_t NumberOfCategories;
+  SLArrayIndex_t BatchStart;
+  SLArrayIndex_t BatchLength;
+  SLArrayIndex_t ShardLength;
+  SLArrayIndex_t ShardWorkspaceLength;
+} siglib_numerix_NetworkFitBatchContext_s;
+
+/********************************************************
+ * Function: siglib_numerix_NetworkFitBatchShard
+ *
+ * Parameters:
+ *  void *                  - Pointer to training context
+ *  const SLArrayIndex_t    - Shard index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Forward and back propagate one shard of a mini-batch
+ *  and calculate the weight and bias gradients for the
+ *  shard, summed over the training sequences.
+ *
+ * Notes:
+ *  The workspace for each shard holds, in order :
+ *   Layer 1 weight gradients [layer 1 nodes][input nodes]
+ *   Layer 2 weight gradients [categories][layer 1 nodes]
+ *   Layer 1 bias gradients [layer 1 nodes]
+ *   Layer 2 bias gradients [categories]
+ *   Layer 1 pre / post activation and error
+ *    [shard length][layer 1 nodes]
+ *   Layer 2 pre / post activation and error
+ *    [shard length][categories]
+ *   Transposed error [max(layer 1 nodes, categories)]
+ *    [shard length]
+ *
+ ********************************************************/
+
+static void siglib_numerix_NetworkFitBatchShard(void* pContext, const SLArrayIndex_t shardIndex)
+{
+  const siglib_numerix_NetworkFitBatchContext_s* pCtx = (const siglib_numerix_NetworkFitBatchContext_s*)pContext;
+  const SLArrayIndex_t I = pCtx->NumberOfInputNodes;
+  const SLArrayIndex_t H = pCtx->NumberOfLayer1Nodes;
+  const SLArrayIndex_t C = pCtx->NumberOfCategories;
+
+  const SLArrayIndex_t FirstSequence = shardIndex * pCtx->ShardLength;
+  const SLArrayIndex_t Rows =
+      ((pCtx->BatchLength - FirstSequence) < pCtx->ShardLength) ? (pCtx->BatchLength - FirstSequence) : pCtx->ShardLength;
+  const SLData_t* pData = pCtx->pTrainingData + ((pCtx->BatchStart + FirstSequence) * I);
+  const SLArrayIndex_t* pCategories = pCtx->pCategoricalValues + pCtx->BatchStart + FirstSequence;
+
+  SLData_t* pLayer1Gradients = pCtx->pWorkspace + (shardIndex * pCtx->ShardWorkspaceLength);
+  SLData_t* pLayer2Gradients = pLayer1Gradients + (H * I);
+  SLData_t* pLayer1BiasGradients = pLayer2Gradients + (C * H);
+  SLData_t* pLayer2BiasGradients = pLayer1BiasGradients + H;
+  SLData_t* pLayer1PreActivation = pLayer2BiasGradients + C;
+  SLData_t* pLayer1PostActivation = pLayer1PreActivation + (pCtx->ShardLength * H);
+  SLData_t* pLayer1Error = pLayer1PostActivation + (pCtx->ShardLength * H);
+  SLData_t* pLayer2PreActivation = pLayer1Error + (pCtx->ShardLength * H);
+  SLData_t* pLayer2PostActivation = pLayer2PreActivation + (pCtx->ShardLength * C);
+  SLData_t* pLayer2Error = pLayer2PostActivation + (pCtx->ShardLength * C);
+  SLData_t* pErrorTransposed = pLayer2Error + (pCtx->ShardLength * C);
+
+  // Forward propagation
+  SMX_Multiply2(pData, pCtx->pLayer1WeightsTransposed, pLayer1PreActivation, Rows, I, H);
+  if (SIGLIB_NULL_DATA_PTR != pCtx->pLayer1Biases) {
+    for (SLArrayIndex_t i = 0; i < Rows; i++) {
+      SDA_Add2(pLayer1PreActivation + (i * H), pCtx->pLayer1Biases, pLayer1PreActivation + (i * H), H);
+    }
+  }
+  siglib_numerix_ActivationArray(pLayer1PreActivation, pLayer1PostActivation, pCtx->Layer1ActivationType, pCtx->Layer1ActivationAlpha, Rows * H);
+
+  SMX_Multiply2(pLayer1PostActivation, pCtx->pLayer2WeightsTransposed, pLayer2PreActivation, Rows, H, C);
+  if (SIGLIB_NULL_DATA_PTR != pCtx->pLayer2Biases) {
+    for (SLArrayIndex_t i = 0; i < Rows; i++) {
+      SDA_Add2(pLayer2PreActivation + (i * C), pCtx->pLayer2Biases, pLayer2PreActivation + (i * C), C);
+    }
+  }
+  siglib_numerix_ActivationArray(pLayer2PreActivation, pLayer2PostActivation, pCtx->Layer2ActivationType, pCtx->Layer2ActivationAlpha, Rows * C);
+
+  // Backward propagation
+  for (SLArrayIndex_t i = 0; i < Rows; i++) {
+    if (C == 1) {    // Single output node - the target is the category value
+      pLayer2Error[i] = (SLData_t)pCategories[i] - pLayer2PostActivation[i];
+    } else {    // One output node per category
+      for (SLArrayIndex_t j = 0; j < C; j++) {
+        pLayer2Error[(i * C) + j] = ((j == pCategories[i]) ? SIGLIB_ONE : SIGLIB_ZERO) - pLayer2PostActivation[(i * C) + j];
+      }
+    }
+  }
+  siglib_numerix_ActivationDerivativeArray(pLayer2PreActivation, pLayer2PreActivation, pCtx->Layer2ActivationType, pCtx->Layer2ActivationAlpha,
+                                           Rows * C);
+  SDA_Multiply2(pLayer2Error, pLayer2PreActivation, pLayer2Error, Rows * C);
+
+  SMX_Multiply2(pLayer2Error, pCtx->pLayer2Weights, pLayer1Error, Rows, C, H);    // Back propagate the error through the layer 2 weights
+  siglib_numerix_ActivationDerivativeArray(pLayer1PreActivation, pLayer1PreActivation, pCtx->Layer1ActivationType, pCtx->Layer1ActivationAlpha,
+                                           Rows * H);
+  SDA_Multiply2(pLayer1Error, pLayer1PreActivation, pLayer1Error, Rows * H);
+
+  // Gradients, summed over the sequences in the shard
+  SMX_Transpose(pLayer2Error, pErrorTransposed, Rows, C);
+  SMX_Multiply2(pErrorTransposed, pLayer1PostActivation, pLayer2Gradients, C, Rows, H);
+  for (SLArrayIndex_t j = 0; j < C; j++) {
+    pLayer2BiasGradients[j] = SDA_Sum(pErrorTransposed + (j * Rows), Rows);
+  }
+
+  SMX_Transpose(pLayer1Error, pErrorTransposed, Rows, H);
+  SMX_Multiply2(pErrorTransposed, pData, pLayer1Gradients, H, Rows, I);
+  for (SLArrayIndex_t j = 0; j < H; j++) {
+    pLayer1BiasGradients[j] = SDA_Sum(pErrorTransposed + (j * Rows), Rows);
+  }
+}    // End of siglib_numerix_NetworkFitBatchShard()
+
+/********************************************************
+ * Function: SDA_TwoLayerNetworkFitBatch
+ *
+ * Parameters:
+ *  const SLData_t *,               - pTrainingData
+ *  const SLArrayIndex_t *,         - pCategoricalValues
+ *  SLData_t *,                     - pLayer1Weights
+ *  SLData_t *,                     - pLayer1Biases
+ *  SLData_t *,                     - pLayer2Weights
+ *  SLData_t *,                     - pLayer2Biases
+ *  const enum SLActivationType_t   - layer1ActivationType
+ *  const SLData_t,                 - layer1ActivationAlpha
+ *  const enum SLActivationType_t   - layer2ActivationType
+ *  const SLData_t,                 - layer2ActivationAlpha
+ *  const SLData_t,                 - learningRate
+ *  const SLArrayIndex_t,           - numberOfTrainingSequences
+ *  const SLArrayIndex_t,           - numberOfInputNodes
+ *  const SLArrayIndex_t,           - numberOfLayer1Nodes
+ *  const SLArrayIndex_t,           - numberOfCategories
+ *  const SLArrayIndex_t,           - batchSize
+ *  const SLArrayIndex_t)           - numberOfShards
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Fit the two layer model to the data, using mini-batch
+ *  gradient descent.
+ *
+ * Notes:
+ *  The network, weight and bias layouts are the same as
+ *  for the single sequence functions. When the number of
+ *  categories is 1 the network has a single output node
+ *  that is trained towards the category value (0 or 1),
+ *  as in SDA_TwoLayer2CategoryNetworkFit, otherwise there
+ *  is one output node per category, as in
+ *  SDA_TwoLayerNCategoryNetworkFit.
+ *  If the bias pointers are SIGLIB_NULL_DATA_PTR then the
+ *  network does not use biases.
+ *
+ *  For each batch, the layer pre-activations are
+ *  calculated as matrix products with SMX_Multiply2 and
+ *  the activations and their derivatives are applied to
+ *  whole arrays. The weights are updated once per batch,
+ *  with the gradients averaged over the batch, so the
+ *  learning rate can be kept the same as the single
+ *  sequence functions when the batch size is changed.
+ *
+ *  Each batch is split into numberOfShards shards that are
+ *  processed through SUF_ParallelFor, each shard
+ *  calculating its own gradients, which are then summed.
+ *  With one shard, the matrix products are parallelized
+ *  internally instead. With more than one shard, the
+ *  SUF_ParallelFor calls inside the shards run serially on
+ *  the thread of each shard.
+ *
+ *  The workspace is allocated on each call.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SDA_TwoLayerNetworkFitBatch(const SLData_t* pTrainingData, const SLArrayIndex_t* pCategoricalValues,
+                                                       SLData_t* pLayer1Weights, SLData_t* pLayer1Biases, SLData_t* pLayer2Weights,
+                                                       SLData_t* pLayer2Biases, const enum SLActivationType_t layer1ActivationType,
+                                                       const SLData_t layer1ActivationAlpha, const enum SLActivationType_t layer2ActivationType,
+                                                       const SLData_t layer2ActivationAlpha, const SLData_t learningRate,
+                                                       const SLArrayIndex_t numberOfTrainingSequences, const SLArrayIndex_t numberOfInputNodes,
+                                                       const SLArrayIndex_t numberOfLayer1Nodes, const SLArrayIndex_t numberOfCategories,
+                                                       const SLArrayIndex_t batchSize, const SLArrayIndex_t numberOfShards)
+{
+  if ((batchSize < 1) || (numberOfShards < 1) || (numberOfInputNodes < 1) || (numberOfLayer1Nodes < 1) || (numberOfCategories < 1)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  const SLArrayIndex_t I = numberOfInputNodes;
+  const SLArrayIndex_t H = numberOfLayer1Nodes;
+  const SLArrayIndex_t C = numberOfCategories;
+  const SLArrayIndex_t ShardLength = (batchSize + numberOfShards - 1) / numberOfShards;
+  const SLArrayIndex_t ShardWorkspaceLength = (H * I) + (C * H) + H + C + (3 * ShardLength * H) + (3 * ShardLength * C) +
+                                              (((H > C) ? H : C) * ShardLength);
+
+  SLData_t* pLayer1WeightsTransposed = (SLData_t*)SUF_MemoryAllocate((size_t)((H * I) + (C * H)) * sizeof(SLData_t));
+  SLData_t* pWorkspace = (SLData_t*)SUF_MemoryAllocate((size_t)numberOfShards * (size_t)ShardWorkspaceLength * sizeof(SLData_t));
+  if ((SIGLIB_NULL_DATA_PTR == pLayer1WeightsTransposed) || (SIGLIB_NULL_DATA_PTR == pWorkspace)) {
+    SUF_MemoryFree(pLayer1WeightsTransposed);
+    SUF_MemoryFree(pWorkspace);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  SLData_t* pLayer2WeightsTransposed = pLayer1WeightsTransposed + (H * I);
+
+  siglib_numerix_NetworkFitBatchContext_s Ctx;
+  Ctx.pTrainingData = pTrainingData;
+  Ctx.pCategoricalValues = pCategoricalValues;
+  Ctx.pLayer1Biases = pLayer1Biases;
+  Ctx.pLayer2Weights = pLayer2Weights;
+  Ctx.pLayer2Biases = pLayer2Biases;
+  Ctx.pLayer1WeightsTransposed = pLayer1WeightsTransposed;
+  Ctx.pLayer2WeightsTransposed = pLayer2WeightsTransposed;
+  Ctx.pWorkspace = pWorkspace;
+  Ctx.Layer1ActivationType = layer1ActivationType;
+  Ctx.Layer1ActivationAlpha = layer1ActivationAlpha;
+  Ctx.Layer2ActivationType = layer2ActivationType;
+  Ctx.Layer2ActivationAlpha = layer2ActivationAlpha;
+  Ctx.NumberOfInputNodes = I;
+  Ctx.NumberOfLayer1Nodes = H;
+  Ctx.NumberOfCategories = C;
+  Ctx.ShardLength = ShardLength;
+  Ctx.ShardWorkspaceLength = ShardWorkspaceLength;
+
+  for (SLArrayIndex_t batchStart = 0; batchStart < numberOfTrainingSequences; batchStart += batchSize) {
+    Ctx.BatchStart = batchStart;
+    Ctx.BatchLength = ((numberOfTrainingSequences - batchStart) < batchSize) ? (numberOfTrainingSequences - batchStart) : batchSize;
+
+    SMX_Transpose(pLayer1Weights, pLayer1WeightsTransposed, H, I);    // Weights in [input][output] order for the forward products
+    SMX_Transpose(pLayer2Weights, pLayer2WeightsTransposed, C, H);
+
+    const SLArrayIndex_t NumberOfActiveShards = (Ctx.BatchLength + ShardLength - 1) / ShardLength;
+    SUF_ParallelFor(siglib_numerix_NetworkFitBatchShard, &Ctx, NumberOfActiveShards);
+
+    for (SLArrayIndex_t i = 1; i < NumberOfActiveShards; i++) {    // Sum the gradients from all of the shards
+      SDA_Add2(pWorkspace, pWorkspace + (i * ShardWorkspaceLength), pWorkspace, (H * I) + (C * H) + H + C);
+    }
+
+    const SLData_t Step = learningRate / (SLData_t)Ctx.BatchLength;
+    SDA_WeightedSum(pWorkspace, pLayer1Weights, pLayer1Weights, Step, H * I);
+    SDA_WeightedSum(pWorkspace + (H * I), pLayer2Weights, pLayer2Weights, Step, C * H);
+    if (SIGLIB_NULL_DATA_PTR != pLayer1Biases) {
+      SDA_WeightedSum(pWorkspace + (H * I) + (C * H), pLayer1Biases, pLayer1Biases, Step, H);
+    }
+    if (SIGLIB_NULL_DATA_PTR != pLayer2Biases) {
+      SDA_WeightedSum(pWorkspace + (H * I) + (C * H) + H, pLayer2Biases, pLayer2Biases, Step, C);
+    }
+  }
+
+  SUF_MemoryFree(pLayer1WeightsTransposed);
+  SUF_MemoryFree(pWorkspace);
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SDA_TwoLayerNetworkFitBatch()
+
+/********************************************************
+ * Function: siglib_numerix_NetworkPredictions
+ *
+ * Parameters:
+ *  const SLData_t *                - Pointer to output layer activations
+ *  SLNeuralNetworkPrediction_s *   - Pointer to predictions
+ *  const SLData_t                  - Classification threshold
+ *  const SLArrayIndex_t            - Number of categories
+ *  const SLArrayIndex_t            - Number of sequences
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Convert the output layer activations to predictions.
+ *  A single output node is compared with the
+ *  classification threshold, otherwise the category
+ *  with the largest activation is selected.
+ *
+ ********************************************************/
+
+static void siglib_numerix_NetworkPredictions(const SLData_t* pLayer2PostActivation, SLNeuralNetworkPrediction_s* pPredictions,
+                                              const SLData_t classificationThreshold, const SLArrayIndex_t numberOfCategories,
+                                              const SLArrayIndex_t numberOfSequences)
+{
+  for (SLArrayIndex_t i = 0; i < numberOfSequences; i++) {
+    const SLData_t* pOutputs = pLayer2PostActivation + (i * numberOfCategories);
+    if (numberOfCategories == 1) {
+      pPredictions[i].predictedCategory = (*pOutputs > classificationThreshold) ? SIGLIB_AI_ONE : SIGLIB_AI_ZERO;
+      pPredictions[i].probability = *pOutputs;
+    } else {
+      pPredictions[i].predictedCategory = SDA_MaxIndex(pOutputs, numberOfCategories);
+      pPredictions[i].probability = pOutputs[pPredictions[i].predictedCategory];
+    }
+  }
+}    // End of siglib_numerix_NetworkPredictions()
+
+/********************************************************
+ * Function: SDA_TwoLayerNetworkPredictBatch
+ *
+ * Parameters:
+ *  const SLData_t *,               - pData
+ *  const SLData_t *,               - pLayer1Weights
+ *  const SLData_t *,               - pLayer1Biases
+ *  const SLData_t *,               - pLayer2Weights
+ *  const SLData_t *,               - pLayer2Biases
+ *  SLData_t *,                     - pLayer1PostActivation
+ *  SLData_t *,                     - pLayer2PostActivation
+ *  SLNeuralNetworkPrediction_s *,  - pPredictions
+ *  const enum SLActivationType_t   - layer1ActivationType
+ *  const SLData_t,                 - layer1ActivationAlpha
+ *  const enum SLActivationType_t   - layer2ActivationType
+ *  const SLData_t,                 - layer2ActivationAlpha
+ *  const SLData_t,                 - classificationThreshold
+ *  const SLArrayIndex_t,           - numberOfInputNodes
+ *  const SLArrayIndex_t,           - numberOfLayer1Nodes
+ *  const SLArrayIndex_t,           - numberOfCategories
+ *  const SLArrayIndex_t)           - numberOfSequences
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Use the model to predict the categories of a batch of
+ *  data sequences.
+ *
+ * Notes:
+ *  The network, weight and bias layouts are the same as
+ *  for SDA_TwoLayerNetworkFitBatch. If the number of
+ *  categories is 1, the output is compared with the
+ *  classification threshold, as in
+ *  SDA_TwoLayer2CategoryNetworkPredict, otherwise the
+ *  threshold is not used.
+ *  The activation arrays hold the activations for all of
+ *  the sequences : [sequences][layer 1 nodes] and
+ *  [sequences][categories].
+ *  The layer pre-activations are calculated for all of the
+ *  sequences with SMX_Multiply2Transposed.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_TwoLayerNetworkPredictBatch(const SLData_t* pData, const SLData_t* pLayer1Weights, const SLData_t* pLayer1Biases,
+                                                      const SLData_t* pLayer2Weights, const SLData_t* pLayer2Biases,
+                                                      SLData_t* pLayer1PostActivation, SLData_t* pLayer2PostActivation,
+                                                      SLNeuralNetworkPrediction_s* pPredictions,
+                                                      const enum SLActivationType_t layer1ActivationType, const SLData_t layer1ActivationAlpha,
+                                                      const enum SLActivationType_t layer2ActivationType, const SLData_t layer2ActivationAlpha,
+                                                      const SLData_t classificationThreshold, const SLArrayIndex_t numberOfInputNodes,
+                                                      const SLArrayIndex_t numberOfLayer1Nodes, const SLArrayIndex_t numberOfCategories,
+                                                      const SLArrayIndex_t numberOfSequences)
+{
+  const SLArrayIndex_t H = numberOfLayer1Nodes;
+  const SLArrayIndex_t C = numberOfCategories;
+
+  // First layer
+  SMX_Multiply2Transposed(pData, pLayer1Weights, pLayer1PostActivation, numberOfSequences, numberOfInputNodes, H);
+  if (SIGLIB_NULL_DATA_PTR != pLayer1Biases) {
+    for (SLArrayIndex_t i = 0; i < numberOfSequences; i++) {
+      SDA_Add2(pLayer1PostActivation + (i * H), pLayer1Biases, pLayer1PostActivation + (i * H), H);
+    }
+  }
+  siglib_numerix_ActivationArray(pLayer1PostActivation, pLayer1PostActivation, layer1ActivationType, layer1ActivationAlpha,
+                                 numberOfSequences * H);
+
+  // Second layer
+  SMX_Multiply2Transposed(pLayer1PostActivation, pLayer2Weights, pLayer2PostActivation, numberOfSequences, H, C);
+  if (SIGLIB_NULL_DATA_PTR != pLayer2Biases) {
+    for (SLArrayIndex_t i = 0; i < numberOfSequences; i++) {
+      SDA_Add2(pLayer2PostActivation + (i * C), pLayer2Biases, pLayer2PostActivation + (i * C), C);
+    }
+  }
+  siglib_numerix_ActivationArray(pLayer2PostActivation, pLayer2PostActivation, layer2ActivationType, layer2ActivationAlpha,
+                                 numberOfSequences * C);
+
+  siglib_numerix_NetworkPredictions(pLayer2PostActivation, pPredictions, classificationThreshold, C, numberOfSequences);
+}    // End of SDA_TwoLayerNetworkPredictBatch()
+
+#define SIGLIB_QUANTIZED_VECTOR_LENGTH 32    // Number of outputs calculated together in the quantized layers
+#define SIGLIB_QUANTIZED_MR 4                // Number of rows calculated together in the quantized layers
+#define SIGLIB_QUANTIZED_PANEL_LENGTH 48     // Number of sequences quantized and multiplied together
+#if (SIGLIB_VECTOR_EXTENSIONS == 1) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#  define SIGLIB_QUANTIZED_VECTORS 1
+typedef SLInt16_t siglib_numerix_Int16x16_t __attribute__((vector_size(32)));    // 8 bit layers
+typedef SLUInt16_t siglib_numerix_UInt16x16_t __attribute__((vector_size(32)));
+typedef SLInt32_t siglib_numerix_Int32x8_t __attribute__((vector_size(32)));
+typedef SLUInt32_t siglib_numerix_UInt32x8_t __attribute__((vector_size(32)));
+typedef SLInt32_t siglib_numerix_Int32x16_t __attribute__((vector_size(64)));    // 16 bit layers
+typedef SLUInt32_t siglib_numerix_UInt32x16_t __attribute__((vector_size(64)));
+typedef SLInt64_t siglib_numerix_Int64x8_t __attribute__((vector_size(64)));
+typedef SLUInt64_t siglib_numerix_UInt64x8_t __attribute__((vector_size(64)));
+#else
+#  define SIGLIB_QUANTIZED_VECTORS 0
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_QuantizedStride
+ *
+ * Parameters:
+ *  const SLArrayIndex_t    - Number of layer outputs
+ *
+ * Return value:
+ *  Row stride of the quantized weights
+ *
+ * Description:
+ *  The quantized weights are stored transposed, one row
+ *  per input, and each row is padded with zero weights to
+ *  a multiple of SIGLIB_QUANTIZED_VECTOR_LENGTH outputs.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_QuantizedStride(const SLArrayIndex_t numberOfOutputs)
+{
+  return (((numberOfOutputs + SIGLIB_QUANTIZED_VECTOR_LENGTH - 1) / SIGLIB_QUANTIZED_VECTOR_LENGTH) * SIGLIB_QUANTIZED_VECTOR_LENGTH);
+}    // End of siglib_numerix_QuantizedStride()
+
+/********************************************************
+ * Function: siglib_numerix_QuantizedLayerInt8
+ *
+ * Parameters:
+ *  const SLInt8_t *        - Pointer to quantized layer inputs, [rows][inputs]
+ *  const SLInt8_t *        - Pointer to transposed quantized weights
+ *  const SLData_t *        - Pointer to product quantization step of each row
+ *  const SLData_t *        - Pointer to biases (or NULL)
+ *  SLData_t *              - Pointer to pre-activations, [rows][outputs]
+ *  const SLArrayIndex_t    - Number of rows
+ *  const SLArrayIndex_t    - Number of inputs
+ *  const SLArrayIndex_t    - Number of outputs
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Calculate the pre-activations of a layer for a block
+ *  of rows with an 8 bit integer matrix multiply.
+ *
+ * Notes:
+ *  Each input is multiplied by a row of the transposed
+ *  weights, so a block of outputs is accumulated in the
+ *  vector lanes and no horizontal sums are required.
+ *  SIGLIB_QUANTIZED_MR rows are calculated together so
+ *  that each block of weights is loaded and sign extended
+ *  once for all of the rows.
+ *  The weights are sign extended to 16 bits with shifts,
+ *  which separates the even and odd outputs, and pairs of
+ *  products are added in 16 bits, 127 x 128 x 2 fits in
+ *  16 bits. The pairs are sign extended to 32 bits with
+ *  shifts again, so the four accumulators hold every
+ *  fourth output.
+ *
+ ********************************************************/
+
+static SIGLIB_FUNC_MULTIVERSION void siglib_numerix_QuantizedLayerInt8(const SLInt8_t* pInputs, const SLInt8_t* pWeights, const SLData_t* pSteps,
+                                                                       const SLData_t* pBiases, SLData_t* pDst, const SLArrayIndex_t numberOfRows,
+                                                                       const SLArrayIndex_t numberOfInputs, const SLArrayIndex_t numberOfOutputs)
+{
+  const SLArrayIndex_t Stride = siglib_numerix_QuantizedStride(numberOfOutputs);
+
+  for (SLArrayIndex_t r = 0; r < numberOfRows; r += SIGLIB_QUANTIZED_MR) {
+    const SLInt8_t* pX[SIGLIB_QUANTIZED_MR];
+    for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {    // A partial block repeats the last row
+      pX[k] = pInputs + ((((r + k) < numberOfRows) ? (r + k) : (numberOfRows - 1)) * numberOfInputs);
+    }
+
+    for (SLArrayIndex_t o = 0; o < numberOfOutputs; o += SIGLIB_QUANTIZED_VECTOR_LENGTH) {
+      SLInt32_t Sum[SIGLIB_QUANTIZED_MR][SIGLIB_QUANTIZED_VECTOR_LENGTH];
+      const SLInt8_t* pW = pWeights + o;
+#if (SIGLIB_QUANTIZED_VECTORS == 1)
+      siglib_numerix_Int32x8_t Acc[SIGLIB_QUANTIZED_MR][4] = {{{0}}};
+      siglib_numerix_Int16x16_t W0, W1 = {0};
+      for (SLArrayIndex_t i = 0; i < numberOfInputs; i += 2, pW += 2 * Stride) {
+        memcpy(&W0, pW, sizeof(W0));
+        if ((i + 1) < numberOfInputs) {
+          memcpy(&W1, pW + Stride, sizeof(W1));
+        }
+        const siglib_numerix_Int16x16_t W0Even = (siglib_numerix_Int16x16_t)((siglib_numerix_UInt16x16_t)W0 << 8) >> 8;
+        const siglib_numerix_Int16x16_t W1Even = (siglib_numerix_Int16x16_t)((siglib_numerix_UInt16x16_t)W1 << 8) >> 8;
+        const siglib_numerix_Int16x16_t W0Odd = W0 >> 8;
+        const siglib_numerix_Int16x16_t W1Odd = W1 >> 8;
+        for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+          const SLInt16_t X0 = pX[k][i];
+          const SLInt16_t X1 = ((i + 1) < numberOfInputs) ? pX[k][i + 1] : 0;
+          siglib_numerix_Int16x16_t Even = W0Even * X0 + W1Even * X1;
+          siglib_numerix_Int16x16_t Odd = W0Odd * X0 + W1Odd * X1;
+          Acc[k][0] += (siglib_numerix_Int32x8_t)((siglib_numerix_UInt32x8_t)Even << 16) >> 16;
+          Acc[k][1] += (siglib_numerix_Int32x8_t)((siglib_numerix_UInt32x8_t)Odd << 16) >> 16;
+          Acc[k][2] += (siglib_numerix_Int32x8_t)Even >> 16;
+          Acc[k][3] += (siglib_numerix_Int32x8_t)Odd >> 16;
+        }
+      }
+      for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+        for (SLArrayIndex_t j = 0; j < SIGLIB_QUANTIZED_VECTOR_LENGTH; j++) {
+          Sum[k][j] = Acc[k][j & 3][j >> 2];
+        }
+      }
+#else
+      for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+        for (SLArrayIndex_t j = 0; j < SIGLIB_QUANTIZED_VECTOR_LENGTH; j++) {
+          Sum[k][j] = 0;
+        }
+      }
+      for (SLArrayIndex_t i = 0; i < numberOfInputs; i++, pW += Stride) {
+        for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+          for (SLArrayIndex_t j = 0; j < SIGLIB_QUANTIZED_VECTOR_LENGTH; j++) {
+            Sum[k][j] += (SLInt32_t)pX[k][i] * (SLInt32_t)pW[j];
+          }
+        }
+      }
+#endif
+
+      for (SLArrayIndex_t k = 0; (k < SIGLIB_QUANTIZED_MR) && ((r + k) < numberOfRows); k++) {
+        SLData_t* pD = pDst + ((r + k) * numberOfOutputs);
+        for (SLArrayIndex_t j = 0; (j < SIGLIB_QUANTIZED_VECTOR_LENGTH) && ((o + j) < numberOfOutputs); j++) {
+          pD[o + j] = ((SLData_t)Sum[k][j] * pSteps[r + k]) + ((SIGLIB_NULL_DATA_PTR != pBiases) ? pBiases[o + j] : SIGLIB_ZERO);
+        }
+      }
+    }
+  }
+}    // End of siglib_numerix_QuantizedLayerInt8()
+
+/********************************************************
+ * Function: siglib_numerix_QuantizedLayerInt16
+ *
+ * Parameters:
+ *  const SLInt16_t *       - Pointer to quantized layer inputs, [rows][inputs]
+ *  const SLInt16_t *       - Pointer to transposed quantized weights
+ *  const SLData_t *        - Pointer to product quantization step of each row
+ *  const SLData_t *        - Pointer to biases (or NULL)
+ *  SLData_t *              - Pointer to pre-activations, [rows][outputs]
+ *  const SLArrayIndex_t    - Number of rows
+ *  const SLArrayIndex_t    - Number of inputs
+ *  const SLArrayIndex_t    - Number of outputs
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Calculate the pre-activations of a layer for a block
+ *  of rows with a 16 bit integer matrix multiply.
+ *
+ * Notes:
+ *  The same as siglib_numerix_QuantizedLayerInt8, with
+ *  the pairs of products added in 32 bits, 32767 x 32767
+ *  x 2 fits in 32 bits, and accumulated in 64 bits.
+ *
+ ********************************************************/
+
+static SIGLIB_FUNC_MULTIVERSION void siglib_numerix_QuantizedLayerInt16(const SLInt16_t* pInputs, const SLInt16_t* pWeights, const SLData_t* pSteps,
+                                                                        const SLData_t* pBiases, SLData_t* pDst, const SLArrayIndex_t numberOfRows,
+                                                                        const SLArrayIndex_t numberOfInputs, const SLArrayIndex_t numberOfOutputs)
+{
+  const SLArrayIndex_t Stride = siglib_numerix_QuantizedStride(numberOfOutputs);
+
+  for (SLArrayIndex_t r = 0; r < numberOfRows; r += SIGLIB_QUANTIZED_MR) {
+    const SLInt16_t* pX[SIGLIB_QUANTIZED_MR];
+    for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {    // A partial block repeats the last row
+      pX[k] = pInputs + ((((r + k) < numberOfRows) ? (r + k) : (numberOfRows - 1)) * numberOfInputs);
+    }
+
+    for (SLArrayIndex_t o = 0; o < numberOfOutputs; o += SIGLIB_QUANTIZED_VECTOR_LENGTH) {
+      SLInt64_t Sum[SIGLIB_QUANTIZED_MR][SIGLIB_QUANTIZED_VECTOR_LENGTH];
+      const SLInt16_t* pW = pWeights + o;
+#if (SIGLIB_QUANTIZED_VECTORS == 1)
+      siglib_numerix_Int64x8_t Acc[SIGLIB_QUANTIZED_MR][4] = {{{0}}};
+      siglib_numerix_Int32x16_t W0, W1 = {0};
+      for (SLArrayIndex_t i = 0; i < numberOfInputs; i += 2, pW += 2 * Stride) {
+        memcpy(&W0, pW, sizeof(W0));
+        if ((i + 1) < numberOfInputs) {
+          memcpy(&W1, pW + Stride, sizeof(W1));
+        }
+        const siglib_numerix_Int32x16_t W0Even = (siglib_numerix_Int32x16_t)((siglib_numerix_UInt32x16_t)W0 << 16) >> 16;
+        const siglib_numerix_Int32x16_t W1Even = (siglib_numerix_Int32x16_t)((siglib_numerix_UInt32x16_t)W1 << 16) >> 16;
+        const siglib_numerix_Int32x16_t W0Odd = W0 >> 16;
+        const siglib_numerix_Int32x16_t W1Odd = W1 >> 16;
+        for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+          const SLInt32_t X0 = pX[k][i];
+          const SLInt32_t X1 = ((i + 1) < numberOfInputs) ? pX[k][i + 1] : 0;
+          siglib_numerix_Int32x16_t Even = W0Even * X0 + W1Even * X1;
+          siglib_numerix_Int32x16_t Odd = W0Odd * X0 + W1Odd * X1;
+          Acc[k][0] += (siglib_numerix_Int64x8_t)((siglib_numerix_UInt64x8_t)Even << 32) >> 32;
+          Acc[k][1] += (siglib_numerix_Int64x8_t)((siglib_numerix_UInt64x8_t)Odd << 32) >> 32;
+          Acc[k][2] += (siglib_numerix_Int64x8_t)Even >> 32;
+          Acc[k][3] += (siglib_numerix_Int64x8_t)Odd >> 32;
+        }
+      }
+      for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+        for (SLArrayIndex_t j = 0; j < SIGLIB_QUANTIZED_VECTOR_LENGTH; j++) {
+          Sum[k][j] = Acc[k][j & 3][j >> 2];
+        }
+      }
+#else
+      for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+        for (SLArrayIndex_t j = 0; j < SIGLIB_QUANTIZED_VECTOR_LENGTH; j++) {
+          Sum[k][j] = 0;
+        }
+      }
+      for (SLArrayIndex_t i = 0; i < numberOfInputs; i++, pW += Stride) {
+        for (SLArrayIndex_t k = 0; k < SIGLIB_QUANTIZED_MR; k++) {
+          for (SLArrayIndex_t j = 0; j < SIGLIB_QUANTIZED_VECTOR_LENGTH; j++) {
+            Sum[k][j] += (SLInt64_t)((SLInt32_t)pX[k][i] * (SLInt32_t)pW[j]);
+          }
+        }
+      }
+#endif
+
+      for (SLArrayIndex_t k = 0; (k < SIGLIB_QUANTIZED_MR) && ((r + k) < numberOfRows); k++) {
+        SLData_t* pD = pDst + ((r + k) * numberOfOutputs);
+        for (SLArrayIndex_t j = 0; (j < SIGLIB_QUANTIZED_VECTOR_LENGTH) && ((o + j) < numberOfOutputs); j++) {
+          pD[o + j] = ((SLData_t)Sum[k][j] * pSteps[r + k]) + ((SIGLIB_NULL_DATA_PTR != pBiases) ? pBiases[o + j] : SIGLIB_ZERO);
+        }
+      }
+    }
+  }
+}    // End of siglib_numerix_QuantizedLayerInt16()
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+typedef __typeof__((SLDataVector_t){0} > (SLDataVector_t){0}) siglib_numerix_DataMask_t;    // Result of a vector comparison
+
+/********************************************************
+ * Function: siglib_numerix_AbsMaxVector
+ *
+ * Parameters:
+ *  const SLData_t *        - Pointer to source vector
+ *  SLDataVector_t *        - Pointer to absolute maxima
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Branchless absolute maximum, comparing the vectors as
+ *  masks and clearing the sign bits.
+ *
+ ********************************************************/
+
+static inline void siglib_numerix_AbsMaxVector(const SLData_t* pSrc, SLDataVector_t* pMax)
+{
+  const siglib_numerix_DataMask_t SignBits = (siglib_numerix_DataMask_t)(-(SLDataVector_t){0});    // -0.0 has only the sign bit set
+  SLDataVector_t V;
+  SDV_Load(V, pSrc);
+  V = (SLDataVector_t)((siglib_numerix_DataMask_t)V & ~SignBits);
+  const siglib_numerix_DataMask_t Greater = V > *pMax;
+  *pMax = (SLDataVector_t)((Greater & (siglib_numerix_DataMask_t)V) | (~Greater & (siglib_numerix_DataMask_t)*pMax));
+}    // End of siglib_numerix_AbsMaxVector()
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_Quantize
+ *
+ * Parameters:
+ *  const SLData_t *        - Pointer to source array
+ *  void *                  - Pointer to SLInt8_t or SLInt16_t destination array
+ *  const SLArrayIndex_t    - Number of bits (8 or 16)
+ *  const SLArrayIndex_t    - Array length
+ *
+ * Return value:
+ *  Value of one quantization step
+ *
+ * Description:
+ *  Quantize an array, scaling the largest absolute value
+ *  to the largest positive integer value and rounding to
+ *  the nearest integer.
+ *
+ ********************************************************/
+
+static SIGLIB_FUNC_MULTIVERSION SLData_t siglib_numerix_Quantize(const SLData_t* pSrc, void* pDst, const SLArrayIndex_t numberOfBits,
+                                                                 const SLArrayIndex_t arrayLength)
+{
+  const SLData_t IntegerMax = (numberOfBits == 8) ? (SLData_t)SIGLIB_INT8_MAX : (SLData_t)SIGLIB_INT16_MAX;
+  SLData_t AbsMax = SIGLIB_ZERO;
+  SLArrayIndex_t i = 0;
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  SLDataVector_t Max0 = {0}, Max1 = {0}, Max2 = {0}, Max3 = {0};    // Independent maxima, to break the dependency chain
+  for (; i <= (arrayLength - (4 * SIGLIB_VECTOR_LENGTH)); i += 4 * SIGLIB_VECTOR_LENGTH) {
+    siglib_numerix_AbsMaxVector(pSrc + i, &Max0);
+    siglib_numerix_AbsMaxVector(pSrc + i + SIGLIB_VECTOR_LENGTH, &Max1);
+    siglib_numerix_AbsMaxVector(pSrc + i + (2 * SIGLIB_VECTOR_LENGTH), &Max2);
+    siglib_numerix_AbsMaxVector(pSrc + i + (3 * SIGLIB_VECTOR_LENGTH), &Max3);
+  }
+  for (SLArrayIndex_t j = 0; j < SIGLIB_VECTOR_LENGTH; j++) {
+    AbsMax = (Max0[j] > AbsMax) ? Max0[j] : AbsMax;
+    AbsMax = (Max1[j] > AbsMax) ? Max1[j] : AbsMax;
+    AbsMax = (Max2[j] > AbsMax) ? Max2[j] : AbsMax;
+    AbsMax = (Max3[j] > AbsMax) ? Max3[j] : AbsMax;
+  }
+#endif
+  for (; i < arrayLength; i++) {
+    AbsMax = (SDS_Abs(pSrc[i]) > AbsMax) ? SDS_Abs(pSrc[i]) : AbsMax;
+  }
+  if (AbsMax == SIGLIB_ZERO) {    // Avoid divide by zero, all of the values quantize to 0
+    AbsMax = SIGLIB_ONE;
+  }
+  const SLData_t Scale = IntegerMax / AbsMax;
+
+  // Branchless round to nearest, by adding 0.5 with the sign of the value and truncating
+  i = 0;
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  typedef SLInt32_t Int32Vector_t __attribute__((vector_size(SIGLIB_VECTOR_LENGTH * sizeof(SLInt32_t))));
+  typedef SLInt8_t Int8Vector_t __attribute__((vector_size(SIGLIB_VECTOR_LENGTH * sizeof(SLInt8_t))));
+  typedef SLInt16_t Int16Vector_t __attribute__((vector_size(SIGLIB_VECTOR_LENGTH * sizeof(SLInt16_t))));
+  const siglib_numerix_DataMask_t SignBits = (siglib_numerix_DataMask_t)(-(SLDataVector_t){0});
+  const siglib_numerix_DataMask_t Half = (siglib_numerix_DataMask_t)((SLDataVector_t){0} + SIGLIB_HALF);
+  for (; i <= (arrayLength - SIGLIB_VECTOR_LENGTH); i += SIGLIB_VECTOR_LENGTH) {
+    SLDataVector_t V;
+    SDV_Load(V, pSrc + i);
+    V *= Scale;
+    V += (SLDataVector_t)(((siglib_numerix_DataMask_t)V & SignBits) | Half);
+    const Int32Vector_t Rounded = __builtin_convertvector(V, Int32Vector_t);
+    if (numberOfBits == 8) {
+      const Int8Vector_t Quantized = __builtin_convertvector(Rounded, Int8Vector_t);
+      memcpy((SLInt8_t*)pDst + i, &Quantized, sizeof(Quantized));
+    } else {
+      const Int16Vector_t Quantized = __builtin_convertvector(Rounded, Int16Vector_t);
+      memcpy((SLInt16_t*)pDst + i, &Quantized, sizeof(Quantized));
+    }
+  }
+#endif
+  if (numberOfBits == 8) {
+    SLInt8_t* pQuantized = (SLInt8_t*)pDst;
+    for (; i < arrayLength; i++) {
+      SLData_t Scaled = pSrc[i] * Scale;
+      pQuantized[i] = (SLInt8_t)(SLInt32_t)(Scaled + (SLData_t)copysign((double)SIGLIB_HALF, (double)Scaled));
+    }
+  } else {
+    SLInt16_t* pQuantized = (SLInt16_t*)pDst;
+    for (; i < arrayLength; i++) {
+      SLData_t Scaled = pSrc[i] * Scale;
+      pQuantized[i] = (SLInt16_t)(SLInt32_t)(Scaled + (SLData_t)copysign((double)SIGLIB_HALF, (double)Scaled));
+    }
+  }
+  return (AbsMax / IntegerMax);
+}    // End of siglib_numerix_Quantize()
+
+/********************************************************
+ * Function: siglib_numerix_QuantizedWeightsTranspose
+ *
+ * Parameters:
+ *  const void *            - Pointer to source weights, [outputs][inputs]
+ *  void *                  - Pointer to destination weights
+ *  const SLArrayIndex_t    - Number of bits (8 or 16)
+ *  const SLArrayIndex_t    - Number of inputs
+ *  const SLArrayIndex_t    - Number of outputs
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Transpose quantized weights into the padded layout used
+ *  by the quantized layers.
+ *
+ ********************************************************/
+
+static void siglib_numerix_QuantizedWeightsTranspose(const void* pSrc, void* pDst, const SLArrayIndex_t numberOfBits,
+                                                     const SLArrayIndex_t numberOfInputs, const SLArrayIndex_t numberOfOutputs)
+{
+  const SLArrayIndex_t Stride = siglib_numerix_QuantizedStride(numberOfOutputs);
+
+  if (numberOfBits == 8) {
+    memset(pDst, 0, (size_t)numberOfInputs * (size_t)Stride * sizeof(SLInt8_t));
+    for (SLArrayIndex_t o = 0; o < numberOfOutputs; o++) {
+      for (SLArrayIndex_t i = 0; i < numberOfInputs; i++) {
+        ((SLInt8_t*)pDst)[(i * Stride) + o] = ((const SLInt8_t*)pSrc)[(o * numberOfInputs) + i];
+      }
+    }
+  } else {
+    memset(pDst, 0, (size_t)numberOfInputs * (size_t)Stride * sizeof(SLInt16_t));
+    for (SLArrayIndex_t o = 0; o < numberOfOutputs; o++) {
+      for (SLArrayIndex_t i = 0; i < numberOfInputs; i++) {
+        ((SLInt16_t*)pDst)[(i * Stride) + o] = ((const SLInt16_t*)pSrc)[(o * numberOfInputs) + i];
+      }
+    }
+  }
+}    // End of siglib_numerix_QuantizedWeightsTranspose()
+
+/********************************************************
+ * Function: siglib_numerix_TwoLayerNetworkQuantizedAllocate
+ *
+ * Parameters:
+ *  SLTwoLayerNetworkQuantized_s *  - Pointer to network
+ *  const SLData_t *                - Pointer to layer 1 biases
+ *  const SLData_t *                - Pointer to layer 2 biases
+ *  const SLArrayIndex_t            - Number of weight bits
+ *  const SLArrayIndex_t            - Number of input nodes
+ *  const SLArrayIndex_t            - Number of layer 1 nodes
+ *  const SLArrayIndex_t            - Number of categories
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Allocate the arrays for a quantized network and copy
+ *  the biases.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_TwoLayerNetworkQuantizedAllocate(SLTwoLayerNetworkQuantized_s* pNetwork, const SLData_t* pLayer1Biases,
+                                                                 const SLData_t* pLayer2Biases, const SLArrayIndex_t weightBits,
+                                                                 const SLArrayIndex_t numberOfInputNodes, const SLArrayIndex_t numberOfLayer1Nodes,
+                                                                 const SLArrayIndex_t numberOfCategories)
+{
+  pNetwork->pLayer1Weights = NULL;
+  pNetwork->pLayer2Weights = NULL;
+  pNetwork->pLayer1Biases = SIGLIB_NULL_DATA_PTR;
+  pNetwork->pLayer2Biases = SIGLIB_NULL_DATA_PTR;
+  pNetwork->pQuantizedActivations = NULL;
+  pNetwork->pActivations = SIGLIB_NULL_DATA_PTR;
+  pNetwork->pQuantizationSteps = SIGLIB_NULL_DATA_PTR;
+
+  if (((weightBits != 8) && (weightBits != 16)) || (numberOfInputNodes < 1) || (numberOfLayer1Nodes < 1) || (numberOfCategories < 1)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  const size_t WordSize = (weightBits == 8) ? sizeof(SLInt8_t) : sizeof(SLInt16_t);
+  pNetwork->WeightBits = weightBits;
+  pNetwork->NumberOfInputNodes = numberOfInputNodes;
+  pNetwork->NumberOfLayer1Nodes = numberOfLayer1Nodes;
+  pNetwork->NumberOfCategories = numberOfCategories;
+
+  const size_t Layer1Size = (size_t)numberOfInputNodes * (size_t)siglib_numerix_QuantizedStride(numberOfLayer1Nodes);
+  const size_t Layer2Size = (size_t)numberOfLayer1Nodes * (size_t)siglib_numerix_QuantizedStride(numberOfCategories);
+  pNetwork->pLayer1Weights = SUF_MemoryAllocate(Layer1Size * WordSize);
+  pNetwork->pLayer2Weights = SUF_MemoryAllocate(Layer2Size * WordSize);
+  const size_t LayerInputs = (size_t)((numberOfInputNodes > numberOfLayer1Nodes) ? numberOfInputNodes : numberOfLayer1Nodes);
+  pNetwork->pQuantizedActivations = SUF_MemoryAllocate((size_t)SIGLIB_QUANTIZED_PANEL_LENGTH * LayerInputs * WordSize);
+  pNetwork->pActivations =
+      (SLData_t*)SUF_MemoryAllocate((size_t)SIGLIB_QUANTIZED_PANEL_LENGTH * (size_t)(numberOfLayer1Nodes + numberOfCategories) * sizeof(SLData_t));
+  pNetwork->pQuantizationSteps = (SLData_t*)SUF_MemoryAllocate((size_t)SIGLIB_QUANTIZED_PANEL_LENGTH * sizeof(SLData_t));
+  if (SIGLIB_NULL_DATA_PTR != pLayer1Biases) {
+    pNetwork->pLayer1Biases = (SLData_t*)SUF_MemoryAllocate((size_t)numberOfLayer1Nodes * sizeof(SLData_t));
+  }
+  if (SIGLIB_NULL_DATA_PTR != pLayer2Biases) {
+    pNetwork->pLayer2Biases = (SLData_t*)SUF_MemoryAllocate((size_t)numberOfCategories * sizeof(SLData_t));
+  }
+
+  if ((NULL == pNetwork->pLayer1Weights) || (NULL == pNetwork->pLayer2Weights) || (NULL == pNetwork->pQuantizedActivations) ||
+      (SIGLIB_NULL_DATA_PTR == pNetwork->pActivations) || (SIGLIB_NULL_DATA_PTR == pNetwork->pQuantizationSteps) ||
+      ((SIGLIB_NULL_DATA_PTR != pLayer1Biases) && (SIGLIB_NULL_DATA_PTR == pNetwork->pLayer1Biases)) ||
+      ((SIGLIB_NULL_DATA_PTR != pLayer2Biases) && (SIGLIB_NULL_DATA_PTR == pNetwork->pLayer2Biases))) {
+    SUF_TwoLayerNetworkQuantizedFree(pNetwork);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  if (SIGLIB_NULL_DATA_PTR != pLayer1Biases) {
+    SDA_Copy(pLayer1Biases, pNetwork->pLayer1Biases, numberOfLayer1Nodes);
+  }
+  if (SIGLIB_NULL_DATA_PTR != pLayer2Biases) {
+    SDA_Copy(pLayer2Biases, pNetwork->pLayer2Biases, numberOfCategories);
+  }
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_TwoLayerNetworkQuantizedAllocate()
+
+/********************************************************
+ * Function: SIF_TwoLayerNetworkQuantize
+ *
+ * Parameters:
+ *  SLTwoLayerNetworkQuantized_s *  - pNetwork
+ *  const SLData_t *,               - pLayer1Weights
+ *  const SLData_t *,               - pLayer1Biases
+ *  const SLData_t *,               - pLayer2Weights
+ *  const SLData_t *,               - pLayer2Biases
+ *  const SLArrayIndex_t,           - weightBits
+ *  const SLArrayIndex_t,           - numberOfInputNodes
+ *  const SLArrayIndex_t,           - numberOfLayer1Nodes
+ *  const SLArrayIndex_t)           - numberOfCategories
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Initialise a quantized network from trained floating
+ *  point weights.
+ *
+ * Notes:
+ *  The weights are quantized to 8 or 16 bits, with one
+ *  scale per layer, so that the largest absolute weight
+ *  in each layer maps to the largest integer value.
+ *  The biases are kept in floating point. If the bias
+ *  pointers are SIGLIB_NULL_DATA_PTR then the network
+ *  does not use biases.
+ *  The arrays are allocated by this function and must be
+ *  released with SUF_TwoLayerNetworkQuantizedFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_TwoLayerNetworkQuantize(SLTwoLayerNetworkQuantized_s* pNetwork, const SLData_t* pLayer1Weights,
+                                                       const SLData_t* pLayer1Biases, const SLData_t* pLayer2Weights, const SLData_t* pLayer2Biases,
+                                                       const SLArrayIndex_t weightBits, const SLArrayIndex_t numberOfInputNodes,
+                                                       const SLArrayIndex_t numberOfLayer1Nodes, const SLArrayIndex_t numberOfCategories)
+{
+  SLError_t ErrorCode = siglib_numerix_TwoLayerNetworkQuantizedAllocate(pNetwork, pLayer1Biases, pLayer2Biases, weightBits, numberOfInputNodes,
+                                                                        numberOfLayer1Nodes, numberOfCategories);
+  if (ErrorCode != SIGLIB_NO_ERROR) {
+    return (ErrorCode);
+  }
+
+  // Quantize the weights in their original layout and then transpose them
+  const size_t WordSize = (weightBits == 8) ? sizeof(SLInt8_t) : sizeof(SLInt16_t);
+  const SLArrayIndex_t LargestLayer = ((numberOfCategories > numberOfInputNodes) ? numberOfCategories : numberOfInputNodes) * numberOfLayer1Nodes;
+  void* pQuantized = SUF_MemoryAllocate((size_t)LargestLayer * WordSize);
+  if (NULL == pQuantized) {
+    SUF_TwoLayerNetworkQuantizedFree(pNetwork);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  pNetwork->Layer1WeightScale = siglib_numerix_Quantize(pLayer1Weights, pQuantized, weightBits, numberOfLayer1Nodes * numberOfInputNodes);
+  siglib_numerix_QuantizedWeightsTranspose(pQuantized, pNetwork->pLayer1Weights, weightBits, numberOfInputNodes, numberOfLayer1Nodes);
+  pNetwork->Layer2WeightScale = siglib_numerix_Quantize(pLayer2Weights, pQuantized, weightBits, numberOfCategories * numberOfLayer1Nodes);
+  siglib_numerix_QuantizedWeightsTranspose(pQuantized, pNetwork->pLayer2Weights, weightBits, numberOfLayer1Nodes, numberOfCategories);
+
+  SUF_MemoryFree(pQuantized);
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_TwoLayerNetworkQuantize()
+
+/********************************************************
+ * Function: SIF_TwoLayerNetworkQuantizedInt8
+ *
+ * Parameters:
+ *  SLTwoLayerNetworkQuantized_s *  - pNetwork
+ *  const SLInt8_t *,               - pLayer1Weights
+ *  const SLData_t,                 - layer1WeightsAbsMax
+ *  const SLData_t *,               - pLayer1Biases
+ *  const SLInt8_t *,               - pLayer2Weights
+ *  const SLData_t,                 - layer2WeightsAbsMax
+ *  const SLData_t *,               - pLayer2Biases
+ *  const SLArrayIndex_t,           - numberOfInputNodes
+ *  const SLArrayIndex_t,           - numberOfLayer1Nodes
+ *  const SLArrayIndex_t)           - numberOfCategories
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Initialise a quantized network from 8 bit weights, as
+ *  written by SUF_WriteWeightsIntegerCFile.
+ *
+ * Notes:
+ *  The absolute maximum values are the
+ *  LAYER_1_WEIGHTS_ABS_MAX and LAYER_2_WEIGHTS_ABS_MAX
+ *  values in the weights file, which are the weight
+ *  values of SIGLIB_INT8_MAX.
+ *  The biases are in floating point. If the bias pointers
+ *  are SIGLIB_NULL_DATA_PTR then the network does not use
+ *  biases.
+ *  The arrays are allocated by this function and must be
+ *  released with SUF_TwoLayerNetworkQuantizedFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_TwoLayerNetworkQuantizedInt8(SLTwoLayerNetworkQuantized_s* pNetwork, const SLInt8_t* pLayer1Weights,
+                                                            const SLData_t layer1WeightsAbsMax, const SLData_t* pLayer1Biases,
+                                                            const SLInt8_t* pLayer2Weights, const SLData_t layer2WeightsAbsMax,
+                                                            const SLData_t* pLayer2Biases, const SLArrayIndex_t numberOfInputNodes,
+                                                            const SLArrayIndex_t numberOfLayer1Nodes, const SLArrayIndex_t numberOfCategories)
+{
+  SLError_t ErrorCode = siglib_numerix_TwoLayerNetworkQuantizedAllocate(pNetwork, pLayer1Biases, pLayer2Biases, 8, numberOfInputNodes,
+                                                                        numberOfLayer1Nodes, numberOfCategories);
+  if (ErrorCode != SIGLIB_NO_ERROR) {
+    return (ErrorCode);
+  }
+
+  siglib_numerix_QuantizedWeightsTranspose(pLayer1Weights, pNetwork->pLayer1Weights, 8, numberOfInputNodes, numberOfLayer1Nodes);
+  siglib_numerix_QuantizedWeightsTranspose(pLayer2Weights, pNetwork->pLayer2Weights, 8, numberOfLayer1Nodes, numberOfCategories);
+  pNetwork->Layer1WeightScale = layer1WeightsAbsMax / (SLData_t)SIGLIB_INT8_MAX;
+  pNetwork->Layer2WeightScale = layer2WeightsAbsMax / (SLData_t)SIGLIB_INT8_MAX;
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_TwoLayerNetworkQuantizedInt8()
+
+/********************************************************
+ * Function: SDA_TwoLayerNetworkPredictQuantizedBatch
+ *
+ * Parameters:
+ *  const SLData_t *,               - pData
+ *  SLTwoLayerNetworkQuantized_s *  - pNetwork
+ *  SLNeuralNetworkPrediction_s *,  - pPredictions
+ *  const enum SLActivationType_t   - layer1ActivationType
+ *  const SLData_t,                 - layer1ActivationAlpha
+ *  const enum SLActivationType_t   - layer2ActivationType
+ *  const SLData_t,                 - layer2ActivationAlpha
+ *  const SLData_t,                 - classificationThreshold
+ *  const SLArrayIndex_t)           - numberOfSequences
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Use the quantized model to predict the categories of a
+ *  batch of data sequences.
+ *
+ * Notes:
+ *  The sequences are processed in panels of
+ *  SIGLIB_QUANTIZED_PANEL_LENGTH. The data sequences of a
+ *  panel, and then their layer 1 activations, are
+ *  quantized to the number of bits of the weights, with a
+ *  scale calculated for each sequence, and each layer is
+ *  calculated for the whole panel with one SIMD integer
+ *  matrix multiply, which uses each block of weights for
+ *  several sequences. 8 bit products are accumulated in
+ *  32 bits and 16 bit products in 64 bits, so the dot
+ *  products are exact.
+ *  The matrix multiplies and the quantization use SIMD
+ *  vector extensions, with the instruction set (SSE2 /
+ *  AVX2 / AVX-512) selected at run time. The quantized
+ *  networks reduce the size of the weights by 8 (8 bit)
+ *  or 4 (16 bit) but they are not faster than
+ *  SDA_TwoLayerNetworkPredictBatch.
+ *  If the number of categories is 1, the output is
+ *  compared with the classification threshold, otherwise
+ *  the threshold is not used.
+ *  The network holds the working arrays so it must not be
+ *  used by more than one thread at a time.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_TwoLayerNetworkPredictQuantizedBatch(const SLData_t* pData, SLTwoLayerNetworkQuantized_s* pNetwork,
+                                                               SLNeuralNetworkPrediction_s* pPredictions,
+                                                               const enum SLActivationType_t layer1ActivationType,
+                                                               const SLData_t layer1ActivationAlpha,
+                                                               const enum SLActivationType_t layer2ActivationType,
+                                                               const SLData_t layer2ActivationAlpha, const SLData_t classificationThreshold,
+                                                               const SLArrayIndex_t numberOfSequences)
+{
+  const SLArrayIndex_t I = pNetwork->NumberOfInputNodes;
+  const SLArrayIndex_t H = pNetwork->NumberOfLayer1Nodes;
+  const SLArrayIndex_t C = pNetwork->NumberOfCategories;
+  const SLArrayIndex_t WeightBits = pNetwork->WeightBits;
+  const size_t WordSize = (WeightBits == 8) ? sizeof(SLInt8_t) : sizeof(SLInt16_t);
+  SLData_t* pLayer1Activation = pNetwork->pActivations;
+  SLData_t* pLayer2Activation = pNetwork->pActivations + (SIGLIB_QUANTIZED_PANEL_LENGTH * H);
+  SLData_t* pSteps = pNetwork->pQuantizationSteps;
+
+  for (SLArrayIndex_t Panel = 0; Panel < numberOfSequences; Panel += SIGLIB_QUANTIZED_PANEL_LENGTH) {
+    const SLArrayIndex_t Rows =
+        ((numberOfSequences - Panel) < SIGLIB_QUANTIZED_PANEL_LENGTH) ? (numberOfSequences - Panel) : SIGLIB_QUANTIZED_PANEL_LENGTH;
+
+    // First layer
+    for (SLArrayIndex_t i = 0; i < Rows; i++) {
+      pSteps[i] = siglib_numerix_Quantize(pData + ((Panel + i) * I), (char*)pNetwork->pQuantizedActivations + ((size_t)(i * I) * WordSize),
+                                          WeightBits, I) *
+                  pNetwork->Layer1WeightScale;
+    }
+    if (WeightBits == 8) {
+      siglib_numerix_QuantizedLayerInt8((const SLInt8_t*)pNetwork->pQuantizedActivations, (const SLInt8_t*)pNetwork->pLayer1Weights, pSteps,
+                                        pNetwork->pLayer1Biases, pLayer1Activation, Rows, I, H);
+    } else {
+      siglib_numerix_QuantizedLayerInt16((const SLInt16_t*)pNetwork->pQuantizedActivations, (const SLInt16_t*)pNetwork->pLayer1Weights, pSteps,
+                                         pNetwork->pLayer1Biases, pLayer1Activation, Rows, I, H);
+    }
+    siglib_numerix_ActivationArray(pLayer1Activation, pLayer1Activation, layer1ActivationType, layer1ActivationAlpha, Rows * H);
+
+    // Second layer
+    for (SLArrayIndex_t i = 0; i < Rows; i++) {
+      pSteps[i] = siglib_numerix_Quantize(pLayer1Activation + (i * H), (char*)pNetwork->pQuantizedActivations + ((size_t)(i * H) * WordSize),
+                                          WeightBits, H) *
+                  pNetwork->Layer2WeightScale;
+    }
+    if (WeightBits == 8) {
+      siglib_numerix_QuantizedLayerInt8((const SLInt8_t*)pNetwork->pQuantizedActivations, (const SLInt8_t*)pNetwork->pLayer2Weights, pSteps,
+                                        pNetwork->pLayer2Biases, pLayer2Activation, Rows, H, C);
+    } else {
+      siglib_numerix_QuantizedLayerInt16((const SLInt16_t*)pNetwork->pQuantizedActivations, (const SLInt16_t*)pNetwork->pLayer2Weights, pSteps,
+                                         pNetwork->pLayer2Biases, pLayer2Activation, Rows, H, C);
+    }
+    siglib_numerix_ActivationArray(pLayer2Activation, pLayer2Activation, layer2ActivationType, layer2ActivationAlpha, Rows * C);
+
+    siglib_numerix_NetworkPredictions(pLayer2Activation, pPredictions + Panel, classificationThreshold, C, Rows);
+  }
+}    // End of SDA_TwoLayerNetworkPredictQuantizedBatch()
+
+/********************************************************
+ * Function: SUF_TwoLayerNetworkQuantizedFree
+ *
+ * Parameters:
+ *  SLTwoLayerNetworkQuantized_s *  - pNetwork
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the arrays allocated by SIF_TwoLayerNetworkQuantize
+ *  or SIF_TwoLayerNetworkQuantizedInt8.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_TwoLayerNetworkQuantizedFree(SLTwoLayerNetworkQuantized_s* pNetwork)
+{
+  SUF_MemoryFree(pNetwork->pLayer1Weights);
+  SUF_MemoryFree(pNetwork->pLayer2Weights);
+  SUF_MemoryFree(pNetwork->pLayer1Biases);
+  SUF_MemoryFree(pNetwork->pLayer2Biases);
+  SUF_MemoryFree(pNetwork->pQuantizedActivations);
+  SUF_MemoryFree(pNetwork->pActivations);
+  SUF_MemoryFree(pNetwork->pQuantizationSteps);
+  pNetwork->pLayer1Weights = NULL;
+  pNetwork->pLayer2Weights = NULL;
+  pNetwork->pLayer1Biases = SIGLIB_NULL_DATA_PTR;
+  pNetwork->pLayer2Biases = SIGLIB_NULL_DATA_PTR;
+  pNetwork->pQuantizedActivations = NULL;
+  pNetwork->pActivations = SIGLIB_NULL_DATA_PTR;
+  pNetwork->pQuantizationSteps = SIGLIB_NULL_DATA_PTR;
+}    // End of SUF_TwoLayerNetworkQuantizedFree()
+
 /********************************************************
  * Function: SDS_ActivationReLU
  *
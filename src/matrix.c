@@ -40,6 +40,17 @@ Description: Matrix manipulation routines, for SigLib DSP library.
 
 #include <siglib.h>    // Include SigLib header file
 
+#define SIGLIB_MATRIX_MULTIPLY_MR 6    // SMX_Multiply2 micro-kernel rows
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+#  define SIGLIB_MATRIX_MULTIPLY_NR (2 * SIGLIB_VECTOR_LENGTH)    // SMX_Multiply2 micro-kernel columns
+#else
+#  define SIGLIB_MATRIX_MULTIPLY_NR 4
+#endif
+#define SIGLIB_MATRIX_MULTIPLY_KC 256            // Depth of the packed matrix 2 blocks
+#define SIGLIB_MATRIX_MULTIPLY_ROW_PANEL 48      // Number of rows per parallel task
+#define SIGLIB_MATRIX_MULTIPLY_MIN_MACS 32768    // Smaller products use the direct triple loop
+#define SIGLIB_MATRIX_FACTORIZE_BLOCK 32         // Panel width of the blocked factorizations and solves
+
 /********************************************************
  * Function: SMX_Transpose
  *
@@ -153,6 +164,259 @@ void SIGLIB_FUNC_DECL SMX_Diagonal(const SLData_t* SIGLIB_PTR_DECL pSrcMatrix, S
   }
 }    // End of SMX_Diagonal()
 
+// Multiply-adds are not contracted to FMAs, from the micro-kernel to SMX_Multiply2, so the results do not
+// depend on the instruction set selected at run time and match the direct triple loop
+#if defined(__clang__)
+#  pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC optimize("fp-contract=off")
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_MatrixMultiplyKernel
+ *
+ * Parameters:
+ *  const SLData_t *pSrc1,              - Pointer to the first row of the matrix 1 block
+ *  const SLArrayIndex_t src1Stride,    - Matrix 1 row stride
+ *  const SLData_t *pPackedSrc2,        - Pointer to the packed matrix 2 block
+ *  SLData_t *pDst,                     - Pointer to the first row of the output block
+ *  const SLArrayIndex_t dstStride,     - Output matrix row stride
+ *  const SLArrayIndex_t rows,          - Number of rows, up to SIGLIB_MATRIX_MULTIPLY_MR
+ *  const SLArrayIndex_t columns,       - Number of columns, up to SIGLIB_MATRIX_MULTIPLY_NR
+ *  const SLArrayIndex_t depth,         - Number of multiply-accumulates per output
+ *  const SLArrayIndex_t accumulate     - Add the products to the output block
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Register tiled matrix multiply micro-kernel. The
+ *  (MR x NR) output tile is held in registers while the
+ *  matrix 1 rows and the packed matrix 2 block, of
+ *  SIGLIB_MATRIX_MULTIPLY_NR columns per row, are read
+ *  sequentially.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_MatrixMultiplyKernel(const SLData_t* SIGLIB_PTR_DECL pSrc1, const SLArrayIndex_t src1Stride,
+                                                                         const SLData_t* SIGLIB_PTR_DECL pPackedSrc2,
+                                                                         SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t dstStride,
+                                                                         const SLArrayIndex_t rows, const SLArrayIndex_t columns,
+                                                                         const SLArrayIndex_t depth, const SLArrayIndex_t accumulate)
+{
+  SLData_t Tile[SIGLIB_MATRIX_MULTIPLY_MR * SIGLIB_MATRIX_MULTIPLY_NR];
+  const SLData_t* pRow[SIGLIB_MATRIX_MULTIPLY_MR];
+
+  for (SLArrayIndex_t r = 0; r < SIGLIB_MATRIX_MULTIPLY_MR; r++) {
+    pRow[r] = pSrc1 + (((r < rows) ? r : 0) * src1Stride);    // Unused rows repeat the first row and are not stored
+    for (SLArrayIndex_t c = 0; c < SIGLIB_MATRIX_MULTIPLY_NR; c++) {
+      Tile[(r * SIGLIB_MATRIX_MULTIPLY_NR) + c] = (accumulate && (r < rows) && (c < columns)) ? pDst[(r * dstStride) + c] : SIGLIB_ZERO;
+    }
+  }
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1)
+  SLDataVector_t C00, C01, C10, C11, C20, C21, C30, C31, C40, C41, C50, C51;
+  SDV_Load(C00, Tile);
+  SDV_Load(C01, Tile + SIGLIB_VECTOR_LENGTH);
+  SDV_Load(C10, Tile + SIGLIB_MATRIX_MULTIPLY_NR);
+  SDV_Load(C11, Tile + SIGLIB_MATRIX_MULTIPLY_NR + SIGLIB_VECTOR_LENGTH);
+  SDV_Load(C20, Tile + (2 * SIGLIB_MATRIX_MULTIPLY_NR));
+  SDV_Load(C21, Tile + (2 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH);
+  SDV_Load(C30, Tile + (3 * SIGLIB_MATRIX_MULTIPLY_NR));
+  SDV_Load(C31, Tile + (3 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH);
+  SDV_Load(C40, Tile + (4 * SIGLIB_MATRIX_MULTIPLY_NR));
+  SDV_Load(C41, Tile + (4 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH);
+  SDV_Load(C50, Tile + (5 * SIGLIB_MATRIX_MULTIPLY_NR));
+  SDV_Load(C51, Tile + (5 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH);
+
+  for (SLArrayIndex_t k = 0; k < depth; k++) {
+    SLDataVector_t B0, B1;
+    SDV_Load(B0, pPackedSrc2 + (k * SIGLIB_MATRIX_MULTIPLY_NR));
+    SDV_Load(B1, pPackedSrc2 + (k * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH);
+    SLData_t A0 = pRow[0][k];
+    SLData_t A1 = pRow[1][k];
+    SLData_t A2 = pRow[2][k];
+    SLData_t A3 = pRow[3][k];
+    SLData_t A4 = pRow[4][k];
+    SLData_t A5 = pRow[5][k];
+    C00 += A0 * B0;
+    C01 += A0 * B1;
+    C10 += A1 * B0;
+    C11 += A1 * B1;
+    C20 += A2 * B0;
+    C21 += A2 * B1;
+    C30 += A3 * B0;
+    C31 += A3 * B1;
+    C40 += A4 * B0;
+    C41 += A4 * B1;
+    C50 += A5 * B0;
+    C51 += A5 * B1;
+  }
+
+  SDV_Store(Tile, C00);
+  SDV_Store(Tile + SIGLIB_VECTOR_LENGTH, C01);
+  SDV_Store(Tile + SIGLIB_MATRIX_MULTIPLY_NR, C10);
+  SDV_Store(Tile + SIGLIB_MATRIX_MULTIPLY_NR + SIGLIB_VECTOR_LENGTH, C11);
+  SDV_Store(Tile + (2 * SIGLIB_MATRIX_MULTIPLY_NR), C20);
+  SDV_Store(Tile + (2 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH, C21);
+  SDV_Store(Tile + (3 * SIGLIB_MATRIX_MULTIPLY_NR), C30);
+  SDV_Store(Tile + (3 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH, C31);
+  SDV_Store(Tile + (4 * SIGLIB_MATRIX_MULTIPLY_NR), C40);
+  SDV_Store(Tile + (4 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH, C41);
+  SDV_Store(Tile + (5 * SIGLIB_MATRIX_MULTIPLY_NR), C50);
+  SDV_Store(Tile + (5 * SIGLIB_MATRIX_MULTIPLY_NR) + SIGLIB_VECTOR_LENGTH, C51);
+#else
+  for (SLArrayIndex_t k = 0; k < depth; k++) {
+    for (SLArrayIndex_t r = 0; r < SIGLIB_MATRIX_MULTIPLY_MR; r++) {
+      SLData_t A = pRow[r][k];
+      for (SLArrayIndex_t c = 0; c < SIGLIB_MATRIX_MULTIPLY_NR; c++) {
+        Tile[(r * SIGLIB_MATRIX_MULTIPLY_NR) + c] += A * pPackedSrc2[(k * SIGLIB_MATRIX_MULTIPLY_NR) + c];
+      }
+    }
+  }
+#endif
+
+  for (SLArrayIndex_t r = 0; r < rows; r++) {
+    for (SLArrayIndex_t c = 0; c < columns; c++) {
+      pDst[(r * dstStride) + c] = Tile[(r * SIGLIB_MATRIX_MULTIPLY_NR) + c];
+    }
+  }
+}    // End of siglib_numerix_MatrixMultiplyKernel()
+
+typedef struct {
+  const SLData_t* pSrcMatrix1;
+  const SLData_t* pSrcMatrix2;
+  SLData_t* pDstMatrix;
+  SLArrayIndex_t Rows1;
+  SLArrayIndex_t Columns1;
+  SLArrayIndex_t Columns2;
+  SLArrayIndex_t Src1Stride;        // Row strides, for operating on sub-matrices
+  SLArrayIndex_t Src2Stride;
+  SLArrayIndex_t DstStride;
+  SLData_t Src2Scale;               // SIGLIB_MINUS_ONE to subtract the product from the destination
+  SLArrayIndex_t Accumulate;        // Add the product to the destination
+  SLArrayIndex_t Src2Transposed;    // Matrix 2 is stored transposed
+  SLArrayIndex_t LowerTriangle;     // Only the lower triangle of the destination is required
+} siglib_numerix_MatrixMultiplyContext_s;
+
+/********************************************************
+ * Function: siglib_numerix_MatrixMultiplyRowPanel
+ *
+ * Parameters:
+ *  void *pContext,                     - Pointer to the matrix multiply context
+ *  SLArrayIndex_t panelIndex           - Row panel index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Calculate SIGLIB_MATRIX_MULTIPLY_ROW_PANEL rows of the
+ *  output matrix. For each block of
+ *  SIGLIB_MATRIX_MULTIPLY_KC rows and
+ *  SIGLIB_MATRIX_MULTIPLY_NR columns of matrix 2, the
+ *  block is packed into a contiguous array and reused by
+ *  all of the rows in the panel.
+ *  The row panels are independent so they can be
+ *  calculated in parallel by SUF_ParallelFor.
+ *
+ ********************************************************/
+
+static void siglib_numerix_MatrixMultiplyRowPanel(void* pContext, SLArrayIndex_t panelIndex)
+{
+  const siglib_numerix_MatrixMultiplyContext_s* pMultiply = (const siglib_numerix_MatrixMultiplyContext_s*)pContext;
+  const SLArrayIndex_t Columns1 = pMultiply->Columns1;
+  const SLArrayIndex_t FirstRow = panelIndex * SIGLIB_MATRIX_MULTIPLY_ROW_PANEL;
+  const SLArrayIndex_t LastRow =
+    ((FirstRow + SIGLIB_MATRIX_MULTIPLY_ROW_PANEL) < pMultiply->Rows1) ? (FirstRow + SIGLIB_MATRIX_MULTIPLY_ROW_PANEL) : pMultiply->Rows1;
+  const SLArrayIndex_t Columns2 =
+    (pMultiply->LowerTriangle && (LastRow < pMultiply->Columns2)) ? LastRow : pMultiply->Columns2;    // Skip the blocks above the diagonal
+  SLData_t PackedSrc2[SIGLIB_MATRIX_MULTIPLY_KC * SIGLIB_MATRIX_MULTIPLY_NR];
+
+  for (SLArrayIndex_t j = 0; j < Columns2; j += SIGLIB_MATRIX_MULTIPLY_NR) {
+    SLArrayIndex_t BlockColumns = ((Columns2 - j) < SIGLIB_MATRIX_MULTIPLY_NR) ? (Columns2 - j) : SIGLIB_MATRIX_MULTIPLY_NR;
+
+    for (SLArrayIndex_t k = 0; k < Columns1; k += SIGLIB_MATRIX_MULTIPLY_KC) {
+      SLArrayIndex_t Depth = ((Columns1 - k) < SIGLIB_MATRIX_MULTIPLY_KC) ? (Columns1 - k) : SIGLIB_MATRIX_MULTIPLY_KC;
+
+      for (SLArrayIndex_t p = 0; p < Depth; p++) {    // Pack the matrix 2 block, zero padding the last columns
+        for (SLArrayIndex_t c = 0; c < SIGLIB_MATRIX_MULTIPLY_NR; c++) {
+          SLData_t Src2 = SIGLIB_ZERO;
+          if (c < BlockColumns) {
+            Src2 = pMultiply->Src2Transposed ? pMultiply->pSrcMatrix2[((j + c) * pMultiply->Src2Stride) + k + p]
+                                             : pMultiply->pSrcMatrix2[((k + p) * pMultiply->Src2Stride) + j + c];
+          }
+          PackedSrc2[(p * SIGLIB_MATRIX_MULTIPLY_NR) + c] = Src2 * pMultiply->Src2Scale;
+        }
+      }
+
+      for (SLArrayIndex_t i = FirstRow; i < LastRow; i += SIGLIB_MATRIX_MULTIPLY_MR) {
+        SLArrayIndex_t BlockRows = ((LastRow - i) < SIGLIB_MATRIX_MULTIPLY_MR) ? (LastRow - i) : SIGLIB_MATRIX_MULTIPLY_MR;
+        siglib_numerix_MatrixMultiplyKernel(pMultiply->pSrcMatrix1 + (i * pMultiply->Src1Stride) + k, pMultiply->Src1Stride, PackedSrc2,
+                                            pMultiply->pDstMatrix + (i * pMultiply->DstStride) + j, pMultiply->DstStride, BlockRows,
+                                            BlockColumns, Depth, pMultiply->Accumulate || (k != 0));
+      }
+    }
+  }
+}    // End of siglib_numerix_MatrixMultiplyRowPanel()
+
+/********************************************************
+ * Function: siglib_numerix_MatrixMultiplySubtract
+ *
+ * Parameters:
+ *  const SLData_t *pSrc1,              - Pointer to matrix 1
+ *  const SLArrayIndex_t src1Stride,    - Matrix 1 row stride
+ *  const SLData_t *pSrc2,              - Pointer to matrix 2
+ *  const SLArrayIndex_t src2Stride,    - Matrix 2 row stride
+ *  SLData_t *pDst,                     - Pointer to destination matrix
+ *  const SLArrayIndex_t dstStride,     - Destination matrix row stride
+ *  const SLArrayIndex_t rows1,         - Matrix 1 number of rows
+ *  const SLArrayIndex_t columns1,      - Matrix 1 number of columns
+ *  const SLArrayIndex_t columns2,      - Matrix 2 number of columns
+ *  const SLArrayIndex_t src2Transposed,    - Matrix 2 is stored transposed
+ *  const SLArrayIndex_t lowerTriangle  - Only update the lower triangle
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Subtract the product of two sub-matrices from the
+ *  destination sub-matrix, using the blocked matrix
+ *  multiply. This is the trailing matrix update of the
+ *  blocked factorizations and triangular solves.
+ *  With lowerTriangle set, blocks above the diagonal are
+ *  skipped, although the elements of the blocks that
+ *  straddle the diagonal are updated.
+ *
+ ********************************************************/
+
+static void siglib_numerix_MatrixMultiplySubtract(const SLData_t* pSrc1, const SLArrayIndex_t src1Stride, const SLData_t* pSrc2,
+                                                  const SLArrayIndex_t src2Stride, SLData_t* pDst, const SLArrayIndex_t dstStride,
+                                                  const SLArrayIndex_t rows1, const SLArrayIndex_t columns1, const SLArrayIndex_t columns2,
+                                                  const SLArrayIndex_t src2Transposed, const SLArrayIndex_t lowerTriangle)
+{
+  if ((rows1 < 1) || (columns1 < 1) || (columns2 < 1)) {
+    return;
+  }
+
+  siglib_numerix_MatrixMultiplyContext_s Multiply;
+  Multiply.pSrcMatrix1 = pSrc1;
+  Multiply.pSrcMatrix2 = pSrc2;
+  Multiply.pDstMatrix = pDst;
+  Multiply.Rows1 = rows1;
+  Multiply.Columns1 = columns1;
+  Multiply.Columns2 = columns2;
+  Multiply.Src1Stride = src1Stride;
+  Multiply.Src2Stride = src2Stride;
+  Multiply.DstStride = dstStride;
+  Multiply.Src2Scale = SIGLIB_MINUS_ONE;
+  Multiply.Accumulate = 1;
+  Multiply.Src2Transposed = src2Transposed;
+  Multiply.LowerTriangle = lowerTriangle;
+  SUF_ParallelFor(siglib_numerix_MatrixMultiplyRowPanel, &Multiply,
+                  (rows1 + SIGLIB_MATRIX_MULTIPLY_ROW_PANEL - 1) / SIGLIB_MATRIX_MULTIPLY_ROW_PANEL);
+}    // End of siglib_numerix_MatrixMultiplySubtract()
+
 /********************************************************
  * Function: SMX_Multiply2
  *
@@ -173,6 +437,11 @@ void SIGLIB_FUNC_DECL SMX_Diagonal(const SLData_t* SIGLIB_PTR_DECL pSrcMatrix, S
  *  the number of rows in the second.
  *  The output matrix has order: [#rows 1, # cols 2]
  *  This function does not work in-place.
+ *  Larger matrices are multiplied in cache sized blocks,
+ *  with a register tiled SIMD micro-kernel. The row
+ *  panels are calculated with SUF_ParallelFor so they
+ *  are run in parallel when a parallel executor has been
+ *  registered with SUF_SetParallelFor.
  *
  ********************************************************/
 
@@ -188,6 +457,27 @@ void SIGLIB_FUNC_DECL SMX_Multiply2(const SLData_t* SIGLIB_PTR_DECL pSrcMatrix1,
 #  endif
 #endif
 
+  if ((Rows1 >= SIGLIB_MATRIX_MULTIPLY_MR) && (Columns2 >= SIGLIB_MATRIX_MULTIPLY_NR) &&
+      (((SLData_t)Rows1 * (SLData_t)Columns1 * (SLData_t)Columns2) >= (SLData_t)SIGLIB_MATRIX_MULTIPLY_MIN_MACS)) {
+    siglib_numerix_MatrixMultiplyContext_s Multiply;
+    Multiply.pSrcMatrix1 = pSrcMatrix1;
+    Multiply.pSrcMatrix2 = pSrcMatrix2;
+    Multiply.pDstMatrix = pDstMatrix;
+    Multiply.Rows1 = Rows1;
+    Multiply.Columns1 = Columns1;
+    Multiply.Columns2 = Columns2;
+    Multiply.Src1Stride = Columns1;
+    Multiply.Src2Stride = Columns2;
+    Multiply.DstStride = Columns2;
+    Multiply.Src2Scale = SIGLIB_ONE;
+    Multiply.Accumulate = 0;
+    Multiply.Src2Transposed = 0;
+    Multiply.LowerTriangle = 0;
+    SUF_ParallelFor(siglib_numerix_MatrixMultiplyRowPanel, &Multiply,
+                    (Rows1 + SIGLIB_MATRIX_MULTIPLY_ROW_PANEL - 1) / SIGLIB_MATRIX_MULTIPLY_ROW_PANEL);
+    return;
+  }
+
   for (SLArrayIndex_t i = 0; i < Rows1; i++) {
     for (SLArrayIndex_t j = 0; j < Columns2; j++) {
       *pDstMatrix = (*pSrcMatrix1++) * (*pSrcMatrix2);
@@ -205,6 +495,72 @@ void SIGLIB_FUNC_DECL SMX_Multiply2(const SLData_t* SIGLIB_PTR_DECL pSrcMatrix1,
   }
 }    // End of SMX_Multiply2()
 
+#if defined(__clang__)
+#  pragma STDC FP_CONTRACT DEFAULT
+#elif defined(__GNUC__)
+#  pragma GCC pop_options
+#endif
+
+/********************************************************
+ * Function: SMX_Multiply2Transposed
+ *
+ * Parameters:
+ *  const SLData_t *        - Input matrix 1
+ *  const SLData_t *        - Input matrix 2
+ *  SLData_t    *           - Output matrix
+ *  const SLArrayIndex_t    - Source matrix 1 number of rows
+ *  const SLArrayIndex_t    - Source matrix 1 number of columns
+ *  const SLArrayIndex_t    - Source matrix 2 number of rows
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Cross multiply matrix 1 by the transpose
+ *  of matrix 2.
+ *
+ * Notes: The number of columns in the first must equal
+ *  the number of columns in the second.
+ *  The output matrix has order: [#rows 1, # rows 2]
+ *  This function does not work in-place.
+ *  Matrix 2 is not transposed in memory, larger matrices
+ *  use the blocked matrix multiply of SMX_Multiply2,
+ *  which reads the columns of matrix 2 as rows when it
+ *  packs the blocks.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SMX_Multiply2Transposed(const SLData_t* SIGLIB_PTR_DECL pSrcMatrix1, const SLData_t* SIGLIB_PTR_DECL pSrcMatrix2,
+                                              SLData_t* SIGLIB_PTR_DECL pDstMatrix, const SLArrayIndex_t Rows1, const SLArrayIndex_t Columns1,
+                                              const SLArrayIndex_t Rows2)
+{
+  if ((Rows1 >= SIGLIB_MATRIX_MULTIPLY_MR) && (Rows2 >= SIGLIB_MATRIX_MULTIPLY_NR) &&
+      (((SLData_t)Rows1 * (SLData_t)Columns1 * (SLData_t)Rows2) >= (SLData_t)SIGLIB_MATRIX_MULTIPLY_MIN_MACS)) {
+    siglib_numerix_MatrixMultiplyContext_s Multiply;
+    Multiply.pSrcMatrix1 = pSrcMatrix1;
+    Multiply.pSrcMatrix2 = pSrcMatrix2;
+    Multiply.pDstMatrix = pDstMatrix;
+    Multiply.Rows1 = Rows1;
+    Multiply.Columns1 = Columns1;
+    Multiply.Columns2 = Rows2;
+    Multiply.Src1Stride = Columns1;
+    Multiply.Src2Stride = Columns1;
+    Multiply.DstStride = Rows2;
+    Multiply.Src2Scale = SIGLIB_ONE;
+    Multiply.Accumulate = 0;
+    Multiply.Src2Transposed = 1;
+    Multiply.LowerTriangle = 0;
+    SUF_ParallelFor(siglib_numerix_MatrixMultiplyRowPanel, &Multiply,
+                    (Rows1 + SIGLIB_MATRIX_MULTIPLY_ROW_PANEL - 1) / SIGLIB_MATRIX_MULTIPLY_ROW_PANEL);
+    return;
+  }
+
+  for (SLArrayIndex_t i = 0; i < Rows1; i++) {    // Each output is the dot product of a row of each matrix
+    for (SLArrayIndex_t j = 0; j < Rows2; j++) {
+      *pDstMatrix++ = SDA_RealDotProduct(pSrcMatrix1 + (i * Columns1), pSrcMatrix2 + (j * Columns1), Columns1);
+    }
+  }
+}    // End of SMX_Multiply2Transposed()
+
 /********************************************************
  * Function: SMX_Identity
  *
@@ -370,6 +726,104 @@ SLError_t SIGLIB_FUNC_DECL SMX_ComplexInverse2x2(const SLComplexRect_s* SIGLIB_I
   return (SIGLIB_NO_ERROR);
 }    // End of SMX_ComplexInverse2x2()
 
+/********************************************************
+ * Function: siglib_numerix_LuDecomposeBlocked
+ *
+ * Parameters:
+ *  SLData_t *              - Source and destination matrix pointer
+ *  SLArrayIndex_t *        - Row interchange indices
+ *  SLData_t *              - Scaling factor array, NULL for unscaled pivoting
+ *  const SLArrayIndex_t    - Number of rows and columns
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description: Blocked right-looking LU decomposition,
+ *  used by SMX_LuDecomposeBlocked and SMX_Inverse.
+ *
+ * Notes:
+ *  When the scaling factor array is supplied, the pivot is
+ *  the element with the largest magnitude relative to the
+ *  largest magnitude in its row (scaled partial pivoting),
+ *  as in SMX_LuDecompose.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_LuDecomposeBlocked(SLData_t* pSrcMatrix, SLArrayIndex_t* pRowInterchangeIndex, SLData_t* pScalingFactor,
+                                                   const SLArrayIndex_t RowsAndCols)
+{
+  const SLArrayIndex_t N = RowsAndCols;
+
+  if (NULL != pScalingFactor) {    // Scale each row by the inverse of its largest magnitude
+    for (SLArrayIndex_t i = 0; i < N; i++) {
+      SLData_t AbsMaxValue = SDA_AbsMax(pSrcMatrix + (i * N), N);
+      if (AbsMaxValue < SIGLIB_MIN_THRESHOLD) {    // Every value in the row is 0.0 so the matrix is singular
+        return (SIGLIB_ERROR);
+      }
+      pScalingFactor[i] = SIGLIB_ONE / AbsMaxValue;
+    }
+  }
+
+  for (SLArrayIndex_t j0 = 0; j0 < N; j0 += SIGLIB_MATRIX_FACTORIZE_BLOCK) {
+    const SLArrayIndex_t jEnd = ((N - j0) < SIGLIB_MATRIX_FACTORIZE_BLOCK) ? N : (j0 + SIGLIB_MATRIX_FACTORIZE_BLOCK);
+
+    for (SLArrayIndex_t k = j0; k < jEnd; k++) {    // Factorize the panel
+      SLArrayIndex_t LargestPivotElement = k;
+      SLData_t AbsMaxValue = SIGLIB_ZERO;
+      for (SLArrayIndex_t i = k; i < N; i++) {
+        SLData_t Value = SDS_Abs(pSrcMatrix[(i * N) + k]);
+        if (NULL != pScalingFactor) {    // Use scaled partial pivoting
+          Value *= pScalingFactor[i];
+        }
+        if (Value > AbsMaxValue) {
+          AbsMaxValue = Value;
+          LargestPivotElement = i;
+        }
+      }
+
+      if (SDS_Abs(pSrcMatrix[(LargestPivotElement * N) + k]) < SIGLIB_MIN_THRESHOLD) {    // Test to see if matrix is singular
+        return (SIGLIB_ERROR);
+      }
+
+      pRowInterchangeIndex[k] = LargestPivotElement;
+      if (k != LargestPivotElement) {    // Swap the whole rows, including L and the trailing sub-matrix
+        SDA_Swap(pSrcMatrix + (LargestPivotElement * N), pSrcMatrix + (k * N), N);
+        if (NULL != pScalingFactor) {
+          pScalingFactor[LargestPivotElement] = pScalingFactor[k];
+        }
+      }
+
+      SLData_t InversePivot = SIGLIB_ONE / pSrcMatrix[(k * N) + k];
+      const SLData_t* pPivotRow = pSrcMatrix + (k * N);
+      for (SLArrayIndex_t i = k + 1; i < N; i++) {    // Calculate L and update the rest of the panel
+        SLData_t* pRow = pSrcMatrix + (i * N);
+        SLData_t L = pRow[k] * InversePivot;
+        pRow[k] = L;
+        for (SLArrayIndex_t j = k + 1; j < jEnd; j++) {
+          pRow[j] -= L * pPivotRow[j];
+        }
+      }
+    }
+
+    for (SLArrayIndex_t i = j0 + 1; i < jEnd; i++) {    // Calculate the rows of U to the right of the panel
+      SLData_t* pRow = pSrcMatrix + (i * N);
+      for (SLArrayIndex_t k = j0; k < i; k++) {
+        SLData_t L = pRow[k];
+        const SLData_t* pURow = pSrcMatrix + (k * N);
+        for (SLArrayIndex_t j = jEnd; j < N; j++) {
+          pRow[j] -= L * pURow[j];
+        }
+      }
+    }
+
+    // Update the trailing sub-matrix : A22 = A22 - (L21 x U12)
+    siglib_numerix_MatrixMultiplySubtract(pSrcMatrix + (jEnd * N) + j0, N, pSrcMatrix + (j0 * N) + jEnd, N, pSrcMatrix + (jEnd * N) + jEnd, N,
+                                          N - jEnd, jEnd - j0, N - jEnd, 0, 0);
+  }
+
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_LuDecomposeBlocked()
+
 /********************************************************
  * Function: SMX_Inverse
  *
@@ -392,6 +846,12 @@ SLError_t SIGLIB_FUNC_DECL SMX_ComplexInverse2x2(const SLComplexRect_s* SIGLIB_I
  *  SIGLIB_ERROR if the matrix is non-invertable.
  *  I.E. singular.
  *
+ *  The inverse is calculated with a blocked LU
+ *  decomposition, with scaled partial pivoting as in
+ *  SMX_LuDecompose, and SMX_LuSolveMultiple. The index
+ *  substitution array is no longer used and is retained
+ *  for compatibility.
+ *
  ********************************************************/
 
 SLError_t SIGLIB_FUNC_DECL SMX_Inverse(const SLData_t* SIGLIB_PTR_DECL pSrcMatrix, SLData_t* SIGLIB_PTR_DECL pDstMatrix,
@@ -399,23 +859,19 @@ SLError_t SIGLIB_FUNC_DECL SMX_Inverse(const SLData_t* SIGLIB_PTR_DECL pSrcMatri
                                        SLArrayIndex_t* SIGLIB_PTR_DECL pRowInterchangeIndex, SLData_t* SIGLIB_PTR_DECL pScalingFactor,
                                        const SLArrayIndex_t RowsAndCols)
 {
+  (void)pSubstituteIndex;
+
   SMX_Copy(pSrcMatrix, pTempSourceArray, RowsAndCols,
            RowsAndCols);    // Copy source data to working matrix
 
   SLError_t ErrorCode;
-  if ((ErrorCode = SMX_LuDecompose(pTempSourceArray, pRowInterchangeIndex, pScalingFactor, RowsAndCols)) !=
+  if ((ErrorCode = siglib_numerix_LuDecomposeBlocked(pTempSourceArray, pRowInterchangeIndex, pScalingFactor, RowsAndCols)) !=
       SIGLIB_NO_ERROR) {    // LU decomposition
-    return (ErrorCode);     // Error state indicates singular matrix
+    return (ErrorCode);    // Error state indicates singular matrix
   }
 
-  for (SLArrayIndex_t i = 0; i < RowsAndCols; i++) {    // Calculate the inverse of the input on per-column basis
-    SDA_Zeros(pSubstituteIndex, RowsAndCols);           // Set a '1' in appropriate row
-    *(pSubstituteIndex + i) = SIGLIB_ONE;
-    SMX_LuSolve(pTempSourceArray, pSubstituteIndex, pRowInterchangeIndex,
-                RowsAndCols);    // Back substitute column
-
-    SDA_CopyWithStride(pSubstituteIndex, 1, pDstMatrix + i, RowsAndCols, RowsAndCols);
-  }
+  SMX_Identity(pDstMatrix, RowsAndCols);    // Solve for all of the columns of the identity matrix together
+  SMX_LuSolveMultiple(pTempSourceArray, pDstMatrix, pRowInterchangeIndex, RowsAndCols, RowsAndCols);
 
   return (SIGLIB_NO_ERROR);
 }    // End of SMX_Inverse()
@@ -580,6 +1036,128 @@ void SIGLIB_FUNC_DECL SMX_LuSolve(const SLData_t* SIGLIB_PTR_DECL pLUArray, SLDa
   }
 }    // End of SMX_LuSolve()
 
+/********************************************************
+ * Function: SMX_LuDecomposeBlocked
+ *
+ * Parameters:
+ *  SLData_t *              - Source and destination matrix pointer
+ *  SLArrayIndex_t *        - Row interchange indices
+ *  const SLArrayIndex_t    - Number of rows and columns
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description: Perform LU decomposition on a square matrix,
+ *  using a blocked right-looking algorithm.
+ *
+ * Notes:
+ *  The data in the source matrix is replaced by the LU
+ *  decomposition, with the same layout as SMX_LuDecompose
+ *  so the results can be used by SMX_LuSolve,
+ *  SMX_LuSolveMultiple and SMX_LuDeterminant.
+ *
+ *  Partial pivoting is used and the rows are interchanged.
+ *  Each panel of SIGLIB_MATRIX_FACTORIZE_BLOCK columns is
+ *  factorized, the corresponding rows of U are calculated
+ *  and the remaining sub-matrix is updated with the
+ *  blocked matrix multiply, which is where most of the
+ *  operations are performed.
+ *
+ *  This function will return the error code
+ *  SIGLIB_ERROR if the matrix is singular.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SMX_LuDecomposeBlocked(SLData_t* SIGLIB_PTR_DECL pSrcMatrix, SLArrayIndex_t* SIGLIB_PTR_DECL pRowInterchangeIndex,
+                                                  const SLArrayIndex_t RowsAndCols)
+{
+  return (siglib_numerix_LuDecomposeBlocked(pSrcMatrix, pRowInterchangeIndex, NULL, RowsAndCols));
+}    // End of SMX_LuDecomposeBlocked()
+
+/********************************************************
+ * Function: SMX_LuSolveMultiple
+ *
+ * Parameters:
+ *  const SLData_t *        - Interchanged LU decomposed matrix pointer
+ *  SLData_t *              - Source and solution matrix pointer
+ *  SLArrayIndex_t *        - Row interchange matrix pointer
+ *  const SLArrayIndex_t    - Number of rows and columns in LU matrix
+ *  const SLArrayIndex_t    - Number of right hand side columns
+ *
+ * Return value:
+ *  void
+ *
+ * Description: Solve A.X = B for all of the columns of B
+ *  together, following LU decomposition.
+ *
+ * Notes:
+ *  B has [#rows in LU matrix, # right hand sides] and is
+ *  replaced by X.
+ *  The row interchanges are applied once and the forward
+ *  and backward substitutions are performed in blocks of
+ *  SIGLIB_MATRIX_FACTORIZE_BLOCK rows. The contribution of
+ *  the rows that have already been solved is subtracted
+ *  from each block with the blocked matrix multiply, then
+ *  the triangular block is solved with row operations
+ *  across all of the right hand sides.
+ *  This function accepts an LU array with interchanged
+ *  rows, as indicated in the row interchange index matrix.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SMX_LuSolveMultiple(const SLData_t* SIGLIB_PTR_DECL pLUArray, SLData_t* SIGLIB_PTR_DECL pSrcDstMatrix,
+                                          const SLArrayIndex_t* SIGLIB_PTR_DECL pRowInterchangeIndex, const SLArrayIndex_t RowsAndCols,
+                                          const SLArrayIndex_t NumberOfColumns)
+{
+  const SLArrayIndex_t N = RowsAndCols;
+  const SLArrayIndex_t M = NumberOfColumns;
+
+  for (SLArrayIndex_t i = 0; i < N; i++) {    // Interchange the rows
+    if (pRowInterchangeIndex[i] != i) {
+      SDA_Swap(pSrcDstMatrix + (i * M), pSrcDstMatrix + (pRowInterchangeIndex[i] * M), M);
+    }
+  }
+
+  for (SLArrayIndex_t i0 = 0; i0 < N; i0 += SIGLIB_MATRIX_FACTORIZE_BLOCK) {    // Forward substitution, L has a unit diagonal
+    const SLArrayIndex_t iEnd = ((N - i0) < SIGLIB_MATRIX_FACTORIZE_BLOCK) ? N : (i0 + SIGLIB_MATRIX_FACTORIZE_BLOCK);
+
+    siglib_numerix_MatrixMultiplySubtract(pLUArray + (i0 * N), N, pSrcDstMatrix, M, pSrcDstMatrix + (i0 * M), M, iEnd - i0, i0, M, 0, 0);
+
+    for (SLArrayIndex_t i = i0 + 1; i < iEnd; i++) {
+      SLData_t* pRow = pSrcDstMatrix + (i * M);
+      for (SLArrayIndex_t k = i0; k < i; k++) {
+        SLData_t L = pLUArray[(i * N) + k];
+        const SLData_t* pSolvedRow = pSrcDstMatrix + (k * M);
+        for (SLArrayIndex_t j = 0; j < M; j++) {
+          pRow[j] -= L * pSolvedRow[j];
+        }
+      }
+    }
+  }
+
+  for (SLArrayIndex_t iEnd = N; iEnd > 0; iEnd -= SIGLIB_MATRIX_FACTORIZE_BLOCK) {    // Backward substitution
+    const SLArrayIndex_t i0 = (iEnd < SIGLIB_MATRIX_FACTORIZE_BLOCK) ? 0 : (iEnd - SIGLIB_MATRIX_FACTORIZE_BLOCK);
+
+    siglib_numerix_MatrixMultiplySubtract(pLUArray + (i0 * N) + iEnd, N, pSrcDstMatrix + (iEnd * M), M, pSrcDstMatrix + (i0 * M), M, iEnd - i0,
+                                          N - iEnd, M, 0, 0);
+
+    for (SLArrayIndex_t i = iEnd - 1; i >= i0; i--) {
+      SLData_t* pRow = pSrcDstMatrix + (i * M);
+      for (SLArrayIndex_t k = i + 1; k < iEnd; k++) {
+        SLData_t U = pLUArray[(i * N) + k];
+        const SLData_t* pSolvedRow = pSrcDstMatrix + (k * M);
+        for (SLArrayIndex_t j = 0; j < M; j++) {
+          pRow[j] -= U * pSolvedRow[j];
+        }
+      }
+      SLData_t InverseDiagonal = SIGLIB_ONE / pLUArray[(i * N) + i];
+      for (SLArrayIndex_t j = 0; j < M; j++) {
+        pRow[j] *= InverseDiagonal;
+      }
+    }
+  }
+}    // End of SMX_LuSolveMultiple()
+
 /********************************************************
  * Function: SMX_CholeskyDecompose
  *
@@ -595,30 +1173,51 @@ void SIGLIB_FUNC_DECL SMX_LuSolve(const SLData_t* SIGLIB_PTR_DECL pLUArray, SLDa
  *
  * Notes:
  *  This function works in-place and not-in-place.
+ *  Only the lower triangle of the source matrix is used.
+ *  A blocked right-looking algorithm is used : each
+ *  diagonal block of SIGLIB_MATRIX_FACTORIZE_BLOCK columns
+ *  and the block below it are factorized, then the lower
+ *  triangle of the remaining sub-matrix is updated with
+ *  the blocked matrix multiply.
  *
  ********************************************************/
 
 void SIGLIB_FUNC_DECL SMX_CholeskyDecompose(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t RowsAndCols)
 {
-  for (SLArrayIndex_t i = 0; i < RowsAndCols; i++) {
-    SLArrayIndex_t j;
-    for (j = 0; j <= i; j++) {
-      SLData_t sum = 0;
+  const SLArrayIndex_t N = RowsAndCols;
 
-      if (j == i) {    // On the diagonal
-        for (SLArrayIndex_t k = 0; k < j; k++) {
-          sum += pDst[j * RowsAndCols + k] * pDst[j * RowsAndCols + k];
+  if (pSrc != pDst) {
+    SDA_Copy(pSrc, pDst, N * N);
+  }
+
+  for (SLArrayIndex_t j0 = 0; j0 < N; j0 += SIGLIB_MATRIX_FACTORIZE_BLOCK) {
+    const SLArrayIndex_t jEnd = ((N - j0) < SIGLIB_MATRIX_FACTORIZE_BLOCK) ? N : (j0 + SIGLIB_MATRIX_FACTORIZE_BLOCK);
+
+    for (SLArrayIndex_t i = j0; i < N; i++) {    // Factorize the diagonal block and the block below it
+      SLData_t* pRow = pDst + (i * N);
+      const SLArrayIndex_t LastColumn = (i < jEnd) ? i : (jEnd - 1);
+      for (SLArrayIndex_t j = j0; j <= LastColumn; j++) {
+        const SLData_t* pDiagonalRow = pDst + (j * N);
+        SLData_t sum = pRow[j];
+        for (SLArrayIndex_t k = j0; k < j; k++) {
+          sum -= pRow[k] * pDiagonalRow[k];
         }
-        pDst[j * RowsAndCols + j] = SDS_Sqrt(pSrc[j * RowsAndCols + j] - sum);
-      } else {    // Not on the diagonal
-        for (SLArrayIndex_t k = 0; k < j; k++) {
-          sum += (pDst[i * RowsAndCols + k] * pDst[j * RowsAndCols + k]);
+        if (j == i) {    // On the diagonal
+          pRow[j] = SDS_Sqrt(sum);
+        } else {    // Not on the diagonal
+          pRow[j] = sum / pDiagonalRow[j];
         }
-        pDst[i * RowsAndCols + j] = (pSrc[i * RowsAndCols + j] - sum) / pDst[j * RowsAndCols + j];
       }
     }
-    for (; j < RowsAndCols; j++) {    // Clear the upper triangular matrix
-      pDst[i * RowsAndCols + j] = SIGLIB_ZERO;
+
+    // Update the lower triangle of the trailing sub-matrix : A22 = A22 - (L21 x L21^T)
+    siglib_numerix_MatrixMultiplySubtract(pDst + (jEnd * N) + j0, N, pDst + (jEnd * N) + j0, N, pDst + (jEnd * N) + jEnd, N, N - jEnd, jEnd - j0,
+                                          N - jEnd, 1, 1);
+  }
+
+  for (SLArrayIndex_t i = 0; i < N; i++) {    // Clear the upper triangular matrix
+    for (SLArrayIndex_t j = i + 1; j < N; j++) {
+      pDst[(i * N) + j] = SIGLIB_ZERO;
     }
   }
 }    // End of SMX_CholeskyDecompose()
@@ -3305,6 +3305,97 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_FirstMaxVertexPos(const SLData_t* SIGLIB_PTR
   return (i - 1);
 }    // End of SDA_FirstMaxVertexPos
 
+/********************************************************
+ * Function: siglib_numerix_NHeapSiftDown
+ *
+ * Parameters:
+ *  SLData_t *              - Pointer to heap
+ *  SLArrayIndex_t          - Root of the sub-heap
+ *  const SLArrayIndex_t    - Heap length
+ *  const SLFixData_t       - SIGLIB_TRUE for a min-heap,
+ *                            SIGLIB_FALSE for a max-heap
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Move the root of the heap down to its position.
+ *
+ ********************************************************/
+
+static void siglib_numerix_NHeapSiftDown(SLData_t* pHeap, SLArrayIndex_t Root, const SLArrayIndex_t Length, const SLFixData_t MinHeapFlag)
+{
+  for (SLArrayIndex_t Child = (2 * Root) + 1; Child < Length; Root = Child, Child = (2 * Child) + 1) {
+    if (SIGLIB_TRUE == MinHeapFlag) {
+      if (((Child + 1) < Length) && (pHeap[Child + 1] < pHeap[Child])) {
+        Child++;
+      }
+      if (!(pHeap[Child] < pHeap[Root])) {
+        break;
+      }
+    } else {
+      if (((Child + 1) < Length) && (pHeap[Child + 1] > pHeap[Child])) {
+        Child++;
+      }
+      if (!(pHeap[Child] > pHeap[Root])) {
+        break;
+      }
+    }
+    SDS_Swap(pHeap[Root], pHeap[Child]);
+  }
+}    // End of siglib_numerix_NHeapSiftDown()
+
+/********************************************************
+ * Function: siglib_numerix_NHeapSelect
+ *
+ * Parameters:
+ *  const SLData_t *        - Pointer to source array
+ *  SLData_t *              - Pointer to destination array
+ *  const SLArrayIndex_t    - Source array length
+ *  const SLArrayIndex_t    - Number of values to find
+ *  const SLFixData_t       - SIGLIB_TRUE to find the largest values,
+ *                            SIGLIB_FALSE to find the smallest values
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Find the N largest or smallest values in O(N log n),
+ *  where n is the number of values to find, using a heap
+ *  in the destination array. For the largest values a
+ *  min-heap holds the largest values found so far and a
+ *  new value replaces the root if it is larger. The heap
+ *  is then heap sorted, which orders it largest to
+ *  smallest.
+ *
+ ********************************************************/
+
+static void siglib_numerix_NHeapSelect(const SLData_t* pSrc, SLData_t* pDst, const SLArrayIndex_t srcLength, const SLArrayIndex_t numToFind,
+                                       const SLFixData_t LargestFlag)
+{
+  if (numToFind <= 0) {
+    return;
+  }
+  for (SLArrayIndex_t i = 0; i < numToFind; i++) {    // Copy first N elements
+    pDst[i] = pSrc[i];
+  }
+  for (SLArrayIndex_t i = (numToFind >> 1) - 1; i >= 0; i--) {
+    siglib_numerix_NHeapSiftDown(pDst, i, numToFind, LargestFlag);
+  }
+
+  for (SLArrayIndex_t i = numToFind; i < srcLength; i++) {    // Replace the root with newer elements that are larger / smaller
+    if ((SIGLIB_TRUE == LargestFlag) ? (pSrc[i] > pDst[0]) : (pSrc[i] < pDst[0])) {
+      pDst[0] = pSrc[i];
+      siglib_numerix_NHeapSiftDown(pDst, 0, numToFind, LargestFlag);
+    }
+  }
+
+  for (SLArrayIndex_t i = numToFind - 1; i > 0; i--) {    // Heap sort
+    SDS_Swap(pDst[0], pDst[i]);
+    siglib_numerix_NHeapSiftDown(pDst, 0, i, LargestFlag);
+  }
+}    // End of siglib_numerix_NHeapSelect()
+
 /********************************************************
  * Function: SDA_NLargest
  *
@@ -3327,34 +3418,7 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_FirstMaxVertexPos(const SLData_t* SIGLIB_PTR
 void SIGLIB_FUNC_DECL SDA_NLargest(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t srcLength,
                                    const SLArrayIndex_t numToFind)
 {
-  for (SLArrayIndex_t i = 0; i < numToFind; i++) {    // Copy first N elements
-    pDst[i] = pSrc[i];
-  }
-
-  for (SLArrayIndex_t i = 0; i < (numToFind - 1); i++) {    // Sort max to min
-    for (SLArrayIndex_t j = (i + 1); j < numToFind; j++) {
-      if (pDst[i] < pDst[j]) {
-        SLData_t Tmp = pDst[j];
-        pDst[j] = pDst[i];
-        pDst[i] = Tmp;
-      }
-    }
-  }
-
-  for (SLArrayIndex_t i = numToFind; i < srcLength; i++) {    // Copy in newer element, if larger, and re-sort max to min
-    if (pSrc[i] > pDst[numToFind - 1]) {
-      pDst[numToFind - 1] = pSrc[i];
-      for (SLArrayIndex_t j = (numToFind - 1); j >= 1; j--) {
-        if (pDst[j] > pDst[j - 1]) {
-          SLData_t Tmp = pDst[j];
-          pDst[j] = pDst[j - 1];
-          pDst[j - 1] = Tmp;
-        } else {    // Array now fully sorted
-          break;
-        }
-      }
-    }
-  }
+  siglib_numerix_NHeapSelect(pSrc, pDst, srcLength, numToFind, SIGLIB_TRUE);
 }    // End of SDA_NLargest
 
 /********************************************************
@@ -3379,31 +3443,5 @@ void SIGLIB_FUNC_DECL SDA_NLargest(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_
 void SIGLIB_FUNC_DECL SDA_NSmallest(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t srcLength,
                                     const SLArrayIndex_t numToFind)
 {
-  for (SLArrayIndex_t i = 0; i < numToFind; i++) {    // Copy first N elements
-    pDst[i] = pSrc[i];
-  }
-
-  for (SLArrayIndex_t i = 0; i < (numToFind - 1); i++) {    // Sort min to max
-    for (SLArrayIndex_t j = (i + 1); j < numToFind; j++) {
-      if (pDst[i] > pDst[j]) {
-        SLData_t Tmp = pDst[j];
-        pDst[j] = pDst[i];
-        pDst[i] = Tmp;
-      }
-    }
-  }
-  for (SLArrayIndex_t i = numToFind; i < srcLength; i++) {    // Copy in newer element, if smaller, and re-sort min to max
-    if (pSrc[i] < pDst[numToFind - 1]) {
-      pDst[numToFind - 1] = pSrc[i];
-      for (SLArrayIndex_t j = (numToFind - 1); j >= 1; j--) {
-        if (pDst[j] < pDst[j - 1]) {
-          SLData_t Tmp = pDst[j];
-          pDst[j] = pDst[j - 1];
-          pDst[j - 1] = Tmp;
-        } else {    // Array now fully sorted
-          break;
-        }
-      }
-    }
-  }
+  siglib_numerix_NHeapSelect(pSrc, pDst, srcLength, numToFind, SIGLIB_FALSE);
 }    // End of SDA_NSmallest
@@ -181,6 +181,8 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDS_CostasQamDemodulate(
     SLData_t* SIGLIB_PTR_DECL pELGRealOutputSynchDelay, SLData_t* SIGLIB_PTR_DECL pELGImagOutputSynchDelay,
     SLArrayIndex_t* pELGOutputSynchDelayIndex, const SLArrayIndex_t ELGOutputSynchDelayLength)
 {
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDS_COSTAS_QAM_DEMODULATE);
+
   SLData_t ImagTmp,
       RealTmp;                              // Temporary data processing variables - one for each path
   SLData_t RealVCOOutput, ImagVCOOutput;    // Local VCO output
@@ -271,6 +273,7 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDS_CostasQamDemodulate(
   // Calculate one pole loop filter
   *pCostasLoopLoopSample = SDS_OnePoleNormalized(*pCostasLoopLoopSample, CostasLpLoopFilterCoeff, pCostasLpLoopFilterState);
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDS_COSTAS_QAM_DEMODULATE);
   return (IQOutputFlag);    // Return number of IQ symbols demodulated
 
 }    // End of SDS_CostasQamDemodulate()
@@ -492,6 +495,8 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_CostasQamDemodulate(
     SLFixData_t* pELGTriggerUpdatedFlag, const SLArrayIndex_t SymbolLength, SLData_t* pELGRealOutputSynchDelay, SLData_t* pELGImagOutputSynchDelay,
     SLArrayIndex_t* pELGOutputSynchDelayIndex, const SLArrayIndex_t ELGOutputSynchDelayLength, const SLArrayIndex_t sampleLength)
 {
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_COSTAS_QAM_DEMODULATE);
+
   SLData_t ImagTmp,
       RealTmp;                              // Temporary data processing variables - one for each path
   SLData_t RealVCOOutput, ImagVCOOutput;    // Local VCO output
@@ -585,6 +590,7 @@ SLArrayIndex_t SIGLIB_FUNC_DECL SDA_CostasQamDemodulate(
 
   *pCostasLoopLoopSample = LocalCostasLoopLoopSample;    // Save loop sample for next iteration
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_COSTAS_QAM_DEMODULATE);
   return (IQOutputCount);    // Return number of IQ symbols demodulated
 }    // End of SDA_CostasQamDemodulate()
 #endif    // End of !((_TMS320C30) || (_TMS320C40))
@@ -1046,6 +1052,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_QpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
                                                 SLData_t* SIGLIB_PTR_DECL pRRCFCoeffs, const SLArrayIndex_t RRCFSize,
                                                 const SLArrayIndex_t RRCFSwitch)
 {
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_QPSK_DEMODULATE);
+
   SLData_t ISample, QSample;    // Data samples
   SLFixData_t RxDiBit = SIGLIB_AI_ZERO;
 
@@ -1102,6 +1110,7 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_QpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
     }
   }
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_QPSK_DEMODULATE);
   return (RxDiBit);
 }    // End of SDA_QpskDemodulate()
 
@@ -1706,6 +1715,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_FskDemodulate(const SLData_t* SIGLIB_PTR_DECL p
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_FSK_DEMODULATE);
+
   SLData_t LevelOneSum, LevelZeroSum;
   SLData_t LevelOnePeak, LevelZeroPeak;
 
@@ -1733,6 +1744,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_FskDemodulate(const SLData_t* SIGLIB_PTR_DECL p
     }
   }
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_FSK_DEMODULATE);
+
   if (LevelOnePeak > LevelZeroPeak) {    // Set bit if '1'
     return ((SIGLIB_FIX_ONE));
   }
@@ -2110,6 +2123,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_Qam16Demodulate(const SLData_t* SIGLIB_PTR_DECL
                                                  SLData_t* SIGLIB_PTR_DECL pRRCFCoeffs, const SLArrayIndex_t RRCFSize,
                                                  const SLArrayIndex_t RRCFSwitch)
 {
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_QAM16_DEMODULATE);
+
 #if (SIGLIB_ARRAYS_ALIGNED)
 #  ifdef __TMS320C6X__             // Defined by TI compiler
   _nassert((int)pSrc % 8 == 0);    // Align arrays on 64 bit double word boundary for LDDW
@@ -2172,6 +2187,7 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_Qam16Demodulate(const SLData_t* SIGLIB_PTR_DECL
     }
   }
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_QAM16_DEMODULATE);
   return (RxNibble);
 }    // End of SDA_Qam16Demodulate()
 
@@ -2372,6 +2388,767 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_Qam16DifferentialDecode(const SLFixData_t Mappe
   return (Output);
 }    // End of SDA_Qam16DifferentialDecode()
 
+// Multi-channel QPSK and 16-QAM modem functions
+
+#define SIGLIB_QAM_SLICER_LENGTH 64    // Number of symbols sliced together by the multi-channel demodulators
+
+typedef struct {    // Multi-channel modem context for SUF_ParallelFor
+  SLQamModemMultiChannel_s* pModem;
+  const SLFixData_t* pTxSymbols;
+  SLData_t* pDst;
+  const SLData_t* pSrc;
+  SLFixData_t* pRxSymbols;
+  const SLComplexRect_s* pTxConstellation;
+  SLUFixData_t SymbolMask;
+  void (*pSlicer)(const SLData_t*, const SLData_t*, SLFixData_t*, const SLArrayIndex_t);
+  SLArrayIndex_t NumberOfSymbols;
+} siglib_numerix_QamModemContext_s;
+
+/********************************************************
+ * Function: siglib_numerix_QamModemInit
+ *
+ * Parameters:
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLData_t CarrierPhaseIncrement, - Carrier phase increment per sample (radians / 2π)
+ *  const SLArrayIndex_t CarrierTableSize,
+ *  const SLArrayIndex_t CarrierTableIncrement,
+ *  const SLArrayIndex_t SamplesPerSymbol,
+ *  const SLData_t RRCFPeriod,
+ *  const SLData_t RRCFRollOff,
+ *  const SLArrayIndex_t RRCFSize,
+ *  const SLArrayIndex_t RRCFSwitch,    - RRCF enable / disable switch
+ *  const SLArrayIndex_t NumberOfChannels
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description:
+ *  Allocate and initialise the tables and the per
+ *  channel state shared by the multi-channel modulators
+ *  and demodulators.
+ *  The carrier phase of each channel is one of the
+ *  NcoLength phases (k x CarrierTableIncrement) modulo
+ *  CarrierTableSize, so the carrier table is unrolled
+ *  into cos and sin sequences of this period, extended
+ *  by one symbol so that every symbol is mixed from
+ *  contiguous samples.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_QamModemInit(SLQamModemMultiChannel_s* pModem, const SLData_t CarrierPhaseIncrement,
+                                             const SLArrayIndex_t CarrierTableSize, const SLArrayIndex_t CarrierTableIncrement,
+                                             const SLArrayIndex_t SamplesPerSymbol, const SLData_t RRCFPeriod, const SLData_t RRCFRollOff,
+                                             const SLArrayIndex_t RRCFSize, const SLArrayIndex_t RRCFSwitch, const SLArrayIndex_t NumberOfChannels)
+{
+  pModem->pCarrierTable = SIGLIB_NULL_DATA_PTR;
+  pModem->pMagn = SIGLIB_NULL_COMPLEX_RECT_PTR;
+  pModem->pNcoIndex = SIGLIB_NULL_ARRAY_INDEX_PTR;
+
+  if ((NumberOfChannels < 1) || (SamplesPerSymbol < 1) || (CarrierTableSize < 4) || (CarrierTableIncrement < 0) ||
+      (CarrierTableIncrement >= CarrierTableSize) || ((RRCFSwitch == SIGLIB_ENABLE) && (RRCFSize < 1))) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  SLArrayIndex_t Gcd = CarrierTableSize;    // Greatest common divisor of the table size and increment
+  for (SLArrayIndex_t Remainder = CarrierTableIncrement; Remainder != 0;) {
+    const SLArrayIndex_t Tmp = Gcd % Remainder;
+    Gcd = Remainder;
+    Remainder = Tmp;
+  }
+
+  const SLArrayIndex_t FilterLength = (RRCFSwitch == SIGLIB_ENABLE) ? RRCFSize : 0;
+  const SLArrayIndex_t CarrierTableLength = (CarrierTableSize * ((SLArrayIndex_t)5)) / ((SLArrayIndex_t)4);
+
+  pModem->NumberOfChannels = NumberOfChannels;
+  pModem->SamplesPerSymbol = SamplesPerSymbol;
+  pModem->CarrierTableSize = CarrierTableSize;
+  pModem->CarrierTableIncrement = CarrierTableIncrement;
+  pModem->NcoLength = CarrierTableSize / Gcd;
+  pModem->RRCFSize = FilterLength;
+  pModem->RRCFSwitch = RRCFSwitch;
+  pModem->PolyphaseLength = (FilterLength + SamplesPerSymbol - 1) / SamplesPerSymbol;
+  pModem->WorkspaceLength = 2 * (SamplesPerSymbol + pModem->PolyphaseLength);
+
+  const SLArrayIndex_t NcoTableLength = pModem->NcoLength + SamplesPerSymbol;
+  const SLArrayIndex_t PolyphaseCoeffsLength = pModem->PolyphaseLength * SamplesPerSymbol;
+
+  pModem->pCarrierTable = (SLData_t*)SUF_MemoryAllocate(
+    ((size_t)CarrierTableLength + (2 * (size_t)NcoTableLength) + (size_t)FilterLength + (size_t)PolyphaseCoeffsLength +
+     ((size_t)NumberOfChannels * (size_t)(1 + (2 * FilterLength) + pModem->WorkspaceLength))) *
+    sizeof(SLData_t));
+  pModem->pMagn = (SLComplexRect_s*)SUF_MemoryAllocate((size_t)NumberOfChannels * sizeof(SLComplexRect_s));
+  pModem->pNcoIndex = (SLArrayIndex_t*)SUF_MemoryAllocate(((size_t)CarrierTableSize + (3 * (size_t)NumberOfChannels)) * sizeof(SLArrayIndex_t));
+  if ((SIGLIB_NULL_DATA_PTR == pModem->pCarrierTable) || (SIGLIB_NULL_COMPLEX_RECT_PTR == pModem->pMagn) ||
+      (SIGLIB_NULL_ARRAY_INDEX_PTR == pModem->pNcoIndex)) {
+    SUF_QamModemMultiChannelFree(pModem);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  pModem->pNcoCos = pModem->pCarrierTable + CarrierTableLength;
+  pModem->pNcoSin = pModem->pNcoCos + NcoTableLength;
+  pModem->pRRCFCoeffs = pModem->pNcoSin + NcoTableLength;
+  pModem->pPolyphaseCoeffs = pModem->pRRCFCoeffs + FilterLength;
+  pModem->pCarrierPhase = pModem->pPolyphaseCoeffs + PolyphaseCoeffsLength;
+  pModem->pRRCFIStateArray = pModem->pCarrierPhase + NumberOfChannels;
+  pModem->pRRCFQStateArray = pModem->pRRCFIStateArray + (NumberOfChannels * FilterLength);
+  pModem->pWorkspace = pModem->pRRCFQStateArray + (NumberOfChannels * FilterLength);
+  pModem->pSampleClock = pModem->pNcoIndex + CarrierTableSize;
+  pModem->pRRCFIFilterIndex = pModem->pSampleClock + NumberOfChannels;
+  pModem->pRRCFQFilterIndex = pModem->pRRCFIFilterIndex + NumberOfChannels;
+
+  // 1 + 1/4 wave overlapped cosine and sine table
+  SLData_t SinPhase = SIGLIB_ZERO;
+  SDA_SignalGenerate(pModem->pCarrierTable, SIGLIB_SINE_WAVE, SIGLIB_ONE, SIGLIB_FILL, CarrierPhaseIncrement, SIGLIB_ZERO, SIGLIB_ZERO,
+                     SIGLIB_ZERO, &SinPhase, SIGLIB_NULL_DATA_PTR, CarrierTableLength);
+
+  for (SLArrayIndex_t i = 0; i < CarrierTableSize; i++) {    // Unreachable phases are never looked up
+    pModem->pNcoIndex[i] = SIGLIB_AI_ZERO;
+  }
+  for (SLArrayIndex_t i = 0, Phase = 0; i < NcoTableLength; i++) {    // Unroll the carrier table into the phase sequence
+    if (i < pModem->NcoLength) {
+      pModem->pNcoIndex[Phase] = i;
+    }
+    pModem->pNcoCos[i] = pModem->pCarrierTable[Phase + (SLArrayIndex_t)((SLUFixData_t)CarrierTableSize >> 2U)];
+    pModem->pNcoSin[i] = pModem->pCarrierTable[Phase];
+    Phase += CarrierTableIncrement;
+    if (Phase >= CarrierTableSize) {
+      Phase -= CarrierTableSize;
+    }
+  }
+
+  if (RRCFSwitch == SIGLIB_ENABLE) {
+    // Initialise Root raised cosine filter
+    SIF_RootRaisedCosineFirFilter(pModem->pRRCFCoeffs, RRCFPeriod, RRCFRollOff, RRCFSize);
+
+    // Scale coefficients for unity gain
+    SDA_Multiply(pModem->pRRCFCoeffs, SIGLIB_FOUR, pModem->pRRCFCoeffs, RRCFSize);
+
+    // Polyphase coefficients - phase k of symbol m is tap (m x SamplesPerSymbol) + k
+    for (SLArrayIndex_t i = 0; i < PolyphaseCoeffsLength; i++) {
+      pModem->pPolyphaseCoeffs[i] = (i < RRCFSize) ? pModem->pRRCFCoeffs[i] : SIGLIB_ZERO;
+    }
+
+    SDA_Zeros(pModem->pRRCFIStateArray, 2 * NumberOfChannels * FilterLength);
+  }
+
+  for (SLArrayIndex_t c = 0; c < NumberOfChannels; c++) {
+    pModem->pCarrierPhase[c] = SIGLIB_ZERO;    // Initialise phase for carrier
+    pModem->pSampleClock[c] = SIGLIB_AI_ZERO;
+    pModem->pMagn[c].real = SIGLIB_ZERO;
+    pModem->pMagn[c].imag = SIGLIB_ZERO;
+    pModem->pRRCFIFilterIndex[c] = SIGLIB_AI_ZERO;
+    pModem->pRRCFQFilterIndex[c] = SIGLIB_AI_ZERO;
+  }
+
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_QamModemInit()
+
+/********************************************************
+ * Function: SIF_QamModulateMultiChannel
+ *
+ * Parameters:
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLData_t,         Carrier phase increment per sample (radians / 2π)
+ *  const SLArrayIndex_t,   Sine table length
+ *  const SLArrayIndex_t,   Carrier table increment
+ *  const SLArrayIndex_t,   Samples per symbol
+ *  const SLData_t,         RRCF Period
+ *  const SLData_t,         RRCF Roll off
+ *  const SLArrayIndex_t,   RRCF size
+ *  const SLArrayIndex_t,   RRCF enable / disable switch
+ *  const SLArrayIndex_t    Number of channels
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description:
+ *  Initialise the multi-channel modulator for
+ *  SDA_QpskModulateMultiChannel and
+ *  SDA_Qam16ModulateMultiChannel.
+ *  Each channel starts in the state set by
+ *  SIF_QpskModulate and SIF_Qam16Modulate.
+ *  The carrier table increment must be less than the
+ *  sine table length.
+ *  The memory is released with
+ *  SUF_QamModemMultiChannelFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_QamModulateMultiChannel(SLQamModemMultiChannel_s* pModem, const SLData_t CarrierPhaseIncrement,
+                                                       const SLArrayIndex_t CarrierTableSize, const SLArrayIndex_t CarrierTableIncrement,
+                                                       const SLArrayIndex_t SamplesPerSymbol, const SLData_t RRCFPeriod,
+                                                       const SLData_t RRCFRollOff, const SLArrayIndex_t RRCFSize, const SLArrayIndex_t RRCFSwitch,
+                                                       const SLArrayIndex_t NumberOfChannels)
+{
+  return (siglib_numerix_QamModemInit(pModem, CarrierPhaseIncrement, CarrierTableSize, CarrierTableIncrement, SamplesPerSymbol, RRCFPeriod,
+                                      RRCFRollOff, RRCFSize, RRCFSwitch, NumberOfChannels));
+}    // End of SIF_QamModulateMultiChannel()
+
+/********************************************************
+ * Function: siglib_numerix_QamModulateChannel
+ *
+ * Parameters:
+ *  void *pContext,                     - Pointer to modem context
+ *  SLArrayIndex_t channel              - Channel index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Modulate the symbols of one channel.
+ *  Only one in SamplesPerSymbol of the RRC filter
+ *  inputs is non-zero, so each output sample is the
+ *  sum of one polyphase branch of the filter applied
+ *  to the symbol history. The history is read from the
+ *  SDS_Fir state array, which is updated exactly as it
+ *  is by SDA_QpskModulate, and each branch is summed in
+ *  the SDS_Fir tap order so the output is the same.
+ *  All phases of a symbol are accumulated together and
+ *  then mixed with contiguous carrier samples.
+ *
+ ********************************************************/
+
+static void siglib_numerix_QamModulateChannel(void* pContext, SLArrayIndex_t channel)
+{
+  const siglib_numerix_QamModemContext_s* pCtx = (const siglib_numerix_QamModemContext_s*)pContext;
+  SLQamModemMultiChannel_s* pModem = pCtx->pModem;
+  const SLArrayIndex_t SamplesPerSymbol = pModem->SamplesPerSymbol;
+  const SLArrayIndex_t FilterLength = pModem->RRCFSize;
+  const SLArrayIndex_t PolyphaseLength = pModem->PolyphaseLength;
+
+  const SLFixData_t* pTxSymbols = pCtx->pTxSymbols + (channel * pCtx->NumberOfSymbols);
+  SLData_t* pDst = pCtx->pDst + (channel * pCtx->NumberOfSymbols * SamplesPerSymbol);
+  SLData_t* pIState = pModem->pRRCFIStateArray + (channel * FilterLength);
+  SLData_t* pQState = pModem->pRRCFQStateArray + (channel * FilterLength);
+  SLData_t* pISamples = pModem->pWorkspace + (channel * pModem->WorkspaceLength);
+  SLData_t* pQSamples = pISamples + SamplesPerSymbol;
+  SLData_t* pIHistory = pQSamples + SamplesPerSymbol;
+  SLData_t* pQHistory = pIHistory + PolyphaseLength;
+
+  SLArrayIndex_t FilterIndex = pModem->pRRCFIFilterIndex[channel];
+  SLArrayIndex_t NcoPosition = pModem->pNcoIndex[(SLArrayIndex_t)pModem->pCarrierPhase[channel]];
+  SLComplexRect_s Magn = pModem->pMagn[channel];
+
+  for (SLArrayIndex_t s = 0; s < pCtx->NumberOfSymbols; s++) {
+    // Convert data value to constellation point
+    const SLComplexRect_s Symbol = pCtx->pTxConstellation[(SLUFixData_t)pTxSymbols[s] & pCtx->SymbolMask];
+
+    if (pModem->RRCFSwitch == SIGLIB_ENABLE) {
+      pIState[FilterIndex] = Symbol.real;
+      pQState[FilterIndex] = Symbol.imag;
+
+      for (SLArrayIndex_t m = 0, j = FilterIndex; m < PolyphaseLength; m++) {    // Symbol history, newest first
+        pIHistory[m] = pIState[j];
+        pQHistory[m] = pQState[j];
+        j += SamplesPerSymbol;
+        if (j >= FilterLength) {
+          j -= FilterLength;
+        }
+      }
+
+      for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+        pISamples[k] = SIGLIB_ZERO;
+        pQSamples[k] = SIGLIB_ZERO;
+      }
+      for (SLArrayIndex_t m = 0; m < PolyphaseLength; m++) {    // Apply baseband RRC filter
+        const SLData_t* pCoeffs = pModem->pPolyphaseCoeffs + (m * SamplesPerSymbol);
+        for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+          pISamples[k] += pCoeffs[k] * pIHistory[m];
+          pQSamples[k] += pCoeffs[k] * pQHistory[m];
+        }
+      }
+
+      for (SLArrayIndex_t k = 1; k < SamplesPerSymbol; k++) {    // Zero other samples
+        if (--FilterIndex < 0) {
+          FilterIndex = FilterLength - 1;
+        }
+        pIState[FilterIndex] = SIGLIB_ZERO;
+        pQState[FilterIndex] = SIGLIB_ZERO;
+      }
+      if (--FilterIndex < 0) {
+        FilterIndex = FilterLength - 1;
+      }
+
+      if (SamplesPerSymbol == 1) {    // Last filter input
+        Magn = Symbol;
+      } else {
+        Magn.real = SIGLIB_ZERO;
+        Magn.imag = SIGLIB_ZERO;
+      }
+    }
+
+    else {    // No RRCF
+      for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+        pISamples[k] = Symbol.real;
+        pQSamples[k] = Symbol.imag;
+      }
+      Magn = Symbol;
+    }
+
+    // Modulate the I and Q carriers
+    const SLData_t* pCos = pModem->pNcoCos + NcoPosition;
+    const SLData_t* pSin = pModem->pNcoSin + NcoPosition;
+    for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+      pDst[k] = (pISamples[k] * pCos[k]) + (pQSamples[k] * pSin[k]);
+    }
+    pDst += SamplesPerSymbol;
+
+    NcoPosition = (NcoPosition + SamplesPerSymbol) % pModem->NcoLength;
+  }
+
+  pModem->pCarrierPhase[channel] =
+    (SLData_t)(((SLUInt64_t)NcoPosition * (SLUInt64_t)pModem->CarrierTableIncrement) % (SLUInt64_t)pModem->CarrierTableSize);
+  pModem->pMagn[channel] = Magn;
+  pModem->pRRCFIFilterIndex[channel] = FilterIndex;
+  pModem->pRRCFQFilterIndex[channel] = FilterIndex;
+}    // End of siglib_numerix_QamModulateChannel()
+
+/********************************************************
+ * Function: SDA_QpskModulateMultiChannel
+ *
+ * Parameters:
+ *  const SLFixData_t *pTxDiBits,       - Pointer to Tx di-bits
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLArrayIndex_t NumberOfSymbols - Number of symbols per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Modulate NumberOfSymbols di-bits on each channel.
+ *  The source array holds the di-bits of each channel
+ *  in turn and the destination array holds the
+ *  (NumberOfSymbols x SamplesPerSymbol) samples of each
+ *  channel in turn.
+ *  The output and the per channel state are the same as
+ *  for NumberOfSymbols calls to SDA_QpskModulate.
+ *  The channels are processed through SUF_ParallelFor.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_QpskModulateMultiChannel(const SLFixData_t* SIGLIB_PTR_DECL pTxDiBits, SLData_t* SIGLIB_PTR_DECL pDst,
+                                                   SLQamModemMultiChannel_s* pModem, const SLArrayIndex_t NumberOfSymbols)
+{
+  siglib_numerix_QamModemContext_s Ctx;
+  Ctx.pModem = pModem;
+  Ctx.pTxSymbols = pTxDiBits;
+  Ctx.pDst = pDst;
+  Ctx.pTxConstellation = siglib_numerix_QPSKTxConstellation;
+  Ctx.SymbolMask = SIGLIB_UFIX_THREE;
+  Ctx.NumberOfSymbols = NumberOfSymbols;
+
+  SUF_ParallelFor(siglib_numerix_QamModulateChannel, &Ctx, pModem->NumberOfChannels);
+}    // End of SDA_QpskModulateMultiChannel()
+
+/********************************************************
+ * Function: SDA_Qam16ModulateMultiChannel
+ *
+ * Parameters:
+ *  const SLFixData_t *pTxNibbles,      - Pointer to Tx nibbles
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLArrayIndex_t NumberOfSymbols - Number of symbols per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Modulate NumberOfSymbols nibbles on each channel.
+ *  The source array holds the nibbles of each channel
+ *  in turn and the destination array holds the
+ *  (NumberOfSymbols x SamplesPerSymbol) samples of each
+ *  channel in turn.
+ *  The output and the per channel state are the same as
+ *  for NumberOfSymbols calls to SDA_Qam16Modulate.
+ *  The channels are processed through SUF_ParallelFor.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Qam16ModulateMultiChannel(const SLFixData_t* SIGLIB_PTR_DECL pTxNibbles, SLData_t* SIGLIB_PTR_DECL pDst,
+                                                    SLQamModemMultiChannel_s* pModem, const SLArrayIndex_t NumberOfSymbols)
+{
+  siglib_numerix_QamModemContext_s Ctx;
+  Ctx.pModem = pModem;
+  Ctx.pTxSymbols = pTxNibbles;
+  Ctx.pDst = pDst;
+  Ctx.pTxConstellation = siglib_numerix_QAM16TxConstellation;
+  Ctx.SymbolMask = 0xfU;
+  Ctx.NumberOfSymbols = NumberOfSymbols;
+
+  SUF_ParallelFor(siglib_numerix_QamModulateChannel, &Ctx, pModem->NumberOfChannels);
+}    // End of SDA_Qam16ModulateMultiChannel()
+
+/********************************************************
+ * Function: SIF_QamDemodulateMultiChannel
+ *
+ * Parameters:
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLData_t,         Carrier phase increment per sample (radians / 2π)
+ *  const SLArrayIndex_t,   Sine table length
+ *  const SLArrayIndex_t,   Carrier table increment
+ *  const SLArrayIndex_t,   Samples per symbol
+ *  const SLData_t,         RRCF Period
+ *  const SLData_t,         RRCF Roll off
+ *  const SLArrayIndex_t,   RRCF size
+ *  const SLArrayIndex_t,   RRCF enable / disable switch
+ *  const SLArrayIndex_t    Number of channels
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description:
+ *  Initialise the multi-channel demodulator for
+ *  SDA_QpskDemodulateMultiChannel and
+ *  SDA_Qam16DemodulateMultiChannel.
+ *  Each channel starts in the state set by
+ *  SIF_QpskDemodulate and SIF_Qam16Demodulate.
+ *  The carrier table increment must be less than the
+ *  sine table length.
+ *  The memory is released with
+ *  SUF_QamModemMultiChannelFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_QamDemodulateMultiChannel(SLQamModemMultiChannel_s* pModem, const SLData_t CarrierPhaseIncrement,
+                                                         const SLArrayIndex_t CarrierTableSize, const SLArrayIndex_t CarrierTableIncrement,
+                                                         const SLArrayIndex_t SamplesPerSymbol, const SLData_t RRCFPeriod,
+                                                         const SLData_t RRCFRollOff, const SLArrayIndex_t RRCFSize,
+                                                         const SLArrayIndex_t RRCFSwitch, const SLArrayIndex_t NumberOfChannels)
+{
+  SLError_t ErrorCode = siglib_numerix_QamModemInit(pModem, CarrierPhaseIncrement, CarrierTableSize, CarrierTableIncrement, SamplesPerSymbol,
+                                                    RRCFPeriod, RRCFRollOff, RRCFSize, RRCFSwitch, NumberOfChannels);
+
+  if ((ErrorCode == SIGLIB_NO_ERROR) && (RRCFSwitch == SIGLIB_ENABLE)) {
+    for (SLArrayIndex_t c = 0; c < NumberOfChannels; c++) {
+      pModem->pSampleClock[c] = ((SLArrayIndex_t)15);    // Allow for filter group delay
+    }
+  }
+
+  return (ErrorCode);
+}    // End of SIF_QamDemodulateMultiChannel()
+
+/********************************************************
+ * Function: siglib_numerix_QamModemFir
+ *
+ * Parameters:
+ *  const SLData_t *pState,             - Pointer to filter state array
+ *  const SLData_t *pCoeffs,            - Pointer to filter coefficients
+ *  const SLArrayIndex_t filterIndex,   - Index of the newest sample
+ *  const SLArrayIndex_t filterLength   - Filter length
+ *
+ * Return value:
+ *  SLData_t - Filter output
+ *
+ * Description:
+ *  Return the output of the FIR filter for the state
+ *  array after the newest sample has been written, with
+ *  the taps summed in the same order as SDS_Fir.
+ *
+ ********************************************************/
+
+static SLData_t siglib_numerix_QamModemFir(const SLData_t* SIGLIB_PTR_DECL pState, const SLData_t* SIGLIB_PTR_DECL pCoeffs,
+                                           const SLArrayIndex_t filterIndex, const SLArrayIndex_t filterLength)
+{
+  const SLArrayIndex_t FirstLength = filterLength - filterIndex;
+  SLData_t Sum = SIGLIB_ZERO;
+
+  for (SLArrayIndex_t i = 0; i < FirstLength; i++) {
+    Sum += pCoeffs[i] * pState[filterIndex + i];
+  }
+  for (SLArrayIndex_t i = 0; i < filterIndex; i++) {
+    Sum += pCoeffs[FirstLength + i] * pState[i];
+  }
+
+  return (Sum);
+}    // End of siglib_numerix_QamModemFir()
+
+/********************************************************
+ * Function: siglib_numerix_QpskSlice
+ *
+ * Parameters:
+ *  const SLData_t *pReal,              - Pointer to real decision samples
+ *  const SLData_t *pImag,              - Pointer to imaginary decision samples
+ *  SLFixData_t *pDst,                  - Pointer to received di-bits
+ *  const SLArrayIndex_t sampleLength   - Number of symbols
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Decode the QPSK constellation for a group of
+ *  symbols, as in SDA_QpskDemodulate.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_QpskSlice(const SLData_t* SIGLIB_PTR_DECL pReal, const SLData_t* SIGLIB_PTR_DECL pImag,
+                                                              SLFixData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t sampleLength)
+{
+  for (SLArrayIndex_t i = 0; i < sampleLength; i++) {
+    const SLArrayIndex_t Index = (SLArrayIndex_t)(pReal[i] > SIGLIB_EPSILON) + ((SLArrayIndex_t)(pImag[i] > SIGLIB_EPSILON) << 1);
+    pDst[i] = siglib_numerix_QPSKRxConstellation[Index];
+  }
+}    // End of siglib_numerix_QpskSlice()
+
+/********************************************************
+ * Function: siglib_numerix_Qam16Slice
+ *
+ * Parameters:
+ *  const SLData_t *pReal,              - Pointer to real decision samples
+ *  const SLData_t *pImag,              - Pointer to imaginary decision samples
+ *  SLFixData_t *pDst,                  - Pointer to received nibbles
+ *  const SLArrayIndex_t sampleLength   - Number of symbols
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Decode the 16-QAM constellation for a group of
+ *  symbols, as in SDA_Qam16Demodulate.
+ *  The scaled decision samples are limited to the range
+ *  0 to 3, which truncates to the same levels as the
+ *  (-SIGLIB_EPSILON, 3) limits of SDA_Qam16Demodulate.
+ *
+ ********************************************************/
+
+static void SIGLIB_FUNC_MULTIVERSION siglib_numerix_Qam16Slice(const SLData_t* SIGLIB_PTR_DECL pReal, const SLData_t* SIGLIB_PTR_DECL pImag,
+                                                               SLFixData_t* SIGLIB_PTR_DECL pDst, const SLArrayIndex_t sampleLength)
+{
+  for (SLArrayIndex_t i = 0; i < sampleLength; i++) {
+    SLData_t Real = (pReal[i] + SIGLIB_QAM16_DEMOD_OFFSET) * SIGLIB_QAM16_DEMOD_SCALE;    // Offset and scale for look up table
+    SLData_t Imag = (pImag[i] + SIGLIB_QAM16_DEMOD_OFFSET) * SIGLIB_QAM16_DEMOD_SCALE;
+    Real = (Real < SIGLIB_ZERO) ? SIGLIB_ZERO : Real;    // Limit to the constellation
+    Real = (Real > SIGLIB_THREE) ? SIGLIB_THREE : Real;
+    Imag = (Imag < SIGLIB_ZERO) ? SIGLIB_ZERO : Imag;
+    Imag = (Imag > SIGLIB_THREE) ? SIGLIB_THREE : Imag;
+
+    const SLArrayIndex_t Index = (SLArrayIndex_t)((SLUFixData_t)(((SLFixData_t)Real) + (12 - (((SLFixData_t)Imag) << 2))) & 0x0fU);
+    pDst[i] = (SLFixData_t)siglib_numerix_QAM16RxConstellation[Index];
+  }
+}    // End of siglib_numerix_Qam16Slice()
+
+/********************************************************
+ * Function: siglib_numerix_QamDemodulateChannel
+ *
+ * Parameters:
+ *  void *pContext,                     - Pointer to modem context
+ *  SLArrayIndex_t channel              - Channel index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Demodulate the symbols of one channel.
+ *  Each symbol is mixed with contiguous carrier samples
+ *  and written to the SDS_Fir state arrays, and the RRC
+ *  filter output is only calculated at the decision
+ *  instants, and for the magnitude state at the end of
+ *  the array.
+ *  The decision samples are sliced in groups of
+ *  SIGLIB_QAM_SLICER_LENGTH symbols.
+ *
+ ********************************************************/
+
+static void siglib_numerix_QamDemodulateChannel(void* pContext, SLArrayIndex_t channel)
+{
+  const siglib_numerix_QamModemContext_s* pCtx = (const siglib_numerix_QamModemContext_s*)pContext;
+  SLQamModemMultiChannel_s* pModem = pCtx->pModem;
+  const SLArrayIndex_t SamplesPerSymbol = pModem->SamplesPerSymbol;
+  const SLArrayIndex_t FilterLength = pModem->RRCFSize;
+
+  const SLData_t* pSrc = pCtx->pSrc + (channel * pCtx->NumberOfSymbols * SamplesPerSymbol);
+  SLFixData_t* pRxSymbols = pCtx->pRxSymbols + (channel * pCtx->NumberOfSymbols);
+  SLData_t* pIState = pModem->pRRCFIStateArray + (channel * FilterLength);
+  SLData_t* pQState = pModem->pRRCFQStateArray + (channel * FilterLength);
+  SLData_t* pISamples = pModem->pWorkspace + (channel * pModem->WorkspaceLength);
+  SLData_t* pQSamples = pISamples + SamplesPerSymbol;
+
+  SLData_t DecisionReal[SIGLIB_QAM_SLICER_LENGTH];
+  SLData_t DecisionImag[SIGLIB_QAM_SLICER_LENGTH];
+
+  SLArrayIndex_t FilterIndex = pModem->pRRCFIFilterIndex[channel];
+  SLArrayIndex_t SampleClock = pModem->pSampleClock[channel];
+  SLArrayIndex_t NcoPosition = pModem->pNcoIndex[(SLArrayIndex_t)pModem->pCarrierPhase[channel]];
+  SLComplexRect_s Magn = pModem->pMagn[channel];
+
+  for (SLArrayIndex_t s = 0, Decision = 0; s < pCtx->NumberOfSymbols; s++) {
+    // Demodulate the I and Q carriers
+    const SLData_t* pCos = pModem->pNcoCos + NcoPosition;
+    const SLData_t* pSin = pModem->pNcoSin + NcoPosition;
+    for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+      pISamples[k] = pSrc[k] * pCos[k];
+      pQSamples[k] = pSrc[k] * pSin[k];
+    }
+    pSrc += SamplesPerSymbol;
+    NcoPosition = (NcoPosition + SamplesPerSymbol) % pModem->NcoLength;
+
+    // There is exactly one decision in every SamplesPerSymbol samples
+    if (pModem->RRCFSwitch == SIGLIB_ENABLE) {
+      for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+        pIState[FilterIndex] = pISamples[k];
+        pQState[FilterIndex] = pQSamples[k];
+
+        if (++SampleClock >= SamplesPerSymbol) {    // Apply baseband RRC filter at the decision instant
+          SampleClock = SIGLIB_AI_ZERO;
+          DecisionReal[Decision] = siglib_numerix_QamModemFir(pIState, pModem->pRRCFCoeffs, FilterIndex, FilterLength);
+          DecisionImag[Decision] = siglib_numerix_QamModemFir(pQState, pModem->pRRCFCoeffs, FilterIndex, FilterLength);
+        }
+
+        if (--FilterIndex < 0) {
+          FilterIndex = FilterLength - 1;
+        }
+      }
+    }
+
+    else {    // No RRCF
+      for (SLArrayIndex_t k = 0; k < SamplesPerSymbol; k++) {
+        Magn.real += pISamples[k];    // Keep running sum
+        Magn.imag += pQSamples[k];
+
+        if (++SampleClock >= SamplesPerSymbol) {
+          SampleClock = SIGLIB_AI_ZERO;
+          DecisionReal[Decision] = Magn.real;
+          DecisionImag[Decision] = Magn.imag;
+          Magn.real = SIGLIB_ZERO;    // Reset running sum values
+          Magn.imag = SIGLIB_ZERO;
+        }
+      }
+    }
+
+    if ((++Decision == SIGLIB_QAM_SLICER_LENGTH) || (s == (pCtx->NumberOfSymbols - 1))) {    // Decode constellation
+      pCtx->pSlicer(DecisionReal, DecisionImag, pRxSymbols + (s + 1 - Decision), Decision);
+      Decision = 0;
+    }
+  }
+
+  // The magnitude holds the filter output for the last sample, or is reset after a decision
+  if ((pModem->RRCFSwitch == SIGLIB_ENABLE) && (pCtx->NumberOfSymbols > 0)) {
+    if (SampleClock == SIGLIB_AI_ZERO) {
+      Magn.real = SIGLIB_ZERO;
+      Magn.imag = SIGLIB_ZERO;
+    } else {
+      const SLArrayIndex_t LastIndex = (FilterIndex == (FilterLength - 1)) ? 0 : (FilterIndex + 1);
+      Magn.real = siglib_numerix_QamModemFir(pIState, pModem->pRRCFCoeffs, LastIndex, FilterLength);
+      Magn.imag = siglib_numerix_QamModemFir(pQState, pModem->pRRCFCoeffs, LastIndex, FilterLength);
+    }
+  }
+
+  pModem->pCarrierPhase[channel] =
+    (SLData_t)(((SLUInt64_t)NcoPosition * (SLUInt64_t)pModem->CarrierTableIncrement) % (SLUInt64_t)pModem->CarrierTableSize);
+  pModem->pSampleClock[channel] = SampleClock;
+  pModem->pMagn[channel] = Magn;
+  pModem->pRRCFIFilterIndex[channel] = FilterIndex;
+  pModem->pRRCFQFilterIndex[channel] = FilterIndex;
+}    // End of siglib_numerix_QamDemodulateChannel()
+
+/********************************************************
+ * Function: SDA_QpskDemodulateMultiChannel
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLFixData_t *pRxDiBits,             - Pointer to Rx di-bits
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLArrayIndex_t NumberOfSymbols - Number of symbols per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Demodulate NumberOfSymbols di-bits on each channel.
+ *  The source array holds the
+ *  (NumberOfSymbols x SamplesPerSymbol) samples of each
+ *  channel in turn and the destination array holds the
+ *  di-bits of each channel in turn.
+ *  The di-bits and the per channel state are the same
+ *  as for NumberOfSymbols calls to SDA_QpskDemodulate.
+ *  The channels are processed through SUF_ParallelFor.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_QpskDemodulateMultiChannel(const SLData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pRxDiBits,
+                                                     SLQamModemMultiChannel_s* pModem, const SLArrayIndex_t NumberOfSymbols)
+{
+  siglib_numerix_QamModemContext_s Ctx;
+  Ctx.pModem = pModem;
+  Ctx.pSrc = pSrc;
+  Ctx.pRxSymbols = pRxDiBits;
+  Ctx.pSlicer = siglib_numerix_QpskSlice;
+  Ctx.NumberOfSymbols = NumberOfSymbols;
+
+  SUF_ParallelFor(siglib_numerix_QamDemodulateChannel, &Ctx, pModem->NumberOfChannels);
+}    // End of SDA_QpskDemodulateMultiChannel()
+
+/********************************************************
+ * Function: SDA_Qam16DemodulateMultiChannel
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLFixData_t *pRxNibbles,            - Pointer to Rx nibbles
+ *  SLQamModemMultiChannel_s *pModem,   - Pointer to modem structure
+ *  const SLArrayIndex_t NumberOfSymbols - Number of symbols per channel
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Demodulate NumberOfSymbols nibbles on each channel.
+ *  The source array holds the
+ *  (NumberOfSymbols x SamplesPerSymbol) samples of each
+ *  channel in turn and the destination array holds the
+ *  nibbles of each channel in turn.
+ *  The nibbles and the per channel state are the same
+ *  as for NumberOfSymbols calls to SDA_Qam16Demodulate.
+ *  The channels are processed through SUF_ParallelFor.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Qam16DemodulateMultiChannel(const SLData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pRxNibbles,
+                                                      SLQamModemMultiChannel_s* pModem, const SLArrayIndex_t NumberOfSymbols)
+{
+  siglib_numerix_QamModemContext_s Ctx;
+  Ctx.pModem = pModem;
+  Ctx.pSrc = pSrc;
+  Ctx.pRxSymbols = pRxNibbles;
+  Ctx.pSlicer = siglib_numerix_Qam16Slice;
+  Ctx.NumberOfSymbols = NumberOfSymbols;
+
+  SUF_ParallelFor(siglib_numerix_QamDemodulateChannel, &Ctx, pModem->NumberOfChannels);
+}    // End of SDA_Qam16DemodulateMultiChannel()
+
+/********************************************************
+ * Function: SUF_QamModemMultiChannelFree
+ *
+ * Parameters:
+ *  SLQamModemMultiChannel_s *pModem    - Pointer to modem structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the memory allocated by
+ *  SIF_QamModulateMultiChannel or
+ *  SIF_QamDemodulateMultiChannel.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_QamModemMultiChannelFree(SLQamModemMultiChannel_s* pModem)
+{
+  if (SIGLIB_NULL_DATA_PTR != pModem->pCarrierTable) {
+    SUF_MemoryFree(pModem->pCarrierTable);
+    pModem->pCarrierTable = SIGLIB_NULL_DATA_PTR;
+  }
+  if (SIGLIB_NULL_COMPLEX_RECT_PTR != pModem->pMagn) {
+    SUF_MemoryFree(pModem->pMagn);
+    pModem->pMagn = SIGLIB_NULL_COMPLEX_RECT_PTR;
+  }
+  if (SIGLIB_NULL_ARRAY_INDEX_PTR != pModem->pNcoIndex) {
+    SUF_MemoryFree(pModem->pNcoIndex);
+    pModem->pNcoIndex = SIGLIB_NULL_ARRAY_INDEX_PTR;
+  }
+}    // End of SUF_QamModemMultiChannelFree()
+
 // OPSK functions
 
 // Definition of constelation space - With Gray Coding
@@ -2690,6 +3467,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_OpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
                                                 SLArrayIndex_t* SIGLIB_PTR_DECL pRRCFRxQFilterIndex, SLData_t* SIGLIB_PTR_DECL pRRCFCoeffs,
                                                 const SLArrayIndex_t RRCFSize, const SLArrayIndex_t RRCFSwitch)
 {
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_OPSK_DEMODULATE);
+
   SLData_t ISample, QSample;    // Data samples
   SLArrayIndex_t i;
   SLFixData_t RxTriBit = SIGLIB_AI_ZERO;
@@ -2739,6 +3518,7 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_OpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
     }
   }
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_OPSK_DEMODULATE);
   return (RxTriBit);
 
 }    // End of SDA_OpskDemodulate()
@@ -3077,6 +3857,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_BpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_BPSK_DEMODULATE);
+
   SLFixData_t ReturnValue = SIGLIB_FIX_ZERO;
   SLData_t RealTmp,
       ImagTmp;                              // Temporary data processing variables - one for each path
@@ -3116,6 +3898,7 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_BpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
     *pSample = SDS_OnePole(RealTmp * ImagTmp, CostasLpLoopFilterCoeff, pCostasLpLoopFilterState);
   }
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_BPSK_DEMODULATE);
   return (ReturnValue);
 }    // End of SDA_BpskDemodulate()
 
@@ -3442,6 +4225,8 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_DpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
 #  endif
 #endif
 
+  SIGLIB_PROFILE_START(SIGLIB_PROFILE_SDA_DPSK_DEMODULATE);
+
   SLFixData_t ReturnValue = SIGLIB_AI_ZERO;
   SLData_t RealTmp,
       ImagTmp;                              // Temporary data processing variables - one for each path
@@ -3485,6 +4270,7 @@ SLFixData_t SIGLIB_FUNC_DECL SDA_DpskDemodulate(const SLData_t* SIGLIB_PTR_DECL
     *pSample = SDS_OnePole(RealTmp * ImagTmp, CostasLpLoopFilterCoeff, pCostasLpLoopFilterState);
   }
 
+  SIGLIB_PROFILE_END(SIGLIB_PROFILE_SDA_DPSK_DEMODULATE);
   return (ReturnValue);
 }    // End of SDA_DpskDemodulate()
 
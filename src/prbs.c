@@ -32,7 +32,7 @@ support@.numerix-dsp.com
 
 Copyright (c) 2026 Delta Numerix All rights reserved.
 ---------------------------------------------------------------------------
-Description: PRBS Scrambler / descrambler routines, for SigLib DSP library.
+Description: PRBS Scrambler / descrambler and CRC routines, for SigLib DSP library.
 
 ****************************************************************************/
 
@@ -40,6 +40,13 @@ Description: PRBS Scrambler / descrambler routines, for SigLib DSP library.
 
 #include <siglib.h>    // Include SigLib header file
 
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#  define SIGLIB_CRC_CLMUL 1    // Carry-less multiply CRC folding, selected at run time
+#  include <immintrin.h>
+#else
+#  define SIGLIB_CRC_CLMUL 0
+#endif
+
 /********************************************************
  * Function: SDS_Scrambler1417
  *
@@ -946,6 +953,10 @@ SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorgCRC8(SLUInt32_t* SIGLIB_PTR_D
   return ((SLFixData_t)OTmp);
 }    // End of SDS_SequenceGeneratorgCRC8()
 
+#define SIGLIB_LONG_CODE_BLOCK_LENGTH 32    // Chips generated per register update
+
+static const SLData_t siglib_numerix_LongCodeLevels[2] = {SIGLIB_ONE, SIGLIB_MINUS_ONE};    // Binary value to balanced output
+
 /********************************************************
  * Function: SDS_LongCodeGenerator3GPPDL
  *
@@ -973,24 +984,49 @@ SLFixData_t SIGLIB_FUNC_DECL SDS_SequenceGeneratorgCRC8(SLUInt32_t* SIGLIB_PTR_D
 void SIGLIB_FUNC_DECL SDS_LongCodeGenerator3GPPDL(SLComplexRect_s* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pXShiftRegister,
                                                   SLUInt32_t* SIGLIB_PTR_DECL pYShiftRegister, const SLArrayIndex_t NumberOfSamples)
 {
-  SLUInt32_t SRXTmp = *pXShiftRegister;
-  SLUInt32_t SRYTmp = *pYShiftRegister;
-
-  for (SLArrayIndex_t i = 0; i < NumberOfSamples; i++) {                     // Process each bit in the word
-    SLUInt32_t FXTmp = (SRXTmp >> 15U) ^ (SRXTmp >> 6U) ^ (SRXTmp >> 4U);    // Caclulate feedforward
-    SLUInt32_t FYTmp = (SRYTmp >> 15U) ^ (SRYTmp >> 14U) ^ (SRYTmp >> 13U) ^ (SRYTmp >> 12U) ^ (SRYTmp >> 11U) ^ (SRYTmp >> 10U) ^ (SRYTmp >> 9U) ^
+  SLUInt64_t SRXTmp = *pXShiftRegister;
+  SLUInt64_t SRYTmp = *pYShiftRegister;
+  SLArrayIndex_t i = 0;
+
+  // Seed bits above the 18 bit registers are shifted out one chip at a time
+  for (; (i < NumberOfSamples) && (0U != ((SRXTmp | SRYTmp) >> 18U)); i++) {
+    SLUInt64_t FXTmp = (SRXTmp >> 15U) ^ (SRXTmp >> 6U) ^ (SRXTmp >> 4U);    // Caclulate feedforward
+    SLUInt64_t FYTmp = (SRYTmp >> 15U) ^ (SRYTmp >> 14U) ^ (SRYTmp >> 13U) ^ (SRYTmp >> 12U) ^ (SRYTmp >> 11U) ^ (SRYTmp >> 10U) ^ (SRYTmp >> 9U) ^
                        (SRYTmp >> 8U) ^ (SRYTmp >> 6U) ^ (SRYTmp >> 5U);
 
-    pDst->real = (-(((SLData_t)((SRXTmp ^ SRYTmp) & 0x1U))) * SIGLIB_TWO) + SIGLIB_ONE;    // Write new output value
-    pDst->imag = (-(((SLData_t)((FXTmp ^ FYTmp) & 0x1U))) * SIGLIB_TWO) + SIGLIB_ONE;
+    pDst->real = siglib_numerix_LongCodeLevels[(SRXTmp ^ SRYTmp) & 0x1U];    // Write new output value
+    pDst->imag = siglib_numerix_LongCodeLevels[(FXTmp ^ FYTmp) & 0x1U];
     pDst++;
     SRXTmp |= ((SRXTmp ^ (SRXTmp >> 7U)) & 0x1U) << 18U;                                       // Caclulate feedback
     SRXTmp >>= 1U;                                                                             // Shift state register
     SRYTmp |= ((SRYTmp ^ (SRYTmp >> 10U) ^ (SRYTmp >> 7U) ^ (SRYTmp >> 5U)) & 0x1U) << 18U;    // Caclulate feedback
     SRYTmp >>= 1U;                                                                             // Shift state register
   }
-  *pXShiftRegister = SRXTmp;
-  *pYShiftRegister = SRYTmp;
+
+  for (; i < NumberOfSamples; i += SIGLIB_LONG_CODE_BLOCK_LENGTH) {    // Process a block of chips
+    SLArrayIndex_t BlockLength = ((NumberOfSamples - i) < SIGLIB_LONG_CODE_BLOCK_LENGTH) ? (NumberOfSamples - i) : SIGLIB_LONG_CODE_BLOCK_LENGTH;
+
+    for (SLUInt32_t k = 18U; k < 50U; k += 11U) {    // Extend X sequence to 50 bits, 11 new bits per step
+      SRXTmp |= (((SRXTmp >> (k - 18U)) ^ (SRXTmp >> (k - 11U))) & 0x7FFU) << k;
+    }
+    for (SLUInt32_t k = 18U; k < 50U; k += 8U) {    // Extend Y sequence to 50 bits, 8 new bits per step
+      SRYTmp |= (((SRYTmp >> (k - 18U)) ^ (SRYTmp >> (k - 13U)) ^ (SRYTmp >> (k - 11U)) ^ (SRYTmp >> (k - 8U))) & 0xFFU) << k;
+    }
+
+    SLUInt64_t RealBits = SRXTmp ^ SRYTmp;
+    SLUInt64_t ImagBits = (SRXTmp >> 15U) ^ (SRXTmp >> 6U) ^ (SRXTmp >> 4U) ^ (SRYTmp >> 15U) ^ (SRYTmp >> 14U) ^ (SRYTmp >> 13U) ^
+                          (SRYTmp >> 12U) ^ (SRYTmp >> 11U) ^ (SRYTmp >> 10U) ^ (SRYTmp >> 9U) ^ (SRYTmp >> 8U) ^ (SRYTmp >> 6U) ^ (SRYTmp >> 5U);
+
+    for (SLArrayIndex_t j = 0; j < BlockLength; j++) {    // Write new output values
+      pDst->real = siglib_numerix_LongCodeLevels[(RealBits >> j) & 0x1U];
+      pDst->imag = siglib_numerix_LongCodeLevels[(ImagBits >> j) & 0x1U];
+      pDst++;
+    }
+    SRXTmp = (SRXTmp >> BlockLength) & 0x3FFFFU;    // Shift state registers
+    SRYTmp = (SRYTmp >> BlockLength) & 0x3FFFFU;
+  }
+  *pXShiftRegister = (SLUInt32_t)SRXTmp;
+  *pYShiftRegister = (SLUInt32_t)SRYTmp;
 }    // End of SDS_LongCodeGenerator3GPPDL()
 
 /********************************************************
@@ -1020,21 +1056,1366 @@ void SIGLIB_FUNC_DECL SDS_LongCodeGenerator3GPPDL(SLComplexRect_s* SIGLIB_PTR_DE
 void SIGLIB_FUNC_DECL SDS_LongCodeGenerator3GPPUL(SLComplexRect_s* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pXShiftRegister,
                                                   SLUInt32_t* SIGLIB_PTR_DECL pYShiftRegister, const SLArrayIndex_t NumberOfSamples)
 {
-  SLUInt32_t SRXTmp = *pXShiftRegister;
-  SLUInt32_t SRYTmp = *pYShiftRegister;
+  SLUInt64_t SRXTmp = *pXShiftRegister;
+  SLUInt64_t SRYTmp = *pYShiftRegister;
+  SLArrayIndex_t i = 0;
 
-  for (SLArrayIndex_t i = 0; i < NumberOfSamples; i++) {                     // Process each bit in the word
-    SLUInt32_t FXTmp = (SRXTmp >> 18U) ^ (SRXTmp >> 7U) ^ (SRXTmp >> 4U);    // Caclulate feedforward
-    SLUInt32_t FYTmp = (SRYTmp >> 17U) ^ (SRYTmp >> 6U) ^ (SRYTmp >> 4U);
+  // Seed bits above the 25 bit registers are shifted out one chip at a time
+  for (; (i < NumberOfSamples) && (0U != ((SRXTmp | SRYTmp) >> 25U)); i++) {
+    SLUInt64_t FXTmp = (SRXTmp >> 18U) ^ (SRXTmp >> 7U) ^ (SRXTmp >> 4U);    // Caclulate feedforward
+    SLUInt64_t FYTmp = (SRYTmp >> 17U) ^ (SRYTmp >> 6U) ^ (SRYTmp >> 4U);
 
-    pDst->real = (-(((SLData_t)((SRXTmp ^ SRYTmp) & 0x1U))) * SIGLIB_TWO) + SIGLIB_ONE;    // Write new output value
-    pDst->imag = (-(((SLData_t)((FXTmp ^ FYTmp) & 0x1U))) * SIGLIB_TWO) + SIGLIB_ONE;
+    pDst->real = siglib_numerix_LongCodeLevels[(SRXTmp ^ SRYTmp) & 0x1U];    // Write new output value
+    pDst->imag = siglib_numerix_LongCodeLevels[(FXTmp ^ FYTmp) & 0x1U];
     pDst++;
     SRXTmp |= ((SRXTmp ^ (SRXTmp >> 3U)) & 0x1U) << 25U;                                      // Caclulate feedback
     SRXTmp >>= 1U;                                                                            // Shift state register
     SRYTmp |= ((SRYTmp ^ (SRYTmp >> 3U) ^ (SRYTmp >> 2U) ^ (SRYTmp >> 1U)) & 0x1U) << 25U;    // Caclulate feedback
     SRYTmp >>= 1U;                                                                            // Shift state register
   }
-  *pXShiftRegister = SRXTmp;
-  *pYShiftRegister = SRYTmp;
+
+  for (; i < NumberOfSamples; i += SIGLIB_LONG_CODE_BLOCK_LENGTH) {    // Process a block of chips
+    SLArrayIndex_t BlockLength = ((NumberOfSamples - i) < SIGLIB_LONG_CODE_BLOCK_LENGTH) ? (NumberOfSamples - i) : SIGLIB_LONG_CODE_BLOCK_LENGTH;
+
+    // Extend the sequences to 57 bits, 22 new bits then 10 new bits
+    SRXTmp |= ((SRXTmp ^ (SRXTmp >> 3U)) & 0x3FFFFFU) << 25U;
+    SRXTmp |= (((SRXTmp >> 22U) ^ (SRXTmp >> 25U)) & 0x3FFU) << 47U;
+    SRYTmp |= ((SRYTmp ^ (SRYTmp >> 1U) ^ (SRYTmp >> 2U) ^ (SRYTmp >> 3U)) & 0x3FFFFFU) << 25U;
+    SRYTmp |= (((SRYTmp >> 22U) ^ (SRYTmp >> 23U) ^ (SRYTmp >> 24U) ^ (SRYTmp >> 25U)) & 0x3FFU) << 47U;
+
+    SLUInt64_t RealBits = SRXTmp ^ SRYTmp;
+    SLUInt64_t ImagBits = (SRXTmp >> 18U) ^ (SRXTmp >> 7U) ^ (SRXTmp >> 4U) ^ (SRYTmp >> 17U) ^ (SRYTmp >> 6U) ^ (SRYTmp >> 4U);
+
+    for (SLArrayIndex_t j = 0; j < BlockLength; j++) {    // Write new output values
+      pDst->real = siglib_numerix_LongCodeLevels[(RealBits >> j) & 0x1U];
+      pDst->imag = siglib_numerix_LongCodeLevels[(ImagBits >> j) & 0x1U];
+      pDst++;
+    }
+    SRXTmp = (SRXTmp >> BlockLength) & 0x1FFFFFFU;    // Shift state registers
+    SRYTmp = (SRYTmp >> BlockLength) & 0x1FFFFFFU;
+  }
+  *pXShiftRegister = (SLUInt32_t)SRXTmp;
+  *pYShiftRegister = (SLUInt32_t)SRYTmp;
 }    // End of SDS_LongCodeGenerator3GPPUL()
+
+// Array versions of the scramblers and sequence generators
+// The self synchronizing scramblers are processed a byte at a time, with the
+// tap contributions read directly from the shift register.
+// The additive scramblers and sequence generators use a set of 16 entry
+// tables, one per 4 bits of state, to jump the shift register 8 bits at a time.
+
+#define SIGLIB_PRBS_MAX_ADDITIVE_LENGTH 24U                                               // Longest additive shift register
+#define SIGLIB_PRBS_MAX_TABLE_GROUPS ((SIGLIB_PRBS_MAX_ADDITIVE_LENGTH + 3U) >> 2U)    // Number of 4 bit groups
+
+static const SLUInt8_t siglib_numerix_ReverseByte[256] = {
+  0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+  0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+  0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+  0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+  0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+  0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+  0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+  0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+  0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+  0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+  0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+  0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+  0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+  0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+  0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+  0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF,
+};
+
+/********************************************************
+ * Function: siglib_numerix_SelfSyncScramble
+ *
+ * Parameters:
+ *  const SLUInt32_t    Data byte
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLUInt32_t    Tap 1 - may be less than 8
+ *  const SLUInt32_t    Tap 2 - must be 8 or greater
+ *
+ * Return value:
+ *  Scrambled byte
+ *
+ * Description:
+ *  Scramble one byte with the self synchronizing
+ *  scrambler 1 + x-Tap1 + x-Tap2.
+ *  The shift register holds the newest bit in the lsb
+ *  so the byte is bit reversed into shift register order,
+ *  where all 8 output bits can be calculated together.
+ *  Taps shorter than 8 feed back the new bits, which is
+ *  resolved with a prefix XOR.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_SelfSyncScramble(const SLUInt32_t Source, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLUInt32_t Tap1,
+                                                  const SLUInt32_t Tap2)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+  SLUInt32_t Extended = SRTmp << 8U;    // Space for the new bits
+
+  SLUInt32_t RTmp = ((SLUInt32_t)siglib_numerix_ReverseByte[Source & 0xFFU] ^ (Extended >> Tap1) ^ (Extended >> Tap2)) & 0xFFU;
+  for (SLUInt32_t Shift = Tap1; Shift < 8U; Shift <<= 1U) {    // Resolve feedback of the new bits
+    RTmp ^= RTmp >> Shift;
+  }
+
+  *pShiftRegister = Extended | RTmp;
+  return ((SLUInt32_t)siglib_numerix_ReverseByte[RTmp]);
+}    // End of siglib_numerix_SelfSyncScramble()
+
+/********************************************************
+ * Function: siglib_numerix_SelfSyncDescramble
+ *
+ * Parameters:
+ *  const SLUInt32_t    Data byte
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLUInt32_t    Tap 1
+ *  const SLUInt32_t    Tap 2
+ *
+ * Return value:
+ *  Descrambled byte
+ *
+ * Description:
+ *  Descramble one byte with the self synchronizing
+ *  descrambler 1 + x-Tap1 + x-Tap2.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_SelfSyncDescramble(const SLUInt32_t Source, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLUInt32_t Tap1,
+                                                    const SLUInt32_t Tap2)
+{
+  SLUInt32_t Reversed = (SLUInt32_t)siglib_numerix_ReverseByte[Source & 0xFFU];
+  SLUInt32_t Extended = (*pShiftRegister << 8U) | Reversed;
+
+  *pShiftRegister = Extended;
+  return ((SLUInt32_t)siglib_numerix_ReverseByte[(Reversed ^ (Extended >> Tap1) ^ (Extended >> Tap2)) & 0xFFU]);
+}    // End of siglib_numerix_SelfSyncDescramble()
+
+/********************************************************
+ * Function: siglib_numerix_LeadingOnes
+ *
+ * Parameters:
+ *  const SLUInt32_t    Data byte
+ *
+ * Return value:
+ *  Number of consecutive ones at the msb end of the byte
+ *
+ * Description:
+ *  Used to update the ones bit counter of the inversion
+ *  scramblers, where the msb is the most recent bit.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_LeadingOnes(const SLUInt32_t Byte)
+{
+  SLUInt32_t Count = 0U;
+  while ((Count < 8U) && (Byte & (0x80U >> Count))) {
+    Count++;
+  }
+  return (Count);
+}    // End of siglib_numerix_LeadingOnes()
+
+/********************************************************
+ * Function: siglib_numerix_AdditiveScrambler
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc - NULL for sequence generation
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLUInt32_t    Feedback taps mask
+ *  const SLUInt32_t    Shift register length
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Additive scrambler / sequence generator engine for
+ *  shift registers of 8 to 24 bits, where the sequence
+ *  is read from bit 0 and the feedback bit is the parity
+ *  of the taps mask and is written to the top of the
+ *  shift register.
+ *  The next 8 bits of the sequence are the bottom 8 bits
+ *  of the shift register and the 8 new feedback bits are
+ *  a linear function of the state, which is tabulated
+ *  for each 4 bits of state from the single bit
+ *  responses of the register.
+ *  Seed bits above the shift register length are ORed
+ *  into the feedback bit as they shift down, as in the
+ *  SDS functions, so those bytes are generated one bit
+ *  at a time.
+ *
+ ********************************************************/
+
+static void siglib_numerix_AdditiveScrambler(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                             SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLUInt32_t Taps, const SLUInt32_t RegisterLength,
+                                             const SLArrayIndex_t ArrayLength)
+{
+  SLUInt8_t JumpTable[SIGLIB_PRBS_MAX_TABLE_GROUPS][16];
+
+  for (SLUInt32_t Group = 0U; Group < SIGLIB_PRBS_MAX_TABLE_GROUPS; Group++) {    // Build the jump tables, unused groups are zero
+    JumpTable[Group][0] = 0U;
+    for (SLUInt32_t Bit = 0U; Bit < 4U; Bit++) {
+      SLUInt32_t SRTmp = 0U;
+      if ((Group * 4U) + Bit < RegisterLength) {
+        SRTmp = 1UL << ((Group * 4U) + Bit);
+        for (SLUInt32_t i = 0U; i < 8U; i++) {    // Step the register from the single bit state
+          SLUInt32_t Parity = SRTmp & Taps;
+          Parity ^= Parity >> 16U;
+          Parity ^= Parity >> 8U;
+          Parity ^= Parity >> 4U;
+          Parity ^= Parity >> 2U;
+          Parity ^= Parity >> 1U;
+          SRTmp |= (Parity & 0x1U) << RegisterLength;
+          SRTmp >>= 1U;
+        }
+        SRTmp >>= RegisterLength - 8U;    // The new feedback bits
+      }
+      for (SLUInt32_t Index = 0U; Index < (1U << Bit); Index++) {    // Combine with the lower bits of the group
+        JumpTable[Group][(1U << Bit) + Index] = (SLUInt8_t)(JumpTable[Group][Index] ^ SRTmp);
+      }
+    }
+  }
+
+  SLUInt32_t SRTmp = *pShiftRegister;
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    SLUInt32_t OTmp;
+    if (0U == (SRTmp >> RegisterLength)) {
+      OTmp = SRTmp & 0xFFU;    // Next 8 bits of the sequence
+      SLUInt32_t Feedback = 0U;
+      for (SLUInt32_t Group = 0U; Group < SIGLIB_PRBS_MAX_TABLE_GROUPS; Group++) {
+        Feedback ^= JumpTable[Group][(SRTmp >> (Group * 4U)) & 0xFU];
+      }
+      SRTmp = (SRTmp >> 8U) | (Feedback << (RegisterLength - 8U));
+    } else {    // Seed bits above the shift register
+      OTmp = 0U;
+      for (SLUInt32_t Bit = 0U; Bit < 8U; Bit++) {
+        OTmp |= (SRTmp & 0x1U) << Bit;
+        SLUInt32_t Parity = SRTmp & Taps;
+        Parity ^= Parity >> 16U;
+        Parity ^= Parity >> 8U;
+        Parity ^= Parity >> 4U;
+        Parity ^= Parity >> 2U;
+        Parity ^= Parity >> 1U;
+        SRTmp |= (Parity & 0x1U) << RegisterLength;
+        SRTmp >>= 1U;
+      }
+    }
+
+    if (SIGLIB_NULL_FIX_DATA_PTR == pSrc) {
+      pDst[i] = (SLFixData_t)OTmp;
+    } else {
+      pDst[i] = (SLFixData_t)(OTmp ^ (SLUInt32_t)pSrc[i]);
+    }
+  }
+  *pShiftRegister = SRTmp;
+}    // End of siglib_numerix_AdditiveScrambler()
+
+/********************************************************
+ * Function: SDA_Scrambler1417
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing scrambler
+ *  having the generating polynomial: 1 + x-14 + x-17, on an
+ *  array of data bytes.
+ *  The results are identical to calling SDS_Scrambler1417()
+ *  for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Scrambler1417(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                        SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    pDst[i] = (SLFixData_t)siglib_numerix_SelfSyncScramble((SLUInt32_t)pSrc[i], &SRTmp, 14U, 17U);
+  }
+  *pShiftRegister = SRTmp;
+}    // End of SDA_Scrambler1417()
+
+/********************************************************
+ * Function: SDA_Descrambler1417
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing descrambler
+ *  having the generating polynomial: 1 + x-14 + x-17, on an
+ *  array of data bytes.
+ *  The results are identical to calling SDS_Descrambler1417()
+ *  for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Descrambler1417(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                          SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    pDst[i] = (SLFixData_t)siglib_numerix_SelfSyncDescramble((SLUInt32_t)pSrc[i], &SRTmp, 14U, 17U);
+  }
+  *pShiftRegister = SRTmp;
+}    // End of SDA_Descrambler1417()
+
+/********************************************************
+ * Function: SDA_Scrambler1417WithInversion
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  SLFixData_t         *pOnesBitCount,
+ *  SLFixData_t         *pBitInversionFlag,
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing scrambler
+ *  having the generating polynomial: 1 + x-14 + x-17,
+ *  with detection of 64 consecutive ones at the
+ *  output of the scrambler, on an array of data bytes.
+ *  Bytes that can not complete a run of 64 ones are
+ *  processed 8 bits at a time, the remainder are
+ *  processed with SDS_Scrambler1417WithInversion().
+ *  The results are identical to calling
+ *  SDS_Scrambler1417WithInversion() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Scrambler1417WithInversion(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                     SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, SLFixData_t* SIGLIB_PTR_DECL pOnesBitCount,
+                                                     SLFixData_t* SIGLIB_PTR_DECL pBitInversionFlag, const SLArrayIndex_t ArrayLength)
+{
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    if ((*pBitInversionFlag == 0) && (*pOnesBitCount < (64 - SIGLIB_BYTE_LENGTH))) {    // No inversion possible in this byte
+      SLUInt32_t ITmp = (SLUInt32_t)pSrc[i] & 0xFFU;
+      SLUInt32_t OTmp = siglib_numerix_SelfSyncScramble(ITmp, pShiftRegister, 14U, 17U);
+      if (OTmp == 0xFFU) {
+        *pOnesBitCount += SIGLIB_BYTE_LENGTH;
+      } else {
+        *pOnesBitCount = (SLFixData_t)siglib_numerix_LeadingOnes(OTmp);
+      }
+      pDst[i] = (SLFixData_t)OTmp;
+    } else {
+      pDst[i] = SDS_Scrambler1417WithInversion(pSrc[i], pShiftRegister, pOnesBitCount, pBitInversionFlag);
+    }
+  }
+}    // End of SDA_Scrambler1417WithInversion()
+
+/********************************************************
+ * Function: SDA_Descrambler1417WithInversion
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  SLFixData_t         *pOnesBitCount,
+ *  SLFixData_t         *pBitInversionFlag,
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing descrambler
+ *  having the generating polynomial: 1 + x-14 + x-17,
+ *  with detection of 64 consecutive ones at the
+ *  input to the descrambler, on an array of data bytes.
+ *  Bytes that can not complete a run of 64 ones are
+ *  processed 8 bits at a time, the remainder are
+ *  processed with SDS_Descrambler1417WithInversion().
+ *  The results are identical to calling
+ *  SDS_Descrambler1417WithInversion() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Descrambler1417WithInversion(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                       SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, SLFixData_t* SIGLIB_PTR_DECL pOnesBitCount,
+                                                       SLFixData_t* SIGLIB_PTR_DECL pBitInversionFlag, const SLArrayIndex_t ArrayLength)
+{
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    if ((*pBitInversionFlag == 0) && (*pOnesBitCount < (64 - SIGLIB_BYTE_LENGTH))) {    // No inversion possible in this byte
+      SLUInt32_t ITmp = (SLUInt32_t)pSrc[i] & 0xFFU;
+      SLUInt32_t OTmp = siglib_numerix_SelfSyncDescramble(ITmp, pShiftRegister, 14U, 17U);
+      if (ITmp == 0xFFU) {
+        *pOnesBitCount += SIGLIB_BYTE_LENGTH;
+      } else {
+        *pOnesBitCount = (SLFixData_t)siglib_numerix_LeadingOnes(ITmp);
+      }
+      pDst[i] = (SLFixData_t)OTmp;
+    } else {
+      pDst[i] = SDS_Descrambler1417WithInversion(pSrc[i], pShiftRegister, pOnesBitCount, pBitInversionFlag);
+    }
+  }
+}    // End of SDA_Descrambler1417WithInversion()
+
+/********************************************************
+ * Function: SDA_Scrambler1823
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing scrambler
+ *  having the generating polynomial: 1 + x-18 + x-23, on an
+ *  array of data bytes.
+ *  The results are identical to calling SDS_Scrambler1823()
+ *  for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Scrambler1823(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                        SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    pDst[i] = (SLFixData_t)siglib_numerix_SelfSyncScramble((SLUInt32_t)pSrc[i], &SRTmp, 18U, 23U);
+  }
+  *pShiftRegister = SRTmp;
+}    // End of SDA_Scrambler1823()
+
+/********************************************************
+ * Function: SDA_Descrambler1823
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing descrambler
+ *  having the generating polynomial: 1 + x-18 + x-23, on an
+ *  array of data bytes.
+ *  The results are identical to calling SDS_Descrambler1823()
+ *  for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Descrambler1823(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                          SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    pDst[i] = (SLFixData_t)siglib_numerix_SelfSyncDescramble((SLUInt32_t)pSrc[i], &SRTmp, 18U, 23U);
+  }
+  *pShiftRegister = SRTmp;
+}    // End of SDA_Descrambler1823()
+
+/********************************************************
+ * Function: SDA_Scrambler523
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing scrambler
+ *  having the generating polynomial: 1 + x-5 + x-23, on an
+ *  array of data bytes.
+ *  The results are identical to calling SDS_Scrambler523()
+ *  for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Scrambler523(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                       SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    pDst[i] = (SLFixData_t)siglib_numerix_SelfSyncScramble((SLUInt32_t)pSrc[i], &SRTmp, 5U, 23U);
+  }
+  *pShiftRegister = SRTmp;
+}    // End of SDA_Scrambler523()
+
+/********************************************************
+ * Function: SDA_Descrambler523
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a self synchronizing descrambler
+ *  having the generating polynomial: 1 + x-5 + x-23, on an
+ *  array of data bytes.
+ *  The results are identical to calling SDS_Descrambler523()
+ *  for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_Descrambler523(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                         SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt32_t SRTmp = *pShiftRegister;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+    pDst[i] = (SLFixData_t)siglib_numerix_SelfSyncDescramble((SLUInt32_t)pSrc[i], &SRTmp, 5U, 23U);
+  }
+  *pShiftRegister = SRTmp;
+}    // End of SDA_Descrambler523()
+
+/********************************************************
+ * Function: SDA_ScramblerDescramblerPN9
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a scrambler
+ *  having the generating polynomial: x^9+x^4+1,
+ *  on an array of data bytes.
+ *  The results are identical to calling
+ *  SDS_ScramblerDescramblerPN9() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblerPN9(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                  SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(pSrc, pDst, pShiftRegister, 0x011U, 9U, ArrayLength);
+}    // End of SDA_ScramblerDescramblerPN9()
+
+/********************************************************
+ * Function: SDA_SequenceGeneratorPN9
+ *
+ * Parameters:
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function generates an array of bytes of the
+ *  PN9 sequence having the generating polynomial:
+ *  x^9+x^4+1.
+ *  The results are identical to calling
+ *  SDS_SequenceGeneratorPN9() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorPN9(SLFixData_t* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister,
+                                               const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(SIGLIB_NULL_FIX_DATA_PTR, pDst, pShiftRegister, 0x011U, 9U, ArrayLength);
+}    // End of SDA_SequenceGeneratorPN9()
+
+/********************************************************
+ * Function: SDA_ScramblerDescramblerPN15
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a scrambler
+ *  having the generating polynomial: x^15+x^14+1,
+ *  on an array of data bytes.
+ *  The results are identical to calling
+ *  SDS_ScramblerDescramblerPN15() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblerPN15(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                   SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(pSrc, pDst, pShiftRegister, 0x4001U, 15U, ArrayLength);
+}    // End of SDA_ScramblerDescramblerPN15()
+
+/********************************************************
+ * Function: SDA_SequenceGeneratorPN15
+ *
+ * Parameters:
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function generates an array of bytes of the
+ *  PN15 sequence having the generating polynomial:
+ *  x^15+x^14+1.
+ *  The results are identical to calling
+ *  SDS_SequenceGeneratorPN15() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorPN15(SLFixData_t* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister,
+                                                const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(SIGLIB_NULL_FIX_DATA_PTR, pDst, pShiftRegister, 0x4001U, 15U, ArrayLength);
+}    // End of SDA_SequenceGeneratorPN15()
+
+/********************************************************
+ * Function: SDA_ScramblerDescramblergCRC24
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a scrambler
+ *  having the generating polynomial: D^24 + D^23 + D^6 + D^5 + D + 1,
+ *  on an array of data bytes.
+ *  The results are identical to calling
+ *  SDS_ScramblerDescramblergCRC24() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC24(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                     SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(pSrc, pDst, pShiftRegister, 0x800063U, 24U, ArrayLength);
+}    // End of SDA_ScramblerDescramblergCRC24()
+
+/********************************************************
+ * Function: SDA_SequenceGeneratorgCRC24
+ *
+ * Parameters:
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function generates an array of bytes of the
+ *  gCRC24 sequence having the generating polynomial:
+ *  D^24 + D^23 + D^6 + D^5 + D + 1.
+ *  The results are identical to calling
+ *  SDS_SequenceGeneratorgCRC24() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC24(SLFixData_t* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister,
+                                                  const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(SIGLIB_NULL_FIX_DATA_PTR, pDst, pShiftRegister, 0x800063U, 24U, ArrayLength);
+}    // End of SDA_SequenceGeneratorgCRC24()
+
+/********************************************************
+ * Function: SDA_ScramblerDescramblergCRC16
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a scrambler
+ *  having the generating polynomial: D^16 + D^12 + D^5 + 1,
+ *  on an array of data bytes.
+ *  The results are identical to calling
+ *  SDS_ScramblerDescramblergCRC16() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC16(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                     SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(pSrc, pDst, pShiftRegister, 0x1021U, 16U, ArrayLength);
+}    // End of SDA_ScramblerDescramblergCRC16()
+
+/********************************************************
+ * Function: SDA_SequenceGeneratorgCRC16
+ *
+ * Parameters:
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function generates an array of bytes of the
+ *  gCRC16 sequence having the generating polynomial:
+ *  D^16 + D^12 + D^5 + 1.
+ *  The results are identical to calling
+ *  SDS_SequenceGeneratorgCRC16() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC16(SLFixData_t* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister,
+                                                  const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(SIGLIB_NULL_FIX_DATA_PTR, pDst, pShiftRegister, 0x1021U, 16U, ArrayLength);
+}    // End of SDA_SequenceGeneratorgCRC16()
+
+/********************************************************
+ * Function: SDA_ScramblerDescramblergCRC12
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a scrambler
+ *  having the generating polynomial: D^12 + D^11 + D^3 + D^2 + D + 1,
+ *  on an array of data bytes.
+ *  The results are identical to calling
+ *  SDS_ScramblerDescramblergCRC12() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC12(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                     SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(pSrc, pDst, pShiftRegister, 0x80FU, 12U, ArrayLength);
+}    // End of SDA_ScramblerDescramblergCRC12()
+
+/********************************************************
+ * Function: SDA_SequenceGeneratorgCRC12
+ *
+ * Parameters:
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function generates an array of bytes of the
+ *  gCRC12 sequence having the generating polynomial:
+ *  D^12 + D^11 + D^3 + D^2 + D + 1.
+ *  The results are identical to calling
+ *  SDS_SequenceGeneratorgCRC12() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC12(SLFixData_t* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister,
+                                                  const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(SIGLIB_NULL_FIX_DATA_PTR, pDst, pShiftRegister, 0x80FU, 12U, ArrayLength);
+}    // End of SDA_SequenceGeneratorgCRC12()
+
+/********************************************************
+ * Function: SDA_ScramblerDescramblergCRC8
+ *
+ * Parameters:
+ *  const SLFixData_t   *pSrc
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function executes a scrambler
+ *  having the generating polynomial: D^8 + D^7 + D^4 + D^3 + D + 1,
+ *  on an array of data bytes.
+ *  The results are identical to calling
+ *  SDS_ScramblerDescramblergCRC8() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ScramblerDescramblergCRC8(const SLFixData_t* SIGLIB_PTR_DECL pSrc, SLFixData_t* SIGLIB_PTR_DECL pDst,
+                                                    SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister, const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(pSrc, pDst, pShiftRegister, 0x9BU, 8U, ArrayLength);
+}    // End of SDA_ScramblerDescramblergCRC8()
+
+/********************************************************
+ * Function: SDA_SequenceGeneratorgCRC8
+ *
+ * Parameters:
+ *  SLFixData_t         *pDst
+ *  SLUInt32_t          *pShiftRegister
+ *  const SLArrayIndex_t    Array length
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  This function generates an array of bytes of the
+ *  gCRC8 sequence having the generating polynomial:
+ *  D^8 + D^7 + D^4 + D^3 + D + 1.
+ *  The results are identical to calling
+ *  SDS_SequenceGeneratorgCRC8() for each byte.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_SequenceGeneratorgCRC8(SLFixData_t* SIGLIB_PTR_DECL pDst, SLUInt32_t* SIGLIB_PTR_DECL pShiftRegister,
+                                                 const SLArrayIndex_t ArrayLength)
+{
+  siglib_numerix_AdditiveScrambler(SIGLIB_NULL_FIX_DATA_PTR, pDst, pShiftRegister, 0x9BU, 8U, ArrayLength);
+}    // End of SDA_SequenceGeneratorgCRC8()
+
+// CRC engine
+// The CRC register is 32 bits long for all widths. For msb first CRCs the
+// register holds the CRC in the top Width bits and for reflected CRCs it holds
+// the bit reversed CRC in the bottom Width bits. This is a 32 bit CRC with the
+// polynomial P(x).x^(32-Width), so the same tables and folding code support
+// all widths.
+
+#define SIGLIB_CRC_TABLE_LENGTH 256              // Entries per slicing table
+#define SIGLIB_CRC_NUMBER_OF_TABLES 8            // Slicing-by-8
+#define SIGLIB_CRC_CLMUL_MIN_LENGTH 256          // Shortest array that uses the carry-less multiply path
+#define SIGLIB_CRC_FIX_DATA_BLOCK_LENGTH 1024    // Bytes packed per SDA_CrcUpdate call by SDA_CrcUpdateFixData
+
+/********************************************************
+ * Function: siglib_numerix_CrcReflect
+ *
+ * Parameters:
+ *  const SLUInt32_t    Value
+ *  const SLArrayIndex_t    Number of bits
+ *
+ * Return value:
+ *  Bit reversed value
+ *
+ * Description:
+ *  Reverse the order of the bottom NumberOfBits bits.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_CrcReflect(const SLUInt32_t Value, const SLArrayIndex_t NumberOfBits)
+{
+  SLUInt32_t Reflected = 0U;
+  for (SLArrayIndex_t i = 0; i < NumberOfBits; i++) {
+    Reflected = (Reflected << 1U) | ((Value >> i) & 0x1U);
+  }
+  return (Reflected);
+}    // End of siglib_numerix_CrcReflect()
+
+/********************************************************
+ * Function: siglib_numerix_CrcSlicing
+ *
+ * Parameters:
+ *  const SLUInt8_t     *pSrc
+ *  SLUInt32_t          Register
+ *  const SLCrc_s       *pCrc
+ *  SLArrayIndex_t      Array length
+ *
+ * Return value:
+ *  Updated CRC register
+ *
+ * Description:
+ *  Table driven CRC update, 8 bytes per step with the
+ *  slicing-by-8 tables and then 1 byte per step.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_CrcSlicing(const SLUInt8_t* SIGLIB_PTR_DECL pSrc, SLUInt32_t Register, const SLCrc_s* SIGLIB_PTR_DECL pCrc,
+                                            SLArrayIndex_t ArrayLength)
+{
+  const SLUInt32_t* pT = pCrc->pTable;
+
+  if (pCrc->ReflectIn) {
+    for (; ArrayLength >= 8; ArrayLength -= 8, pSrc += 8) {
+      SLUInt32_t Low = Register ^ ((SLUInt32_t)pSrc[0] | ((SLUInt32_t)pSrc[1] << 8U) | ((SLUInt32_t)pSrc[2] << 16U) | ((SLUInt32_t)pSrc[3] << 24U));
+      SLUInt32_t High = (SLUInt32_t)pSrc[4] | ((SLUInt32_t)pSrc[5] << 8U) | ((SLUInt32_t)pSrc[6] << 16U) | ((SLUInt32_t)pSrc[7] << 24U);
+      Register = pT[(7 * SIGLIB_CRC_TABLE_LENGTH) + (Low & 0xFFU)] ^ pT[(6 * SIGLIB_CRC_TABLE_LENGTH) + ((Low >> 8U) & 0xFFU)] ^
+                 pT[(5 * SIGLIB_CRC_TABLE_LENGTH) + ((Low >> 16U) & 0xFFU)] ^ pT[(4 * SIGLIB_CRC_TABLE_LENGTH) + (Low >> 24U)] ^
+                 pT[(3 * SIGLIB_CRC_TABLE_LENGTH) + (High & 0xFFU)] ^ pT[(2 * SIGLIB_CRC_TABLE_LENGTH) + ((High >> 8U) & 0xFFU)] ^
+                 pT[SIGLIB_CRC_TABLE_LENGTH + ((High >> 16U) & 0xFFU)] ^ pT[High >> 24U];
+    }
+    for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+      Register = pT[(Register ^ pSrc[i]) & 0xFFU] ^ (Register >> 8U);
+    }
+  } else {
+    for (; ArrayLength >= 8; ArrayLength -= 8, pSrc += 8) {
+      SLUInt32_t High =
+        Register ^ (((SLUInt32_t)pSrc[0] << 24U) | ((SLUInt32_t)pSrc[1] << 16U) | ((SLUInt32_t)pSrc[2] << 8U) | (SLUInt32_t)pSrc[3]);
+      SLUInt32_t Low = ((SLUInt32_t)pSrc[4] << 24U) | ((SLUInt32_t)pSrc[5] << 16U) | ((SLUInt32_t)pSrc[6] << 8U) | (SLUInt32_t)pSrc[7];
+      Register = pT[(7 * SIGLIB_CRC_TABLE_LENGTH) + (High >> 24U)] ^ pT[(6 * SIGLIB_CRC_TABLE_LENGTH) + ((High >> 16U) & 0xFFU)] ^
+                 pT[(5 * SIGLIB_CRC_TABLE_LENGTH) + ((High >> 8U) & 0xFFU)] ^ pT[(4 * SIGLIB_CRC_TABLE_LENGTH) + (High & 0xFFU)] ^
+                 pT[(3 * SIGLIB_CRC_TABLE_LENGTH) + (Low >> 24U)] ^ pT[(2 * SIGLIB_CRC_TABLE_LENGTH) + ((Low >> 16U) & 0xFFU)] ^
+                 pT[SIGLIB_CRC_TABLE_LENGTH + ((Low >> 8U) & 0xFFU)] ^ pT[Low & 0xFFU];
+    }
+    for (SLArrayIndex_t i = 0; i < ArrayLength; i++) {
+      Register = pT[(Register >> 24U) ^ pSrc[i]] ^ (Register << 8U);
+    }
+  }
+  return (Register);
+}    // End of siglib_numerix_CrcSlicing()
+
+#if SIGLIB_CRC_CLMUL
+/********************************************************
+ * Function: siglib_numerix_CrcOrderBlock
+ *
+ * Parameters:
+ *  __m128i             16 bytes in array order
+ *  const SLFixData_t   Reflect
+ *
+ * Return value:
+ *  16 byte polynomial
+ *
+ * Description:
+ *  Reorder 16 bytes as a polynomial with the first bit
+ *  of the block in bit 127. Also used to convert a folded
+ *  block back to array order, because the transform is
+ *  its own inverse.
+ *
+ ********************************************************/
+
+static __attribute__((target("pclmul,ssse3"))) __m128i siglib_numerix_CrcOrderBlock(__m128i Block, const SLFixData_t Reflect)
+{
+  Block = _mm_shuffle_epi8(Block, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));    // Reverse the bytes
+  if (Reflect) {                                                                                           // Reverse the bits in each byte
+    const __m128i NibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i ReverseLow = _mm_setr_epi8(0x00, (char)0x80, 0x40, (char)0xC0, 0x20, (char)0xA0, 0x60, (char)0xE0, 0x10, (char)0x90, 0x50,
+                                             (char)0xD0, 0x30, (char)0xB0, 0x70, (char)0xF0);
+    const __m128i ReverseHigh = _mm_setr_epi8(0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF);
+    Block = _mm_or_si128(_mm_shuffle_epi8(ReverseLow, _mm_and_si128(Block, NibbleMask)),
+                         _mm_shuffle_epi8(ReverseHigh, _mm_and_si128(_mm_srli_epi16(Block, 4), NibbleMask)));
+  }
+  return (Block);
+}    // End of siglib_numerix_CrcOrderBlock()
+
+/********************************************************
+ * Function: siglib_numerix_CrcFoldBlock
+ *
+ * Parameters:
+ *  const __m128i       Block
+ *  const __m128i       Fold constants
+ *
+ * Return value:
+ *  Block multiplied by x^T, modulo the polynomial
+ *
+ * Description:
+ *  The low 64 bits of the fold constants are x^T and
+ *  the high 64 bits are x^(T+64), modulo the polynomial.
+ *  The result is less than 96 bits long.
+ *
+ ********************************************************/
+
+static __attribute__((target("pclmul,ssse3"))) __m128i siglib_numerix_CrcFoldBlock(const __m128i Block, const __m128i Constants)
+{
+  return (_mm_xor_si128(_mm_clmulepi64_si128(Block, Constants, 0x00), _mm_clmulepi64_si128(Block, Constants, 0x11)));
+}    // End of siglib_numerix_CrcFoldBlock()
+
+/********************************************************
+ * Function: siglib_numerix_CrcClmul
+ *
+ * Parameters:
+ *  const SLUInt8_t     *pSrc
+ *  SLUInt32_t          Register
+ *  const SLCrc_s       *pCrc
+ *  const SLArrayIndex_t    Number of 16 byte blocks, at least 4
+ *
+ * Return value:
+ *  Updated CRC register
+ *
+ * Description:
+ *  Carry-less multiply CRC update. The blocks are folded
+ *  4 at a time into 4 accumulators, modulo the polynomial,
+ *  and the accumulators are then folded into one 16 byte
+ *  block that has the same CRC as the whole array. The
+ *  CRC of this block is calculated with the tables.
+ *  Reflected CRCs bit reverse the input so that the
+ *  folding is always msb first.
+ *
+ ********************************************************/
+
+static __attribute__((target("pclmul,ssse3"))) SLUInt32_t siglib_numerix_CrcClmul(const SLUInt8_t* SIGLIB_PTR_DECL pSrc, SLUInt32_t Register,
+                                                                                 const SLCrc_s* SIGLIB_PTR_DECL pCrc,
+                                                                                 const SLArrayIndex_t NumberOfBlocks)
+{
+  const SLFixData_t Reflect = pCrc->ReflectIn;
+  const __m128i Fold128 = _mm_set_epi64x((long long)pCrc->FoldConstants[1], (long long)pCrc->FoldConstants[0]);
+  const __m128i Fold512 = _mm_set_epi64x((long long)pCrc->FoldConstants[3], (long long)pCrc->FoldConstants[2]);
+  SLUInt8_t Folded[16];
+
+  if (!Reflect) {    // Bytes of the register in array order
+    Register = (Register >> 24U) | ((Register >> 8U) & 0xFF00U) | ((Register << 8U) & 0xFF0000U) | (Register << 24U);
+  }
+  __m128i Acc0 = siglib_numerix_CrcOrderBlock(_mm_xor_si128(_mm_loadu_si128((const __m128i*)pSrc), _mm_cvtsi32_si128((int)Register)), Reflect);
+  __m128i Acc1 = siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)(pSrc + 16)), Reflect);
+  __m128i Acc2 = siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)(pSrc + 32)), Reflect);
+  __m128i Acc3 = siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)(pSrc + 48)), Reflect);
+  pSrc += 64;
+
+  SLArrayIndex_t i = 4;
+  for (; i + 4 <= NumberOfBlocks; i += 4, pSrc += 64) {    // Fold 64 bytes per step
+    Acc0 = _mm_xor_si128(siglib_numerix_CrcFoldBlock(Acc0, Fold512), siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)pSrc), Reflect));
+    Acc1 = _mm_xor_si128(siglib_numerix_CrcFoldBlock(Acc1, Fold512),
+                         siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)(pSrc + 16)), Reflect));
+    Acc2 = _mm_xor_si128(siglib_numerix_CrcFoldBlock(Acc2, Fold512),
+                         siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)(pSrc + 32)), Reflect));
+    Acc3 = _mm_xor_si128(siglib_numerix_CrcFoldBlock(Acc3, Fold512),
+                         siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)(pSrc + 48)), Reflect));
+  }
+
+  Acc1 = _mm_xor_si128(Acc1, siglib_numerix_CrcFoldBlock(Acc0, Fold128));    // Combine the accumulators
+  Acc2 = _mm_xor_si128(Acc2, siglib_numerix_CrcFoldBlock(Acc1, Fold128));
+  Acc3 = _mm_xor_si128(Acc3, siglib_numerix_CrcFoldBlock(Acc2, Fold128));
+  for (; i < NumberOfBlocks; i++, pSrc += 16) {    // Fold the remaining blocks
+    Acc3 = _mm_xor_si128(siglib_numerix_CrcFoldBlock(Acc3, Fold128), siglib_numerix_CrcOrderBlock(_mm_loadu_si128((const __m128i*)pSrc), Reflect));
+  }
+
+  _mm_storeu_si128((__m128i*)Folded, siglib_numerix_CrcOrderBlock(Acc3, Reflect));
+  return (siglib_numerix_CrcSlicing(Folded, 0U, pCrc, 16));
+}    // End of siglib_numerix_CrcClmul()
+#endif
+
+/********************************************************
+ * Function: SIF_Crc
+ *
+ * Parameters:
+ *  SLCrc_s *pCrc                       - Pointer to CRC structure
+ *  const SLUInt32_t Polynomial         - Generator polynomial, msb first, without the x^Width term
+ *  const SLArrayIndex_t Width          - CRC width, 1 to 32 bits
+ *  const SLUInt32_t Init               - Initial CRC value
+ *  const SLUInt32_t XorOut             - Value XORed with the final CRC
+ *  const SLFixData_t ReflectIn         - Process input bytes lsb first
+ *  const SLFixData_t ReflectOut        - Bit reverse the final CRC
+ *
+ * Return value:
+ *  SigLib error code
+ *
+ * Description:
+ *  Initialise a CRC engine with the standard CRC model
+ *  parameters, for example CRC-32 is:
+ *      Polynomial = 0x04C11DB7, Width = 32, Init = 0xFFFFFFFF,
+ *      XorOut = 0xFFFFFFFF, ReflectIn = ReflectOut = SIGLIB_TRUE.
+ *  Allocates and generates the slicing-by-8 tables and
+ *  the constants for the carry-less multiply path.
+ *  The memory is released with SUF_CrcFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_Crc(SLCrc_s* SIGLIB_PTR_DECL pCrc, const SLUInt32_t Polynomial, const SLArrayIndex_t Width, const SLUInt32_t Init,
+                                   const SLUInt32_t XorOut, const SLFixData_t ReflectIn, const SLFixData_t ReflectOut)
+{
+  pCrc->pTable = SIGLIB_NULL_UINT32_PTR;
+
+  if ((Width < 1) || (Width > 32)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  const SLUInt32_t WidthMask = 0xFFFFFFFFU >> (32 - Width);
+  pCrc->Polynomial = Polynomial & WidthMask;
+  pCrc->Width = Width;
+  pCrc->Init = Init & WidthMask;
+  pCrc->XorOut = XorOut & WidthMask;
+  pCrc->ReflectIn = ReflectIn;
+  pCrc->ReflectOut = ReflectOut;
+
+  pCrc->pTable = (SLUInt32_t*)SUF_MemoryAllocate((size_t)(SIGLIB_CRC_NUMBER_OF_TABLES * SIGLIB_CRC_TABLE_LENGTH) * sizeof(SLUInt32_t));
+  if (SIGLIB_NULL_UINT32_PTR == pCrc->pTable) {
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  const SLUInt32_t TopPolynomial = pCrc->Polynomial << (32 - Width);    // P(x).x^(32-Width), without the x^32 term
+  SLUInt32_t* pT = pCrc->pTable;
+
+  if (ReflectIn) {
+    const SLUInt32_t ReflectedPolynomial = siglib_numerix_CrcReflect(TopPolynomial, 32);
+    for (SLUInt32_t i = 0U; i < SIGLIB_CRC_TABLE_LENGTH; i++) {
+      SLUInt32_t Register = i;
+      for (SLArrayIndex_t j = 0; j < 8; j++) {
+        Register = (Register >> 1U) ^ ((Register & 0x1U) ? ReflectedPolynomial : 0U);
+      }
+      pT[i] = Register;
+    }
+    for (SLArrayIndex_t k = 1; k < SIGLIB_CRC_NUMBER_OF_TABLES; k++) {    // Each table advances the previous one by a byte
+      for (SLArrayIndex_t i = 0; i < SIGLIB_CRC_TABLE_LENGTH; i++) {
+        SLUInt32_t Previous = pT[((k - 1) * SIGLIB_CRC_TABLE_LENGTH) + i];
+        pT[(k * SIGLIB_CRC_TABLE_LENGTH) + i] = pT[Previous & 0xFFU] ^ (Previous >> 8U);
+      }
+    }
+  } else {
+    for (SLUInt32_t i = 0U; i < SIGLIB_CRC_TABLE_LENGTH; i++) {
+      SLUInt32_t Register = i << 24U;
+      for (SLArrayIndex_t j = 0; j < 8; j++) {
+        Register = (Register << 1U) ^ ((Register & 0x80000000U) ? TopPolynomial : 0U);
+      }
+      pT[i] = Register;
+    }
+    for (SLArrayIndex_t k = 1; k < SIGLIB_CRC_NUMBER_OF_TABLES; k++) {
+      for (SLArrayIndex_t i = 0; i < SIGLIB_CRC_TABLE_LENGTH; i++) {
+        SLUInt32_t Previous = pT[((k - 1) * SIGLIB_CRC_TABLE_LENGTH) + i];
+        pT[(k * SIGLIB_CRC_TABLE_LENGTH) + i] = pT[Previous >> 24U] ^ (Previous << 8U);
+      }
+    }
+  }
+
+  SLUInt64_t Power = 1U;    // x^n modulo x^32 + TopPolynomial, for n = 1 to 576
+  for (SLArrayIndex_t n = 1; n <= 576; n++) {
+    Power = (Power << 1U) ^ ((Power & 0x80000000U) ? (0x100000000ULL ^ (SLUInt64_t)TopPolynomial) : 0U);
+    if (n == 128) {
+      pCrc->FoldConstants[0] = Power;
+    } else if (n == 192) {
+      pCrc->FoldConstants[1] = Power;
+    } else if (n == 512) {
+      pCrc->FoldConstants[2] = Power;
+    } else if (n == 576) {
+      pCrc->FoldConstants[3] = Power;
+    }
+  }
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_Crc()
+
+/********************************************************
+ * Function: SDS_CrcStart
+ *
+ * Parameters:
+ *  const SLCrc_s *pCrc                 - Pointer to CRC structure
+ *
+ * Return value:
+ *  Initial CRC register
+ *
+ * Description:
+ *  Return the CRC register for the start of a message,
+ *  to be passed to SDA_CrcUpdate.
+ *
+ ********************************************************/
+
+SLUInt32_t SIGLIB_FUNC_DECL SDS_CrcStart(const SLCrc_s* SIGLIB_PTR_DECL pCrc)
+{
+  if (pCrc->ReflectIn) {
+    return (siglib_numerix_CrcReflect(pCrc->Init, pCrc->Width));
+  }
+  return (pCrc->Init << (32 - pCrc->Width));
+}    // End of SDS_CrcStart()
+
+/********************************************************
+ * Function: SDA_CrcUpdate
+ *
+ * Parameters:
+ *  const SLUInt8_t *pSrc               - Pointer to source array
+ *  const SLUInt32_t Register           - CRC register
+ *  const SLCrc_s *pCrc                 - Pointer to CRC structure
+ *  const SLArrayIndex_t ArrayLength    - Array length
+ *
+ * Return value:
+ *  Updated CRC register
+ *
+ * Description:
+ *  Update the CRC register with an array of bytes.
+ *  A message may be passed in any number of arrays, the
+ *  register starts from SDS_CrcStart and the CRC is
+ *  returned by SDS_CrcFinish.
+ *  Long arrays use carry-less multiply folding on x86-64
+ *  processors that support PCLMULQDQ, otherwise the
+ *  slicing-by-8 tables are used.
+ *
+ ********************************************************/
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_CrcUpdate(const SLUInt8_t* SIGLIB_PTR_DECL pSrc, const SLUInt32_t Register, const SLCrc_s* SIGLIB_PTR_DECL pCrc,
+                                          const SLArrayIndex_t ArrayLength)
+{
+#if SIGLIB_CRC_CLMUL
+  if ((ArrayLength >= SIGLIB_CRC_CLMUL_MIN_LENGTH) && __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) {
+    const SLArrayIndex_t NumberOfBlocks = ArrayLength >> 4U;
+    SLUInt32_t FoldedRegister = siglib_numerix_CrcClmul(pSrc, Register, pCrc, NumberOfBlocks);
+    return (siglib_numerix_CrcSlicing(pSrc + (NumberOfBlocks << 4U), FoldedRegister, pCrc, ArrayLength - (NumberOfBlocks << 4U)));
+  }
+#endif
+  return (siglib_numerix_CrcSlicing(pSrc, Register, pCrc, ArrayLength));
+}    // End of SDA_CrcUpdate()
+
+/********************************************************
+ * Function: SDS_CrcFinish
+ *
+ * Parameters:
+ *  const SLUInt32_t Register           - CRC register
+ *  const SLCrc_s *pCrc                 - Pointer to CRC structure
+ *
+ * Return value:
+ *  CRC
+ *
+ * Description:
+ *  Apply the output reflection and XOR to the CRC
+ *  register, to give the CRC of the message.
+ *
+ ********************************************************/
+
+SLUInt32_t SIGLIB_FUNC_DECL SDS_CrcFinish(const SLUInt32_t Register, const SLCrc_s* SIGLIB_PTR_DECL pCrc)
+{
+  SLUInt32_t Crc;
+
+  if (pCrc->ReflectIn) {    // Register holds the bit reversed CRC
+    Crc = pCrc->ReflectOut ? Register : siglib_numerix_CrcReflect(Register, pCrc->Width);
+  } else {
+    Crc = Register >> (32 - pCrc->Width);
+    if (pCrc->ReflectOut) {
+      Crc = siglib_numerix_CrcReflect(Crc, pCrc->Width);
+    }
+  }
+  return (Crc ^ pCrc->XorOut);
+}    // End of SDS_CrcFinish()
+
+/********************************************************
+ * Function: SDA_Crc
+ *
+ * Parameters:
+ *  const SLUInt8_t *pSrc               - Pointer to source array
+ *  const SLCrc_s *pCrc                 - Pointer to CRC structure
+ *  const SLArrayIndex_t ArrayLength    - Array length
+ *
+ * Return value:
+ *  CRC
+ *
+ * Description:
+ *  Calculate the CRC of an array of bytes.
+ *
+ ********************************************************/
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_Crc(const SLUInt8_t* SIGLIB_PTR_DECL pSrc, const SLCrc_s* SIGLIB_PTR_DECL pCrc, const SLArrayIndex_t ArrayLength)
+{
+  return (SDS_CrcFinish(SDA_CrcUpdate(pSrc, SDS_CrcStart(pCrc), pCrc, ArrayLength), pCrc));
+}    // End of SDA_Crc()
+
+/********************************************************
+ * Function: SDA_CrcUpdateFixData
+ *
+ * Parameters:
+ *  const SLFixData_t *pSrc             - Pointer to source array
+ *  const SLUInt32_t Register           - CRC register
+ *  const SLCrc_s *pCrc                 - Pointer to CRC structure
+ *  const SLArrayIndex_t ArrayLength    - Array length
+ *
+ * Return value:
+ *  Updated CRC register
+ *
+ * Description:
+ *  Update the CRC register with an array of bytes held
+ *  one per SLFixData_t word, as output by the
+ *  scramblers and demodulators. Only the low 8 bits of
+ *  each word are used.
+ *  The bytes are packed in blocks and passed to
+ *  SDA_CrcUpdate.
+ *
+ ********************************************************/
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_CrcUpdateFixData(const SLFixData_t* SIGLIB_PTR_DECL pSrc, const SLUInt32_t Register,
+                                                 const SLCrc_s* SIGLIB_PTR_DECL pCrc, const SLArrayIndex_t ArrayLength)
+{
+  SLUInt8_t Block[SIGLIB_CRC_FIX_DATA_BLOCK_LENGTH];
+  SLUInt32_t CrcRegister = Register;
+
+  for (SLArrayIndex_t i = 0; i < ArrayLength; i += SIGLIB_CRC_FIX_DATA_BLOCK_LENGTH) {
+    SLArrayIndex_t BlockLength = ArrayLength - i;
+    if (BlockLength > SIGLIB_CRC_FIX_DATA_BLOCK_LENGTH) {
+      BlockLength = SIGLIB_CRC_FIX_DATA_BLOCK_LENGTH;
+    }
+    for (SLArrayIndex_t j = 0; j < BlockLength; j++) {
+      Block[j] = (SLUInt8_t)pSrc[i + j];
+    }
+    CrcRegister = SDA_CrcUpdate(Block, CrcRegister, pCrc, BlockLength);
+  }
+  return (CrcRegister);
+}    // End of SDA_CrcUpdateFixData()
+
+/********************************************************
+ * Function: SDA_CrcFixData
+ *
+ * Parameters:
+ *  const SLFixData_t *pSrc             - Pointer to source array
+ *  const SLCrc_s *pCrc                 - Pointer to CRC structure
+ *  const SLArrayIndex_t ArrayLength    - Array length
+ *
+ * Return value:
+ *  CRC
+ *
+ * Description:
+ *  Calculate the CRC of an array of bytes held one per
+ *  SLFixData_t word. Only the low 8 bits of each word
+ *  are used.
+ *
+ ********************************************************/
+
+SLUInt32_t SIGLIB_FUNC_DECL SDA_CrcFixData(const SLFixData_t* SIGLIB_PTR_DECL pSrc, const SLCrc_s* SIGLIB_PTR_DECL pCrc,
+                                           const SLArrayIndex_t ArrayLength)
+{
+  return (SDS_CrcFinish(SDA_CrcUpdateFixData(pSrc, SDS_CrcStart(pCrc), pCrc, ArrayLength), pCrc));
+}    // End of SDA_CrcFixData()
+
+/********************************************************
+ * Function: SUF_CrcFree
+ *
+ * Parameters:
+ *  SLCrc_s *pCrc                       - Pointer to CRC structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the memory allocated by SIF_Crc.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_CrcFree(SLCrc_s* SIGLIB_PTR_DECL pCrc)
+{
+  if (SIGLIB_NULL_UINT32_PTR != pCrc->pTable) {
+    SUF_MemoryFree(pCrc->pTable);
+    pCrc->pTable = SIGLIB_NULL_UINT32_PTR;
+  }
+}    // End of SUF_CrcFree()
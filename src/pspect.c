@@ -550,10 +550,9 @@ void SIGLIB_FUNC_DECL SDA_WelchRealPowerSpectrum(const SLData_t* SIGLIB_PTR_DECL
     //      SDA_ComplexScalarMultiply (pRealData, pImagData, InverseFFTLength,
     //      pRealData, pImagData, ResultLength);
 
-    SDA_MagnitudeSquared(pRealData, pImagData, pRealData,
-                         ResultLength);    // Calculate the magnitude squared
-
-    SDA_Add2(pRealData, pDst, pDst, ResultLength);    // Average the magnitudes
+    for (SLArrayIndex_t k = 0; k < ResultLength; k++) {    // Accumulate the magnitude squared
+      pDst[k] += (pRealData[k] * pRealData[k]) + (pImagData[k] * pImagData[k]);
+    }
   }
 
   *pDst *= SIGLIB_HALF;    // Scale D.C. value appropriately
@@ -637,10 +636,9 @@ void SIGLIB_FUNC_DECL SDA_WelchComplexPowerSpectrum(const SLData_t* SIGLIB_PTR_D
     //      SDA_ComplexScalarMultiply (pRealData, pImagData, InverseFFTLength,
     //      pRealData, pImagData, ResultLength);
 
-    SDA_MagnitudeSquared(pRealData, pImagData, pRealData,
-                         ResultLength);    // Calculate the magnitude squared
-
-    SDA_Add2(pRealData, pDst, pDst, ResultLength);    // Average the magnitudes
+    for (SLArrayIndex_t k = 0; k < ResultLength; k++) {    // Accumulate the magnitude squared
+      pDst[k] += (pRealData[k] * pRealData[k]) + (pImagData[k] * pImagData[k]);
+    }
   }
 
   *pDst *= SIGLIB_HALF;    // Scale D.C. value appropriately
@@ -750,3 +748,356 @@ void SIGLIB_FUNC_DECL SDA_MagnitudeSquaredCoherence(SLData_t* SIGLIB_PTR_DECL pR
   SDA_Divide2(pRealData1, pRealAPSData1, pRealData1,
               ResultLength);    // Perform the divide
 }
+
+typedef struct {    // Welch spectrum state, shared by the shards
+  const SLData_t* pSrc1;
+  const SLData_t* pSrc2;    // SIGLIB_NULL_DATA_PTR for the power spectrum
+  SLWelch_s* pWelch;
+  SLArrayIndex_t NumberOfSegments;
+  SLArrayIndex_t SegmentsPerShard;
+} siglib_numerix_WelchContext_s;
+
+/********************************************************
+ * Function: siglib_numerix_WelchShard
+ *
+ * Parameters:
+ *  void *pContext,                     - Pointer to Welch shard context
+ *  SLArrayIndex_t shardIndex           - Shard index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Accumulate the spectra of one shard of segments into
+ *  the shard's own accumulators.
+ *  The window is applied as each segment is loaded into
+ *  the FFT arrays and the spectra are accumulated
+ *  directly from the bit reversed FFT output.
+ *  For the power spectrum, pairs of segments are
+ *  transformed together, one in the real input and one
+ *  in the imaginary input, and the sum of their power
+ *  spectra in bin k is (|Z(k)|^2 + |Z(N-k)|^2) / 2.
+ *  For the coherence, the two sources are transformed
+ *  together and separated with
+ *  X(k) = (Z(k) + Z*(N-k)) / 2 and
+ *  Y(k) = (Z(k) - Z*(N-k)) / 2j.
+ *
+ ********************************************************/
+
+static void siglib_numerix_WelchShard(void* pContext, SLArrayIndex_t shardIndex)
+{
+  const siglib_numerix_WelchContext_s* pCtx = (const siglib_numerix_WelchContext_s*)pContext;
+  const SLWelch_s* pWelch = pCtx->pWelch;
+  const SLArrayIndex_t N = pWelch->FFTLength;
+  const SLArrayIndex_t BinCount = (N >> 1) + 1;
+  const SLArrayIndex_t* pBitReverse = pWelch->pBitReverseAddressTable;
+  const SLData_t* pWindow = pWelch->pWindowCoeffs;
+
+  SLData_t* pReal = pWelch->pWorkspace + (shardIndex * pWelch->ShardWorkspaceLength);
+  SLData_t* pImag = pReal + N;
+  SLData_t* pAcc = pImag + N;
+
+  const SLArrayIndex_t FirstSegment = shardIndex * pCtx->SegmentsPerShard;
+  const SLArrayIndex_t LastSegment = ((FirstSegment + pCtx->SegmentsPerShard) < pCtx->NumberOfSegments)
+                                       ? (FirstSegment + pCtx->SegmentsPerShard)
+                                       : pCtx->NumberOfSegments;
+
+  if (SIGLIB_NULL_DATA_PTR == pCtx->pSrc2) {    // Power spectrum
+    SDA_Zeros(pAcc, BinCount);
+
+    for (SLArrayIndex_t s = FirstSegment; s < LastSegment; s += 2) {
+      const SLData_t* pSegment1 = pCtx->pSrc1 + (s * pWelch->SegmentStep);
+      const SLData_t* pSegment2 = pSegment1 + pWelch->SegmentStep;
+      if ((s + 1) < LastSegment) {
+        for (SLArrayIndex_t n = 0; n < N; n++) {    // Window the two segments as they are loaded
+          pReal[n] = pSegment1[n] * pWindow[n];
+          pImag[n] = pSegment2[n] * pWindow[n];
+        }
+      } else {    // Odd segment at the end of the shard
+        for (SLArrayIndex_t n = 0; n < N; n++) {
+          pReal[n] = pSegment1[n] * pWindow[n];
+          pImag[n] = SIGLIB_ZERO;
+        }
+      }
+
+      SDA_FftExecute(pReal, pImag, pWelch->pPlanCoeffs, SIGLIB_BIT_REV_NONE, N, pWelch->Log2FFTLength);
+
+      for (SLArrayIndex_t k = 0; k < BinCount; k++) {
+        const SLArrayIndex_t i = pBitReverse[k];
+        const SLArrayIndex_t j = pBitReverse[(N - k) & (N - 1)];
+        pAcc[k] += (pReal[i] * pReal[i]) + (pImag[i] * pImag[i]) + (pReal[j] * pReal[j]) + (pImag[j] * pImag[j]);
+      }
+    }
+  }
+
+  else {    // Coherence
+    SLData_t* pSxx = pAcc;
+    SLData_t* pSyy = pSxx + BinCount;
+    SLData_t* pRealSxy = pSyy + BinCount;
+    SLData_t* pImagSxy = pRealSxy + BinCount;
+    SDA_Zeros(pAcc, 4 * BinCount);
+
+    for (SLArrayIndex_t s = FirstSegment; s < LastSegment; s++) {
+      const SLData_t* pSegment1 = pCtx->pSrc1 + (s * pWelch->SegmentStep);
+      const SLData_t* pSegment2 = pCtx->pSrc2 + (s * pWelch->SegmentStep);
+      for (SLArrayIndex_t n = 0; n < N; n++) {    // Window the two sources as they are loaded
+        pReal[n] = pSegment1[n] * pWindow[n];
+        pImag[n] = pSegment2[n] * pWindow[n];
+      }
+
+      SDA_FftExecute(pReal, pImag, pWelch->pPlanCoeffs, SIGLIB_BIT_REV_NONE, N, pWelch->Log2FFTLength);
+
+      for (SLArrayIndex_t k = 0; k < BinCount; k++) {    // 2.X(k) and 2.Y(k), the scaling cancels in the coherence
+        const SLArrayIndex_t i = pBitReverse[k];
+        const SLArrayIndex_t j = pBitReverse[(N - k) & (N - 1)];
+        const SLData_t RealX = pReal[i] + pReal[j];
+        const SLData_t ImagX = pImag[i] - pImag[j];
+        const SLData_t RealY = pImag[i] + pImag[j];
+        const SLData_t ImagY = pReal[j] - pReal[i];
+        pSxx[k] += (RealX * RealX) + (ImagX * ImagX);
+        pSyy[k] += (RealY * RealY) + (ImagY * ImagY);
+        pRealSxy[k] += (RealX * RealY) + (ImagX * ImagY);    // X.Y*
+        pImagSxy[k] += (ImagX * RealY) - (RealX * ImagY);
+      }
+    }
+  }
+}    // End of siglib_numerix_WelchShard()
+
+/********************************************************
+ * Function: siglib_numerix_WelchRun
+ *
+ * Parameters:
+ *  const SLData_t *pSrc1,              - Pointer to source array 1
+ *  const SLData_t *pSrc2,              - Pointer to source array 2
+ *  SLWelch_s *pWelch,                  - Pointer to Welch structure
+ *  const SLArrayIndex_t accLength,     - Accumulator length per shard
+ *  const SLArrayIndex_t sourceLength   - Source array length
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of segments averaged
+ *
+ * Description:
+ *  Split the segments into shards, accumulate the
+ *  shards through SUF_ParallelFor and sum the shard
+ *  accumulators, in shard order, into the accumulator
+ *  of the first shard.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_WelchRun(const SLData_t* SIGLIB_PTR_DECL pSrc1, const SLData_t* SIGLIB_PTR_DECL pSrc2, SLWelch_s* pWelch,
+                                              const SLArrayIndex_t accLength, const SLArrayIndex_t sourceLength)
+{
+  if (sourceLength < pWelch->FFTLength) {
+    return (0);
+  }
+
+  siglib_numerix_WelchContext_s Ctx;
+  Ctx.pSrc1 = pSrc1;
+  Ctx.pSrc2 = pSrc2;
+  Ctx.pWelch = pWelch;
+  Ctx.NumberOfSegments = ((sourceLength - pWelch->FFTLength) / pWelch->SegmentStep) + 1;
+  Ctx.SegmentsPerShard = (Ctx.NumberOfSegments + pWelch->NumberOfShards - 1) / pWelch->NumberOfShards;
+  if (SIGLIB_NULL_DATA_PTR == pSrc2) {    // Power spectrum segments are transformed in pairs
+    Ctx.SegmentsPerShard += Ctx.SegmentsPerShard & 1;
+  }
+  const SLArrayIndex_t NumberOfActiveShards = (Ctx.NumberOfSegments + Ctx.SegmentsPerShard - 1) / Ctx.SegmentsPerShard;
+
+  SUF_ParallelFor(siglib_numerix_WelchShard, &Ctx, NumberOfActiveShards);
+
+  SLData_t* pAcc = pWelch->pWorkspace + (2 * pWelch->FFTLength);
+  for (SLArrayIndex_t i = 1; i < NumberOfActiveShards; i++) {    // Sum the accumulators from all of the shards
+    SDA_Add2(pAcc, pAcc + (i * pWelch->ShardWorkspaceLength), pAcc, accLength);
+  }
+
+  return (Ctx.NumberOfSegments);
+}    // End of siglib_numerix_WelchRun()
+
+/********************************************************
+ * Function: SIF_Welch
+ *
+ * Parameters:
+ *  SLWelch_s *pWelch,                  - Pointer to Welch structure
+ *  const enum SLWindow_t WindowType,   - Window type
+ *  const SLData_t WindowCoeff,         - Window coefficient
+ *  const SLArrayIndex_t fftLength,     - FFT length
+ *  const SLArrayIndex_t overlapLength, - Overlap between segments
+ *  const SLArrayIndex_t numberOfShards - Number of shards
+ *
+ * Return value:
+ *  SLError_t - SIGLIB_MEM_ALLOC_ERROR or
+ *  SIGLIB_PARAMETER_ERROR on failure
+ *
+ * Description:
+ *  Initialise the Welch power spectrum and coherence
+ *  functions SDA_WelchPowerSpectrum and
+ *  SDA_WelchCoherence.
+ *  The FFT length must be a power of 2 and at least 4
+ *  and the overlap must be less than the FFT length.
+ *  The segments are split into numberOfShards shards,
+ *  each with its own FFT arrays and accumulators, that
+ *  are processed through SUF_ParallelFor.
+ *  The number of shards is normally the number of
+ *  threads available to the parallel executor and the
+ *  results do not depend on the executor.
+ *  The memory is released with SUF_WelchFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_Welch(SLWelch_s* pWelch, const enum SLWindow_t WindowType, const SLData_t WindowCoeff,
+                                     const SLArrayIndex_t fftLength, const SLArrayIndex_t overlapLength, const SLArrayIndex_t numberOfShards)
+{
+  pWelch->pWindowCoeffs = SIGLIB_NULL_DATA_PTR;
+  pWelch->pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+
+  if ((fftLength < 4) || ((fftLength & (fftLength - 1)) != 0) || (overlapLength < 0) || (overlapLength >= fftLength) ||
+      (numberOfShards < 1)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  pWelch->FFTLength = fftLength;
+  pWelch->Log2FFTLength = SAI_FftLengthLog2(fftLength);
+  pWelch->SegmentStep = fftLength - overlapLength;
+  pWelch->NumberOfShards = numberOfShards;
+  pWelch->ShardWorkspaceLength = (2 * fftLength) + (4 * ((fftLength >> 1) + 1));
+
+  pWelch->pWindowCoeffs = (SLData_t*)SUF_MemoryAllocate(
+    (size_t)(fftLength + SAI_FftPlanCoeffsLength(fftLength) + (numberOfShards * pWelch->ShardWorkspaceLength)) * sizeof(SLData_t));
+  pWelch->pBitReverseAddressTable = (SLArrayIndex_t*)SUF_MemoryAllocate((size_t)fftLength * sizeof(SLArrayIndex_t));
+  if ((SIGLIB_NULL_DATA_PTR == pWelch->pWindowCoeffs) || (SIGLIB_NULL_ARRAY_INDEX_PTR == pWelch->pBitReverseAddressTable)) {
+    SUF_WelchFree(pWelch);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  pWelch->pPlanCoeffs = pWelch->pWindowCoeffs + fftLength;
+  pWelch->pWorkspace = pWelch->pPlanCoeffs + SAI_FftPlanCoeffsLength(fftLength);
+
+  SLError_t ErrorCode = SIF_Window(pWelch->pWindowCoeffs, WindowType, WindowCoeff, fftLength);    // Generate window table
+  if (ErrorCode != SIGLIB_NO_ERROR) {
+    SUF_WelchFree(pWelch);
+    return (ErrorCode);
+  }
+  // Compensate for the inverse coherent gain
+  SDA_Multiply(pWelch->pWindowCoeffs, SDA_WindowInverseCoherentGain(pWelch->pWindowCoeffs, fftLength), pWelch->pWindowCoeffs, fftLength);
+
+  SIF_FftPlan(pWelch->pPlanCoeffs, pWelch->pBitReverseAddressTable, fftLength);
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_Welch()
+
+/********************************************************
+ * Function: SDA_WelchPowerSpectrum
+ *
+ * Parameters:
+ *  const SLData_t *pSrc,               - Pointer to source array
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLWelch_s *pWelch,                  - Pointer to Welch structure
+ *  const SLArrayIndex_t sourceLength   - Source array length
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of segments averaged
+ *
+ * Description:
+ *  Returns the Welch power spectrum of the real source
+ *  array, averaged over all of the complete segments in
+ *  the array, with the same scaling as
+ *  SDA_WelchRealPowerSpectrum.
+ *  The result array is of length (N/2)+1.
+ *  If the source array is shorter than the FFT length
+ *  the result array is cleared and 0 is returned.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_WelchPowerSpectrum(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pDst, SLWelch_s* pWelch,
+                                                       const SLArrayIndex_t sourceLength)
+{
+  const SLArrayIndex_t BinCount = (pWelch->FFTLength >> 1) + 1;
+
+  SLArrayIndex_t NumberOfSegments = siglib_numerix_WelchRun(pSrc, SIGLIB_NULL_DATA_PTR, pWelch, BinCount, sourceLength);
+  if (0 == NumberOfSegments) {
+    SDA_Zeros(pDst, BinCount);
+    return (0);
+  }
+
+  // Each accumulated bin is 2 x the sum of the segment power spectra, so this
+  // gives the single sided PSD and average scaling
+  SDA_Multiply(pWelch->pWorkspace + (2 * pWelch->FFTLength), SIGLIB_ONE / (SLData_t)NumberOfSegments, pDst, BinCount);
+  *pDst *= SIGLIB_HALF;    // Scale D.C. value appropriately
+
+  return (NumberOfSegments);
+}    // End of SDA_WelchPowerSpectrum()
+
+/********************************************************
+ * Function: SDA_WelchCoherence
+ *
+ * Parameters:
+ *  const SLData_t *pSrc1,              - Pointer to source array 1
+ *  const SLData_t *pSrc2,              - Pointer to source array 2
+ *  SLData_t *pDst,                     - Pointer to destination array
+ *  SLWelch_s *pWelch,                  - Pointer to Welch structure
+ *  const SLArrayIndex_t sourceLength   - Source array length
+ *
+ * Return value:
+ *  SLArrayIndex_t - Number of segments averaged
+ *
+ * Description:
+ *  Returns the magnitude squared coherence of the two
+ *  real source arrays:
+ *  |Sxy|^2 / (Sxx.Syy)
+ *  where the auto and cross power spectra are averaged
+ *  over all of the complete segments in the arrays.
+ *  Both sources are transformed with a single complex
+ *  FFT per segment.
+ *  The result array is of length (N/2)+1. Bins where
+ *  either auto power spectrum is zero are set to 0.
+ *  If the source arrays are shorter than the FFT length
+ *  the result array is cleared and 0 is returned.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_WelchCoherence(const SLData_t* SIGLIB_PTR_DECL pSrc1, const SLData_t* SIGLIB_PTR_DECL pSrc2,
+                                                   SLData_t* SIGLIB_PTR_DECL pDst, SLWelch_s* pWelch, const SLArrayIndex_t sourceLength)
+{
+  const SLArrayIndex_t BinCount = (pWelch->FFTLength >> 1) + 1;
+
+  SLArrayIndex_t NumberOfSegments = siglib_numerix_WelchRun(pSrc1, pSrc2, pWelch, 4 * BinCount, sourceLength);
+  if (0 == NumberOfSegments) {
+    SDA_Zeros(pDst, BinCount);
+    return (0);
+  }
+
+  const SLData_t* pSxx = pWelch->pWorkspace + (2 * pWelch->FFTLength);
+  const SLData_t* pSyy = pSxx + BinCount;
+  const SLData_t* pRealSxy = pSyy + BinCount;
+  const SLData_t* pImagSxy = pRealSxy + BinCount;
+  for (SLArrayIndex_t k = 0; k < BinCount; k++) {
+    const SLData_t Denominator = pSxx[k] * pSyy[k];
+    pDst[k] = (Denominator > SIGLIB_ZERO) ? (((pRealSxy[k] * pRealSxy[k]) + (pImagSxy[k] * pImagSxy[k])) / Denominator) : SIGLIB_ZERO;
+  }
+
+  return (NumberOfSegments);
+}    // End of SDA_WelchCoherence()
+
+/********************************************************
+ * Function: SUF_WelchFree
+ *
+ * Parameters:
+ *  SLWelch_s *pWelch                   - Pointer to Welch structure
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the memory allocated by SIF_Welch.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_WelchFree(SLWelch_s* pWelch)
+{
+  if (SIGLIB_NULL_DATA_PTR != pWelch->pWindowCoeffs) {
+    SUF_MemoryFree(pWelch->pWindowCoeffs);
+    pWelch->pWindowCoeffs = SIGLIB_NULL_DATA_PTR;
+  }
+  if (SIGLIB_NULL_ARRAY_INDEX_PTR != pWelch->pBitReverseAddressTable) {
+    SUF_MemoryFree(pWelch->pBitReverseAddressTable);
+    pWelch->pBitReverseAddressTable = SIGLIB_NULL_ARRAY_INDEX_PTR;
+  }
+}    // End of SUF_WelchFree()
@@ -496,100 +496,1541 @@ void SIGLIB_FUNC_DECL SUF_PrintLower(const SLData_t src, const SLData_t threshol
 
 #if SIGLIB_FILE_IO_SUPPORTED    // File I/O is supported for Debugfprintf functions
 
+#  if (SIGLIB_DEBUG_TRACE == 1) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#    define SIGLIB_DEBUG_TRACE_RING 1    // Log to the per thread binary trace buffers
+#    include <stdatomic.h>
+#    if defined(__unix__) || defined(__APPLE__)
+#      define SIGLIB_TRACE_THREAD_EXIT 1    // Recycle the trace buffer of each thread when the thread exits
+#      define SIGLIB_TRACE_FLUSHER 1        // SUF_DebugTraceStartFlusher is supported
+#      include <pthread.h>
+#    else
+#      define SIGLIB_TRACE_THREAD_EXIT 0    // Keep the trace buffers until the program exits
+#      define SIGLIB_TRACE_FLUSHER 0        // The application calls SUF_DebugTraceFlush
+#    endif
+#  else
+#    define SIGLIB_DEBUG_TRACE_RING 0    // Log directly to the text log file
+#  endif
+
+// Binary trace file record types
+#  define SIGLIB_TRACE_SESSION 'S'    // Start of a session - start time
+#  define SIGLIB_TRACE_FORMAT 'F'     // Format string definition - format id, string length, string
+#  define SIGLIB_TRACE_RECORD 'R'     // Trace record - thread index, record
+#  define SIGLIB_TRACE_DROPPED 'D'    // Records dropped because the buffer was full - thread index, number of records
+
+// Trace records - length (2 bytes), number of arguments (1), timestamp (8), format id (8), function id (8), followed by the arguments
+#  define SIGLIB_TRACE_RECORD_HEADER_LENGTH 27
+#  define SIGLIB_TRACE_RECORD_FORMAT_ID 11      // Offset of the format id
+#  define SIGLIB_TRACE_RECORD_FUNCTION_ID 19    // Offset of the function id, 0 when the function is not known
+#  define SIGLIB_TRACE_MAX_RECORD_LENGTH 256    // The arguments are truncated to fit in the longest record
+
+// Format and function name definitions in the ring buffers - length (2 bytes), SIGLIB_TRACE_RING_FORMAT (1), id (8), followed by the string
+#  define SIGLIB_TRACE_FORMAT_HEADER_LENGTH 11
+#  define SIGLIB_TRACE_RING_FORMAT 0xFFU          // Stored in the number of arguments field
+#  define SIGLIB_TRACE_FORMAT_CACHE_LENGTH 64U    // Format and function ids remembered by each ring buffer - must be a power of 2
+
+// Argument types - integers and pointers are stored as 64 bits, floating point as double, strings as length (2 bytes) and characters
+#  define SIGLIB_TRACE_ARG_SIGNED 'i'
+#  define SIGLIB_TRACE_ARG_UNSIGNED 'u'
+#  define SIGLIB_TRACE_ARG_DOUBLE 'f'
+#  define SIGLIB_TRACE_ARG_STRING 's'
+#  define SIGLIB_TRACE_ARG_POINTER 'p'
+#  define SIGLIB_TRACE_SPEC_LENGTH 48U    // Longest conversion specification rebuilt by the decoder
+
+typedef struct {    // Format string table, the strings are only stored by the decoder
+  SLUInt64_t* pIds;
+  char** ppStrings;
+  SLUInt32_t Length;    // Power of 2
+  SLUInt32_t Count;
+} siglib_numerix_TraceFormatTable_s;
+
+/********************************************************
+ * Function: siglib_numerix_TraceFormatFind
+ *
+ * Parameters:
+ *  siglib_numerix_TraceFormatTable_s * - Pointer to format table
+ *  const SLUInt64_t                    - Format id
+ *  const char *                        - Format string to add, NULL for none
+ *  const SLFixData_t                   - SIGLIB_TRUE to add the format if it is not found
+ *
+ * Return value:
+ *  SLArrayIndex_t  - Index of the format in the table, -1 if it was not found
+ *                    or could not be added
+ *
+ * Description:
+ *  Find a format id in the open addressing hash table of
+ *  formats and optionally add it. The table grows when it
+ *  is half full.
+ *
+ ********************************************************/
+
+static SLArrayIndex_t siglib_numerix_TraceFormatFind(siglib_numerix_TraceFormatTable_s* pTable, const SLUInt64_t Id, const char* pString,
+                                                     const SLFixData_t AddFlag)
+{
+  if ((SIGLIB_TRUE == AddFlag) && ((2U * (pTable->Count + 1U)) > pTable->Length)) {    // Grow the table
+    SLUInt32_t Length = (pTable->Length == 0U) ? 256U : (2U * pTable->Length);
+    SLUInt64_t* pIds = (SLUInt64_t*)SUF_MemoryAllocate((size_t)Length * sizeof(SLUInt64_t));
+    char** ppStrings = (char**)SUF_MemoryAllocate((size_t)Length * sizeof(char*));
+    if ((NULL == pIds) || (NULL == ppStrings)) {
+      SUF_MemoryFree(pIds);
+      SUF_MemoryFree(ppStrings);
+      return (-1);
+    }
+    for (SLUInt32_t i = 0; i < Length; i++) {
+      pIds[i] = 0U;
+    }
+    for (SLUInt32_t i = 0; i < pTable->Length; i++) {
+      if (0U != pTable->pIds[i]) {
+        SLUInt32_t Slot = (SLUInt32_t)((pTable->pIds[i] * 0x9E3779B97F4A7C15ULL) >> 40U) & (Length - 1U);
+        while (0U != pIds[Slot]) {
+          Slot = (Slot + 1U) & (Length - 1U);
+        }
+        pIds[Slot] = pTable->pIds[i];
+        ppStrings[Slot] = pTable->ppStrings[i];
+      }
+    }
+    SUF_MemoryFree(pTable->pIds);
+    SUF_MemoryFree(pTable->ppStrings);
+    pTable->pIds = pIds;
+    pTable->ppStrings = ppStrings;
+    pTable->Length = Length;
+  }
+
+  if ((0U == pTable->Length) || (0U == Id)) {
+    return (-1);
+  }
+
+  SLUInt32_t Slot = (SLUInt32_t)((Id * 0x9E3779B97F4A7C15ULL) >> 40U) & (pTable->Length - 1U);
+  while (0U != pTable->pIds[Slot]) {
+    if (Id == pTable->pIds[Slot]) {
+      return ((SLArrayIndex_t)Slot);
+    }
+    Slot = (Slot + 1U) & (pTable->Length - 1U);
+  }
+  if ((SIGLIB_TRUE != AddFlag) || ((2U * (pTable->Count + 1U)) > pTable->Length)) {
+    return (-1);
+  }
+  pTable->pIds[Slot] = Id;
+  pTable->ppStrings[Slot] = (char*)pString;
+  pTable->Count++;
+  return ((SLArrayIndex_t)Slot);
+}    // End of siglib_numerix_TraceFormatFind()
+
+/********************************************************
+ * Function: siglib_numerix_TraceFormatFree
+ *
+ * Parameters:
+ *  siglib_numerix_TraceFormatTable_s * - Pointer to format table
+ *  const SLFixData_t                   - SIGLIB_TRUE to free the strings
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the format table.
+ *
+ ********************************************************/
+
+static void siglib_numerix_TraceFormatFree(siglib_numerix_TraceFormatTable_s* pTable, const SLFixData_t FreeStringsFlag)
+{
+  if (SIGLIB_TRUE == FreeStringsFlag) {
+    for (SLUInt32_t i = 0; i < pTable->Length; i++) {
+      if (0U != pTable->pIds[i]) {
+        SUF_MemoryFree(pTable->ppStrings[i]);
+      }
+    }
+  }
+  SUF_MemoryFree(pTable->pIds);
+  SUF_MemoryFree(pTable->ppStrings);
+  pTable->pIds = NULL;
+  pTable->ppStrings = NULL;
+  pTable->Length = 0U;
+  pTable->Count = 0U;
+}    // End of siglib_numerix_TraceFormatFree()
+
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+
+/********************************************************
+ * Function: siglib_numerix_TraceTimestamp
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  SLUInt64_t      - Time in ns
+ *
+ * Description:
+ *  Return the current time for the trace records.
+ *
+ ********************************************************/
+
+static SLUInt64_t siglib_numerix_TraceTimestamp(void)
+{
+#    ifdef TIME_UTC
+  struct timespec Time;
+  timespec_get(&Time, TIME_UTC);
+  return (((SLUInt64_t)Time.tv_sec * 1000000000ULL) + (SLUInt64_t)Time.tv_nsec);
+#    else
+  return (((SLUInt64_t)clock() * 1000000000ULL) / (SLUInt64_t)CLOCKS_PER_SEC);
+#    endif
+}    // End of siglib_numerix_TraceTimestamp()
+
+typedef struct siglib_numerix_TraceBuffer_s {    // Per thread trace ring buffer
+  struct siglib_numerix_TraceBuffer_s* pNext;    // Next buffer in the list of all of the thread buffers
+  SLUInt32_t ThreadIndex;
+  _Atomic SLUInt32_t WriteIndex;        // Free running byte index, only written by the thread that owns the buffer
+  _Atomic SLUInt32_t ReadIndex;         // Free running byte index, only written by SUF_DebugTraceFlush
+  _Atomic SLUInt32_t DroppedRecords;    // Number of records dropped since the last flush
+  _Atomic SLUInt32_t InUse;             // Set while a thread owns the buffer
+  SLUInt32_t FormatGeneration;          // Value of siglib_numerix_TraceGeneration when FormatIds was cleared
+  SLUInt64_t FormatIds[SIGLIB_TRACE_FORMAT_CACHE_LENGTH];
+  unsigned char Buffer[SIGLIB_DEBUG_TRACE_BUFFER_LENGTH];
+} siglib_numerix_TraceBuffer_s;
+
+static _Atomic(siglib_numerix_TraceBuffer_s*) siglib_numerix_TraceBuffers = NULL;    // List of all of the thread buffers
+static _Atomic SLUInt32_t siglib_numerix_TraceThreadCount = 0U;
+static _Thread_local siglib_numerix_TraceBuffer_s* siglib_numerix_pThreadTraceBuffer = NULL;
+static atomic_flag siglib_numerix_TraceFlushLock = ATOMIC_FLAG_INIT;    // Held while the buffers are flushed
+static _Atomic SLUInt32_t siglib_numerix_TraceGeneration = 0U;          // Incremented when the pending records are discarded
+#    if (SIGLIB_TRACE_THREAD_EXIT == 1)
+static pthread_key_t siglib_numerix_TraceThreadKey;    // Releases the buffer of a thread when it exits
+static pthread_once_t siglib_numerix_TraceThreadKeyOnce = PTHREAD_ONCE_INIT;
+#    endif
+#    if (SIGLIB_TRACE_FLUSHER == 1)
+static pthread_t siglib_numerix_TraceFlusherThread;
+static pthread_mutex_t siglib_numerix_TraceFlusherControlMutex = PTHREAD_MUTEX_INITIALIZER;    // Serializes starting and stopping the flusher
+static pthread_mutex_t siglib_numerix_TraceFlusherMutex = PTHREAD_MUTEX_INITIALIZER;    // Protects the flusher period and stop flag
+static pthread_cond_t siglib_numerix_TraceFlusherCondition = PTHREAD_COND_INITIALIZER;
+static SLArrayIndex_t siglib_numerix_TraceFlusherPeriod = 0;                    // ms
+static SLFixData_t siglib_numerix_TraceFlusherStop = SIGLIB_FALSE;
+static _Atomic SLUInt32_t siglib_numerix_TraceFlusherRunning = 0U;    // Read by the logging threads
+static _Atomic SLUInt32_t siglib_numerix_TraceFlushRequested = 0U;    // Set by a logging thread when its buffer passes the high water mark
+#    endif
+
+// Flush state, only accessed with the flush lock held
+static SLFixData_t siglib_numerix_TraceSessionStarted = SIGLIB_FALSE;
+static siglib_numerix_TraceFormatTable_s siglib_numerix_TraceFormats = {NULL, NULL, 0U, 0U};    // Formats written to the trace file
+static SLUInt64_t siglib_numerix_TraceStartTime = 0U;    // Set when the first buffer is allocated, before it is added to the list
+
+/********************************************************
+ * Function: siglib_numerix_TraceRingWrite
+ *
+ * Parameters:
+ *  siglib_numerix_TraceBuffer_s *  - Pointer to trace buffer
+ *  const SLUInt32_t                - Free running byte index
+ *  const void *                    - Pointer to source data
+ *  const SLUInt32_t                - Number of bytes
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Copy data into a ring buffer, wrapping at the end.
+ *
+ ********************************************************/
+
+static void siglib_numerix_TraceRingWrite(siglib_numerix_TraceBuffer_s* pBuffer, const SLUInt32_t Index, const void* pSrc,
+                                          const SLUInt32_t Length)
+{
+  SLUInt32_t Offset = Index & (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - 1U);
+  SLUInt32_t FirstLength = ((SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - Offset) < Length) ? (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - Offset) : Length;
+  memcpy(pBuffer->Buffer + Offset, pSrc, FirstLength);
+  memcpy(pBuffer->Buffer, (const unsigned char*)pSrc + FirstLength, Length - FirstLength);
+}    // End of siglib_numerix_TraceRingWrite()
+
+/********************************************************
+ * Function: siglib_numerix_TraceRingRead
+ *
+ * Parameters:
+ *  const siglib_numerix_TraceBuffer_s *    - Pointer to trace buffer
+ *  const SLUInt32_t                        - Free running byte index
+ *  void *                                  - Pointer to destination
+ *  const SLUInt32_t                        - Number of bytes
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Copy data out of a ring buffer, wrapping at the end.
+ *
+ ********************************************************/
+
+static void siglib_numerix_TraceRingRead(const siglib_numerix_TraceBuffer_s* pBuffer, const SLUInt32_t Index, void* pDst, const SLUInt32_t Length)
+{
+  SLUInt32_t Offset = Index & (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - 1U);
+  SLUInt32_t FirstLength = ((SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - Offset) < Length) ? (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - Offset) : Length;
+  memcpy(pDst, pBuffer->Buffer + Offset, FirstLength);
+  memcpy((unsigned char*)pDst + FirstLength, pBuffer->Buffer, Length - FirstLength);
+}    // End of siglib_numerix_TraceRingRead()
+
+/********************************************************
+ * Function: siglib_numerix_TraceFlush
+ *
+ * Parameters:
+ *  const SLFixData_t       - SIGLIB_TRUE to wait if another thread is
+ *                            flushing the buffers
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Append the records in the trace buffers of all of the
+ *  threads to the binary trace file. The format string or
+ *  function name of each id is written before the first
+ *  record that uses it.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_TraceFlush(const SLFixData_t WaitFlag)
+{
+  while (atomic_flag_test_and_set_explicit(&siglib_numerix_TraceFlushLock, memory_order_acquire)) {
+    if (SIGLIB_TRUE != WaitFlag) {
+      return (SIGLIB_NO_ERROR);    // Another thread is flushing the buffers
+    }
+  }
+
+  FILE* fp_TraceFile;
+#    if SIGLIB_FILE_OPEN_SECURE
+  SUF_Fopen(&fp_TraceFile, SIGLIB_TRACE_FILE, "ab");
+#    else
+  fp_TraceFile = SUF_Fopen(SIGLIB_TRACE_FILE, "ab");
+#    endif
+  if (NULL == fp_TraceFile) {
+    atomic_flag_clear_explicit(&siglib_numerix_TraceFlushLock, memory_order_release);
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  siglib_numerix_TraceBuffer_s* pBuffers = atomic_load_explicit(&siglib_numerix_TraceBuffers, memory_order_acquire);
+  if (SIGLIB_FALSE == siglib_numerix_TraceSessionStarted) {
+    SLUInt64_t StartTime = (0U != siglib_numerix_TraceStartTime) ? siglib_numerix_TraceStartTime : siglib_numerix_TraceTimestamp();
+    fputc(SIGLIB_TRACE_SESSION, fp_TraceFile);
+    fwrite(&StartTime, sizeof(StartTime), 1, fp_TraceFile);
+    siglib_numerix_TraceSessionStarted = SIGLIB_TRUE;
+  }
+
+  for (siglib_numerix_TraceBuffer_s* pBuffer = pBuffers; NULL != pBuffer; pBuffer = pBuffer->pNext) {
+    SLUInt32_t ReadIndex = atomic_load_explicit(&pBuffer->ReadIndex, memory_order_relaxed);
+    const SLUInt32_t WriteIndex = atomic_load_explicit(&pBuffer->WriteIndex, memory_order_acquire);
+    SLUInt32_t UndefinedRecords = 0U;
+
+    while (ReadIndex != WriteIndex) {
+      unsigned char Record[SIGLIB_TRACE_MAX_RECORD_LENGTH];
+      SLUInt16_t Length;
+      SLUInt64_t FormatId;
+      SLUInt64_t FunctionId;
+      siglib_numerix_TraceRingRead(pBuffer, ReadIndex, Record, 3U);
+      memcpy(&Length, Record, sizeof(Length));
+
+      if (SIGLIB_TRACE_RING_FORMAT == Record[2]) {    // Format definition, write it to the file the first time that it is used
+        siglib_numerix_TraceRingRead(pBuffer, ReadIndex + 3U, &FormatId, sizeof(FormatId));
+        if ((siglib_numerix_TraceFormatFind(&siglib_numerix_TraceFormats, FormatId, NULL, SIGLIB_FALSE) < 0) &&
+            (siglib_numerix_TraceFormatFind(&siglib_numerix_TraceFormats, FormatId, NULL, SIGLIB_TRUE) >= 0)) {
+          SLUInt16_t StringLength = (SLUInt16_t)(Length - SIGLIB_TRACE_FORMAT_HEADER_LENGTH);
+          SLUInt32_t Offset = (ReadIndex + SIGLIB_TRACE_FORMAT_HEADER_LENGTH) & (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - 1U);
+          SLUInt32_t FirstLength =
+              ((SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - Offset) < StringLength) ? (SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - Offset) : StringLength;
+          fputc(SIGLIB_TRACE_FORMAT, fp_TraceFile);
+          fwrite(&FormatId, sizeof(FormatId), 1, fp_TraceFile);
+          fwrite(&StringLength, sizeof(StringLength), 1, fp_TraceFile);
+          fwrite(pBuffer->Buffer + Offset, 1, FirstLength, fp_TraceFile);
+          fwrite(pBuffer->Buffer, 1, StringLength - FirstLength, fp_TraceFile);
+        }
+      } else {
+        siglib_numerix_TraceRingRead(pBuffer, ReadIndex, Record, Length);
+        memcpy(&FormatId, Record + SIGLIB_TRACE_RECORD_FORMAT_ID, sizeof(FormatId));
+        memcpy(&FunctionId, Record + SIGLIB_TRACE_RECORD_FUNCTION_ID, sizeof(FunctionId));
+        if ((siglib_numerix_TraceFormatFind(&siglib_numerix_TraceFormats, FormatId, NULL, SIGLIB_FALSE) < 0) ||
+            ((0U != FunctionId) && (siglib_numerix_TraceFormatFind(&siglib_numerix_TraceFormats, FunctionId, NULL, SIGLIB_FALSE) < 0))) {
+          UndefinedRecords++;    // The definition was discarded by SUF_ClearDebugfprintf
+        } else {
+          fputc(SIGLIB_TRACE_RECORD, fp_TraceFile);
+          fwrite(&pBuffer->ThreadIndex, sizeof(pBuffer->ThreadIndex), 1, fp_TraceFile);
+          fwrite(Record, 1, Length, fp_TraceFile);
+        }
+      }
+      ReadIndex += Length;
+    }
+    atomic_store_explicit(&pBuffer->ReadIndex, ReadIndex, memory_order_release);
+
+    SLUInt32_t DroppedRecords = atomic_exchange_explicit(&pBuffer->DroppedRecords, 0U, memory_order_relaxed) + UndefinedRecords;
+    if (0U != DroppedRecords) {
+      fputc(SIGLIB_TRACE_DROPPED, fp_TraceFile);
+      fwrite(&pBuffer->ThreadIndex, sizeof(pBuffer->ThreadIndex), 1, fp_TraceFile);
+      fwrite(&DroppedRecords, sizeof(DroppedRecords), 1, fp_TraceFile);
+    }
+  }
+
+  SUF_Fclose(fp_TraceFile);
+  atomic_flag_clear_explicit(&siglib_numerix_TraceFlushLock, memory_order_release);
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_TraceFlush()
+
+/********************************************************
+ * Function: siglib_numerix_TraceAtExit
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Flush the trace buffers when the program exits.
+ *
+ * Notes:
+ *  The buffers are not freed because other threads may
+ *  still be running and logging to them, the memory is
+ *  released by the operating system.
+ *
+ ********************************************************/
+
+static void siglib_numerix_TraceAtExit(void)
+{
+  (void)siglib_numerix_TraceFlush(SIGLIB_TRUE);
+}    // End of siglib_numerix_TraceAtExit()
+
+#    if (SIGLIB_TRACE_FLUSHER == 1)
+/********************************************************
+ * Function: siglib_numerix_TraceFlusher
+ *
+ * Parameters:
+ *  void *          - Unused
+ *
+ * Return value:
+ *  void *          - NULL
+ *
+ * Description:
+ *  Background thread started by SUF_DebugTraceStartFlusher
+ *  that flushes the trace buffers every period and when a
+ *  logging thread hands off a buffer that has passed the
+ *  high water mark.
+ *
+ * Notes:
+ *  The logging threads do not take the mutex, so a hand
+ *  off that arrives while the flusher is about to wait is
+ *  served at the end of the period.
+ *
+ ********************************************************/
+
+static void* siglib_numerix_TraceFlusher(void* pUnused)
+{
+  (void)pUnused;
+  pthread_mutex_lock(&siglib_numerix_TraceFlusherMutex);
+  while (SIGLIB_FALSE == siglib_numerix_TraceFlusherStop) {
+    if (0U == atomic_exchange_explicit(&siglib_numerix_TraceFlushRequested, 0U, memory_order_acq_rel)) {
+      struct timespec Deadline;
+      timespec_get(&Deadline, TIME_UTC);    // The condition variable waits on the real time clock
+      Deadline.tv_sec += (time_t)(siglib_numerix_TraceFlusherPeriod / 1000);
+      Deadline.tv_nsec += (long)(siglib_numerix_TraceFlusherPeriod % 1000) * 1000000L;
+      if (Deadline.tv_nsec >= 1000000000L) {
+        Deadline.tv_sec++;
+        Deadline.tv_nsec -= 1000000000L;
+      }
+      (void)pthread_cond_timedwait(&siglib_numerix_TraceFlusherCondition, &siglib_numerix_TraceFlusherMutex, &Deadline);
+      atomic_store_explicit(&siglib_numerix_TraceFlushRequested, 0U, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&siglib_numerix_TraceFlusherMutex);
+    (void)siglib_numerix_TraceFlush(SIGLIB_TRUE);
+    pthread_mutex_lock(&siglib_numerix_TraceFlusherMutex);
+  }
+  pthread_mutex_unlock(&siglib_numerix_TraceFlusherMutex);
+  (void)siglib_numerix_TraceFlush(SIGLIB_TRUE);    // Write the records logged before the flusher was stopped
+  return (NULL);
+}    // End of siglib_numerix_TraceFlusher()
+#    endif
+
+#    if (SIGLIB_TRACE_THREAD_EXIT == 1)
+/********************************************************
+ * Function: siglib_numerix_TraceThreadExit
+ *
+ * Parameters:
+ *  void *pBuffer   - Pointer to the trace buffer of the
+ *                    thread that is exiting
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Release the trace buffer of a thread that has exited so
+ *  that it can be claimed by a new thread. The records in
+ *  the buffer are kept until the next flush.
+ *
+ ********************************************************/
+
+static void siglib_numerix_TraceThreadExit(void* pBuffer)
+{
+  atomic_store_explicit(&((siglib_numerix_TraceBuffer_s*)pBuffer)->InUse, 0U, memory_order_release);
+}    // End of siglib_numerix_TraceThreadExit()
+
+/********************************************************
+ * Function: siglib_numerix_TraceThreadKeyCreate
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Create the thread specific key that releases the trace
+ *  buffer of each thread when the thread exits.
+ *
+ ********************************************************/
+
+static void siglib_numerix_TraceThreadKeyCreate(void)
+{
+  (void)pthread_key_create(&siglib_numerix_TraceThreadKey, siglib_numerix_TraceThreadExit);
+}    // End of siglib_numerix_TraceThreadKeyCreate()
+#    endif
+
+/********************************************************
+ * Function: siglib_numerix_TraceThreadBuffer
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  siglib_numerix_TraceBuffer_s *  - Pointer to the trace buffer of the
+ *                                    calling thread, NULL if it could
+ *                                    not be allocated
+ *
+ * Description:
+ *  Return the trace buffer of the calling thread. On the
+ *  first call from each thread the buffer of a thread
+ *  that has exited is claimed, otherwise a new buffer is
+ *  allocated and added to the list of buffers.
+ *
+ * Notes:
+ *  The buffers are released when their thread exits, so
+ *  the number of buffers is the largest number of threads
+ *  that have logged at the same time. A claimed buffer
+ *  keeps the thread index of the thread that allocated
+ *  it. The list is flushed when the program exits.
+ *
+ ********************************************************/
+
+static siglib_numerix_TraceBuffer_s* siglib_numerix_TraceThreadBuffer(void)
+{
+  if (NULL == siglib_numerix_pThreadTraceBuffer) {
+    siglib_numerix_TraceBuffer_s* pBuffer;
+    for (pBuffer = atomic_load_explicit(&siglib_numerix_TraceBuffers, memory_order_acquire); NULL != pBuffer; pBuffer = pBuffer->pNext) {
+      SLUInt32_t Released = 0U;    // Claim the buffer of a thread that has exited
+      if (atomic_compare_exchange_strong_explicit(&pBuffer->InUse, &Released, 1U, memory_order_acquire, memory_order_relaxed)) {
+        break;
+      }
+    }
+
+    if (NULL == pBuffer) {
+      pBuffer = (siglib_numerix_TraceBuffer_s*)SUF_MemoryAllocate(sizeof(siglib_numerix_TraceBuffer_s));
+      if (NULL == pBuffer) {
+        return (NULL);
+      }
+      pBuffer->ThreadIndex = atomic_fetch_add(&siglib_numerix_TraceThreadCount, 1U);
+      atomic_init(&pBuffer->WriteIndex, 0U);
+      atomic_init(&pBuffer->ReadIndex, 0U);
+      atomic_init(&pBuffer->DroppedRecords, 0U);
+      atomic_init(&pBuffer->InUse, 1U);
+      pBuffer->FormatGeneration = atomic_load_explicit(&siglib_numerix_TraceGeneration, memory_order_acquire);
+      for (SLUInt32_t i = 0; i < SIGLIB_TRACE_FORMAT_CACHE_LENGTH; i++) {
+        pBuffer->FormatIds[i] = 0U;
+      }
+
+      if (0U == pBuffer->ThreadIndex) {
+        siglib_numerix_TraceStartTime = siglib_numerix_TraceTimestamp();
+        atexit(siglib_numerix_TraceAtExit);
+      }
+
+      pBuffer->pNext = atomic_load(&siglib_numerix_TraceBuffers);    // Lock free push on to the list
+      while (!atomic_compare_exchange_weak(&siglib_numerix_TraceBuffers, &pBuffer->pNext, pBuffer)) {
+      }
+    }
+
+#    if (SIGLIB_TRACE_THREAD_EXIT == 1)
+    (void)pthread_once(&siglib_numerix_TraceThreadKeyOnce, siglib_numerix_TraceThreadKeyCreate);
+    (void)pthread_setspecific(siglib_numerix_TraceThreadKey, pBuffer);
+#    endif
+    siglib_numerix_pThreadTraceBuffer = pBuffer;
+  }
+  return (siglib_numerix_pThreadTraceBuffer);
+}    // End of siglib_numerix_TraceThreadBuffer()
+
+/********************************************************
+ * Function: siglib_numerix_TraceAppend
+ *
+ * Parameters:
+ *  unsigned char *         - Pointer to record
+ *  SLUInt32_t *            - Pointer to record length
+ *  const SLUInt8_t         - Argument type
+ *  const void *            - Pointer to argument
+ *  const SLUInt32_t        - Argument length
+ *
+ * Return value:
+ *  SLFixData_t     - SIGLIB_TRUE if the argument was appended,
+ *                    SIGLIB_FALSE if the record is full
+ *
+ * Description:
+ *  Append an argument to a trace record.
+ *
+ ********************************************************/
+
+static SLFixData_t siglib_numerix_TraceAppend(unsigned char* pRecord, SLUInt32_t* pLength, const SLUInt8_t Type, const void* pArgument,
+                                              const SLUInt32_t ArgumentLength)
+{
+  if ((*pLength + 1U + ArgumentLength) > SIGLIB_TRACE_MAX_RECORD_LENGTH) {
+    return (SIGLIB_FALSE);
+  }
+  pRecord[*pLength] = Type;
+  memcpy(pRecord + *pLength + 1U, pArgument, ArgumentLength);
+  *pLength += 1U + ArgumentLength;
+  pRecord[2]++;    // Number of arguments
+  return (SIGLIB_TRUE);
+}    // End of siglib_numerix_TraceAppend()
+
+/********************************************************
+ * Function: siglib_numerix_TraceFormatHash
+ *
+ * Parameters:
+ *  const char *            - Format string
+ *  SLUInt32_t *            - Pointer to the length of the format string
+ *
+ * Return value:
+ *  SLUInt64_t      - Format id, never 0
+ *
+ * Description:
+ *  Return the 64 bit FNV-1a hash of the text of a format
+ *  string or function name, so that equal strings have
+ *  the same id wherever they are stored.
+ *
+ ********************************************************/
+
+static SLUInt64_t siglib_numerix_TraceFormatHash(const char* pFormat, SLUInt32_t* pLength)
+{
+  SLUInt64_t Hash = 0xCBF29CE484222325ULL;
+  const char* p = pFormat;
+  for (; *p != '\0'; p++) {
+    Hash = (Hash ^ (SLUInt64_t)(unsigned char)*p) * 0x100000001B3ULL;
+  }
+  *pLength = (SLUInt32_t)(p - pFormat);
+  return ((0U == Hash) ? 1U : Hash);
+}    // End of siglib_numerix_TraceFormatHash()
+
+/********************************************************
+ * Function: siglib_numerix_TraceRecord
+ *
+ * Parameters:
+ *  const char *            - Name of the logging function, NULL if not known
+ *  const char *            - Format string
+ *  va_list                 - Variable argument list
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Write a binary record of the format string and the
+ *  raw arguments into the trace buffer of the calling
+ *  thread, the text is rendered offline by
+ *  SUF_DebugTraceDecode.
+ *
+ * Notes:
+ *  The format string and the function name are identified
+ *  by hashes of their text. The first time that the buffer
+ *  holds a format or function its text is copied into the
+ *  buffer, ahead of the record, so the strings only need
+ *  to be valid during the call.
+ *  String arguments are copied into the record.
+ *  When the buffer is full the record is dropped and
+ *  counted, the calling thread never waits for a flush
+ *  or writes to the trace file. When the background
+ *  flusher is running, a buffer that has passed
+ *  SIGLIB_DEBUG_TRACE_HIGH_WATER bytes is handed off to
+ *  it.
+ *
+ ********************************************************/
+
+static SLError_t siglib_numerix_TraceRecord(const char* pFunctionName, const char* pFormat, va_list ArgumentList)
+{
+  siglib_numerix_TraceBuffer_s* pBuffer = siglib_numerix_TraceThreadBuffer();
+  if (NULL == pBuffer) {
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+  SLUInt64_t Timestamp = siglib_numerix_TraceTimestamp();    // After the first buffer sets the start time
+
+  unsigned char Record[SIGLIB_TRACE_MAX_RECORD_LENGTH];
+  SLUInt32_t Length = SIGLIB_TRACE_RECORD_HEADER_LENGTH;
+  const char* pStrings[2] = {pFormat, pFunctionName};    // Format string and function name
+  SLUInt32_t StringLengths[2] = {0U, 0U};
+  SLUInt64_t Ids[2] = {siglib_numerix_TraceFormatHash(pFormat, &StringLengths[0]), 0U};
+  if (NULL != pFunctionName) {
+    Ids[1] = siglib_numerix_TraceFormatHash(pFunctionName, &StringLengths[1]);
+  }
+  Record[2] = 0U;
+  memcpy(Record + 3, &Timestamp, sizeof(Timestamp));
+  memcpy(Record + SIGLIB_TRACE_RECORD_FORMAT_ID, &Ids[0], sizeof(Ids[0]));
+  memcpy(Record + SIGLIB_TRACE_RECORD_FUNCTION_ID, &Ids[1], sizeof(Ids[1]));
+
+  // Extract the arguments using the conversion specifications in the format string
+  SLFixData_t SpaceFlag = SIGLIB_TRUE;
+  for (const char* p = pFormat; (*p != '\0') && (SIGLIB_TRUE == SpaceFlag); p++) {
+    if ((*p != '%') || (*++p == '%')) {
+      continue;
+    }
+    if (*p == '\0') {
+      break;
+    }
+    while ((*p == '-') || (*p == '+') || (*p == ' ') || (*p == '#') || (*p == '0')) {    // Flags
+      p++;
+    }
+    for (SLArrayIndex_t Field = 0; Field < 2; Field++) {    // Width and precision
+      if ((1 == Field) && (*p == '.')) {
+        p++;
+      }
+      if (*p == '*') {
+        SLInt64_t Value = (SLInt64_t)va_arg(ArgumentList, int);
+        SpaceFlag = siglib_numerix_TraceAppend(Record, &Length, SIGLIB_TRACE_ARG_SIGNED, &Value, sizeof(Value));
+        p++;
+      }
+      while ((*p >= '0') && (*p <= '9')) {
+        p++;
+      }
+    }
+
+    SLArrayIndex_t LongCount = 0;    // Length modifier
+    SLFixData_t SizeFlag = SIGLIB_FALSE;
+    SLFixData_t LongDoubleFlag = SIGLIB_FALSE;
+    while ((*p == 'h') || (*p == 'l') || (*p == 'L') || (*p == 'z') || (*p == 'j') || (*p == 't')) {
+      LongCount += (*p == 'l') ? 1 : 0;
+      SizeFlag = ((*p == 'z') || (*p == 'j') || (*p == 't')) ? SIGLIB_TRUE : SizeFlag;
+      LongDoubleFlag = (*p == 'L') ? SIGLIB_TRUE : LongDoubleFlag;
+      p++;
+    }
+
+    switch (*p) {
+    case 'c': {
+      SLInt64_t Value = (SLInt64_t)va_arg(ArgumentList, int);
+      SpaceFlag = siglib_numerix_TraceAppend(Record, &Length, SIGLIB_TRACE_ARG_SIGNED, &Value, sizeof(Value));
+    } break;
+    case 'd':
+    case 'i': {
+      SLInt64_t Value;
+      if (SIGLIB_TRUE == SizeFlag) {
+        Value = (SLInt64_t)va_arg(ArgumentList, ptrdiff_t);
+      } else if (LongCount >= 2) {
+        Value = (SLInt64_t)va_arg(ArgumentList, long long);
+      } else if (LongCount == 1) {
+        Value = (SLInt64_t)va_arg(ArgumentList, long);
+      } else {
+        Value = (SLInt64_t)va_arg(ArgumentList, int);
+      }
+      SpaceFlag = siglib_numerix_TraceAppend(Record, &Length, SIGLIB_TRACE_ARG_SIGNED, &Value, sizeof(Value));
+    } break;
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X': {
+      SLUInt64_t Value;
+      if (SIGLIB_TRUE == SizeFlag) {
+        Value = (SLUInt64_t)va_arg(ArgumentList, size_t);
+      } else if (LongCount >= 2) {
+        Value = (SLUInt64_t)va_arg(ArgumentList, unsigned long long);
+      } else if (LongCount == 1) {
+        Value = (SLUInt64_t)va_arg(ArgumentList, unsigned long);
+      } else {
+        Value = (SLUInt64_t)va_arg(ArgumentList, unsigned int);
+      }
+      SpaceFlag = siglib_numerix_TraceAppend(Record, &Length, SIGLIB_TRACE_ARG_UNSIGNED, &Value, sizeof(Value));
+    } break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A': {
+      double Value = (SIGLIB_TRUE == LongDoubleFlag) ? (double)va_arg(ArgumentList, long double) : va_arg(ArgumentList, double);
+      SpaceFlag = siglib_numerix_TraceAppend(Record, &Length, SIGLIB_TRACE_ARG_DOUBLE, &Value, sizeof(Value));
+    } break;
+    case 's': {
+      const char* pString = va_arg(ArgumentList, const char*);
+      pString = (NULL == pString) ? "(null)" : pString;
+      size_t StringLength = strlen(pString);
+      SLUInt32_t Space = SIGLIB_TRACE_MAX_RECORD_LENGTH - Length;
+      if (Space < 4U) {
+        SpaceFlag = SIGLIB_FALSE;
+        break;
+      }
+      SLUInt16_t CopyLength = (SLUInt16_t)((StringLength > (size_t)(Space - 3U)) ? (Space - 3U) : StringLength);    // Truncate to fit
+      Record[Length] = SIGLIB_TRACE_ARG_STRING;
+      memcpy(Record + Length + 1U, &CopyLength, sizeof(CopyLength));
+      memcpy(Record + Length + 3U, pString, CopyLength);
+      Length += 3U + (SLUInt32_t)CopyLength;
+      Record[2]++;
+    } break;
+    case 'p': {
+      SLUInt64_t Value = (SLUInt64_t)(size_t)va_arg(ArgumentList, void*);
+      SpaceFlag = siglib_numerix_TraceAppend(Record, &Length, SIGLIB_TRACE_ARG_POINTER, &Value, sizeof(Value));
+    } break;
+    case 'n':
+      (void)va_arg(ArgumentList, void*);
+      break;
+    default:    // Unknown conversion, the remaining arguments can not be extracted
+      SpaceFlag = SIGLIB_FALSE;
+      break;
+    }
+  }
+  SLUInt16_t RecordLength = (SLUInt16_t)Length;
+  memcpy(Record, &RecordLength, sizeof(RecordLength));
+
+  // Define the format and the function in the buffer if they are not already defined
+  SLUInt32_t Generation = atomic_load_explicit(&siglib_numerix_TraceGeneration, memory_order_acquire);
+  if (Generation != pBuffer->FormatGeneration) {    // The buffered definitions have been discarded
+    for (SLUInt32_t i = 0; i < SIGLIB_TRACE_FORMAT_CACHE_LENGTH; i++) {
+      pBuffer->FormatIds[i] = 0U;
+    }
+    pBuffer->FormatGeneration = Generation;
+  }
+  SLUInt32_t DefinitionLengths[2] = {0U, 0U};
+  for (SLArrayIndex_t i = 0; i < 2; i++) {
+    if ((0U != Ids[i]) && (Ids[i] != pBuffer->FormatIds[(SLUInt32_t)Ids[i] & (SIGLIB_TRACE_FORMAT_CACHE_LENGTH - 1U)])) {
+      if (StringLengths[i] > (0xffffU - SIGLIB_TRACE_FORMAT_HEADER_LENGTH)) {
+        StringLengths[i] = 0xffffU - SIGLIB_TRACE_FORMAT_HEADER_LENGTH;
+      }
+      DefinitionLengths[i] = SIGLIB_TRACE_FORMAT_HEADER_LENGTH + StringLengths[i];
+    }
+  }
+
+  // Copy the definitions and the record into the ring buffer
+  SLUInt32_t WriteIndex = atomic_load_explicit(&pBuffer->WriteIndex, memory_order_relaxed);
+  SLUInt32_t UsedLength = WriteIndex - atomic_load_explicit(&pBuffer->ReadIndex, memory_order_acquire);
+#    if (SIGLIB_TRACE_FLUSHER == 1)
+  if ((UsedLength >= SIGLIB_DEBUG_TRACE_HIGH_WATER) && (0U != atomic_load_explicit(&siglib_numerix_TraceFlusherRunning, memory_order_relaxed)) &&
+      (0U == atomic_exchange_explicit(&siglib_numerix_TraceFlushRequested, 1U, memory_order_acq_rel))) {
+    pthread_cond_signal(&siglib_numerix_TraceFlusherCondition);    // Hand the buffer off to the flusher, without taking the mutex
+  }
+#    endif
+  if ((SIGLIB_DEBUG_TRACE_BUFFER_LENGTH - UsedLength) < (DefinitionLengths[0] + DefinitionLengths[1] + Length)) {
+    atomic_fetch_add_explicit(&pBuffer->DroppedRecords, 1U, memory_order_relaxed);    // Never block or write the file here
+    return (SIGLIB_NO_ERROR);
+  }
+  for (SLArrayIndex_t i = 0; i < 2; i++) {
+    if (0U != DefinitionLengths[i]) {
+      unsigned char Definition[SIGLIB_TRACE_FORMAT_HEADER_LENGTH];
+      SLUInt16_t StoredLength = (SLUInt16_t)DefinitionLengths[i];
+      memcpy(Definition, &StoredLength, sizeof(StoredLength));
+      Definition[2] = SIGLIB_TRACE_RING_FORMAT;
+      memcpy(Definition + 3, &Ids[i], sizeof(Ids[i]));
+      siglib_numerix_TraceRingWrite(pBuffer, WriteIndex, Definition, SIGLIB_TRACE_FORMAT_HEADER_LENGTH);
+      siglib_numerix_TraceRingWrite(pBuffer, WriteIndex + SIGLIB_TRACE_FORMAT_HEADER_LENGTH, pStrings[i], StringLengths[i]);
+      WriteIndex += DefinitionLengths[i];
+      pBuffer->FormatIds[(SLUInt32_t)Ids[i] & (SIGLIB_TRACE_FORMAT_CACHE_LENGTH - 1U)] = Ids[i];
+    }
+  }
+  siglib_numerix_TraceRingWrite(pBuffer, WriteIndex, Record, Length);
+  atomic_store_explicit(&pBuffer->WriteIndex, WriteIndex + Length, memory_order_release);
+
+  return (SIGLIB_NO_ERROR);
+}    // End of siglib_numerix_TraceRecord()
+
+#  endif    // End of SIGLIB_DEBUG_TRACE_RING
+
+/********************************************************
+ * Function: SUF_ClearDebugfprintf
+ *
+ * Parameters:
+ *  None
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description: Clear the debug log file.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_ClearDebugfprintf(void)
+{
+  FILE* fp_LogFile;
+#  if SIGLIB_FILE_OPEN_SECURE
+  SUF_Fopen(&fp_LogFile, SIGLIB_LOG_FILE, "w");
+#  else
+  fp_LogFile = SUF_Fopen(SIGLIB_LOG_FILE, "w");
+#  endif
+  if (NULL == fp_LogFile) {
+    return (SIGLIB_FILE_ERROR);
+  }
+  SUF_Fclose(fp_LogFile);
+
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+  while (atomic_flag_test_and_set_explicit(&siglib_numerix_TraceFlushLock, memory_order_acquire)) {    // Wait for any flush to complete
+  }
+  // Discard the pending records and start a new session in an empty trace file
+  atomic_fetch_add_explicit(&siglib_numerix_TraceGeneration, 1U, memory_order_acq_rel);    // The threads define their formats again
+  for (siglib_numerix_TraceBuffer_s* pBuffer = atomic_load_explicit(&siglib_numerix_TraceBuffers, memory_order_acquire); NULL != pBuffer;
+       pBuffer = pBuffer->pNext) {
+    atomic_store_explicit(&pBuffer->ReadIndex, atomic_load_explicit(&pBuffer->WriteIndex, memory_order_acquire), memory_order_release);
+    atomic_store_explicit(&pBuffer->DroppedRecords, 0U, memory_order_relaxed);
+  }
+  siglib_numerix_TraceSessionStarted = SIGLIB_FALSE;
+  siglib_numerix_TraceStartTime = siglib_numerix_TraceTimestamp();
+  siglib_numerix_TraceFormatFree(&siglib_numerix_TraceFormats, SIGLIB_FALSE);
+
+  FILE* fp_TraceFile;
+#    if SIGLIB_FILE_OPEN_SECURE
+  SUF_Fopen(&fp_TraceFile, SIGLIB_TRACE_FILE, "wb");
+#    else
+  fp_TraceFile = SUF_Fopen(SIGLIB_TRACE_FILE, "wb");
+#    endif
+  atomic_flag_clear_explicit(&siglib_numerix_TraceFlushLock, memory_order_release);
+  if (NULL == fp_TraceFile) {
+    return (SIGLIB_FILE_ERROR);
+  }
+  SUF_Fclose(fp_TraceFile);
+#  endif
+
+  return (SIGLIB_NO_ERROR);
+}    // End of SUF_ClearDebugfprintf()
+
+/********************************************************
+ * Function: SUF_Debugfprintf
+ *
+ * Parameters:
+ *  variable argument list
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description: Prints string to file for debugging
+ *
+ * Notes:
+ *  When SIGLIB_DEBUG_TRACE = 1 the record is written to
+ *  the trace buffer of the calling thread, which holds
+ *  SIGLIB_DEBUG_TRACE_BUFFER_LENGTH bytes. The logging
+ *  thread never writes the file, the buffers are written
+ *  by SUF_DebugTraceFlush, by the background flusher
+ *  started with SUF_DebugTraceStartFlusher and when the
+ *  program exits. Records logged to a full buffer are
+ *  dropped and counted.
+ *  When SIGLIB_DEBUG_TRACE = 1 siglib.h defines
+ *  SUF_Debugfprintf as a macro that calls
+ *  SUF_DebugFunctionfprintf with the name of the calling
+ *  function, so the name is parenthesized here.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL (SUF_Debugfprintf)(const char* ArgumentType, ...)
+{
+  va_list p_ArgumentList;
+
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+  va_start(p_ArgumentList, ArgumentType);
+  SLError_t ErrorCode = siglib_numerix_TraceRecord(NULL, ArgumentType, p_ArgumentList);
+  va_end(p_ArgumentList);
+  return (ErrorCode);
+#  else
+  FILE* fp_LogFile;
+#    if SIGLIB_FILE_OPEN_SECURE
+  SUF_Fopen(&fp_LogFile, SIGLIB_LOG_FILE, "a");
+#    else
+  fp_LogFile = SUF_Fopen(SIGLIB_LOG_FILE, "a");
+#    endif
+  if (NULL == fp_LogFile) {
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  va_start(p_ArgumentList, ArgumentType);
+  vfprintf(fp_LogFile, ArgumentType, p_ArgumentList);
+  va_end(p_ArgumentList);
+  SUF_Fclose(fp_LogFile);
+
+  return (SIGLIB_NO_ERROR);
+#  endif
+}    // End of SUF_Debugfprintf()
+
+/********************************************************
+ * Function: SUF_Debugvfprintf
+ *
+ * Parameters:
+ *  const char *format,     - Format
+ *  va_list ap              - Pointer to variable argument list
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description: Prints string to file for debugging
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_Debugvfprintf(const char* format, va_list ap)
+{
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+  return (siglib_numerix_TraceRecord(NULL, format, ap));
+#  else
+  FILE* fp_LogFile;
+#    if SIGLIB_FILE_OPEN_SECURE
+  SUF_Fopen(&fp_LogFile, SIGLIB_LOG_FILE, "a");
+#    else
+  fp_LogFile = SUF_Fopen(SIGLIB_LOG_FILE, "a");
+#    endif
+  if (NULL == fp_LogFile) {
+    return (SIGLIB_FILE_ERROR);
+  }
+
+  vfprintf(fp_LogFile, format, ap);
+  SUF_Fclose(fp_LogFile);
+  return (SIGLIB_NO_ERROR);
+#  endif
+}    // End of SUF_Debugvfprintf()
+
+/********************************************************
+ * Function: SUF_DebugFunctionfprintf
+ *
+ * Parameters:
+ *  const char *pFunctionName   - Name of the calling function
+ *  const char *format,         - Format
+ *  variable argument list
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description: Prints string to file for debugging, with
+ *  the name of the calling function stored in the binary
+ *  trace record.
+ *
+ * Notes:
+ *  When SIGLIB_DEBUG_TRACE = 1 siglib.h defines
+ *  SUF_Debugfprintf as a macro that calls this function
+ *  with __func__. The function name is interned in the
+ *  trace file like the format strings and
+ *  SUF_DebugTraceDecode prints it with the thread index
+ *  and time. The text log file does not record the name.
+ *  SUF_Debugvfprintf is called from wrapper functions so
+ *  it records no function name.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_DebugFunctionfprintf(const char* pFunctionName, const char* format, ...)
+{
+  va_list p_ArgumentList;
+
+  va_start(p_ArgumentList, format);
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+  SLError_t ErrorCode = siglib_numerix_TraceRecord(pFunctionName, format, p_ArgumentList);
+#  else
+  (void)pFunctionName;
+  SLError_t ErrorCode = SUF_Debugvfprintf(format, p_ArgumentList);
+#  endif
+  va_end(p_ArgumentList);
+  return (ErrorCode);
+}    // End of SUF_DebugFunctionfprintf()
+
+/********************************************************
+ * Function: SUF_DebugTraceFlush
+ *
+ * Parameters:
+ *  None
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Append the records in the trace buffers of all of the
+ *  threads to the binary trace file SIGLIB_TRACE_FILE.
+ *
+ * Notes:
+ *  SUF_Debugfprintf and SUF_Debugvfprintf write binary
+ *  records to a lock free ring buffer for each thread
+ *  when SIGLIB_DEBUG_TRACE = 1. The logging threads never
+ *  flush the buffers, the records are written to the file
+ *  by this function, by the background flusher started
+ *  with SUF_DebugTraceStartFlusher and when the program
+ *  exits. Without the flusher this function should be
+ *  called periodically, before any buffer fills. Records
+ *  logged to a full buffer are dropped and the number
+ *  dropped is written to the file.
+ *  If another thread is flushing the buffers then this
+ *  function returns immediately.
+ *  The other SUF_Debug functions still write text to
+ *  SIGLIB_LOG_FILE, so their output is not ordered with
+ *  the trace records.
+ *  The format strings are copied into the buffers so they
+ *  only need to be valid during the SUF_Debugfprintf call.
+ *  The trace file is converted to text with
+ *  SUF_DebugTraceDecode.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceFlush(void)
+{
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+  return (siglib_numerix_TraceFlush(SIGLIB_FALSE));
+#  else
+  return (SIGLIB_NO_ERROR);
+#  endif
+}    // End of SUF_DebugTraceFlush()
+
+/********************************************************
+ * Function: SUF_DebugTraceStartFlusher
+ *
+ * Parameters:
+ *  const SLArrayIndex_t periodMs   - Flush period (ms)
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Start a background thread that appends the trace
+ *  buffers to the binary trace file every period and
+ *  whenever a logging thread's buffer passes the high
+ *  water mark.
+ *
+ * Notes:
+ *  The flusher is optional, without it the application
+ *  calls SUF_DebugTraceFlush. SIGLIB_DEBUG_TRACE_HIGH_WATER
+ *  sets the number of bytes in a buffer at which the
+ *  logging thread signals the flusher, the logging thread
+ *  never waits for the flusher.
+ *  The flusher is only available on POSIX systems, on
+ *  other systems SIGLIB_PARAMETER_ERROR is returned. When
+ *  SIGLIB_DEBUG_TRACE = 0 the log file is written directly
+ *  and SIGLIB_NO_ERROR is returned.
+ *  If the flusher is already running its period is
+ *  changed.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceStartFlusher(const SLArrayIndex_t periodMs)
+{
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+#    if (SIGLIB_TRACE_FLUSHER == 1)
+  if (periodMs <= 0) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+  SLError_t ErrorCode = SIGLIB_NO_ERROR;
+  pthread_mutex_lock(&siglib_numerix_TraceFlusherControlMutex);
+  pthread_mutex_lock(&siglib_numerix_TraceFlusherMutex);
+  siglib_numerix_TraceFlusherPeriod = periodMs;
+  if (0U == atomic_load_explicit(&siglib_numerix_TraceFlusherRunning, memory_order_relaxed)) {
+    siglib_numerix_TraceFlusherStop = SIGLIB_FALSE;
+    if (0 == pthread_create(&siglib_numerix_TraceFlusherThread, NULL, siglib_numerix_TraceFlusher, NULL)) {
+      atomic_store_explicit(&siglib_numerix_TraceFlusherRunning, 1U, memory_order_release);
+    } else {
+      ErrorCode = SIGLIB_MEM_ALLOC_ERROR;
+    }
+  } else {
+    pthread_cond_signal(&siglib_numerix_TraceFlusherCondition);    // Start the new period
+  }
+  pthread_mutex_unlock(&siglib_numerix_TraceFlusherMutex);
+  pthread_mutex_unlock(&siglib_numerix_TraceFlusherControlMutex);
+  return (ErrorCode);
+#    else
+  (void)periodMs;
+  return (SIGLIB_PARAMETER_ERROR);
+#    endif
+#  else
+  (void)periodMs;
+  return (SIGLIB_NO_ERROR);
+#  endif
+}    // End of SUF_DebugTraceStartFlusher()
+
+/********************************************************
+ * Function: SUF_DebugTraceStopFlusher
+ *
+ * Parameters:
+ *  None
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Stop the background thread started by
+ *  SUF_DebugTraceStartFlusher, after it has flushed the
+ *  records logged before the call.
+ *
+ * Notes:
+ *  It is not necessary to stop the flusher before the
+ *  program exits, the buffers are also flushed at exit.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceStopFlusher(void)
+{
+#  if (SIGLIB_DEBUG_TRACE_RING == 1)
+#    if (SIGLIB_TRACE_FLUSHER == 1)
+  pthread_mutex_lock(&siglib_numerix_TraceFlusherControlMutex);
+  if (0U != atomic_load_explicit(&siglib_numerix_TraceFlusherRunning, memory_order_relaxed)) {
+    pthread_mutex_lock(&siglib_numerix_TraceFlusherMutex);
+    siglib_numerix_TraceFlusherStop = SIGLIB_TRUE;
+    atomic_store_explicit(&siglib_numerix_TraceFlusherRunning, 0U, memory_order_relaxed);
+    pthread_cond_signal(&siglib_numerix_TraceFlusherCondition);
+    pthread_mutex_unlock(&siglib_numerix_TraceFlusherMutex);
+    (void)pthread_join(siglib_numerix_TraceFlusherThread, NULL);
+  }
+  pthread_mutex_unlock(&siglib_numerix_TraceFlusherControlMutex);
+#    endif
+#  endif
+  return (SIGLIB_NO_ERROR);
+}    // End of SUF_DebugTraceStopFlusher()
+
+/********************************************************
+ * Function: siglib_numerix_TraceArgument
+ *
+ * Parameters:
+ *  const unsigned char *   - Pointer to record
+ *  const SLUInt32_t        - Record length
+ *  SLUInt32_t *            - Pointer to index of the next argument
+ *  const SLUInt8_t         - Required argument type
+ *  SLUInt64_t *            - Pointer to integer or floating point value
+ *  char *                  - Pointer to string destination, with space
+ *                            for SIGLIB_TRACE_MAX_RECORD_LENGTH characters
+ *
+ * Return value:
+ *  SLFixData_t     - SIGLIB_TRUE if the argument was extracted,
+ *                    SIGLIB_FALSE if there are no more arguments or
+ *                    the argument type does not match
+ *
+ * Description:
+ *  Extract the next argument from a trace record, the
+ *  signed and unsigned integer types are interchangeable.
+ *
+ ********************************************************/
+
+static SLFixData_t siglib_numerix_TraceArgument(const unsigned char* pRecord, const SLUInt32_t Length, SLUInt32_t* pIndex, const SLUInt8_t Type,
+                                                SLUInt64_t* pValue, char* pString)
+{
+  if (*pIndex >= Length) {
+    return (SIGLIB_FALSE);
+  }
+  SLUInt8_t StoredType = pRecord[*pIndex];
+  if (SIGLIB_TRACE_ARG_STRING == StoredType) {
+    SLUInt16_t StringLength;
+    if ((*pIndex + 3U) > Length) {
+      return (SIGLIB_FALSE);
+    }
+    memcpy(&StringLength, pRecord + *pIndex + 1U, sizeof(StringLength));
+    if ((SIGLIB_TRACE_ARG_STRING != Type) || ((*pIndex + 3U + StringLength) > Length)) {
+      *pIndex += 3U + StringLength;
+      return (SIGLIB_FALSE);
+    }
+    memcpy(pString, pRecord + *pIndex + 3U, StringLength);
+    pString[StringLength] = '\0';
+    *pIndex += 3U + StringLength;
+    return (SIGLIB_TRUE);
+  }
+
+  if ((*pIndex + 1U + sizeof(SLUInt64_t)) > Length) {
+    return (SIGLIB_FALSE);
+  }
+  memcpy(pValue, pRecord + *pIndex + 1U, sizeof(SLUInt64_t));
+  *pIndex += 1U + (SLUInt32_t)sizeof(SLUInt64_t);
+  if ((StoredType == Type) || (((SIGLIB_TRACE_ARG_SIGNED == StoredType) || (SIGLIB_TRACE_ARG_UNSIGNED == StoredType)) &&
+                               ((SIGLIB_TRACE_ARG_SIGNED == Type) || (SIGLIB_TRACE_ARG_UNSIGNED == Type)))) {
+    return (SIGLIB_TRUE);
+  }
+  return (SIGLIB_FALSE);
+}    // End of siglib_numerix_TraceArgument()
+
 /********************************************************
- * Function: SUF_ClearDebugfprintf
+ * Function: siglib_numerix_TraceSpecAppend
  *
  * Parameters:
- *  None
+ *  char *                  - Pointer to conversion specification
+ *  size_t *                - Pointer to specification length
+ *  const char *            - Text to append
+ *  const size_t            - Text length
  *
  * Return value:
- *  Error code
+ *  SLFixData_t     - SIGLIB_TRUE if the text was appended,
+ *                    SIGLIB_FALSE if it does not fit
  *
- * Description: Clear the debug log file.
+ * Description:
+ *  Append text to a conversion specification, leaving
+ *  space for the length modifier, the conversion character
+ *  and the terminator.
  *
  ********************************************************/
 
-SLError_t SIGLIB_FUNC_DECL SUF_ClearDebugfprintf(void)
+static SLFixData_t siglib_numerix_TraceSpecAppend(char* pSpec, size_t* pSpecLength, const char* pText, const size_t TextLength)
 {
-  FILE* fp_LogFile;
-#  if SIGLIB_FILE_OPEN_SECURE
-  SUF_Fopen(&fp_LogFile, SIGLIB_LOG_FILE, "w");
-#  else
-  fp_LogFile = SUF_Fopen(SIGLIB_LOG_FILE, "w");
-#  endif
-  if (NULL == fp_LogFile) {
-    return (SIGLIB_FILE_ERROR);
+  if ((*pSpecLength + TextLength) > (SIGLIB_TRACE_SPEC_LENGTH - 4U)) {
+    return (SIGLIB_FALSE);
   }
-  SUF_Fclose(fp_LogFile);
-
-  return (SIGLIB_NO_ERROR);
-}    // End of SUF_ClearDebugfprintf()
+  memcpy(pSpec + *pSpecLength, pText, TextLength);
+  *pSpecLength += TextLength;
+  return (SIGLIB_TRUE);
+}    // End of siglib_numerix_TraceSpecAppend()
 
 /********************************************************
- * Function: SUF_Debugfprintf
+ * Function: siglib_numerix_TraceRender
  *
  * Parameters:
- *  variable argument list
+ *  FILE *                  - Pointer to text file
+ *  const char *            - Format string
+ *  const unsigned char *   - Pointer to record
+ *  const SLUInt32_t        - Record length
  *
  * Return value:
- *  Error code
+ *  void
  *
- * Description: Prints string to file for debugging
+ * Description:
+ *  Print a trace record using the format string, each
+ *  conversion specification is printed with fprintf.
+ *  Arguments that are missing from the record, because
+ *  it was truncated, are printed as <?>.
+ *  Specifications that are too long to rebuild are
+ *  printed as they are in the format string.
  *
  ********************************************************/
 
-SLError_t SIGLIB_FUNC_DECL SUF_Debugfprintf(const char* ArgumentType, ...)
+static void siglib_numerix_TraceRender(FILE* fp_TextFile, const char* pFormat, const unsigned char* pRecord, const SLUInt32_t Length)
 {
-  va_list p_ArgumentList;
+  SLUInt32_t Index = SIGLIB_TRACE_RECORD_HEADER_LENGTH;
+  char String[SIGLIB_TRACE_MAX_RECORD_LENGTH];
+  SLUInt64_t Value;
+
+  for (const char* p = pFormat; *p != '\0'; p++) {
+    if (*p != '%') {
+      fputc(*p, fp_TextFile);
+      continue;
+    }
+    if (*(p + 1) == '%') {
+      fputc('%', fp_TextFile);
+      p++;
+      continue;
+    }
 
-  FILE* fp_LogFile;
-#  if SIGLIB_FILE_OPEN_SECURE
-  SUF_Fopen(&fp_LogFile, SIGLIB_LOG_FILE, "a");
-#  else
-  fp_LogFile = SUF_Fopen(SIGLIB_LOG_FILE, "a");
-#  endif
-  if (NULL == fp_LogFile) {
-    return (SIGLIB_FILE_ERROR);
-  }
+    // Rebuild the conversion specification, with the integer arguments promoted to 64 bits
+    const char* pSpecStart = p;
+    char Spec[SIGLIB_TRACE_SPEC_LENGTH];
+    size_t SpecLength = 0;
+    SLFixData_t SpecFitsFlag = siglib_numerix_TraceSpecAppend(Spec, &SpecLength, p++, 1);
+    while ((*p == '-') || (*p == '+') || (*p == ' ') || (*p == '#') || (*p == '0')) {
+      SpecFitsFlag &= siglib_numerix_TraceSpecAppend(Spec, &SpecLength, p++, 1);
+    }
+    for (SLArrayIndex_t Field = 0; Field < 2; Field++) {    // Width and precision
+      if ((1 == Field) && (*p == '.')) {
+        SpecFitsFlag &= siglib_numerix_TraceSpecAppend(Spec, &SpecLength, p++, 1);
+      }
+      if (*p == '*') {
+        char FieldString[12];
+        int FieldValue = 0;
+        if (SIGLIB_TRUE == siglib_numerix_TraceArgument(pRecord, Length, &Index, SIGLIB_TRACE_ARG_SIGNED, &Value, String)) {
+          FieldValue = (int)(SLInt64_t)Value;
+        }
+        int FieldLength = snprintf(FieldString, sizeof(FieldString), "%d", FieldValue);
+        SpecFitsFlag &= siglib_numerix_TraceSpecAppend(Spec, &SpecLength, FieldString, (size_t)FieldLength);
+        p++;
+      }
+      while ((*p >= '0') && (*p <= '9')) {
+        SpecFitsFlag &= siglib_numerix_TraceSpecAppend(Spec, &SpecLength, p++, 1);
+      }
+    }
+    while ((*p == 'h') || (*p == 'l') || (*p == 'L') || (*p == 'z') || (*p == 'j') || (*p == 't')) {
+      p++;
+    }
+    if (*p == '\0') {
+      break;
+    }
 
-  va_start(p_ArgumentList, ArgumentType);
-  vfprintf(fp_LogFile, ArgumentType, p_ArgumentList);
-  va_end(p_ArgumentList);
-  SUF_Fclose(fp_LogFile);
+    SLUInt8_t Type;
+    switch (*p) {
+    case 'd':
+    case 'i':
+    case 'c':
+      Type = SIGLIB_TRACE_ARG_SIGNED;
+      break;
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+      Type = SIGLIB_TRACE_ARG_UNSIGNED;
+      break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      Type = SIGLIB_TRACE_ARG_DOUBLE;
+      break;
+    case 's':
+      Type = SIGLIB_TRACE_ARG_STRING;
+      break;
+    case 'p':
+      Type = SIGLIB_TRACE_ARG_POINTER;
+      break;
+    case 'n':
+      continue;
+    default:    // Unknown conversion, print the specification
+      fwrite(pSpecStart, 1, (size_t)(p - pSpecStart) + 1U, fp_TextFile);
+      continue;
+    }
 
-  return (SIGLIB_NO_ERROR);
-}    // End of SUF_Debugfprintf()
+    if (SIGLIB_TRUE != siglib_numerix_TraceArgument(pRecord, Length, &Index, Type, &Value, String)) {
+      fputs("<?>", fp_TextFile);
+      continue;
+    }
+    if (SIGLIB_TRUE != SpecFitsFlag) {    // The specification is too long to rebuild, print the raw text
+      fwrite(pSpecStart, 1, (size_t)(p - pSpecStart) + 1U, fp_TextFile);
+      continue;
+    }
+    if (((SIGLIB_TRACE_ARG_SIGNED == Type) && (*p != 'c')) || (SIGLIB_TRACE_ARG_UNSIGNED == Type)) {
+      Spec[SpecLength++] = 'l';    // Space for the length modifier, conversion and terminator is reserved
+      Spec[SpecLength++] = 'l';
+    }
+    Spec[SpecLength++] = *p;
+    Spec[SpecLength] = '\0';
+
+    if (*p == 'c') {
+      fprintf(fp_TextFile, Spec, (int)(SLInt64_t)Value);
+    } else if (SIGLIB_TRACE_ARG_SIGNED == Type) {
+      fprintf(fp_TextFile, Spec, (long long)(SLInt64_t)Value);
+    } else if (SIGLIB_TRACE_ARG_UNSIGNED == Type) {
+      fprintf(fp_TextFile, Spec, (unsigned long long)Value);
+    } else if (SIGLIB_TRACE_ARG_DOUBLE == Type) {
+      double DoubleValue;
+      memcpy(&DoubleValue, &Value, sizeof(DoubleValue));
+      fprintf(fp_TextFile, Spec, DoubleValue);
+    } else if (SIGLIB_TRACE_ARG_STRING == Type) {
+      fprintf(fp_TextFile, Spec, String);
+    } else {
+      fprintf(fp_TextFile, Spec, (void*)(size_t)Value);
+    }
+  }
+}    // End of siglib_numerix_TraceRender()
 
 /********************************************************
- * Function: SUF_Debugvfprintf
+ * Function: SUF_DebugTraceDecode
  *
  * Parameters:
- *  const char *format,     - Format
- *  va_list ap              - Pointer to variable argument list
+ *  const char *            - Binary trace file name
+ *  const char *            - Text file name
+ *  const SLFixData_t       - SIGLIB_TRUE to prefix each line with the
+ *                            thread index, time and logging function
  *
  * Return value:
  *  Error code
  *
- * Description: Prints string to file for debugging
+ * Description:
+ *  Convert a binary trace file, written by
+ *  SUF_DebugTraceFlush, to the text that SUF_Debugfprintf
+ *  would have written to the log file.
+ *
+ * Notes:
+ *  The trace file is in the byte order of the machine that
+ *  wrote it.
+ *  The time is in seconds from the start of the session.
+ *  The logging function is only known for the records
+ *  written by SUF_DebugFunctionfprintf, which is called by
+ *  SUF_Debugfprintf when SIGLIB_DEBUG_TRACE = 1.
+ *  The records of each thread are in order, when several
+ *  threads log the records of each flush are grouped by
+ *  thread.
  *
  ********************************************************/
 
-SLError_t SIGLIB_FUNC_DECL SUF_Debugvfprintf(const char* format, va_list ap)
+SLError_t SIGLIB_FUNC_DECL SUF_DebugTraceDecode(const char* pTraceFileName, const char* pTextFileName, const SLFixData_t timestampFlag)
 {
-  FILE* fp_LogFile;
+  FILE* fp_TraceFile;
+  FILE* fp_TextFile;
 #  if SIGLIB_FILE_OPEN_SECURE
-  SUF_Fopen(&fp_LogFile, SIGLIB_LOG_FILE, "a");
+  SUF_Fopen(&fp_TraceFile, pTraceFileName, "rb");
 #  else
-  fp_LogFile = SUF_Fopen(SIGLIB_LOG_FILE, "a");
+  fp_TraceFile = SUF_Fopen(pTraceFileName, "rb");
 #  endif
-  if (NULL == fp_LogFile) {
+  if (NULL == fp_TraceFile) {
+    return (SIGLIB_FILE_ERROR);
+  }
+#  if SIGLIB_FILE_OPEN_SECURE
+  SUF_Fopen(&fp_TextFile, pTextFileName, "w");
+#  else
+  fp_TextFile = SUF_Fopen(pTextFileName, "w");
+#  endif
+  if (NULL == fp_TextFile) {
+    SUF_Fclose(fp_TraceFile);
     return (SIGLIB_FILE_ERROR);
   }
 
-  vfprintf(fp_LogFile, format, ap);
-  SUF_Fclose(fp_LogFile);
-  return (SIGLIB_NO_ERROR);
-}    // End of SUF_Debugvfprintf()
+  siglib_numerix_TraceFormatTable_s Formats = {NULL, NULL, 0U, 0U};
+  SLUInt64_t StartTime = 0U;
+  SLFixData_t LineStartFlag = SIGLIB_TRUE;
+  SLError_t ErrorCode = SIGLIB_NO_ERROR;
+  int RecordType;
+
+  while ((SIGLIB_NO_ERROR == ErrorCode) && (EOF != (RecordType = fgetc(fp_TraceFile)))) {
+    SLUInt32_t ThreadIndex;
+    SLUInt16_t Length;
+    SLUInt64_t FormatId;
+    unsigned char Record[SIGLIB_TRACE_MAX_RECORD_LENGTH];
+
+    switch (RecordType) {
+    case SIGLIB_TRACE_SESSION:    // Each session has its own format ids
+      if (1 != fread(&StartTime, sizeof(StartTime), 1, fp_TraceFile)) {
+        ErrorCode = SIGLIB_FILE_ERROR;
+      }
+      siglib_numerix_TraceFormatFree(&Formats, SIGLIB_TRUE);
+      break;
+    case SIGLIB_TRACE_FORMAT: {
+      char* pFormat = NULL;
+      if ((1 != fread(&FormatId, sizeof(FormatId), 1, fp_TraceFile)) || (1 != fread(&Length, sizeof(Length), 1, fp_TraceFile)) ||
+          (NULL == (pFormat = (char*)SUF_MemoryAllocate((size_t)Length + 1U))) || (Length != fread(pFormat, 1, Length, fp_TraceFile))) {
+        SUF_MemoryFree(pFormat);
+        ErrorCode = SIGLIB_FILE_ERROR;
+        break;
+      }
+      pFormat[Length] = '\0';
+      if (siglib_numerix_TraceFormatFind(&Formats, FormatId, pFormat, SIGLIB_TRUE) < 0) {
+        SUF_MemoryFree(pFormat);
+        ErrorCode = SIGLIB_MEM_ALLOC_ERROR;
+      }
+    } break;
+    case SIGLIB_TRACE_RECORD: {
+      if ((1 != fread(&ThreadIndex, sizeof(ThreadIndex), 1, fp_TraceFile)) || (1 != fread(&Length, sizeof(Length), 1, fp_TraceFile)) ||
+          (Length < SIGLIB_TRACE_RECORD_HEADER_LENGTH) || (Length > SIGLIB_TRACE_MAX_RECORD_LENGTH) ||
+          ((size_t)(Length - 2U) != fread(Record + 2, 1, (size_t)(Length - 2U), fp_TraceFile))) {
+        ErrorCode = SIGLIB_FILE_ERROR;
+        break;
+      }
+      SLUInt64_t Timestamp;
+      SLUInt64_t FunctionId;
+      memcpy(&Timestamp, Record + 3, sizeof(Timestamp));
+      memcpy(&FormatId, Record + SIGLIB_TRACE_RECORD_FORMAT_ID, sizeof(FormatId));
+      memcpy(&FunctionId, Record + SIGLIB_TRACE_RECORD_FUNCTION_ID, sizeof(FunctionId));
+      SLArrayIndex_t Slot = siglib_numerix_TraceFormatFind(&Formats, FormatId, NULL, SIGLIB_FALSE);
+      SLArrayIndex_t FunctionSlot = (0U != FunctionId) ? siglib_numerix_TraceFormatFind(&Formats, FunctionId, NULL, SIGLIB_FALSE) : -1;
+      if ((Slot < 0) || ((0U != FunctionId) && (FunctionSlot < 0))) {    // The definitions are written before the first record that uses them
+        ErrorCode = SIGLIB_FILE_ERROR;
+        break;
+      }
+      const char* pFormat = Formats.ppStrings[Slot];
+      if ((SIGLIB_TRUE == timestampFlag) && (SIGLIB_TRUE == LineStartFlag)) {
+        fprintf(fp_TextFile, "[%u %.9lf%s%s] ", (unsigned)ThreadIndex, (double)(SLInt64_t)(Timestamp - StartTime) * 1.0e-9,
+                (FunctionSlot < 0) ? "" : " ", (FunctionSlot < 0) ? "" : Formats.ppStrings[FunctionSlot]);
+      }
+      siglib_numerix_TraceRender(fp_TextFile, pFormat, Record, Length);
+      LineStartFlag = ((*pFormat != '\0') && (pFormat[strlen(pFormat) - 1] == '\n')) ? SIGLIB_TRUE : SIGLIB_FALSE;
+    } break;
+    case SIGLIB_TRACE_DROPPED: {
+      SLUInt32_t DroppedRecords;
+      if ((1 != fread(&ThreadIndex, sizeof(ThreadIndex), 1, fp_TraceFile)) ||
+          (1 != fread(&DroppedRecords, sizeof(DroppedRecords), 1, fp_TraceFile))) {
+        ErrorCode = SIGLIB_FILE_ERROR;
+        break;
+      }
+      fprintf(fp_TextFile, "%s*** %u trace records dropped by thread %u ***\n", (SIGLIB_TRUE == LineStartFlag) ? "" : "\n",
+              (unsigned)DroppedRecords, (unsigned)ThreadIndex);
+      LineStartFlag = SIGLIB_TRUE;
+    } break;
+    default:
+      ErrorCode = SIGLIB_FILE_ERROR;
+      break;
+    }
+  }
+
+  siglib_numerix_TraceFormatFree(&Formats, SIGLIB_TRUE);
+  SUF_Fclose(fp_TraceFile);
+  SUF_Fclose(fp_TextFile);
+  return (ErrorCode);
+}    // End of SUF_DebugTraceDecode()
 
 /********************************************************
  * Function: SUF_DebugPrintArray
@@ -1238,3 +2679,437 @@ const char* SUF_StrError(const SLError_t ErrNo)
     return "SigLib: Undefined error code";
   }
 }
+
+static SLParallelFor_t siglib_numerix_ParallelFor = NULL;    // User supplied parallel executor
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#  define SIGLIB_PARALLEL_NESTING 1    // Nested SUF_ParallelFor calls are detected on each thread
+static _Thread_local SLArrayIndex_t siglib_numerix_InParallelTask = 0;    // Set while the thread runs a SUF_ParallelFor task
+#elif defined(_MSC_VER)
+#  define SIGLIB_PARALLEL_NESTING 1
+static __declspec(thread) SLArrayIndex_t siglib_numerix_InParallelTask = 0;
+#elif defined(__GNUC__)
+#  define SIGLIB_PARALLEL_NESTING 1
+static __thread SLArrayIndex_t siglib_numerix_InParallelTask = 0;
+#else
+#  define SIGLIB_PARALLEL_NESTING 0    // No thread local storage, only one call at a time is passed to the executor
+static volatile SLArrayIndex_t siglib_numerix_InParallelTask = 0;    // Set while the executor runs, for all threads
+#endif
+
+#if (SIGLIB_PARALLEL_NESTING == 1)
+typedef struct {    // Task passed to the executor by SUF_ParallelFor
+  SLParallelTask_t pTask;
+  void* pContext;
+} siglib_numerix_ParallelTask_s;
+
+/********************************************************
+ * Function: siglib_numerix_ParallelTask
+ *
+ * Parameters:
+ *  void *              Pointer to siglib_numerix_ParallelTask_s
+ *  SLArrayIndex_t      Task index
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Run a task on an executor thread, marking the thread
+ *  as inside a parallel region so that nested
+ *  SUF_ParallelFor calls run serially.
+ *
+ ********************************************************/
+
+static void siglib_numerix_ParallelTask(void* pContext, SLArrayIndex_t taskIndex)
+{
+  const siglib_numerix_ParallelTask_s* pParallelTask = (const siglib_numerix_ParallelTask_s*)pContext;
+  const SLArrayIndex_t InParallelTask = siglib_numerix_InParallelTask;    // The executor may run tasks on the calling thread
+  siglib_numerix_InParallelTask = 1;
+  pParallelTask->pTask(pParallelTask->pContext, taskIndex);
+  siglib_numerix_InParallelTask = InParallelTask;
+}    // End of siglib_numerix_ParallelTask()
+#endif
+
+/********************************************************
+ * Function: SUF_SetParallelFor
+ *
+ * Parameters:
+ *  SLParallelFor_t     Parallel executor function pointer
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Register the function that the library uses to
+ *  distribute independent tasks across threads.
+ *  The executor must call the task function once for
+ *  each task index from 0 to (numberOfTasks - 1), in any
+ *  order and on any thread, and must not return until
+ *  all of the tasks have completed.
+ *  Tasks may call library functions that use
+ *  SUF_ParallelFor themselves. These nested calls run
+ *  serially on the thread of the task and are not passed
+ *  to the executor, so a thread pool does not wait for
+ *  itself. Compilers without thread local storage (C11
+ *  _Thread_local, GCC __thread or MSVC
+ *  __declspec(thread)) pass one call at a time to the
+ *  executor, the calls made while the executor is running,
+ *  from any thread, run serially on the calling thread.
+ *  The library does not create any threads itself,
+ *  the executor can be based on OpenMP, pthreads or an
+ *  application thread pool.
+ *  Passing NULL restores serial execution.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_SetParallelFor(SLParallelFor_t pParallelFor)
+{
+  siglib_numerix_ParallelFor = pParallelFor;
+}    // End of SUF_SetParallelFor()
+
+/********************************************************
+ * Function: SUF_ParallelFor
+ *
+ * Parameters:
+ *  SLParallelTask_t    Task function pointer
+ *  void *              Task context pointer
+ *  const SLArrayIndex_t    Number of tasks
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Execute the task function for each task index, using
+ *  the executor registered with SUF_SetParallelFor or
+ *  serially when no executor has been registered or when
+ *  called from inside another SUF_ParallelFor task.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_ParallelFor(SLParallelTask_t pTask, void* pContext, const SLArrayIndex_t numberOfTasks)
+{
+  if ((NULL != siglib_numerix_ParallelFor) && (numberOfTasks > 1) && (0 == siglib_numerix_InParallelTask)) {
+#if (SIGLIB_PARALLEL_NESTING == 1)
+    siglib_numerix_ParallelTask_s ParallelTask;
+    ParallelTask.pTask = pTask;
+    ParallelTask.pContext = pContext;
+    siglib_numerix_ParallelFor(siglib_numerix_ParallelTask, &ParallelTask, numberOfTasks);
+#else
+    siglib_numerix_InParallelTask = 1;
+    siglib_numerix_ParallelFor(pTask, pContext, numberOfTasks);
+    siglib_numerix_InParallelTask = 0;
+#endif
+  } else {
+    for (SLArrayIndex_t i = 0; i < numberOfTasks; i++) {
+      pTask(pContext, i);
+    }
+  }
+}    // End of SUF_ParallelFor()
+
+#if SIGLIB_ENABLE_PROFILING
+#  if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#    include <stdatomic.h>
+typedef _Atomic SLUInt64_t siglib_numerix_ProfileCount_t;    // Counters may be updated by several threads
+#    define siglib_numerix_ProfileLoad(pCount) atomic_load_explicit(pCount, memory_order_relaxed)
+#    define siglib_numerix_ProfileStore(pCount, Value) atomic_store_explicit(pCount, Value, memory_order_relaxed)
+#    define siglib_numerix_ProfileAdd(pCount, Value) atomic_fetch_add_explicit(pCount, Value, memory_order_relaxed)
+#    define siglib_numerix_ProfileCompareExchange(pCount, pExpected, Value) \
+      atomic_compare_exchange_weak_explicit(pCount, pExpected, Value, memory_order_relaxed, memory_order_relaxed)
+#  else
+typedef SLUInt64_t siglib_numerix_ProfileCount_t;    // Counters are only valid if a single thread is profiled
+#    define siglib_numerix_ProfileLoad(pCount) (*(pCount))
+#    define siglib_numerix_ProfileStore(pCount, Value) (*(pCount) = (Value))
+#    define siglib_numerix_ProfileAdd(pCount, Value) (*(pCount) += (Value))
+#    define siglib_numerix_ProfileCompareExchange(pCount, pExpected, Value) (*(pCount) = (Value), 1)
+#  endif
+#  if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#  endif
+
+typedef struct {    // Profile counters for each function
+  siglib_numerix_ProfileCount_t Calls;
+  siglib_numerix_ProfileCount_t TotalTicks;
+  siglib_numerix_ProfileCount_t MinTicks;
+  siglib_numerix_ProfileCount_t MaxTicks;
+  siglib_numerix_ProfileCount_t Histogram[SIGLIB_PROFILE_HISTOGRAM_LENGTH];    // Bin n counts the calls of 2^n to 2^(n+1)-1 ticks
+} siglib_numerix_Profile_s;
+
+static siglib_numerix_Profile_s siglib_numerix_Profiles[SIGLIB_PROFILE_FUNCTION_COUNT];
+
+static const char* const siglib_numerix_ProfileNames[SIGLIB_PROFILE_FUNCTION_COUNT] = {    // In the order of enum SLProfileFunction_t
+  "SDA_Fir",
+  "SDA_Iir",
+  "SDA_Rfft",
+  "SDA_Cfft",
+  "SDS_CostasQamDemodulate",
+  "SDA_CostasQamDemodulate",
+  "SDA_QpskDemodulate",
+  "SDA_Qam16Demodulate",
+  "SDA_FskDemodulate",
+  "SDA_OpskDemodulate",
+  "SDA_BpskDemodulate",
+  "SDA_DpskDemodulate",
+  "User0",
+  "User1",
+  "User2",
+  "User3"};
+
+/********************************************************
+ * Function: siglib_numerix_ProfileTime
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  SLData_t        - Time in seconds
+ *
+ * Description:
+ *  Return the wall clock time, used to calibrate the
+ *  profile tick counter.
+ *
+ ********************************************************/
+
+static SLData_t siglib_numerix_ProfileTime(void)
+{
+#  ifdef TIME_UTC
+  struct timespec Time;
+  timespec_get(&Time, TIME_UTC);
+  return ((SLData_t)Time.tv_sec + ((SLData_t)Time.tv_nsec * 1.0e-9));
+#  else
+  return ((SLData_t)clock() / (SLData_t)CLOCKS_PER_SEC);
+#  endif
+}    // End of siglib_numerix_ProfileTime()
+#endif
+
+/********************************************************
+ * Function: SUF_ProfileTicks
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  SLUInt64_t      - Tick count
+ *
+ * Description:
+ *  Return the free running tick counter used to time the
+ *  profiled functions. This is the time stamp counter on
+ *  x86, the virtual counter on AArch64 and the wall clock
+ *  time in ns on other processors.
+ *
+ * Notes:
+ *  Returns 0 when SIGLIB_ENABLE_PROFILING = 0.
+ *
+ ********************************************************/
+
+SLUInt64_t SIGLIB_FUNC_DECL SUF_ProfileTicks(void)
+{
+#if SIGLIB_ENABLE_PROFILING
+#  if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  return ((SLUInt64_t)__builtin_ia32_rdtsc());
+#  elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  return ((SLUInt64_t)__rdtsc());
+#  elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+  SLUInt64_t Ticks;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(Ticks));
+  return (Ticks);
+#  elif defined(TIME_UTC)
+  struct timespec Time;
+  timespec_get(&Time, TIME_UTC);
+  return (((SLUInt64_t)Time.tv_sec * 1000000000ULL) + (SLUInt64_t)Time.tv_nsec);
+#  else
+  return ((SLUInt64_t)clock());
+#  endif
+#else
+  return (0U);
+#endif
+}    // End of SUF_ProfileTicks()
+
+/********************************************************
+ * Function: SUF_ProfileRecord
+ *
+ * Parameters:
+ *  const enum SLProfileFunction_t  - Profiled function
+ *  const SLUInt64_t                - Number of ticks for the call
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Add a call to the count, total time, minimum, maximum
+ *  and log2 latency histogram of the function.
+ *
+ * Notes:
+ *  This function is called by the SIGLIB_PROFILE_END
+ *  macro, the application can profile its own code with
+ *  SIGLIB_PROFILE_START / SIGLIB_PROFILE_END and the
+ *  SIGLIB_PROFILE_USER_n identifiers.
+ *  The counters are updated with relaxed atomic operations
+ *  when C11 atomics are available so functions may be
+ *  profiled in several threads.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_ProfileRecord(const enum SLProfileFunction_t function, const SLUInt64_t ticks)
+{
+#if SIGLIB_ENABLE_PROFILING
+  if (((SLArrayIndex_t)function < 0) || ((SLArrayIndex_t)function >= (SLArrayIndex_t)SIGLIB_PROFILE_FUNCTION_COUNT)) {
+    return;
+  }
+  siglib_numerix_Profile_s* pProfile = &siglib_numerix_Profiles[function];
+
+  SLArrayIndex_t Bin = 0;    // Log2 of the number of ticks
+  for (SLUInt64_t Tmp = ticks >> 1U; (Tmp != 0U) && (Bin < (SIGLIB_PROFILE_HISTOGRAM_LENGTH - 1)); Tmp >>= 1U) {
+    Bin++;
+  }
+
+  siglib_numerix_ProfileAdd(&pProfile->Calls, 1U);
+  siglib_numerix_ProfileAdd(&pProfile->TotalTicks, ticks);
+  siglib_numerix_ProfileAdd(&pProfile->Histogram[Bin], 1U);
+
+  SLUInt64_t Current = siglib_numerix_ProfileLoad(&pProfile->MaxTicks);
+  while ((ticks > Current) && !siglib_numerix_ProfileCompareExchange(&pProfile->MaxTicks, &Current, ticks)) {
+  }
+  Current = siglib_numerix_ProfileLoad(&pProfile->MinTicks);    // 0 until the first call
+  while (((0U == Current) || (ticks < Current)) && (0U != ticks) &&
+         !siglib_numerix_ProfileCompareExchange(&pProfile->MinTicks, &Current, ticks)) {
+  }
+#else
+  (void)function;
+  (void)ticks;
+#endif
+}    // End of SUF_ProfileRecord()
+
+/********************************************************
+ * Function: SUF_ProfileReset
+ *
+ * Parameters:
+ *  void
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Clear the profile counters of all of the functions.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_ProfileReset(void)
+{
+#if SIGLIB_ENABLE_PROFILING
+  for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)SIGLIB_PROFILE_FUNCTION_COUNT; i++) {
+    siglib_numerix_ProfileStore(&siglib_numerix_Profiles[i].Calls, 0U);
+    siglib_numerix_ProfileStore(&siglib_numerix_Profiles[i].TotalTicks, 0U);
+    siglib_numerix_ProfileStore(&siglib_numerix_Profiles[i].MinTicks, 0U);
+    siglib_numerix_ProfileStore(&siglib_numerix_Profiles[i].MaxTicks, 0U);
+    for (SLArrayIndex_t j = 0; j < SIGLIB_PROFILE_HISTOGRAM_LENGTH; j++) {
+      siglib_numerix_ProfileStore(&siglib_numerix_Profiles[i].Histogram[j], 0U);
+    }
+  }
+#endif
+}    // End of SUF_ProfileReset()
+
+/********************************************************
+ * Function: SUF_ProfileDump
+ *
+ * Parameters:
+ *  const char *    - CSV file name, NULL to print to the console
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Print the profile of each function that has been
+ *  called or write the profiles to a CSV file.
+ *  The CSV file has one row per function with the columns :
+ *    Function, Calls, TotalTicks, MinTicks, MaxTicks,
+ *    TotalSeconds, MeanSeconds, Bin0 ... BinN
+ *  where Bin n is the number of calls that took 2^n to
+ *  2^(n+1)-1 ticks, Bin 0 also includes calls of 0 ticks.
+ *
+ * Notes:
+ *  The tick rate is calibrated against the wall clock
+ *  over 10 ms, each time this function is called.
+ *  Returns SIGLIB_ERROR when SIGLIB_ENABLE_PROFILING = 0.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SUF_ProfileDump(const char* fileName)
+{
+#if SIGLIB_ENABLE_PROFILING
+  FILE* fp_Profile = stdout;
+  if (NULL != fileName) {
+#  if SIGLIB_FILE_IO_SUPPORTED
+#    if SIGLIB_FILE_OPEN_SECURE
+    SUF_Fopen(&fp_Profile, fileName, "w");
+#    else
+    fp_Profile = SUF_Fopen(fileName, "w");
+#    endif
+    if (NULL == fp_Profile) {
+      return (SIGLIB_FILE_ERROR);
+    }
+#  else
+    return (SIGLIB_FILE_ERROR);
+#  endif
+  }
+
+  SLData_t StartTime = siglib_numerix_ProfileTime();    // Calibrate the tick counter
+  SLUInt64_t StartTicks = SUF_ProfileTicks();
+  SLData_t ElapsedTime;
+  do {
+    ElapsedTime = siglib_numerix_ProfileTime() - StartTime;
+  } while (ElapsedTime < 0.01);
+  SLData_t SecondsPerTick = ElapsedTime / (SLData_t)(SUF_ProfileTicks() - StartTicks);
+
+  if (NULL != fileName) {
+    fprintf(fp_Profile, "Function,Calls,TotalTicks,MinTicks,MaxTicks,TotalSeconds,MeanSeconds");
+    for (SLArrayIndex_t j = 0; j < SIGLIB_PROFILE_HISTOGRAM_LENGTH; j++) {
+      fprintf(fp_Profile, ",Bin%d", (int)j);
+    }
+    fprintf(fp_Profile, "\n");
+  } else {
+    fprintf(fp_Profile, "SigLib profile - %.3lf ns per tick\n", SecondsPerTick * 1.0e9);
+    fprintf(fp_Profile, "%-24s %12s %14s %12s %12s %12s\n", "Function", "Calls", "Total (s)", "Mean (us)", "Min (us)", "Max (us)");
+  }
+
+  for (SLArrayIndex_t i = 0; i < (SLArrayIndex_t)SIGLIB_PROFILE_FUNCTION_COUNT; i++) {
+    siglib_numerix_Profile_s* pProfile = &siglib_numerix_Profiles[i];
+    SLUInt64_t Calls = siglib_numerix_ProfileLoad(&pProfile->Calls);
+    if (0U == Calls) {
+      continue;
+    }
+    SLUInt64_t TotalTicks = siglib_numerix_ProfileLoad(&pProfile->TotalTicks);
+    SLUInt64_t MinTicks = siglib_numerix_ProfileLoad(&pProfile->MinTicks);
+    SLUInt64_t MaxTicks = siglib_numerix_ProfileLoad(&pProfile->MaxTicks);
+    SLData_t TotalSeconds = (SLData_t)TotalTicks * SecondsPerTick;
+
+    if (NULL != fileName) {
+      fprintf(fp_Profile, "%s,%llu,%llu,%llu,%llu,%.9le,%.9le", siglib_numerix_ProfileNames[i], (unsigned long long)Calls,
+              (unsigned long long)TotalTicks, (unsigned long long)MinTicks, (unsigned long long)MaxTicks, TotalSeconds,
+              TotalSeconds / (SLData_t)Calls);
+      for (SLArrayIndex_t j = 0; j < SIGLIB_PROFILE_HISTOGRAM_LENGTH; j++) {
+        fprintf(fp_Profile, ",%llu", (unsigned long long)siglib_numerix_ProfileLoad(&pProfile->Histogram[j]));
+      }
+      fprintf(fp_Profile, "\n");
+    } else {
+      fprintf(fp_Profile, "%-24s %12llu %14.6lf %12.3lf %12.3lf %12.3lf\n", siglib_numerix_ProfileNames[i], (unsigned long long)Calls, TotalSeconds,
+              (TotalSeconds / (SLData_t)Calls) * 1.0e6, (SLData_t)MinTicks * SecondsPerTick * 1.0e6, (SLData_t)MaxTicks * SecondsPerTick * 1.0e6);
+      for (SLArrayIndex_t j = 0; j < SIGLIB_PROFILE_HISTOGRAM_LENGTH; j++) {    // Latency histogram
+        SLUInt64_t Count = siglib_numerix_ProfileLoad(&pProfile->Histogram[j]);
+        if (0U != Count) {
+          fprintf(fp_Profile, "    %12.3lf - %12.3lf us : %12llu\n", (SLData_t)(1ULL << j) * SecondsPerTick * 1.0e6,
+                  (SLData_t)(2ULL << j) * SecondsPerTick * 1.0e6, (unsigned long long)Count);
+        }
+      }
+    }
+  }
+
+#  if SIGLIB_FILE_IO_SUPPORTED
+  if (NULL != fileName) {
+    SUF_Fclose(fp_Profile);
+  }
+#  endif
+  return (SIGLIB_NO_ERROR);
+#else
+  (void)fileName;
+  return (SIGLIB_ERROR);
+#endif
+}    // End of SUF_ProfileDump()
@@ -528,18 +528,27 @@ void SIGLIB_FUNC_DECL SDA_CovarianceMatrix(const SLData_t* SIGLIB_PTR_DECL pSrc,
  *
  * Description: Return the median value of the array.
  *
+ * Notes:
+ *  The middle value is selected with SDA_NthElement so
+ *  the working array is partially sorted, not sorted.
+ *
  ********************************************************/
 
 SLData_t SIGLIB_FUNC_DECL SDA_Median(const SLData_t* SIGLIB_PTR_DECL pSrc, SLData_t* SIGLIB_PTR_DECL pWorkArray, const SLArrayIndex_t ArrayLength)
 {
-  SDA_SortMinToMax(pSrc, pWorkArray, ArrayLength);
-
   SLData_t returnValue;
   if (((SLUFixData_t)ArrayLength & 0x1U) == 0U) {    // Return mean of two middle values
-    returnValue = ((*(pWorkArray + ((SLUFixData_t)ArrayLength >> 1U))) + (*(pWorkArray + (SLArrayIndex_t)((SLUFixData_t)ArrayLength >> 1U) - 1))) /
-                  SIGLIB_TWO;
+    SLArrayIndex_t Middle = (SLArrayIndex_t)((SLUFixData_t)ArrayLength >> 1U);
+    SLData_t Upper = SDA_NthElement(pSrc, pWorkArray, Middle, ArrayLength);
+    SLData_t Lower = pWorkArray[0];    // The lower middle value is the maximum of the lower half
+    for (SLArrayIndex_t i = 1; i < Middle; i++) {
+      if (pWorkArray[i] > Lower) {
+        Lower = pWorkArray[i];
+      }
+    }
+    returnValue = (Upper + Lower) / SIGLIB_TWO;
   } else {
-    returnValue = *(pWorkArray + ((SLUFixData_t)(ArrayLength - 1) >> 1U));    // Return middle value
+    returnValue = SDA_NthElement(pSrc, pWorkArray, (SLArrayIndex_t)((SLUFixData_t)(ArrayLength - 1) >> 1U), ArrayLength);    // Return middle value
   }
   return (returnValue);
 }    // End of SDA_Median()
@@ -99,6 +99,10 @@ const SLData_t siglib_numerix_K3RxIdealSymbol[SIGLIB_VITK3_NUMBER_OF_STATES][SIG
                                                  {{((SLData_t)-1.0), ((SLData_t)1.0)}, {((SLData_t)1.0), ((SLData_t)-1.0)}}     // 1, 2
 };
 
+// Index of the ideal symbol pair for each transition - bit 1 : first symbol is +1, bit 0 : second symbol is +1
+static const SLArrayIndex_t siglib_numerix_K3RxSymbolCode[SIGLIB_VITK3_NUMBER_OF_STATES][SIGLIB_VITK3_TRANSITIONS_PER_STATE] = {
+    {0, 3}, {3, 0}, {2, 1}, {1, 2}};
+
 // Provides the next state number from the current state
 // through a transition path - [Current State][Path Number]
 const SLUInt16_t siglib_numerix_K3RxNextStateMap[SIGLIB_VITK3_NUMBER_OF_STATES][SIGLIB_VITK3_TRANSITIONS_PER_STATE] = {
@@ -180,6 +184,7 @@ SLChar_t SIGLIB_FUNC_DECL SDS_ViterbiDecoderK3(SLData_t* pSrc, SLFixData_t* pOut
   SLData_t CurrentInput0,
       CurrentInput1;                                    // Local variables to hold current input samples
   SLData_t ErrorSquared;                                // Calculated Euclidean distance for transition
+  SLData_t SymbolError[4];                              // Euclidean distance for each ideal symbol pair
   SLData_t MinimumError;                                // Used to find the minimum error to start trace back
   SLArrayIndex_t MinimumErrorState;                     // State to start trace back from
   SLArrayIndex_t StateHistoryTraceBackIndex;            // Offset into state history array
@@ -202,6 +207,16 @@ SLChar_t SIGLIB_FUNC_DECL SDS_ViterbiDecoderK3(SLData_t* pSrc, SLFixData_t* pOut
     CurrentInput0 = *pSrc++;    // Get first input sample of pair
     CurrentInput1 = *pSrc++;    // Get second input sample of pair
 
+    // There are only four ideal symbol pairs so calculate their errors once, rather than for each transition
+    SLData_t ErrorMinus0 = (SIGLIB_MINUS_ONE - CurrentInput0) * (SIGLIB_MINUS_ONE - CurrentInput0);
+    SLData_t ErrorPlus0 = (SIGLIB_ONE - CurrentInput0) * (SIGLIB_ONE - CurrentInput0);
+    SLData_t ErrorMinus1 = (SIGLIB_MINUS_ONE - CurrentInput1) * (SIGLIB_MINUS_ONE - CurrentInput1);
+    SLData_t ErrorPlus1 = (SIGLIB_ONE - CurrentInput1) * (SIGLIB_ONE - CurrentInput1);
+    SymbolError[0] = ErrorMinus0 + ErrorMinus1;
+    SymbolError[1] = ErrorMinus0 + ErrorPlus1;
+    SymbolError[2] = ErrorPlus0 + ErrorMinus1;
+    SymbolError[3] = ErrorPlus0 + ErrorPlus1;
+
     for (SLArrayIndex_t i = 0; i < SIGLIB_VITK3_NUMBER_OF_STATES; i++) {    // Fill temporary error accumulation table with SIGLIB_MAX
       LocalAccumulatedErrorTable[i] = SIGLIB_MAX;
     }
@@ -221,8 +236,7 @@ SLChar_t SIGLIB_FUNC_DECL SDS_ViterbiDecoderK3(SLData_t* pSrc, SLFixData_t* pOut
         // Calculate the error (Euclidean distance) per channel symbol,
         //   Sum for all channel symbols in convolutional encoder output.
         //   Add error from both received bits
-        ErrorSquared = ((siglib_numerix_K3RxIdealSymbol[i][j][0] - CurrentInput0) * (siglib_numerix_K3RxIdealSymbol[i][j][0] - CurrentInput0)) +
-                       ((siglib_numerix_K3RxIdealSymbol[i][j][1] - CurrentInput1) * (siglib_numerix_K3RxIdealSymbol[i][j][1] - CurrentInput1));
+        ErrorSquared = SymbolError[siglib_numerix_K3RxSymbolCode[i][j]];
 
         // Accumulate errors along the paths from original state to new one and
         // choose the surviving path - with the smallest accumlated error
@@ -647,3 +661,540 @@ SLChar_t SIGLIB_FUNC_DECL SDS_ViterbiDecoderV32(SLComplexRect_s Src, SLData_t* p
   }    // End of do trace back section
   return (DecodedNibble);
 }    // End of SDS_ViterbiDecoderV32()
+
+// Generic Viterbi decoder
+#define SIGLIB_VITERBI_SOFT_SCALE ((SLData_t)32.0)    // Quantized value of an ideal +1.0 soft decision sample
+#define SIGLIB_VITERBI_SOFT_MAX 127                   // Largest quantized soft decision sample
+
+#if (SIGLIB_VECTOR_EXTENSIONS == 1) && (defined(__clang__) || (__GNUC__ >= 12)) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#  define SIGLIB_VITERBI_VECTORS 1
+#  define SIGLIB_VITERBI_VECTOR_LENGTH 16    // Number of butterflies calculated together
+typedef SLInt16_t siglib_numerix_ViterbiMask_t __attribute__((vector_size(2 * SIGLIB_VITERBI_VECTOR_LENGTH)));
+typedef SLUInt16_t siglib_numerix_ViterbiMetric_t __attribute__((vector_size(2 * SIGLIB_VITERBI_VECTOR_LENGTH)));
+typedef SLInt8_t siglib_numerix_ViterbiBytes_t __attribute__((vector_size(SIGLIB_VITERBI_VECTOR_LENGTH)));
+#else
+#  define SIGLIB_VITERBI_VECTORS 0
+#endif
+
+/********************************************************
+ * Function: siglib_numerix_Parity
+ *
+ * Parameters:
+ *  SLUInt32_t              - Word
+ *
+ * Return value:
+ *  Parity of the word - 1 if an odd number of bits are set
+ *
+ * Description:
+ *  Calculate the parity of a word.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_Parity(SLUInt32_t Word)
+{
+  Word ^= Word >> 16U;
+  Word ^= Word >> 8U;
+  Word ^= Word >> 4U;
+  Word ^= Word >> 2U;
+  Word ^= Word >> 1U;
+  return (Word & 1U);
+}    // End of siglib_numerix_Parity()
+
+/********************************************************
+ * Function: siglib_numerix_ReversePolynomial
+ *
+ * Parameters:
+ *  const SLUInt32_t        - Polynomial
+ *  const SLArrayIndex_t    - Constraint length
+ *
+ * Return value:
+ *  Polynomial with the bit order reversed
+ *
+ * Description:
+ *  The polynomials are specified in the usual octal
+ *  notation, with the MSB tapping the current input bit.
+ *  The encoder and decoder shift registers hold the
+ *  current input bit in the LSB so the polynomial bit
+ *  order is reversed.
+ *
+ ********************************************************/
+
+static SLUInt32_t siglib_numerix_ReversePolynomial(const SLUInt32_t Polynomial, const SLArrayIndex_t ConstraintLength)
+{
+  SLUInt32_t Reversed = 0U;
+  for (SLArrayIndex_t i = 0; i < ConstraintLength; i++) {
+    Reversed |= ((Polynomial >> (SLUInt32_t)i) & 1U) << (SLUInt32_t)(ConstraintLength - 1 - i);
+  }
+  return (Reversed);
+}    // End of siglib_numerix_ReversePolynomial()
+
+/********************************************************
+ * Function: SDA_ConvEncoder
+ *
+ * Parameters:
+ *  const SLChar_t *        - Pointer to source bytes
+ *  SLData_t *              - Pointer to destination soft decision symbols
+ *  const SLUInt32_t *      - Pointer to polynomials
+ *  const SLArrayIndex_t    - Number of polynomials
+ *  const SLArrayIndex_t    - Constraint length
+ *  SLUInt32_t *            - Pointer to encoder state
+ *  const SLArrayIndex_t    - Number of source bytes
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Rate 1/n convolutional encode an array of bytes, with
+ *  one output symbol per polynomial for each input bit.
+ *  The bits are encoded LSB first and the symbols are
+ *  +1.0 for a 1 and -1.0 for a 0.
+ *
+ * Notes:
+ *  The polynomials are specified in the usual octal
+ *  notation, for example 07 and 05 for K = 3 or 0171 and
+ *  0133 for K = 7.
+ *  The encoder state should be initialised to 0.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SDA_ConvEncoder(const SLChar_t* SIGLIB_INPUT_PTR_DECL pSrc, SLData_t* SIGLIB_OUTPUT_PTR_DECL pDst,
+                                      const SLUInt32_t* pPolynomials, const SLArrayIndex_t numberOfPolynomials,
+                                      const SLArrayIndex_t constraintLength, SLUInt32_t* pState, const SLArrayIndex_t numberOfBytes)
+{
+  SLUInt32_t Reversed[SIGLIB_VITERBI_MAX_OUTPUTS];
+  for (SLArrayIndex_t k = 0; k < numberOfPolynomials; k++) {
+    Reversed[k] = siglib_numerix_ReversePolynomial(pPolynomials[k], constraintLength);
+  }
+
+  const SLUInt32_t StateMask = (1U << (SLUInt32_t)(constraintLength - 1)) - 1U;
+  SLUInt32_t State = *pState;
+
+  for (SLArrayIndex_t i = 0; i < numberOfBytes; i++) {
+    for (SLUInt32_t Bit = 0U; Bit < (SLUInt32_t)SIGLIB_BYTE_LENGTH; Bit++) {
+      SLUInt32_t Register = (State << 1U) | (((SLUInt32_t)pSrc[i] >> Bit) & 1U);
+      for (SLArrayIndex_t k = 0; k < numberOfPolynomials; k++) {
+        *pDst++ = siglib_numerix_Parity(Register & Reversed[k]) ? SIGLIB_ONE : SIGLIB_MINUS_ONE;
+      }
+      State = Register & StateMask;
+    }
+  }
+  *pState = State;
+}    // End of SDA_ConvEncoder()
+
+/********************************************************
+ * Function: SIF_ViterbiDecoder
+ *
+ * Parameters:
+ *  SLViterbiDecoder_s *    - Pointer to decoder
+ *  const SLUInt32_t *      - Pointer to polynomials
+ *  const SLArrayIndex_t    - Number of polynomials
+ *  const SLArrayIndex_t    - Constraint length
+ *  const SLArrayIndex_t    - Trace back depth
+ *
+ * Return value:
+ *  Error code
+ *
+ * Description:
+ *  Initialise the generic rate 1/n soft decision Viterbi
+ *  decoder for the codes generated by SDA_ConvEncoder.
+ *
+ * Notes:
+ *  The constraint length can be 3 to
+ *  SIGLIB_VITERBI_MAX_CONSTRAINT_LENGTH and the number of
+ *  polynomials 2 to SIGLIB_VITERBI_MAX_OUTPUTS.
+ *  The trace back depth is typically 5 to 7 times the
+ *  constraint length.
+ *  The arrays are allocated by this function and must be
+ *  released with SUF_ViterbiDecoderFree.
+ *
+ ********************************************************/
+
+SLError_t SIGLIB_FUNC_DECL SIF_ViterbiDecoder(SLViterbiDecoder_s* pDecoder, const SLUInt32_t* pPolynomials,
+                                              const SLArrayIndex_t numberOfPolynomials, const SLArrayIndex_t constraintLength,
+                                              const SLArrayIndex_t traceBackDepth)
+{
+  pDecoder->pBranchSigns = NULL;
+  pDecoder->pPathMetrics = NULL;
+  pDecoder->pNextPathMetrics = NULL;
+  pDecoder->pDecisions = NULL;
+
+  if ((constraintLength < 3) || (constraintLength > SIGLIB_VITERBI_MAX_CONSTRAINT_LENGTH) || (numberOfPolynomials < 2) ||
+      (numberOfPolynomials > SIGLIB_VITERBI_MAX_OUTPUTS) || (traceBackDepth < 0)) {
+    return (SIGLIB_PARAMETER_ERROR);
+  }
+
+  const SLArrayIndex_t NumberOfStates = (SLArrayIndex_t)1 << (constraintLength - 1);
+  const SLArrayIndex_t NumberOfButterflies = NumberOfStates >> 1;
+  pDecoder->ConstraintLength = constraintLength;
+  pDecoder->NumberOfStates = NumberOfStates;
+  pDecoder->NumberOfOutputs = numberOfPolynomials;
+  pDecoder->TraceBackDepth = traceBackDepth;
+  pDecoder->DecisionWords = (NumberOfStates > 64) ? (NumberOfStates / 64) : 1;
+  pDecoder->HistoryLength = traceBackDepth + SIGLIB_VITERBI_BLOCK_LENGTH;
+
+  pDecoder->pBranchSigns = (SLInt16_t*)SUF_MemoryAllocate((size_t)(4 * numberOfPolynomials * NumberOfButterflies) * sizeof(SLInt16_t));
+  pDecoder->pPathMetrics = (SLInt16_t*)SUF_MemoryAllocate((size_t)NumberOfStates * sizeof(SLInt16_t));
+  pDecoder->pNextPathMetrics = (SLInt16_t*)SUF_MemoryAllocate((size_t)NumberOfStates * sizeof(SLInt16_t));
+  pDecoder->pDecisions = (SLUInt64_t*)SUF_MemoryAllocate((size_t)(pDecoder->HistoryLength * pDecoder->DecisionWords) * sizeof(SLUInt64_t));
+  if ((NULL == pDecoder->pBranchSigns) || (NULL == pDecoder->pPathMetrics) || (NULL == pDecoder->pNextPathMetrics) ||
+      (NULL == pDecoder->pDecisions)) {
+    SUF_ViterbiDecoderFree(pDecoder);
+    return (SIGLIB_MEM_ALLOC_ERROR);
+  }
+
+  // Butterfly j takes states j and j + N/2 to states 2j and 2j + 1
+  // Transitions : 0 - j to 2j, 1 - j + N/2 to 2j, 2 - j to 2j + 1, 3 - j + N/2 to 2j + 1
+  pDecoder->Symmetric = SIGLIB_TRUE;
+  for (SLArrayIndex_t k = 0; k < numberOfPolynomials; k++) {
+    SLUInt32_t Reversed = siglib_numerix_ReversePolynomial(pPolynomials[k], constraintLength);
+    if ((Reversed & (1U | (1U << (SLUInt32_t)(constraintLength - 1)))) != (1U | (1U << (SLUInt32_t)(constraintLength - 1)))) {
+      pDecoder->Symmetric = SIGLIB_FALSE;
+    }
+    for (SLArrayIndex_t t = 0; t < 4; t++) {
+      for (SLArrayIndex_t j = 0; j < NumberOfButterflies; j++) {
+        SLUInt32_t State = (SLUInt32_t)(j + ((t & 1) * NumberOfButterflies));
+        SLUInt32_t Register = (State << 1U) | (SLUInt32_t)(t >> 1);
+        // A 1 is received as +1.0 so it is the most likely when the metric is -input
+        pDecoder->pBranchSigns[(((t * numberOfPolynomials) + k) * NumberOfButterflies) + j] =
+            siglib_numerix_Parity(Register & Reversed) ? (SLInt16_t)-1 : (SLInt16_t)1;
+      }
+    }
+  }
+
+  SIF_ViterbiDecoderReset(pDecoder);
+  return (SIGLIB_NO_ERROR);
+}    // End of SIF_ViterbiDecoder()
+
+/********************************************************
+ * Function: SIF_ViterbiDecoderReset
+ *
+ * Parameters:
+ *  SLViterbiDecoder_s *    - Pointer to decoder
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Reset the decoder to the start of a new message, with
+ *  the encoder in state 0.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SIF_ViterbiDecoderReset(SLViterbiDecoder_s* pDecoder)
+{
+  // Favour state 0, the offset is well within the range of the modulo arithmetic metric comparisons
+  const SLInt16_t InitialOffset = (SLInt16_t)(SIGLIB_VITERBI_SOFT_MAX * pDecoder->NumberOfOutputs * 2);
+  pDecoder->pPathMetrics[0] = 0;
+  for (SLArrayIndex_t i = 1; i < pDecoder->NumberOfStates; i++) {
+    pDecoder->pPathMetrics[i] = InitialOffset;
+  }
+  pDecoder->HistoryIndex = 0;
+  pDecoder->PendingSteps = 0;
+}    // End of SIF_ViterbiDecoderReset()
+
+/********************************************************
+ * Function: siglib_numerix_ViterbiAddCompareSelect
+ *
+ * Parameters:
+ *  const SLViterbiDecoder_s *  - Pointer to decoder
+ *  const SLInt16_t *       - Pointer to current path metrics
+ *  SLInt16_t *             - Pointer to next path metrics
+ *  SLUInt64_t *            - Pointer to decision words
+ *  const SLInt16_t *       - Pointer to quantized input symbols
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Add-compare-select for one step of the trellis.
+ *
+ * Notes:
+ *  The path metrics are 16 bit and are compared with
+ *  modulo arithmetic, the spread of the metrics is always
+ *  much smaller than 2^15 so they never need normalising.
+ *  The decision for state 2j + b of butterfly j is stored
+ *  at bit (((j / 16) * 2) + b) * 16 + (j % 16), so that a
+ *  block of 16 butterflies writes 32 contiguous bits.
+ *  For symmetric codes the branch metrics of the four
+ *  transitions of a butterfly are +/- the same value, so
+ *  only the first one is computed.
+ *
+ ********************************************************/
+
+static SIGLIB_FUNC_MULTIVERSION void siglib_numerix_ViterbiAddCompareSelect(const SLViterbiDecoder_s* pDecoder, const SLInt16_t* pMetrics,
+                                                                            SLInt16_t* pNextMetrics, SLUInt64_t* pDecisions,
+                                                                            const SLInt16_t* pSymbols)
+{
+  const SLInt16_t* pSigns = pDecoder->pBranchSigns;
+  const SLArrayIndex_t NumberOfOutputs = pDecoder->NumberOfOutputs;
+  const SLArrayIndex_t NumberOfButterflies = pDecoder->NumberOfStates >> 1;
+  const SLArrayIndex_t TransitionStride = NumberOfOutputs * NumberOfButterflies;
+  SLArrayIndex_t j = 0;
+
+#if (SIGLIB_VITERBI_VECTORS == 1)
+  const SLFixData_t Symmetric = pDecoder->Symmetric;
+  for (; j <= (NumberOfButterflies - SIGLIB_VITERBI_VECTOR_LENGTH); j += SIGLIB_VITERBI_VECTOR_LENGTH) {
+    siglib_numerix_ViterbiMetric_t Old0, Old1, Sign;
+    memcpy(&Old0, pMetrics + j, sizeof(Old0));
+    memcpy(&Old1, pMetrics + j + NumberOfButterflies, sizeof(Old1));
+
+    siglib_numerix_ViterbiMetric_t Branch0 = {0}, Branch1 = {0}, Branch2 = {0}, Branch3 = {0};
+    for (SLArrayIndex_t k = 0; k < NumberOfOutputs; k++) {
+      memcpy(&Sign, pSigns + (k * NumberOfButterflies) + j, sizeof(Sign));
+      Branch0 += Sign * (SLUInt16_t)pSymbols[k];
+    }
+    if (Symmetric == SIGLIB_TRUE) {    // Flipping either end bit of the register inverts every output
+      Branch1 = -Branch0;
+      Branch2 = Branch1;
+      Branch3 = Branch0;
+    } else {
+      for (SLArrayIndex_t k = 0; k < NumberOfOutputs; k++) {
+        const SLInt16_t* pSign = pSigns + (k * NumberOfButterflies) + j;
+        memcpy(&Sign, pSign + TransitionStride, sizeof(Sign));
+        Branch1 += Sign * (SLUInt16_t)pSymbols[k];
+        memcpy(&Sign, pSign + (2 * TransitionStride), sizeof(Sign));
+        Branch2 += Sign * (SLUInt16_t)pSymbols[k];
+        memcpy(&Sign, pSign + (3 * TransitionStride), sizeof(Sign));
+        Branch3 += Sign * (SLUInt16_t)pSymbols[k];
+      }
+    }
+
+    siglib_numerix_ViterbiMetric_t A0 = Old0 + Branch0;
+    siglib_numerix_ViterbiMetric_t A1 = Old1 + Branch1;
+    siglib_numerix_ViterbiMask_t D0 = (siglib_numerix_ViterbiMask_t)(A1 - A0) < 0;
+    siglib_numerix_ViterbiMetric_t New0 = (A1 & (siglib_numerix_ViterbiMetric_t)D0) | (A0 & ~(siglib_numerix_ViterbiMetric_t)D0);
+    siglib_numerix_ViterbiMetric_t B0 = Old0 + Branch2;
+    siglib_numerix_ViterbiMetric_t B1 = Old1 + Branch3;
+    siglib_numerix_ViterbiMask_t D1 = (siglib_numerix_ViterbiMask_t)(B1 - B0) < 0;
+    siglib_numerix_ViterbiMetric_t New1 = (B1 & (siglib_numerix_ViterbiMetric_t)D1) | (B0 & ~(siglib_numerix_ViterbiMetric_t)D1);
+
+    // Interleave the even and odd states
+    siglib_numerix_ViterbiMetric_t Lo = __builtin_shufflevector(New0, New1, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    siglib_numerix_ViterbiMetric_t Hi = __builtin_shufflevector(New0, New1, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    memcpy(pNextMetrics + (2 * j), &Lo, sizeof(Lo));
+    memcpy(pNextMetrics + (2 * j) + SIGLIB_VITERBI_VECTOR_LENGTH, &Hi, sizeof(Hi));
+
+    // Pack the decision masks into bits, each byte of the narrowed mask is 0 or 1 after the AND
+    SLUInt64_t Bytes[4];
+    siglib_numerix_ViterbiBytes_t Narrow0 = __builtin_convertvector(D0, siglib_numerix_ViterbiBytes_t);
+    siglib_numerix_ViterbiBytes_t Narrow1 = __builtin_convertvector(D1, siglib_numerix_ViterbiBytes_t);
+    memcpy(Bytes, &Narrow0, sizeof(Narrow0));
+    memcpy(Bytes + 2, &Narrow1, sizeof(Narrow1));
+    SLUInt32_t Bits = 0U;
+    for (SLArrayIndex_t i = 0; i < 4; i++) {
+      Bits |= (SLUInt32_t)((((Bytes[i] & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56U) << (8U * (SLUInt32_t)i));
+    }
+    // Each block of 16 butterflies fills one 32 bit half word, the vectors are only enabled on little endian targets
+    memcpy((SLUInt32_t*)pDecisions + (j >> 4), &Bits, sizeof(Bits));
+  }
+#endif
+
+  if (j < NumberOfButterflies) {    // The vector loop processes all of the states or none of them
+    for (SLArrayIndex_t w = 0; w < pDecoder->DecisionWords; w++) {
+      pDecisions[w] = 0U;
+    }
+  }
+
+  for (; j < NumberOfButterflies; j++) {
+    SLInt16_t Branch0 = 0, Branch1 = 0, Branch2 = 0, Branch3 = 0;
+    for (SLArrayIndex_t k = 0; k < NumberOfOutputs; k++) {
+      const SLInt16_t* pSign = pSigns + (k * NumberOfButterflies) + j;
+      Branch0 = (SLInt16_t)(Branch0 + (pSign[0] * pSymbols[k]));
+      Branch1 = (SLInt16_t)(Branch1 + (pSign[TransitionStride] * pSymbols[k]));
+      Branch2 = (SLInt16_t)(Branch2 + (pSign[2 * TransitionStride] * pSymbols[k]));
+      Branch3 = (SLInt16_t)(Branch3 + (pSign[3 * TransitionStride] * pSymbols[k]));
+    }
+
+    SLInt16_t A0 = (SLInt16_t)(pMetrics[j] + Branch0);
+    SLInt16_t A1 = (SLInt16_t)(pMetrics[j + NumberOfButterflies] + Branch1);
+    SLInt16_t B0 = (SLInt16_t)(pMetrics[j] + Branch2);
+    SLInt16_t B1 = (SLInt16_t)(pMetrics[j + NumberOfButterflies] + Branch3);
+    SLUInt64_t D0 = ((SLInt16_t)(A1 - A0) < 0) ? 1U : 0U;
+    SLUInt64_t D1 = ((SLInt16_t)(B1 - B0) < 0) ? 1U : 0U;
+    pNextMetrics[2 * j] = D0 ? A1 : A0;
+    pNextMetrics[(2 * j) + 1] = D1 ? B1 : B0;
+
+    SLArrayIndex_t BitIndex = ((j >> 4) * 32) + (j & 15);
+    pDecisions[BitIndex >> 6] |= (D0 | (D1 << 16U)) << (SLUInt64_t)(BitIndex & 63);
+  }
+}    // End of siglib_numerix_ViterbiAddCompareSelect()
+
+/********************************************************
+ * Function: siglib_numerix_ViterbiTraceBack
+ *
+ * Parameters:
+ *  SLViterbiDecoder_s *    - Pointer to decoder
+ *  SLChar_t *              - Pointer to destination bytes
+ *  const SLArrayIndex_t    - Number of steps to output
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Trace back from the state with the smallest path metric
+ *  through the trace back depth, then decode the oldest
+ *  steps in the history to the destination.
+ *
+ ********************************************************/
+
+static void siglib_numerix_ViterbiTraceBack(SLViterbiDecoder_s* pDecoder, SLChar_t* pDst, const SLArrayIndex_t numberOfOutputSteps)
+{
+  const SLInt16_t* pMetrics = pDecoder->pPathMetrics;
+  SLArrayIndex_t State = 0;
+  for (SLArrayIndex_t i = 1; i < pDecoder->NumberOfStates; i++) {
+    if ((SLInt16_t)(pMetrics[i] - pMetrics[State]) < 0) {
+      State = i;
+    }
+  }
+
+  for (SLArrayIndex_t i = 0; i < (numberOfOutputSteps / SIGLIB_BYTE_LENGTH); i++) {
+    pDst[i] = 0;
+  }
+
+  const SLArrayIndex_t TotalSteps = pDecoder->PendingSteps;
+  SLArrayIndex_t Index = pDecoder->HistoryIndex;
+  for (SLArrayIndex_t i = 0; i < TotalSteps; i++) {
+    if (--Index < 0) {
+      Index += pDecoder->HistoryLength;
+    }
+    SLArrayIndex_t Step = TotalSteps - 1 - i;    // Step number, relative to the oldest pending step
+    if (Step < numberOfOutputSteps) {            // The LSB of the state is the input bit
+      pDst[Step >> 3] = (SLChar_t)((SLUFixData_t)pDst[Step >> 3] | (((SLUFixData_t)State & 1U) << (SLUFixData_t)(Step & 7)));
+    }
+    SLArrayIndex_t Butterfly = State >> 1;
+    SLArrayIndex_t BitIndex = (((Butterfly >> 4) * 2) + (State & 1)) * 16 + (Butterfly & 15);
+    SLUInt64_t Decision = (pDecoder->pDecisions[(Index * pDecoder->DecisionWords) + (BitIndex >> 6)] >> (SLUInt64_t)(BitIndex & 63)) & 1U;
+    State = (State >> 1) | (SLArrayIndex_t)(Decision << (SLUInt64_t)(pDecoder->ConstraintLength - 2));
+  }
+}    // End of siglib_numerix_ViterbiTraceBack()
+
+/********************************************************
+ * Function: SDA_ViterbiDecoder
+ *
+ * Parameters:
+ *  const SLData_t *        - Pointer to source soft decision symbols
+ *  SLChar_t *              - Pointer to destination bytes
+ *  SLViterbiDecoder_s *    - Pointer to decoder
+ *  const SLArrayIndex_t    - Number of source bytes
+ *
+ * Return value:
+ *  Number of bytes decoded
+ *
+ * Description:
+ *  Viterbi decode the soft decision symbols of a number
+ *  of bytes, NumberOfOutputs symbols per bit, as generated
+ *  by SDA_ConvEncoder.
+ *
+ * Notes:
+ *  The decoder traces back once every
+ *  SIGLIB_VITERBI_BLOCK_LENGTH bits, decoding a block of
+ *  bits each time, so the number of bytes decoded by each
+ *  call varies. The destination array must have space for
+ *  the number of source bytes plus
+ *  SIGLIB_VITERBI_BLOCK_LENGTH / 8 bytes.
+ *  The decoded bytes are delayed by the trace back depth,
+ *  SDA_ViterbiDecoderFlush decodes the remaining bits at
+ *  the end of a message.
+ *  The symbols are quantized to 8 bits, with an ideal
+ *  +1.0 symbol quantized to 32, so the symbols should be
+ *  scaled to approximately +/-1.0.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_ViterbiDecoder(const SLData_t* SIGLIB_INPUT_PTR_DECL pSrc, SLChar_t* SIGLIB_OUTPUT_PTR_DECL pDst,
+                                                   SLViterbiDecoder_s* pDecoder, const SLArrayIndex_t numberOfBytes)
+{
+  const SLArrayIndex_t NumberOfOutputs = pDecoder->NumberOfOutputs;
+  const SLArrayIndex_t NumberOfSteps = numberOfBytes * SIGLIB_BYTE_LENGTH;
+  SLArrayIndex_t OutputBytes = 0;
+  SLInt16_t Symbols[SIGLIB_VITERBI_BLOCK_LENGTH * SIGLIB_VITERBI_MAX_OUTPUTS];
+
+  for (SLArrayIndex_t Step = 0; Step < NumberOfSteps; Step += SIGLIB_VITERBI_BLOCK_LENGTH) {
+    const SLArrayIndex_t BlockSteps =
+        ((NumberOfSteps - Step) < SIGLIB_VITERBI_BLOCK_LENGTH) ? (NumberOfSteps - Step) : SIGLIB_VITERBI_BLOCK_LENGTH;
+
+    for (SLArrayIndex_t i = 0; i < (BlockSteps * NumberOfOutputs); i++) {    // Quantize the soft decision symbols
+      SLData_t Symbol = *pSrc++ * SIGLIB_VITERBI_SOFT_SCALE;
+      Symbol = (Symbol > (SLData_t)SIGLIB_VITERBI_SOFT_MAX) ? (SLData_t)SIGLIB_VITERBI_SOFT_MAX : Symbol;
+      Symbol = (Symbol < (SLData_t)-SIGLIB_VITERBI_SOFT_MAX) ? (SLData_t)-SIGLIB_VITERBI_SOFT_MAX : Symbol;
+      Symbols[i] = (SLInt16_t)(SLInt32_t)(Symbol + (SLData_t)copysign((double)SIGLIB_HALF, (double)Symbol));
+    }
+
+    for (SLArrayIndex_t i = 0; i < BlockSteps; i++) {
+      siglib_numerix_ViterbiAddCompareSelect(pDecoder, pDecoder->pPathMetrics, pDecoder->pNextPathMetrics,
+                                             pDecoder->pDecisions + (pDecoder->HistoryIndex * pDecoder->DecisionWords),
+                                             Symbols + (i * NumberOfOutputs));
+      SLInt16_t* pTemp = pDecoder->pPathMetrics;
+      pDecoder->pPathMetrics = pDecoder->pNextPathMetrics;
+      pDecoder->pNextPathMetrics = pTemp;
+
+      if (++pDecoder->HistoryIndex == pDecoder->HistoryLength) {
+        pDecoder->HistoryIndex = 0;
+      }
+      if (++pDecoder->PendingSteps == pDecoder->HistoryLength) {    // Decode a block
+        siglib_numerix_ViterbiTraceBack(pDecoder, pDst + OutputBytes, SIGLIB_VITERBI_BLOCK_LENGTH);
+        pDecoder->PendingSteps -= SIGLIB_VITERBI_BLOCK_LENGTH;
+        OutputBytes += SIGLIB_VITERBI_BLOCK_LENGTH / SIGLIB_BYTE_LENGTH;
+      }
+    }
+  }
+  return (OutputBytes);
+}    // End of SDA_ViterbiDecoder()
+
+/********************************************************
+ * Function: SDA_ViterbiDecoderFlush
+ *
+ * Parameters:
+ *  SLChar_t *              - Pointer to destination bytes
+ *  SLViterbiDecoder_s *    - Pointer to decoder
+ *
+ * Return value:
+ *  Number of bytes decoded
+ *
+ * Description:
+ *  Decode the remaining bits at the end of a message and
+ *  reset the decoder for the next message.
+ *
+ * Notes:
+ *  The trace back starts from the state with the smallest
+ *  path metric so the encoder does not need to be flushed
+ *  to a known state, although the last bits are more
+ *  reliable if it is.
+ *  The destination array must have space for the trace
+ *  back depth plus SIGLIB_VITERBI_BLOCK_LENGTH bits.
+ *
+ ********************************************************/
+
+SLArrayIndex_t SIGLIB_FUNC_DECL SDA_ViterbiDecoderFlush(SLChar_t* SIGLIB_OUTPUT_PTR_DECL pDst, SLViterbiDecoder_s* pDecoder)
+{
+  SLArrayIndex_t OutputBytes = pDecoder->PendingSteps / SIGLIB_BYTE_LENGTH;
+  siglib_numerix_ViterbiTraceBack(pDecoder, pDst, pDecoder->PendingSteps);
+  SIF_ViterbiDecoderReset(pDecoder);
+  return (OutputBytes);
+}    // End of SDA_ViterbiDecoderFlush()
+
+/********************************************************
+ * Function: SUF_ViterbiDecoderFree
+ *
+ * Parameters:
+ *  SLViterbiDecoder_s *    - Pointer to decoder
+ *
+ * Return value:
+ *  void
+ *
+ * Description:
+ *  Free the arrays allocated by SIF_ViterbiDecoder.
+ *
+ ********************************************************/
+
+void SIGLIB_FUNC_DECL SUF_ViterbiDecoderFree(SLViterbiDecoder_s* pDecoder)
+{
+  SUF_MemoryFree(pDecoder->pBranchSigns);
+  SUF_MemoryFree(pDecoder->pPathMetrics);
+  SUF_MemoryFree(pDecoder->pNextPathMetrics);
+  SUF_MemoryFree(pDecoder->pDecisions);
+  pDecoder->pBranchSigns = NULL;
+  pDecoder->pPathMetrics = NULL;
+  pDecoder->pNextPathMetrics = NULL;
+  pDecoder->pDecisions = NULL;
+}    // End of SUF_ViterbiDecoderFree()
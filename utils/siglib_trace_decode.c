@@ -0,0 +1,49 @@
+/*
+Program to convert the binary trace file written by SUF_Debugfprintf,
+when SIGLIB_DEBUG_TRACE = 1, to text.
+Usage: siglib_trace_decode [-t] [trace file] [text file]
+The default file names are siglib_debug.trace and siglib_debug.log.
+The -t option prefixes each line with the thread index, the
+time, in seconds, from the start of the trace session and the
+name of the function that logged the line.
+The trace file must be decoded on a machine with the same byte order
+as the machine that wrote it.
+*/
+
+#include <siglib.h>
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char** argv)
+{
+  SLFixData_t timestampFlag = SIGLIB_FALSE;
+  const char* pTraceFileName = SIGLIB_TRACE_FILE;
+  const char* pTextFileName = SIGLIB_LOG_FILE;
+  int argIndex = 1;
+
+  if ((argc > argIndex) && (strcmp(argv[argIndex], "-t") == 0)) {
+    timestampFlag = SIGLIB_TRUE;
+    argIndex++;
+  }
+  if (argc > argIndex) {
+    pTraceFileName = argv[argIndex++];
+  }
+  if (argc > argIndex) {
+    pTextFileName = argv[argIndex++];
+  }
+  if (argc > argIndex) {
+    printf("Usage: siglib_trace_decode [-t] [trace file] [text file]\n");
+    return (1);
+  }
+
+  SLError_t errorCode = SUF_DebugTraceDecode(pTraceFileName, pTextFileName, timestampFlag);
+  if (SIGLIB_FILE_ERROR == errorCode) {
+    printf("Error reading %s or writing %s\n", pTraceFileName, pTextFileName);
+    return (1);
+  } else if (SIGLIB_NO_ERROR != errorCode) {
+    printf("Memory allocation failed\n");
+    return (1);
+  }
+
+  return (0);
+}